@@ -220,6 +220,8 @@ void Cz80_Reset(cz80_struc *CPU)
 static inline unsigned char picodrive_read(unsigned short a)
 {
 	uptr v = z80_read_map[a >> Z80_MEM_SHIFT];
+	mem_stats_log(MST_Z80, a >> Z80_MEM_SHIFT,
+		map_flag_set(v) ? (void *)(v << 1) : NULL, 0);
 	if (map_flag_set(v))
 		return ((z80_read_f *)(v << 1))(a);
 	return *(unsigned char *)((v << 1) + a);
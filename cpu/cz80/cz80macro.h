@@ -74,6 +74,8 @@
 	unsigned short a = A; \
 	unsigned char d = D; \
 	uptr v = z80_write_map[a >> Z80_MEM_SHIFT]; \
+	mem_stats_log(MST_Z80, a >> Z80_MEM_SHIFT, \
+		map_flag_set(v) ? (void *)(v << 1) : NULL, 1); \
 	if (map_flag_set(v)) \
 		((z80_write_f *)(v << 1))(a, d); \
 	else \
@@ -6,24 +6,85 @@
  * See COPYING file in the top-level directory.
  */
 #include <stdio.h>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include <pico/pico_int.h>
 #include "cmn.h"
 
 u8 ALIGNED(4096) tcache_default[DRC_TCACHE_SIZE];
 u8 *tcache;
+intptr_t tcache_rw_delta;
 
-void drc_cmn_init(void)
+#if defined(__linux__) && defined(SYS_memfd_create)
+// map a memfd twice, executable for running the code and writable for
+// emitting it, for kernels which refuse RWX mappings. The kernel places shared
+// mappings so that they don't alias in virtually indexed caches, so reading
+// code and cache maintenance can still use the executable view.
+static u8 *tcache_dual_map(size_t size)
 {
+  static u8 *rx;
+  u8 *rw;
+  int fd;
+
+  if (rx != NULL)
+    return rx; // kept for the lifetime of the process, like tcache_default
+
+  fd = syscall(SYS_memfd_create, "tcache", 0);
+  if (fd < 0)
+    return NULL;
+  rw = MAP_FAILED;
+  if (ftruncate(fd, size) == 0)
+    rw = mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if (rw != MAP_FAILED) {
+    rx = mmap(NULL, size, PROT_READ|PROT_EXEC, MAP_SHARED, fd, 0);
+    if (rx == MAP_FAILED) {
+      munmap(rw, size);
+      rx = NULL;
+    }
+  }
+  close(fd);
+  if (rx == NULL)
+    return NULL;
+
+  tcache_rw_delta = (intptr_t)rw - (intptr_t)rx;
+  return rx;
+}
+#else
+#define tcache_dual_map(size) NULL
+#endif
+
+// returns -1 if the tcache can't be made executable (i.e. on kernels which
+// refuse RWX mappings and no dual mapping is possible), the caller must not
+// run any generated code then
+int drc_cmn_init(void)
+{
+  u8 *dual;
   int ret;
 
-  tcache = plat_mem_get_for_drc(DRC_TCACHE_SIZE);
-  if (tcache == NULL)
-    tcache = tcache_default;
+  ret = -1;
+  if (tcache_rw_delta == 0) { // else RWX has already been refused
+    tcache = plat_mem_get_for_drc(DRC_TCACHE_SIZE);
+    if (tcache == NULL)
+      tcache = tcache_default;
 
-  ret = plat_mem_set_exec(tcache, DRC_TCACHE_SIZE);
-  elprintf(EL_STATUS, "drc_cmn_init: %p, %zd bytes: %d",
-    tcache, DRC_TCACHE_SIZE, ret);
+    ret = plat_mem_set_exec(tcache, DRC_TCACHE_SIZE);
+    elprintf(EL_STATUS, "drc_cmn_init: %p, %zd bytes: %d",
+      tcache, (size_t)DRC_TCACHE_SIZE, ret);
+  }
+  if (ret != 0) {
+    dual = tcache_dual_map(DRC_TCACHE_SIZE);
+    if (dual == NULL) {
+      elprintf(EL_STATUS, "drc_cmn_init: tcache not executable, no dynarec");
+      return -1;
+    }
+    tcache = dual;
+    elprintf(EL_STATUS, "drc_cmn_init: RWX refused, dual mapped at %p/%p",
+      tcache, TCACHE_RW(tcache));
+  }
 
 #ifdef __arm__
   if (PicoIn.opt & POPT_EN_DRC)
@@ -31,13 +92,13 @@ void drc_cmn_init(void)
     static int test_done;
     if (!test_done)
     {
-      int *test_out = (void *)tcache;
+      int *test_out = TCACHE_RW(tcache);
       int (*testfunc)(void) = (void *)tcache;
 
       elprintf(EL_STATUS, "testing if we can run recompiled code..");
       *test_out++ = 0xe3a000dd; // mov r0, 0xdd
       *test_out++ = 0xe12fff1e; // bx lr
-      cache_flush_d_inval_i(tcache, test_out);
+      cache_flush_d_inval_i(tcache, tcache + 8);
 
       // we'll usually crash on broken platforms or bad ports,
       // but do a value check too just in case
@@ -47,6 +108,7 @@ void drc_cmn_init(void)
     }
   }
 #endif
+  return 0;
 }
 
 void drc_cmn_cleanup(void)
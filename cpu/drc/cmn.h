@@ -1,9 +1,18 @@
 
+// total translation cache size, may be overridden by the build
+#ifndef DRC_TCACHE_SIZE
 #define DRC_TCACHE_SIZE         (4*1024*1024)
+#endif
 
 extern u8 *tcache;
 
-void drc_cmn_init(void);
+// if the tcache is dual mapped (W^X), tcache and all code pointers are in the
+// executable view, and code is written through the writable view at this
+// offset. 0 for a single RWX mapping.
+extern intptr_t tcache_rw_delta;
+#define TCACHE_RW(p) ((void *)((u8 *)(p) + tcache_rw_delta))
+
+int  drc_cmn_init(void);
 void drc_cmn_cleanup(void);
 
 #define BITMASK1(v0) (1 << (v0))
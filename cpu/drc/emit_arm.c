@@ -25,7 +25,7 @@
 // XXX: tcache_ptr type for SVP and SH2 compilers differs..
 #define EMIT_PTR(ptr, x) \
 	do { \
-		*(u32 *)ptr = x; \
+		*(u32 *)TCACHE_RW(ptr) = x; \
 		ptr = (void *)((u8 *)ptr + sizeof(u32)); \
 	} while (0)
 
@@ -629,9 +629,10 @@ static void emith_pool_commit(int jumpover)
 		exit(1);
 	}
 	// copy pool and adjust addresses in insns accessing the pool
-	memcpy(pool, literal_pool, sz);
+	memcpy(TCACHE_RW(pool), literal_pool, sz);
 	for (i = 0; i < literal_iindex; i++) {
-		*literal_insn[i] += (u8 *)pool - ((u8 *)literal_insn[i] + 8);
+		*(u32 *)TCACHE_RW(literal_insn[i]) +=
+			(u8 *)pool - ((u8 *)literal_insn[i] + 8);
 	}
 	// count pool constants as insns for statistics
 	for (i = 0; i < literal_pindex; i++)
@@ -1181,7 +1182,7 @@ static inline void emith_pool_adjust(int tcache_offs, int move_offs)
 #define emith_jump_patch(ptr, target, pos) do { \
 	u32 *ptr_ = (u32 *)ptr; \
 	u32 val_ = (u32 *)(target) - ptr_ - 2; \
-	*ptr_ = (*ptr_ & 0xff000000) | (val_ & 0x00ffffff); \
+	*(u32 *)TCACHE_RW(ptr_) = (*ptr_ & 0xff000000) | (val_ & 0x00ffffff); \
 	if ((void *)(pos) != NULL) *(u8 **)(pos) = (u8 *)ptr; \
 } while (0)
 #define emith_jump_patch_inrange(ptr, target) !0
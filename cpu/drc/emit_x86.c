@@ -57,7 +57,7 @@ enum { xAX = 0, xCX, xDX, xBX, xSP, xBP, xSI, xDI,	// x86-64,i386 common
 #define DCOND_CC ICOND_JAE     // carry clear
 
 #define EMIT_PTR(ptr, val, type) \
-	*(type *)(ptr) = val
+	*(type *)TCACHE_RW(ptr) = val
 
 #define EMIT(val, type) do { \
 	EMIT_PTR(tcache_ptr, val, type); \
@@ -264,9 +264,17 @@ typedef signed int	s32;
 #define ROR_32(A, C)    (LSR_32(A, C) | LSL_32(A, 32-(C)))
 #define ROR_33(A, C)    (LSR_32(A, C) | LSL_32(A, 33-(C)))
 
+#ifdef CPU_TRACE
+void cpu_trace_fm68k(M68K_CONTEXT *ctx, u32 pc, u32 op, u32 sr);
+#define TRACE_OP() cpu_trace_fm68k(ctx, GET_PC - 2, Opcode, GET_SR)
+#else
+#define TRACE_OP()
+#endif
+
 #ifndef FAMEC_NO_GOTOS
 #define NEXT                    \
     FETCH_WORD(Opcode);         \
+    TRACE_OP();                 \
     goto *JumpTable[Opcode];
 
 #ifdef FAMEC_ROLL_INLINE
@@ -290,6 +298,7 @@ typedef signed int	s32;
 #define NEXT \
     do { \
         FETCH_WORD(Opcode); \
+        TRACE_OP(); \
         JumpTable[Opcode](ctx); \
     } while (ctx->io_cycle_counter > 0);
 
@@ -154,7 +154,11 @@
 /* If ON, CPU will call the instruction hook callback before every
  * instruction.
  */
+#ifdef CPU_TRACE
+#define M68K_INSTRUCTION_HOOK       OPT_SPECIFY_HANDLER
+#else
 #define M68K_INSTRUCTION_HOOK       OPT_OFF
+#endif
 //#define M68K_INSTRUCTION_HOOK       OPT_SPECIFY_HANDLER
 #define M68K_INSTRUCTION_CALLBACK() instruction_hook()
 
@@ -350,14 +350,22 @@ struct block_list {
 
 static u8 *tcache_ptr;       // ptr for code emitters
 
-// XXX: need to tune sizes
+// region sizes start at 30/32 for ROM (rarely used) and DRAM, and 1/32 each
+// for BIOS and data array of master and slave sh2. The data array regions are
+// grown if they keep evicting blocks while the ROM/DRAM region doesn't.
+#define TCACHE_DA_SIZE_MIN  (DRC_TCACHE_SIZE / 32)
+#define TCACHE_DA_SIZE_MAX  (DRC_TCACHE_SIZE / 8)
+#define TCACHE_EVICT_LIMIT  64  // evictions per stat period to trigger resizing
 
 static struct ring_buffer tcache_ring[TCACHE_BUFFERS];
-static const int tcache_sizes[TCACHE_BUFFERS] = {
-  DRC_TCACHE_SIZE * 30 / 32, // ROM (rarely used), DRAM
-  DRC_TCACHE_SIZE / 32, // BIOS, data array in master sh2
-  DRC_TCACHE_SIZE / 32, // ... slave
-};
+static int tcache_sizes[TCACHE_BUFFERS];
+
+// eviction stats, per stat period (about a minute of emulated time)
+static unsigned int tcache_evictions[TCACHE_BUFFERS];
+static unsigned int tcache_space_evictions[TCACHE_BUFFERS];
+static unsigned int tcache_flushes[TCACHE_BUFFERS];
+static unsigned int tcache_stat_frame;
+static int tcache_noexec; // tcache couldn't be made executable
 
 #define BLOCK_MAX_COUNT(tcid)		((tcid) ? 256 : 32*256)
 static struct ring_buffer block_ring[TCACHE_BUFFERS];
@@ -849,12 +857,12 @@ static void dr_block_unlink(struct block_link *bl, int emit_jump)
         emith_jump_patch(jump, sh2_drc_dispatcher, &jump);
       } else if (bl->type == BL_LDJMP) { // restore: load pc, jump @dispatcher
         // inlined: @jump load target_pc, far jump to dispatcher
-        memcpy(jump, bl->jdisp, emith_jump_at_size());
+        memcpy(TCACHE_RW(jump), bl->jdisp, emith_jump_at_size());
         jsz = emith_jump_at_size();
       } else if (bl->type == BL_JCCBLX) { // jump cond @blx; @blx: load pc, jump
         // via blx: @jump near jumpcc to blx; @blx load target_pc, far jump
         emith_jump_patch(bl->jump, bl->blx, &jump);
-        memcpy(bl->blx, bl->jdisp, emith_jump_at_size());
+        memcpy(TCACHE_RW(bl->blx), bl->jdisp, emith_jump_at_size());
         host_instructions_updated(bl->blx, bl->blx + emith_jump_at_size()-1);
       } else {
         printf("unknown BL type %d\n", bl->type);
@@ -1197,6 +1205,7 @@ static void dr_free_oldest_block(int tcache_id)
 {
   struct block_desc *bf;
 
+  tcache_evictions[tcache_id]++;
   bf = ring_first(&block_ring[tcache_id]);
   if (bf->addr && bf->entry_count)
     dr_rm_block_entry(bf, tcache_id, 0, 1);
@@ -1216,6 +1225,9 @@ static void dr_free_oldest_block(int tcache_id)
 
 static inline void dr_reserve_cache(int tcache_id, struct ring_buffer *rb, int count)
 {
+  if (rb == &tcache_ring[tcache_id] && rb->used + count > rb->size)
+    tcache_space_evictions[tcache_id]++;
+
   // while not enough space available
   if (rb->next + count >= rb->size){
     // not enough space in rest of buffer -> wrap around
@@ -1274,6 +1286,7 @@ static void dr_flush_tcache(int tcid)
     tcache_ring[tcid].used, tcache_ring[tcid].size, block_ring[tcid].used,
     block_ring[tcid].size, entry_ring[tcid].used, entry_ring[tcid].size);
 #endif
+  tcache_flushes[tcid]++;
 
   ring_reset(&tcache_ring[tcid]);
   ring_reset(&block_ring[tcid]);
@@ -5822,6 +5835,104 @@ void sh2_drc_flush_all(void)
   Pico32x.emu_flags &= ~P32XF_DRC_ROM_C;
 }
 
+// lay out the tcache regions after the utils code at tcache start
+static void dr_tcache_layout(u8 *start)
+{
+  int i = start - tcache;
+
+  RING_INIT(&tcache_ring[0], start, tcache_sizes[0] - i);
+  for (i = 1; i < ARRAY_SIZE(tcache_ring); i++) {
+    RING_INIT(&tcache_ring[i], tcache_ring[i-1].base + tcache_ring[i-1].size,
+                tcache_sizes[i]);
+  }
+}
+
+// move space between the ROM/DRAM and the data array regions. The regions
+// can only be moved while they are empty, so this flushes everything.
+static void dr_tcache_rebalance(void)
+{
+  int sizes[TCACHE_BUFFERS];
+  int i, changed = 0;
+
+  memcpy(sizes, tcache_sizes, sizeof(sizes));
+  for (i = 1; i < TCACHE_BUFFERS; i++) {
+    if (tcache_space_evictions[i] >= TCACHE_EVICT_LIMIT &&
+        tcache_space_evictions[0] < TCACHE_EVICT_LIMIT &&
+        sizes[i] < TCACHE_DA_SIZE_MAX) {
+      sizes[0] -= sizes[i];
+      sizes[i] *= 2;
+      changed = 1;
+    } else if (tcache_space_evictions[i] == 0 &&
+        tcache_space_evictions[0] >= TCACHE_EVICT_LIMIT &&
+        sizes[i] > TCACHE_DA_SIZE_MIN) {
+      sizes[i] /= 2;
+      sizes[0] += sizes[i];
+      changed = 1;
+    }
+  }
+  if (!changed)
+    return;
+
+  elprintf(EL_STATUS, "tcache resize: %d/%d/%d -> %d/%d/%d",
+    tcache_sizes[0], tcache_sizes[1], tcache_sizes[2],
+    sizes[0], sizes[1], sizes[2]);
+  sh2_drc_flush_all();
+  memcpy(tcache_sizes, sizes, sizeof(tcache_sizes));
+  dr_tcache_layout(tcache_ring[0].base);
+}
+
+// called once per frame, collects the eviction stats and resizes regions
+void sh2_drc_frame(void)
+{
+  unsigned int period = Pico.m.pal ? 50*60 : 60*60;
+  int i;
+
+  if (Pico.m.frame_count - tcache_stat_frame < period)
+    return;
+  tcache_stat_frame = Pico.m.frame_count;
+
+  elprintf(EL_32X, "tcache evictions/min: %u/%u/%u (space %u/%u/%u), "
+    "flushes %u/%u/%u",
+    tcache_evictions[0], tcache_evictions[1], tcache_evictions[2],
+    tcache_space_evictions[0], tcache_space_evictions[1],
+    tcache_space_evictions[2],
+    tcache_flushes[0], tcache_flushes[1], tcache_flushes[2]);
+
+  dr_tcache_rebalance();
+
+  for (i = 0; i < TCACHE_BUFFERS; i++)
+    tcache_evictions[i] = tcache_space_evictions[i] = tcache_flushes[i] = 0;
+}
+
+int sh2_drc_usable(void)
+{
+  return block_tables[0] != NULL && !tcache_noexec;
+}
+
+// find the active block containing an SH2 PC, for the PC profiler.
+// returns 0 if there is none, 2 if the PC is a block entry, 1 otherwise
+int sh2_drc_find_block(u32 pc, int is_slave, u32 *start, u32 *end)
+{
+  struct block_desc *bd;
+  int tcache_id, i, n;
+
+  if (block_tables[0] == NULL)
+    return 0;
+
+  tcache_id = dr_get_tcache_id(pc, is_slave);
+  for (i = block_ring[tcache_id].first, n = 0; n < block_ring[tcache_id].used;
+       i = (i+1) % block_ring[tcache_id].size, n++)
+  {
+    bd = &block_tables[tcache_id][i];
+    if (bd->addr == 0 || !bd->active || pc < bd->addr || pc >= bd->addr + bd->size)
+      continue;
+    *start = bd->addr;
+    *end = bd->addr + bd->size;
+    return dr_get_entry(pc, is_slave, &tcache_id) != NULL ? 2 : 1;
+  }
+  return 0;
+}
+
 void sh2_drc_mem_setup(SH2 *sh2)
 {
   // fill the DRC-only convenience pointers
@@ -5874,7 +5985,10 @@ int sh2_drc_init(SH2 *sh2)
     memset(block_link_pool_counts, 0, sizeof(block_link_pool_counts));
     memset(blink_free, 0, sizeof(blink_free));
 
-    drc_cmn_init();
+    // without executable memory the interpreter must be used
+    tcache_noexec = drc_cmn_init() != 0;
+    if (tcache_noexec)
+      elprintf(EL_STATUS|EL_32X, "sh2 drc unavailable, using interpreter");
     rcache_init();
 
     tcache_ptr = tcache;
@@ -5882,12 +5996,13 @@ int sh2_drc_init(SH2 *sh2)
     host_instructions_updated(tcache, tcache_ptr);
     emith_update_cache();
 
-    i = tcache_ptr - tcache;
-    RING_INIT(&tcache_ring[0], tcache_ptr, tcache_sizes[0] - i);
-    for (i = 1; i < ARRAY_SIZE(tcache_ring); i++) {
-      RING_INIT(&tcache_ring[i], tcache_ring[i-1].base + tcache_ring[i-1].size,
-                  tcache_sizes[i]);
-    }
+    tcache_sizes[0] = DRC_TCACHE_SIZE - 2*TCACHE_DA_SIZE_MIN;
+    tcache_sizes[1] = tcache_sizes[2] = TCACHE_DA_SIZE_MIN;
+    dr_tcache_layout(tcache_ptr);
+    memset(tcache_evictions, 0, sizeof(tcache_evictions));
+    memset(tcache_space_evictions, 0, sizeof(tcache_space_evictions));
+    memset(tcache_flushes, 0, sizeof(tcache_flushes));
+    tcache_stat_frame = Pico.m.frame_count;
 
 #if (DRC_DEBUG & 4)
     for (i = 0; i < ARRAY_SIZE(block_tables); i++)
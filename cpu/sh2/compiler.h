@@ -6,10 +6,15 @@ void sh2_drc_wcheck_da(uint32_t a, unsigned len, SH2 *sh2);
 #ifdef DRC_SH2
 void sh2_drc_mem_setup(SH2 *sh2);
 void sh2_drc_flush_all(void);
+void sh2_drc_frame(void);
+int  sh2_drc_usable(void);
+int  sh2_drc_find_block(uint32_t pc, int is_slave, uint32_t *start, uint32_t *end);
 #else
 #define sh2_drc_mem_setup(x)
 #define sh2_drc_flush_all()
 #define sh2_drc_frame()
+#define sh2_drc_usable() 0
+#define sh2_drc_find_block(pc, is_slave, start, end) 0
 #endif
 
 #define BLOCK_INSN_LIMIT 1024
@@ -141,6 +141,9 @@ int sh2_execute_interpreter(SH2 *sh2, int cycles)
 			sh2->ppc = sh2->pc;
 			opcode = (UINT32)(UINT16)RW(sh2, sh2->pc);
 		}
+#ifdef CPU_TRACE
+		cpu_trace_sh2(sh2, sh2->ppc, opcode);
+#endif
 
 		sh2->delay = 0;
 		sh2->pc += 2;
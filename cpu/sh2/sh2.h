@@ -142,5 +142,8 @@ void REGPARM(3) p32x_sh2_write32(u32 a, u32 d, SH2 *sh2);
 void do_sh2_trace(SH2 *current, int cycles);
 void REGPARM(1) do_sh2_cmp(SH2 *current);
 #endif
+#ifdef CPU_TRACE
+void cpu_trace_sh2(SH2 *sh2, u32 pc, u32 op);
+#endif
 
 #endif /* __SH2_H__ */
@@ -294,16 +294,16 @@ static void hint_event(unsigned int now)
   p32x_schedule_hint(NULL, now);
 }
 
-typedef void (event_cb)(unsigned int now);
-
 /* times are in m68k (7.6MHz) cycles */
 unsigned int p32x_event_times[P32X_EVENT_COUNT];
-static unsigned int event_time_next;
-static event_cb *p32x_event_cbs[P32X_EVENT_COUNT] = {
+static sched_cb * const p32x_event_cbs[P32X_EVENT_COUNT] = {
   p32x_pwm_irq_event, // P32X_EVENT_PWM
   fillend_event,      // P32X_EVENT_FILLEND
   hint_event,         // P32X_EVENT_HINT
 };
+static struct sched p32x_sched =
+  SCHED_INIT(p32x_event_times, p32x_event_cbs, EL_32X, "32x");
+#define event_time_next p32x_sched.next
 
 // schedule event at some time 'after', in m68k clocks
 void p32x_event_schedule(unsigned int now, enum p32x_event event, int after)
@@ -313,10 +313,7 @@ void p32x_event_schedule(unsigned int now, enum p32x_event event, int after)
   when = (now + after) | 1;
 
   elprintf(EL_32X, "32x: new event #%u %u->%u", event, now, when);
-  p32x_event_times[event] = when;
-
-  if (event_time_next == 0 || CYCLES_GT(event_time_next, when))
-    event_time_next = when;
+  sched_event(&p32x_sched, event, when);
 }
 
 void p32x_event_schedule_sh2(SH2 *sh2, enum p32x_event event, int after)
@@ -336,41 +333,7 @@ void p32x_event_schedule_sh2(SH2 *sh2, enum p32x_event event, int after)
 
 static void p32x_run_events(unsigned int until)
 {
-  int oldest, oldest_diff, time;
-  int i, diff;
-
-  while (1) {
-    oldest = -1, oldest_diff = 0x7fffffff;
-
-    for (i = 0; i < P32X_EVENT_COUNT; i++) {
-      if (p32x_event_times[i]) {
-        diff = p32x_event_times[i] - until;
-        if (diff < oldest_diff) {
-          oldest_diff = diff;
-          oldest = i;
-        }
-      }
-    }
-
-    if (oldest_diff <= 0) {
-      time = p32x_event_times[oldest];
-      p32x_event_times[oldest] = 0;
-      elprintf(EL_32X, "32x: run event #%d %u", oldest, time);
-      p32x_event_cbs[oldest](time);
-    }
-    else if (oldest_diff < 0x7fffffff) {
-      event_time_next = p32x_event_times[oldest];
-      break;
-    }
-    else {
-      event_time_next = 0;
-      break;
-    }
-  }
-
-  if (oldest != -1)
-    elprintf(EL_32X, "32x: next event #%d at %u",
-      oldest, event_time_next);
+  sched_run(&p32x_sched, until);
 }
 
 static void run_sh2(SH2 *sh2, unsigned int m68k_cycles)
@@ -384,6 +347,8 @@ static void run_sh2(SH2 *sh2, unsigned int m68k_cycles)
     sh2->m68krcycles_done, cycles, sh2->pc);
 
   done = sh2_execute(sh2, cycles);
+  pc_prof_run(sh2->is_slave ? PCP_SSH2 : PCP_MSH2, sh2_pc(sh2),
+    C_SH2_TO_M68K(sh2, done));
 
   sh2->m68krcycles_done += C_SH2_TO_M68K(sh2, done);
   sh2->state &= ~SH2_STATE_RUN;
@@ -571,8 +536,12 @@ void sync_sh2s_lockstep(unsigned int m68k_target)
 
 void PicoFrame32x(void)
 {
-  sh2_execute_prepare(&msh2, PicoIn.opt & POPT_EN_DRC);
-  sh2_execute_prepare(&ssh2, PicoIn.opt & POPT_EN_DRC);
+  int use_drc = (PicoIn.opt & POPT_EN_DRC) && sh2_drc_usable();
+
+  sh2_execute_prepare(&msh2, use_drc);
+  sh2_execute_prepare(&ssh2, use_drc);
+  if (use_drc)
+    sh2_drc_frame();
 
   Pico.m.scanline = 0;
 
@@ -621,6 +590,7 @@ void Pico32xStateLoaded(int is_early)
   sh2s[0].m68krcycles_done = sh2s[1].m68krcycles_done = SekCyclesDone();
   p32x_update_irls(NULL, SekCyclesDone());
   p32x_pwm_state_loaded();
+  sched_rebuild(&p32x_sched);
   p32x_run_events(SekCyclesDone());
 }
 
@@ -1863,6 +1863,8 @@ u32 REGPARM(2) p32x_sh2_read8(u32 a, SH2 *sh2)
 
   sh2_map += SH2MAP_ADDR2OFFS_R(a);
   p = sh2_map->addr;
+  mem_stats_log(MST_MSH2 + sh2->is_slave, SH2MAP_ADDR2OFFS_R(a),
+    map_flag_set(p) ? (void *)(p << 1) : NULL, 0);
   if (!map_flag_set(p))
     return *(s8 *)((p << 1) + ((a & sh2_map->mask) ^ 1));
   else
@@ -1876,6 +1878,8 @@ u32 REGPARM(2) p32x_sh2_read16(u32 a, SH2 *sh2)
 
   sh2_map += SH2MAP_ADDR2OFFS_R(a);
   p = sh2_map->addr;
+  mem_stats_log(MST_MSH2 + sh2->is_slave, SH2MAP_ADDR2OFFS_R(a),
+    map_flag_set(p) ? (void *)(p << 1) : NULL, 0);
   if (!map_flag_set(p))
     return *(s16 *)((p << 1) + (a & sh2_map->mask));
   else
@@ -1889,6 +1893,8 @@ u32 REGPARM(2) p32x_sh2_read32(u32 a, SH2 *sh2)
 
   sh2_map += SH2MAP_ADDR2OFFS_R(a);
   p = sh2_map->addr;
+  mem_stats_log(MST_MSH2 + sh2->is_slave, SH2MAP_ADDR2OFFS_R(a),
+    map_flag_set(p) ? (void *)(p << 1) : NULL, 0);
   if (!map_flag_set(p)) {
     u32 *pd = (u32 *)((p << 1) + (a & sh2_map->mask));
     return (*pd << 16) | (*pd >> 16);
@@ -1902,6 +1908,7 @@ void REGPARM(3) p32x_sh2_write8(u32 a, u32 d, SH2 *sh2)
   sh2_write_handler *wh;
 
   wh = sh2_wmap[SH2MAP_ADDR2OFFS_W(a)];
+  mem_stats_log(MST_MSH2 + sh2->is_slave, SH2MAP_ADDR2OFFS_W(a), (void *)wh, 1);
   wh(a, d, sh2);
 }
 
@@ -1911,6 +1918,7 @@ void REGPARM(3) p32x_sh2_write16(u32 a, u32 d, SH2 *sh2)
   sh2_write_handler *wh;
 
   wh = sh2_wmap[SH2MAP_ADDR2OFFS_W(a)];
+  mem_stats_log(MST_MSH2 + sh2->is_slave, SH2MAP_ADDR2OFFS_W(a), (void *)wh, 1);
   wh(a, d, sh2);
 }
 
@@ -1920,6 +1928,7 @@ void REGPARM(3) p32x_sh2_write32(u32 a, u32 d, SH2 *sh2)
   sh2_write_handler *wh;
 
   wh = sh2_wmap[SH2MAP_ADDR2OFFS_W(a)];
+  mem_stats_log(MST_MSH2 + sh2->is_slave, SH2MAP_ADDR2OFFS_W(a), (void *)wh, 1);
   wh(a, d, sh2);
 }
 
@@ -14,6 +14,8 @@
 
 
 static int rom_alloc_size;
+static unsigned int rom_crc;
+static int rom_crc_valid; // rom_crc is for the inserted ROM
 static const char *rom_exts[] = { "bin", "gen", "smd", "iso", "sms", "gg", "sg" };
 
 void (*PicoCartUnloadHook)(void);
@@ -616,6 +618,7 @@ int PicoCartInsert(unsigned char *rom, unsigned int romsize, const char *carthw_
 
   Pico.rom=rom;
   Pico.romsize=romsize;
+  rom_crc_valid = 0;
 
   if (Pico.sv.data) {
     free(Pico.sv.data);
@@ -637,9 +640,12 @@ int PicoCartInsert(unsigned char *rom, unsigned int romsize, const char *carthw_
   PicoLoadStateHook = NULL;
   carthw_chunks = NULL;
 
+  startup_prof_phase("carthw detect");
   if (!(PicoIn.AHW & (PAHW_MCD|PAHW_SMS)))
     PicoCartDetect(carthw_cfg);
 
+  startup_prof_phase("mem setup");
+
   // setup correct memory map for loaded ROM
   switch (PicoIn.AHW) {
     default:
@@ -654,6 +660,7 @@ int PicoCartInsert(unsigned char *rom, unsigned int romsize, const char *carthw_
   if (PicoCartMemSetup != NULL)
     PicoCartMemSetup();
 
+  startup_prof_phase("power");
   if (PicoIn.AHW & PAHW_SMS)
     PicoPowerMS();
   else
@@ -692,16 +699,29 @@ void PicoCartUnload(void)
   PicoGameLoaded = 0;
 }
 
+// calculated once per inserted ROM
 static unsigned int rom_crc32(void)
 {
-  unsigned int crc;
+  unsigned char buf[4096];
+  unsigned int i, n;
+
+  if (rom_crc_valid)
+    return rom_crc;
   elprintf(EL_STATUS, "caclulating CRC32..");
 
-  // have to unbyteswap for calculation..
-  Byteswap(Pico.rom, Pico.rom, Pico.romsize);
-  crc = crc32(0, Pico.rom, Pico.romsize);
-  Byteswap(Pico.rom, Pico.rom, Pico.romsize);
-  return crc;
+  // have to unbyteswap for calculation, do it in chunks on the way
+  rom_crc = 0;
+  for (i = 0; i < Pico.romsize; i += n) {
+    n = Pico.romsize - i;
+    if (n > sizeof(buf))
+      n = sizeof(buf);
+    Byteswap(buf, Pico.rom + i, n);
+    // Byteswap leaves a 2 byte tail alone
+    memcpy(buf + (n & ~3), Pico.rom + i + (n & ~3), n & 3);
+    rom_crc = crc32(rom_crc, buf, n);
+  }
+  rom_crc_valid = 1;
+  return rom_crc;
 }
 
 static int rom_strcmp(int rom_offset, const char *s1)
@@ -776,22 +796,88 @@ static int is_expr(const char *expr, char **pr)
   return 1;
 }
 
+// builtin config index, see tools/make_carthw_c.c
+struct carthw_probe {
+  unsigned int offs, len;
+};
+
+struct carthw_sect {
+  unsigned int key;       // rom_key() of the first check
+  unsigned int offs;      // section text in builtin_carthw_cfg
+  short probe;            // builtin_carthw_probes index, -1 if not indexed
+  short next;             // next section in the hash bucket, -1 ends
+};
+
 #include "carthw_cfg.c"
 
+// must match make_key() in tools/make_carthw_c.c
+static unsigned int rom_key(unsigned int offs, unsigned int len)
+{
+  const unsigned char *s_rom = Pico.rom;
+  unsigned int h = (2166136261u ^ offs) * 16777619u;
+  unsigned int i;
+
+  for (i = 0; i < len; i++)
+    h = (h ^ s_rom[(offs + i) ^ 1]) * 16777619u;
+  return h;
+}
+
+// find the builtin sections whose first check can pass, in config order
+static int carthw_builtin_sects(short *sects)
+{
+  const struct carthw_probe *pr;
+  int i, j, n = 0, p;
+  unsigned int key;
+  short t;
+
+  for (i = builtin_carthw_unindexed; i >= 0; i = builtin_carthw_sects[i].next)
+    sects[n++] = i;
+
+  for (p = 0; p < ARRAY_SIZE(builtin_carthw_probes); p++) {
+    pr = &builtin_carthw_probes[p];
+    if (pr->offs + pr->len > Pico.romsize) {
+      // can't hash beyond the ROM, leave it to the checks
+      for (i = 0; i < ARRAY_SIZE(builtin_carthw_sects); i++)
+        if (builtin_carthw_sects[i].probe == p)
+          sects[n++] = i;
+      continue;
+    }
+
+    key = rom_key(pr->offs, pr->len);
+    i = builtin_carthw_hash[key & (ARRAY_SIZE(builtin_carthw_hash) - 1)];
+    for (; i >= 0; i = builtin_carthw_sects[i].next)
+      if (builtin_carthw_sects[i].key == key && builtin_carthw_sects[i].probe == p)
+        sects[n++] = i;
+  }
+
+  // the few candidates from different probes may be out of order
+  for (i = 1; i < n; i++) {
+    for (t = sects[i], j = i; j > 0 && sects[j - 1] > t; j--)
+      sects[j] = sects[j - 1];
+    sects[j] = t;
+  }
+  return n;
+}
+
 static void parse_carthw(const char *carthw_cfg, int *fill_sram,
   int *hw_detected)
 {
   int line = 0, any_checks_passed = 0, skip_sect = 0;
-  const char *s, *builtin = builtin_carthw_cfg;
-  int tmp, rom_crc = 0;
+  const char *s, *builtin = "", *sect_start = NULL;
+  short sects[ARRAY_SIZE(builtin_carthw_sects)];
+  int sect_cnt = 0, sect_i = 0;
+  int tmp;
   char buff[256], *p, *r;
   FILE *f;
 
   f = fopen(carthw_cfg, "r");
   if (f == NULL)
     f = fopen("pico/carthw.cfg", "r");
-  if (f == NULL)
+  if (f == NULL) {
     elprintf(EL_STATUS, "couldn't open carthw.cfg!");
+    // only parse the builtin sections which may apply to this ROM
+    sect_cnt = carthw_builtin_sects(sects);
+  }
 
   for (;;)
   {
@@ -801,8 +887,12 @@ static void parse_carthw(const char *carthw_cfg, int *fill_sram,
         break;
     }
     else {
-      if (*builtin == 0)
-        break;
+      if (*builtin == 0 || (*builtin == '[' && builtin != sect_start)) {
+        if (sect_i >= sect_cnt)
+          break;
+        builtin = sect_start = builtin_carthw_cfg
+          + builtin_carthw_sects[sects[sect_i++]].offs;
+      }
       for (s = builtin; *s != 0 && *s != '\n'; s++)
         ;
       while (*s == '\n')
@@ -890,9 +980,7 @@ static void parse_carthw(const char *carthw_cfg, int *fill_sram,
       if (r == p)
         goto bad;
 
-      if (rom_crc == 0)
-        rom_crc = rom_crc32();
-      if (crc == rom_crc)
+      if (crc == rom_crc32())
         any_checks_passed = 1;
       else
         skip_sect = 1;
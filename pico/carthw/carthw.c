@@ -21,6 +21,45 @@ static int have_bank(u32 base)
   return 1;
 }
 
+/* ROM bank windows.
+ * Mappers switch ROM banks only through carthw_map_rom(), which keeps every
+ * bank directly mapped for reads and FAME fetches. Pages which already map
+ * the wanted bank are left alone, so a bank write only touches the pages
+ * that really change.
+ */
+static int carthw_rom_mapped(u32 a, uptr mh)
+{
+  int i = a >> M68K_MEM_SHIFT;
+
+  if (m68k_read8_map[i] != mh || m68k_read16_map[i] != mh)
+    return 0;
+#ifdef EMU_F68K
+  if (PicoCpuFM68k.Fetch[i] != mh << 1)
+    return 0;
+#endif
+  return 1;
+}
+
+static void carthw_map_rom(u32 target, u32 size, u32 base)
+{
+  // all pages of a window share the same map entry
+  uptr mh = ((uptr)Pico.rom + base - target) >> 1;
+  u32 end = target + size, start;
+
+  while (target < end) {
+    while (target < end && carthw_rom_mapped(target, mh))
+      target += M68K_BANK_SIZE;
+    for (start = target; target < end; target += M68K_BANK_SIZE)
+      if (carthw_rom_mapped(target, mh))
+        break;
+    if (start == target)
+      break;
+
+    cpu68k_map_set(m68k_read8_map,  start, target - 1, (u8 *)(mh << 1) + start, 0);
+    cpu68k_map_set(m68k_read16_map, start, target - 1, (u8 *)(mh << 1) + start, 0);
+  }
+}
+
 /* standard/ssf2 mapper */
 int carthw_ssf2_active;
 unsigned char carthw_ssf2_banks[8];
@@ -52,8 +91,7 @@ void carthw_ssf2_write8(u32 a, u32 d)
     return;
   carthw_ssf2_banks[a >> 1] = d;
 
-  cpu68k_map_set(m68k_read8_map,  target, target + 0x80000 - 1, Pico.rom + base, 0);
-  cpu68k_map_set(m68k_read16_map, target, target + 0x80000 - 1, Pico.rom + base, 0);
+  carthw_map_rom(target, 0x80000, base);
 }
 
 void carthw_ssf2_write16(u32 a, u32 d)
@@ -120,8 +158,7 @@ static void carthw_Xin1_do(u32 a, int mask, int shift)
 	}
 
 	len = (len + M68K_BANK_MASK) & ~M68K_BANK_MASK;
-	cpu68k_map_set(m68k_read8_map,  0x000000, len - 1, Pico.rom + a, 0);
-	cpu68k_map_set(m68k_read16_map, 0x000000, len - 1, Pico.rom + a, 0);
+	carthw_map_rom(0, len, a);
 }
 
 static carthw_state_chunk carthw_Xin1_state[] =
@@ -199,7 +236,7 @@ static void carthw_realtec_write8(u32 a, u32 d)
 	else
 		elprintf(EL_ANOMALY, "realtec: unexpected write [%06x] %02x @ %06x", a, d, SekPc);
 
-	if (realtec_bank >= 0 && realtec_size >= 0 &&
+	if (realtec_bank >= 0 && realtec_size > 0 &&
 		(realtec_bank != bank_old || realtec_size != size_old))
 	{
 		elprintf(EL_ANOMALY, "realtec: new bank %06x, size %06x", realtec_bank, realtec_size, SekPc);
@@ -209,9 +246,12 @@ static void carthw_realtec_write8(u32 a, u32 d)
 			return;
 		}
 
+		// mirror the bank over the whole cart area
 		for (i = 0; i < 0x400000; i += realtec_size) {
-			cpu68k_map_set(m68k_read8_map,  i, realtec_size - 1, Pico.rom + realtec_bank, 0);
-			cpu68k_map_set(m68k_read16_map, i, realtec_size - 1, Pico.rom + realtec_bank, 0);
+			int size = realtec_size;
+			if (size > 0x400000 - i)
+				size = 0x400000 - i;
+			carthw_map_rom(i, size, realtec_bank);
 		}
 	}
 }
@@ -221,10 +261,8 @@ static void carthw_realtec_reset(void)
 	int i;
 
 	/* map boot code */
-	for (i = 0; i < 0x400000; i += M68K_BANK_SIZE) {
-		cpu68k_map_set(m68k_read8_map,  i, i + M68K_BANK_SIZE - 1, Pico.rom + Pico.romsize, 0);
-		cpu68k_map_set(m68k_read16_map, i, i + M68K_BANK_SIZE - 1, Pico.rom + Pico.romsize, 0);
-	}
+	for (i = 0; i < 0x400000; i += M68K_BANK_SIZE)
+		carthw_map_rom(i, M68K_BANK_SIZE, Pico.romsize);
 	cpu68k_map_set(m68k_write8_map, 0x400000, 0x400000 + M68K_BANK_SIZE - 1, carthw_realtec_write8, 1);
 	realtec_bank = realtec_size = 0x80000000;
 }
@@ -354,8 +392,7 @@ do_map:
   if (!have_bank(base))
     return;
 
-  cpu68k_map_set(m68k_read8_map,  target, target + 0x80000 - 1, Pico.rom + base, 0);
-  cpu68k_map_set(m68k_read16_map, target, target + 0x80000 - 1, Pico.rom + base, 0);
+  carthw_map_rom(target, 0x80000, base);
 }
 
 static void carthw_pier_write16(u32 a, u32 d)
@@ -410,16 +447,13 @@ static void carthw_pier_prot_mem_setup(int prot_enable)
   if (prot_enable) {
     /* the dump protection.. */
     int a;
-    for (a = 0x000000; a < 0x400000; a += M68K_BANK_SIZE) {
-      cpu68k_map_set(m68k_read8_map,  a, a + 0xffff, Pico.rom + Pico.romsize, 0);
-      cpu68k_map_set(m68k_read16_map, a, a + 0xffff, Pico.rom + Pico.romsize, 0);
-    }
+    for (a = 0x000000; a < 0x400000; a += M68K_BANK_SIZE)
+      carthw_map_rom(a, M68K_BANK_SIZE, Pico.romsize);
     cpu68k_map_set(m68k_read8_map, M68K_BANK_SIZE, M68K_BANK_SIZE * 2 - 1,
       carthw_pier_prot_read8, 1);
   }
   else {
-    cpu68k_map_set(m68k_read8_map,  0, 0x27ffff, Pico.rom, 0);
-    cpu68k_map_set(m68k_read16_map, 0, 0x27ffff, Pico.rom, 0);
+    carthw_map_rom(0, 0x280000, 0);
   }
 }
 
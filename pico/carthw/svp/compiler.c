@@ -1840,7 +1840,8 @@ void ssp1601_dyn_exit(void)
 
 int ssp1601_dyn_startup(void)
 {
-	drc_cmn_init();
+	if (drc_cmn_init())
+		return -1;
 
 	ssp_block_table = calloc(sizeof(ssp_block_table[0]), SSP_BLOCKTAB_ENTS);
 	if (ssp_block_table == NULL)
@@ -1851,7 +1852,7 @@ int ssp1601_dyn_startup(void)
 		return -1;
 	}
 
-	memset(tcache, 0, DRC_TCACHE_SIZE);
+	memset(TCACHE_RW(tcache), 0, DRC_TCACHE_SIZE);
 	tcache_ptr = (void *)tcache;
 
 	PicoLoadStateHook = ssp1601_state_load;
@@ -150,9 +150,9 @@ void PicoSVPStartup(void)
 	svp_dyn_ready = 0;
 #ifdef _SVP_DRC
 	if (PicoIn.opt & POPT_EN_DRC) {
-		if (ssp1601_dyn_startup())
-			return;
-		svp_dyn_ready = 1;
+		// fall back to the interpreter if the drc can't be used
+		if (ssp1601_dyn_startup() == 0)
+			svp_dyn_ready = 1;
 	}
 #endif
 
@@ -233,3 +233,99 @@ static const char builtin_carthw_cfg[] =
   "hw=prot\n"
   "prot_rw_value16=0x400000,0xc00000,0\n"
 ;
+
+static const struct carthw_probe builtin_carthw_probes[] = {
+  { 0x000150, 13 },
+  { 0x000100,  9 },
+  { 0x000100, 15 },
+  { 0x000120,  6 },
+  { 0x000150, 18 },
+  { 0x000150, 17 },
+  { 0x000150, 14 },
+  { 0x000100,  8 },
+  { 0x000150, 41 },
+  { 0x000150,  4 },
+  { 0x000150,  9 },
+  { 0x000150,  7 },
+  { 0x000150, 10 },
+  { 0x000094, 16 },
+  { 0x0000fe, 19 },
+  { 0x000095, 13 },
+  { 0x000150, 12 },
+  { 0x000150, 28 },
+  { 0x000150, 16 },
+  { 0x000150, 26 },
+  { 0x000150, 20 },
+  { 0x000104, 16 },
+  { 0x000172, 14 },
+  { 0x000104, 27 },
+  { 0x000118,  9 },
+  { 0x00018e,  2 },
+  { 0x000140, 17 },
+};
+
+static const struct carthw_sect builtin_carthw_sects[] = {
+  { 0xf749bc5c,     0,   0,  -1 },
+  { 0x0fe2199c,    65,   0,  -1 },
+  { 0xf802c5c4,   130,   1,  -1 },
+  { 0xe7dc2b4d,   169,   2,  -1 },
+  { 0xfe664eea,   214,   3,  -1 },
+  { 0x91f6beb4,   255,   4,  -1 },
+  { 0xf3efd479,   312,   5,  12 },
+  { 0x68c52de6,   368,   6,  -1 },
+  { 0xa1bebb6c,   433,   4,  -1 },
+  { 0x4fc7363f,   523,   7,  -1 },
+  { 0x4dc1ed25,   568,   8,  -1 },
+  { 0x9966af3b,   659,   9,  -1 },
+  { 0xa62af9f9,   731,   3,  23 },
+  { 0x8c90ec22,   799,  10,  -1 },
+  { 0x5dea4273,   870,  11,  -1 },
+  { 0x1f99e70a,   939,  12,  -1 },
+  { 0x34b43d3d,  1011,  10,  -1 },
+  { 0x427834d3,  1082,   0,  -1 },
+  { 0x87c33f0e,  1157,  13,  -1 },
+  { 0x43143d8c,  1212,  14,  -1 },
+  { 0xb43e2948,  1270,  15,  -1 },
+  { 0x8698af99,  1322,  16,  -1 },
+  { 0xbdf9ebb8,  1389,  17,  -1 },
+  { 0xf3efd479,  1472,   5,  42 },
+  { 0x7c0f984f,  1573,  18,  25 },
+  { 0x7c0f984f,  1691,  18,  26 },
+  { 0x7c0f984f,  1809,  18,  27 },
+  { 0x7c0f984f,  1927,  18,  39 },
+  { 0xf58136d6,  2045,  18,  -1 },
+  { 0x2a3c5c4b,  2116,  19,  -1 },
+  { 0x61ce37b6,  2226,  20,  -1 },
+  { 0x5ebbc108,  2301,  18,  -1 },
+  { 0x80dd78e8,  2401,  18,  -1 },
+  { 0xe591e3aa,  2501,   6,  -1 },
+  { 0xef2a3e93,  2599,  21,  36 },
+  { 0x6a21ff4c,  2707,  22,  -1 },
+  { 0xef2a3e93,  2936,  21,  40 },
+  { 0x7795f7af,  3193,  23,  38 },
+  { 0x7795f7af,  3277,  23,  45 },
+  { 0x92eecd4f,  3429,  24,  -1 },
+  { 0xef2a3e93,  3561,  21,  41 },
+  { 0xef2a3e93,  3696,  21,  44 },
+  { 0x6a0c3af9,  3864,  25,  43 },
+  { 0x6a0c3af9,  3944,  25,  -1 },
+  { 0xef2a3e93,  4131,  21,  -1 },
+  { 0x7795f7af,  4314,  23,  46 },
+  { 0x7795f7af,  4464,  23,  48 },
+  { 0x113d0928,  4548,  26,  -1 },
+  { 0x7795f7af,  4628,  23,  49 },
+  { 0x7795f7af,  4741,  23,  -1 },
+};
+
+static const short builtin_carthw_hash[128] = {
+   -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  31,  -1,  15,  -1,  19,  -1,  18,  -1,
+   -1,  -1,  -1,  34,  -1,  -1,  -1,  -1,  -1,  21,  -1,  -1,   1,  -1,  -1,  -1,
+   -1,  -1,  13,  -1,  -1,  10,  -1,  -1,  47,  -1,  33,  -1,  -1,  -1,  -1,  37,
+   -1,  -1,  -1,  -1,   5,  -1,  30,  -1,  22,  -1,  -1,  11,  -1,  16,  -1,   9,
+   -1,  -1,  -1,  -1,   2,  -1,  -1,  -1,  20,  -1,  -1,  29,  35,   3,  -1,  24,
+   -1,  -1,  -1,  17,  -1,  -1,  28,  -1,  -1,  -1,  -1,  -1,   0,  -1,  -1,  -1,
+   -1,  -1,  -1,  -1,  -1,  -1,   7,  -1,  32,  -1,   4,  -1,   8,  -1,  -1,  -1,
+   -1,  -1,  -1,  14,  -1,  -1,  -1,  -1,  -1,   6,  -1,  -1,  -1,  -1,  -1,  -1,
+};
+
+static const short builtin_carthw_unindexed = -1;
@@ -266,6 +266,7 @@ static void do_dma(enum dma_type type, int words_in)
         words = (0x1000 - dst_addr) / 2;
       }
       dst = Pico_mcd->pcm_ram_b[Pico_mcd->pcm.bank];
+      pcd_pcm_ram_dirty(1 << Pico_mcd->pcm.bank);
       dst = dst + dst_addr;
       while (words > 0)
       {
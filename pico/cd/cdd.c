@@ -41,6 +41,9 @@
 #include "cue.h"
 #include "cdd.h"
 
+/* data read speed multiplier in fast CD mode */
+#define FASTCD_SPEED 4
+
 #ifdef USE_LIBTREMOR
 #define SUPPORTED_EXT 20
 #else
@@ -49,6 +52,52 @@
 
 cdd_t cdd;
 
+/* data track read-ahead: sectors are read from the image in blocks, so
+ * that sequential reads don't seek (and decompress, for CSO) per sector */
+#define READAHEAD_SECTORS 32
+
+static struct
+{
+  uint8 *buf;
+  int lba;                /* first sector in buf */
+  int count;              /* number of sectors in buf */
+  unsigned int hits;
+  unsigned int misses;
+} readahead;
+
+static void readahead_reset(void)
+{
+  if (readahead.hits | readahead.misses)
+    elprintf(EL_CD, "cd: read-ahead %u hits, %u misses",
+      readahead.hits, readahead.misses);
+
+  free(readahead.buf);
+  memset(&readahead, 0, sizeof(readahead));
+}
+
+static int readahead_fill(int lba)
+{
+  int count = READAHEAD_SECTORS;
+  size_t ret;
+
+  if (readahead.buf == NULL)
+  {
+    readahead.buf = malloc(READAHEAD_SECTORS * 2352);
+    if (readahead.buf == NULL)
+      return 0;
+  }
+
+  if (count > cdd.toc.tracks[0].end - lba)
+    count = cdd.toc.tracks[0].end - lba;
+
+  pm_seek(cdd.toc.tracks[0].fd, lba * cdd.sectorSize, SEEK_SET);
+  ret = pm_read(readahead.buf, count * cdd.sectorSize, cdd.toc.tracks[0].fd);
+
+  readahead.lba = lba;
+  readahead.count = ret / cdd.sectorSize;
+  return readahead.count;
+}
+
 /* BCD conversion lookup tables */
 static const uint8 lut_BCD_8[100] =
 {
@@ -288,6 +337,9 @@ int cdd_load(const char *filename, int type)
   /* first unmount any loaded disc */
   cdd_unload();
 
+  if (pmov_active)
+    pmov_disc(filename, type);
+
   /* genplus parses cue here, in PD we use our own parser */
   ret = load_cd_image(filename, &type);
   if (ret != 0)
@@ -439,6 +491,9 @@ int cdd_unload(void)
 {
   int was_loaded = cdd.loaded;
 
+  if (cdd.loaded && pmov_active)
+    pmov_disc(NULL, 0);
+
   if (cdd.loaded)
   {
     int i;
@@ -486,6 +541,9 @@ int cdd_unload(void)
 
   /* reset TOC */
   memset(&cdd.toc, 0x00, sizeof(cdd.toc));
+
+  /* drop sectors read ahead */
+  readahead_reset();
     
   /* unknown CD image file format */
   cdd.sectorSize = 0;
@@ -498,15 +556,21 @@ void cdd_read_data(uint8 *dst)
   /* only read DATA track sectors */
   if ((cdd.lba >= 0) && (cdd.lba < cdd.toc.tracks[0].end))
   {
-    /* BIN format ? */
-    if (cdd.sectorSize == 2352)
+    int i = cdd.lba - readahead.lba;
+
+    if (i >= 0 && i < readahead.count)
+      readahead.hits++;
+    else
     {
-      /* skip 16-byte header */
-      pm_seek(cdd.toc.tracks[0].fd, cdd.lba * 2352 + 16, SEEK_SET);
+      readahead.misses++;
+      if (!readahead_fill(cdd.lba))
+        return;
+      i = 0;
     }
 
-    /* read sector data (Mode 1 = 2048 bytes) */
-    pm_read(dst, 2048, cdd.toc.tracks[0].fd);
+    /* read sector data (Mode 1 = 2048 bytes), skip 16-byte header for BIN */
+    memcpy(dst, readahead.buf + i * cdd.sectorSize
+      + (cdd.sectorSize == 2352 ? 16 : 0), 2048);
   }
 }
 
@@ -670,6 +734,16 @@ void cdd_read_audio(unsigned int samples)
 #endif
 
 
+/* s68k cycles to the next drive update: 75Hz (1x speed), faster while
+ * reading the data track in fast CD mode */
+int cdd_update_period(void)
+{
+  if ((PicoIn.opt & POPT_EN_MCD_FASTCD) && cdd.status == CD_PLAY && !cdd.index)
+    return 12500000/75 / FASTCD_SPEED;
+
+  return 12500000/75;
+}
+
 void cdd_update(void)
 {  
 #ifdef LOG_CDD
@@ -1034,7 +1108,11 @@ void cdd_process(void)
       /* Note: This is only a rough approximation since, on real hardware, seek time is much likely not linear and */
       /* latency much larger than above value, but this model works fine for Sonic CD (track 26 playback needs to  */
       /* be enough delayed to start in sync with intro sequence, as compared with real hardware recording).        */
-      if (lba > cdd.lba)
+      if (PicoIn.opt & POPT_EN_MCD_FASTCD)
+      {
+        /* fast CD: no seek time */
+      }
+      else if (lba > cdd.lba)
       {
         cdd.latency += (((lba - cdd.lba) * 120) / 270000);
       }
@@ -1133,7 +1211,12 @@ void cdd_process(void)
       /* We are using similar linear model as above, although still not exactly accurate, */
       /* it works fine for Switch/Panic! intro (Switch needs at least 30 interrupts while */
       /* seeking from 00:05:63 to 24:03:19, Panic! when seeking from 00:05:60 to 24:06:07) */
-      if (lba > cdd.lba)
+      if (PicoIn.opt & POPT_EN_MCD_FASTCD)
+      {
+        /* fast CD: seek completes on next drive update */
+        cdd.latency = 0;
+      }
+      else if (lba > cdd.lba)
       {
         cdd.latency = ((lba - cdd.lba) * 120) / 270000;
       }
@@ -175,7 +175,169 @@ int gfx_context_load(const uint8 *state)
   return bufferptr;
 }
 
+/* loop invariant state of a rendered line */
+struct gfx_line
+{
+  uint8 *wram;
+  const uint16 *mapPtr;
+  const uint8 *lut_prio;
+  uint32 dotMask;
+  uint32 wrapMask;
+  uint32 stampSize;
+  uint32 stampShift;
+  uint32 mapShift;
+};
+
+/* word RAM word index of the stamp map entry for a dot */
+#define GFX_MAP_INDEX(l, x, y) \
+  (((x) >> (l)->stampShift) | (((y) >> (l)->stampShift) << (l)->mapShift))
+
+/* stamp generator index of a dot, 0 if the dot has no stamp pixel */
+static inline uint32 gfx_stamp_index(const struct gfx_line *l, uint32 xpos, uint32 ypos)
+{
+  uint32 stamp_data, stamp_index;
+
+  /* pixels outside the stamp map are 0 */
+  if ((xpos | ypos) & ~l->dotMask)
+    return 0;
+
+  /* stamp generator base index                                     */
+  /* sss ssssssss ccyyyxxx (16x16) or sss sssssscc ccyyyxxx (32x32) */
+  stamp_data = l->mapPtr[GFX_MAP_INDEX(l, xpos, ypos)];
+  stamp_index = (stamp_data & 0x7ff) << 8;
+
+  /* stamp 0 is not used: pixel is 0 */
+  if (stamp_index)
+  {
+    /* HFLIP & ROTATION bits */
+    stamp_data = (stamp_data >> 13) & 7;
+
+    /* cell offset (0-3 or 0-15), see lut_cell */
+    stamp_index |= gfx.lut_cell[stamp_data | l->stampSize
+      | ((ypos >> 8) & 0xc0) | ((xpos >> 10) & 0x30)] << 6;
+
+    /* pixel offset (0-63), see lut_pixel */
+    stamp_index |= gfx.lut_pixel[stamp_data | ((xpos >> 8) & 0x38) | ((ypos >> 5) & 0x1c0)];
+  }
+  return stamp_index;
+}
+
+static inline uint8 gfx_stamp_pixel(const struct gfx_line *l, uint32 stamp_index)
+{
+  uint8 pixel;
+
+  if (!stamp_index)
+    return 0;
+
+  /* read pixel pair (2 pixels/byte), extract left or right pixel */
+  pixel = READ_BYTE(l->wram, stamp_index >> 1);
+  return (stamp_index & 1) ? pixel & 0x0f : pixel >> 4;
+}
+
+static inline void gfx_write_pixel(const struct gfx_line *l, uint32 bufferIndex, uint8 pixel)
+{
+  uint8 pixel_in = READ_BYTE(l->wram, bufferIndex >> 1);
+
+  /* priority mode write to left or right pixel */
+  if (bufferIndex & 1)
+    pixel = l->lut_prio[((pixel_in & 0x0f) << 4) | pixel] | (pixel_in & 0xf0);
+  else
+    pixel = (l->lut_prio[(pixel_in & 0xf0) | pixel] << 4) | (pixel_in & 0x0f);
+  WRITE_BYTE(l->wram, bufferIndex >> 1, pixel);
+}
+
+/* Dots are processed in runs that end at an image buffer cell boundary.
+ * Stamp indices for a run are computed first, then the pixels are merged
+ * into the buffer, keeping the index pass free of word RAM writes and
+ * buffer stepping. Should the run read the word RAM it writes to, it is
+ * redone dot by dot so that the result stays the same as the hardware's.
+ */
 static void gfx_render(uint32 bufferIndex, uint32 width)
+{
+  struct gfx_line l;
+  uint32 stamp_index[8];
+  uint32 priority, map_base, buf_lo, buf_len;
+  uint32 x, y;
+  int i, n, conflict;
+
+  /* pixel map start position for current line (13.3 format converted to 13.11) */
+  uint32 xpos = *gfx.tracePtr++ << 8;
+  uint32 ypos = *gfx.tracePtr++ << 8;
+
+  /* pixel map offset values for current line (5.11 format) */
+  uint32 xoffset = (int16) *gfx.tracePtr++;
+  uint32 yoffset = (int16) *gfx.tracePtr++;
+
+  priority = (Pico_mcd->s68k_regs[2] << 8) | Pico_mcd->s68k_regs[3];
+  priority = (priority >> 3) & 0x03;
+
+  l.wram = Pico_mcd->word_ram2M;
+  l.mapPtr = gfx.mapPtr;
+  l.lut_prio = gfx.lut_prio[priority][0];
+  l.dotMask = gfx.dotMask;
+  /* stamp map repeat (stamp map range) or 24-bit range */
+  l.wrapMask = (Pico_mcd->s68k_regs[0x58+1] & 0x01) ? gfx.dotMask : 0xffffff;
+  /* stamp size bit for the cell lookup table */
+  l.stampSize = (Pico_mcd->s68k_regs[0x58+1] & 0x02) << 2;
+  l.stampShift = gfx.stampShift;
+  l.mapShift = gfx.mapShift;
+  map_base = gfx.mapPtr - (uint16 *)Pico_mcd->word_ram2M;
+
+  while (width > 0)
+  {
+    /* dots left in the current cell row */
+    n = 8 - (bufferIndex & 7);
+    if (n > width)
+      n = width;
+
+    /* word RAM words written by this run */
+    buf_lo = bufferIndex >> 2;
+    buf_len = ((bufferIndex + n - 1) >> 2) - buf_lo;
+
+    x = xpos, y = ypos;
+    conflict = 0;
+    for (i = 0; i < n; i++)
+    {
+      x &= l.wrapMask;
+      y &= l.wrapMask;
+      stamp_index[i] = gfx_stamp_index(&l, x, y);
+      if (!((x | y) & ~l.dotMask))
+        conflict |= map_base + GFX_MAP_INDEX(&l, x, y) - buf_lo <= buf_len
+          || (stamp_index[i] && (stamp_index[i] >> 2) - buf_lo <= buf_len);
+      x += xoffset;
+      y += yoffset;
+    }
+
+    if (!conflict)
+    {
+      for (i = 0; i < n; i++)
+        gfx_write_pixel(&l, bufferIndex + i, gfx_stamp_pixel(&l, stamp_index[i]));
+      xpos = x, ypos = y;
+    }
+    else
+    {
+      for (i = 0; i < n; i++)
+      {
+        xpos &= l.wrapMask;
+        ypos &= l.wrapMask;
+        gfx_write_pixel(&l, bufferIndex + i,
+          gfx_stamp_pixel(&l, gfx_stamp_index(&l, xpos, ypos)));
+        xpos += xoffset;
+        ypos += yoffset;
+      }
+    }
+
+    /* next cell: increment image buffer offset by one column */
+    bufferIndex += n;
+    if (!(bufferIndex & 7))
+      bufferIndex += gfx.bufferOffset - 1;
+    width -= n;
+  }
+}
+
+#ifdef GFX_CHECK
+/* original per dot renderer, rendered lines are checked against it */
+static void gfx_render_ref(uint32 bufferIndex, uint32 width)
 {
   uint8 pixel_in, pixel_out;
   uint16 stamp_data;
@@ -311,6 +473,36 @@ static void gfx_render(uint32 bufferIndex, uint32 width)
   }
 }
 
+static uint32 gfx_hash(const uint8 *p, int len)
+{
+  uint32 h = 2166136261u;
+  while (len-- > 0)
+    h = (h ^ *p++) * 16777619u;
+  return h;
+}
+
+static void gfx_render_check(uint32 bufferIndex, uint32 width)
+{
+  static uint8 wram_copy[0x40000];
+  uint16 *tracePtr = gfx.tracePtr;
+  uint32 h_ref, h;
+
+  memcpy(wram_copy, Pico_mcd->word_ram2M, sizeof(wram_copy));
+  gfx_render_ref(bufferIndex, width);
+  h_ref = gfx_hash(Pico_mcd->word_ram2M, sizeof(wram_copy));
+
+  memcpy(Pico_mcd->word_ram2M, wram_copy, sizeof(wram_copy));
+  gfx.tracePtr = tracePtr;
+  gfx_render(bufferIndex, width);
+  h = gfx_hash(Pico_mcd->word_ram2M, sizeof(wram_copy));
+
+  if (h != h_ref)
+    elprintf(EL_STATUS|EL_ANOMALY, "gfx: line mismatch @%05x w %d: %08x vs %08x",
+      bufferIndex, width, h, h_ref);
+}
+#define gfx_render gfx_render_check
+#endif
+
 void gfx_start(unsigned int base)
 {
   /* make sure 2M mode is enabled */
@@ -7,6 +7,7 @@
  */
 
 #include "../pico_int.h"
+#include "../memory.h"
 #include "../sound/ym2612.h"
 
 extern unsigned char formatted_bram[4*0x10];
@@ -21,20 +22,25 @@ PICO_INTERNAL void PicoInitMCD(void)
   SekInitS68k();
 }
 
+static void pcd_sync_stats(void);
+
 PICO_INTERNAL void PicoExitMCD(void)
 {
+  pcd_sync_stats();
 }
 
 PICO_INTERNAL void PicoPowerMCD(void)
 {
   int fmt_size;
 
+  pcd_sync_stats();
   SekCycleCntS68k = SekCycleAimS68k = 0;
 
   fmt_size = sizeof(formatted_bram);
   memset(Pico_mcd->prg_ram,    0, sizeof(Pico_mcd->prg_ram));
   memset(Pico_mcd->word_ram2M, 0, sizeof(Pico_mcd->word_ram2M));
   memset(Pico_mcd->pcm_ram,    0, sizeof(Pico_mcd->pcm_ram));
+  pcd_pcm_ram_dirty(0xffff);
   memset(Pico_mcd->bram, 0, sizeof(Pico_mcd->bram));
   memcpy(Pico_mcd->bram + sizeof(Pico_mcd->bram) - fmt_size,
     formatted_bram, fmt_size);
@@ -173,7 +179,7 @@ static void pcd_cdc_event(unsigned int now)
     }
   }
 
-  pcd_event_schedule(now, PCD_EVENT_CDC, 12500000/75);
+  pcd_event_schedule(now, PCD_EVENT_CDC, cdd_update_period());
 }
 
 static void pcd_int3_timer_event(unsigned int now)
@@ -193,17 +199,17 @@ static void pcd_dma_event(unsigned int now)
   cdc_dma_update();
 }
 
-typedef void (event_cb)(unsigned int now);
-
 /* times are in s68k (12.5MHz) cycles */
 unsigned int pcd_event_times[PCD_EVENT_COUNT];
-static unsigned int event_time_next;
-static event_cb *pcd_event_cbs[PCD_EVENT_COUNT] = {
+static sched_cb * const pcd_event_cbs[PCD_EVENT_COUNT] = {
   pcd_cdc_event,            // PCD_EVENT_CDC
   pcd_int3_timer_event,     // PCD_EVENT_TIMER3
   gfx_update,               // PCD_EVENT_GFX
   pcd_dma_event,            // PCD_EVENT_DMA
 };
+static struct sched pcd_sched =
+  SCHED_INIT(pcd_event_times, pcd_event_cbs, EL_CD, "cd");
+#define event_time_next pcd_sched.next
 
 void pcd_event_schedule(unsigned int now, enum pcd_event event, int after)
 {
@@ -212,17 +218,14 @@ void pcd_event_schedule(unsigned int now, enum pcd_event event, int after)
   when = now + after;
   if (when == 0) {
     // event cancelled
-    pcd_event_times[event] = 0;
+    sched_event(&pcd_sched, event, 0);
     return;
   }
 
   when |= 1;
 
   elprintf(EL_CD, "cd: new event #%u %u->%u", event, now, when);
-  pcd_event_times[event] = when;
-
-  if (event_time_next == 0 || CYCLES_GT(event_time_next, when))
-    event_time_next = when;
+  sched_event(&pcd_sched, event, when);
 }
 
 void pcd_event_schedule_s68k(enum pcd_event event, int after)
@@ -235,43 +238,142 @@ void pcd_event_schedule_s68k(enum pcd_event event, int after)
 
 static void pcd_run_events(unsigned int until)
 {
-  int oldest, oldest_diff, time;
-  int i, diff;
-
-  while (1) {
-    oldest = -1, oldest_diff = 0x7fffffff;
-
-    for (i = 0; i < PCD_EVENT_COUNT; i++) {
-      if (pcd_event_times[i]) {
-        diff = pcd_event_times[i] - until;
-        if (diff < oldest_diff) {
-          oldest_diff = diff;
-          oldest = i;
-        }
-      }
-    }
+  sched_run(&pcd_sched, until);
+}
 
-    if (oldest_diff <= 0) {
-      time = pcd_event_times[oldest];
-      pcd_event_times[oldest] = 0;
-      elprintf(EL_CD, "cd: run event #%d %u", oldest, time);
-      pcd_event_cbs[oldest](time);
-    }
-    else if (oldest_diff < 0x7fffffff) {
-      event_time_next = pcd_event_times[oldest];
+/* sub-68k idle loop detection.
+ * A loop which only consists of a read from PRG or word RAM and a branch
+ * back to it can only be left when the RAM is changed by an event, an
+ * interrupt, or the main 68k. The main 68k isn't running while the s68k is
+ * synced to it, and events end the s68k timeslices, so the time up to the
+ * next event or sync target can be skipped once the loop is detected.
+ * This complements the register poll detection in cd/memory.c.
+ */
+#define IDLE_PROBE_CYCLES 64
+
+static struct {
+  u32 pc;               // loop address, 0 if not idling
+  u32 a;                // polled address, 0 for wait-for-interrupt loops
+  u32 d;                // polled memory contents
+} s68k_idle;
+
+static struct {
+  u32 pc;
+  u32 hits;
+  u32 cycles;
+} s68k_idle_hits[16];
+
+static u16 *s68k_code_ptr(u32 a)
+{
+  uptr v = s68k_read16_map[(a & 0xfffffe) >> M68K_MEM_SHIFT];
+  if (map_flag_set(v))
+    return NULL;
+  return (u16 *)((v << 1) + (a & 0xfffffe));
+}
+
+// 4 bytes around a polled address, or ~0 if not RAM
+static u32 s68k_idle_mem(u32 a)
+{
+  u16 *p0 = s68k_code_ptr(a), *p1 = s68k_code_ptr(a + 2);
+  if (p0 == NULL || p1 == NULL)
+    return ~0;
+  return (p0[0] << 16) | p1[0];
+}
+
+// return polled address if op is a RAM read without side effects, else 0
+static u32 s68k_idle_insn(u16 *op, int len)
+{
+  u32 a = 0;
+
+  switch (len) {
+    case 4:
+      if ((op[0] & 0xff3f) == 0x4a38 ||   // tst.x ($xxxx.w)
+          ((op[0] & 0xc1ff) == 0x0038 && (op[0] & 0x3000)) || // move.x ($xxxx.w), dX
+          (op[0] & 0xf13f) == 0xb038)     // cmp.x ($xxxx.w), dX
+        a = (s16)op[1];
       break;
-    }
-    else {
-      event_time_next = 0;
+    case 6:
+      if ((op[0] & 0xff3f) == 0x4a39 ||   // tst.x ($xxxxxxxx)
+          ((op[0] & 0xc1ff) == 0x0039 && (op[0] & 0x3000)) || // move.x ($xxxxxxxx), dX
+          (op[0] & 0xf13f) == 0xb039)     // cmp.x ($xxxxxxxx), dX
+        a = (op[1] << 16) | op[2];
+      else if (op[0] == 0x0838 ||         // btst #X, ($xxxx.w)
+          (op[0] & 0xffbf) == 0x0c38)     // cmpi.{b,w} #X, ($xxxx.w)
+        a = (s16)op[2];
+      break;
+    case 8:
+      if (op[0] == 0x0839 ||              // btst #X, ($xxxxxxxx)
+          (op[0] & 0xffbf) == 0x0c39)     // cmpi.{b,w} #X, ($xxxxxxxx)
+        a = (op[2] << 16) | op[3];
+      else if (op[0] == 0x0cb8)           // cmpi.l #X, ($xxxx.w)
+        a = (s16)op[3];
       break;
+  }
+
+  // PRG and word RAM only, registers have their own poll detection
+  a &= 0xffffff;
+  if (a == 0 || a >= 0x0e0000)
+    return 0;
+  return a;
+}
+
+// check if the s68k is in an idle loop, return loop address or 0
+static u32 s68k_idle_check(void)
+{
+  u32 pc = SekPcS68k & 0xffffff;
+  u16 *op = s68k_code_ptr(pc);
+  int len, disp;
+
+  if (op == NULL)
+    return 0;
+
+  if (op[0] == 0x60fe) {                  // bra.s *
+    s68k_idle.a = 0;
+    return pc;
+  }
+
+  // stopped at the branch, look at the loop start
+  if ((op[0] & 0xf000) == 0x6000 && (op[0] & 0xff) >= 0xf8) {
+    disp = (s8)op[0];
+    pc += 2 + disp;
+    op = s68k_code_ptr(pc);
+    if (op == NULL)
+      return 0;
+  }
+
+  // find the bcc.s to the loop start after the RAM read
+  for (len = 4; len <= 8; len += 2) {
+    if ((op[len/2] & 0xf000) == 0x6000 && (op[len/2] & 0x0e00) != 0 &&
+        (s8)op[len/2] == -(len + 2)) {    // bcc, not bra or bsr
+      s68k_idle.a = s68k_idle_insn(op, len);
+      if (s68k_idle.a == 0)
+        return 0;
+      s68k_idle.d = s68k_idle_mem(s68k_idle.a);
+      return pc;
     }
   }
 
-  if (oldest != -1)
-    elprintf(EL_CD, "cd: next event #%d at %u",
-      oldest, event_time_next);
+  return 0;
 }
 
+static void s68k_idle_hit(u32 pc, int cycles)
+{
+  int i;
+
+  for (i = 0; i < 16 && s68k_idle_hits[i].pc != 0; i++)
+    if (s68k_idle_hits[i].pc == pc)
+      break;
+  if (i == 16)
+    return;
+  if (s68k_idle_hits[i].pc == 0) {
+    elprintf(EL_CDPOLL, "s68k idle loop @%06x, a=%06x", pc, s68k_idle.a);
+    s68k_idle_hits[i].pc = pc;
+  }
+  s68k_idle_hits[i].hits++;
+  s68k_idle_hits[i].cycles += cycles;
+}
+
+
 int pcd_sync_s68k(unsigned int m68k_target, int m68k_poll_sync)
 {
   #define now SekCycleCntS68k
@@ -299,7 +401,25 @@ int pcd_sync_s68k(unsigned int m68k_target, int m68k_poll_sync)
     if (event_time_next && CYCLES_GT(target, event_time_next))
       target = event_time_next;
 
-    SekRunS68k(target);
+    if (s68k_idle.pc) {
+      // run a bit to take any interrupts, skip the rest if still idling
+      unsigned int probe = now + IDLE_PROBE_CYCLES;
+      u32 pc = s68k_idle.pc, a = s68k_idle.a, d = s68k_idle.d;
+      SekRunS68k(CYCLES_GT(target, probe) ? probe : target);
+      if (!CYCLES_GT(target, now))
+        ; // nothing left to skip
+      else if (s68k_idle_check() == pc && s68k_idle.a == a && s68k_idle.d == d) {
+        s68k_idle_hit(pc, target - now);
+        SekCycleCntS68k = SekCycleAimS68k = target;
+      }
+      else
+        s68k_idle.pc = 0;
+    }
+    else {
+      SekRunS68k(target);
+      if (!(PicoIn.opt & POPT_DIS_IDLE_DET) && !SekIsStoppedS68k())
+        s68k_idle.pc = s68k_idle_check();
+    }
     if (m68k_poll_sync && Pico_mcd->m.m68k_poll_cnt == 0)
       break;
   }
@@ -308,6 +428,34 @@ int pcd_sync_s68k(unsigned int m68k_target, int m68k_poll_sync)
   #undef now
 }
 
+/* adaptive cpu interleave.
+ * The m68k runs in quanta, syncing the s68k after each one. A quantum is
+ * halved down to lockstep size if the last one had writes to registers
+ * shared by the cpus, and doubled up to a full line otherwise.
+ */
+#define QUANTUM_MIN_SHIFT 3 // 8 cycles, like lockstep
+#define QUANTUM_MAX_SHIFT 9 // 512 cycles, more than a line
+
+static int quantum_shift = QUANTUM_MAX_SHIFT;
+static unsigned int quantum_hist[QUANTUM_MAX_SHIFT + 1];
+
+static void pcd_sync_stats(void)
+{
+  int i;
+
+  for (i = 0; i < 16 && s68k_idle_hits[i].pc != 0; i++)
+    elprintf(EL_CDPOLL, "s68k idle loop @%06x: %u hits, %u cycles skipped",
+      s68k_idle_hits[i].pc, s68k_idle_hits[i].hits, s68k_idle_hits[i].cycles);
+  memset(s68k_idle_hits, 0, sizeof(s68k_idle_hits));
+  s68k_idle.pc = 0;
+
+  for (i = QUANTUM_MIN_SHIFT; i <= QUANTUM_MAX_SHIFT; i++)
+    if (quantum_hist[i])
+      elprintf(EL_CDPOLL, "cpu quantum %3d: %u", 1 << i, quantum_hist[i]);
+  memset(quantum_hist, 0, sizeof(quantum_hist));
+  quantum_shift = QUANTUM_MAX_SHIFT;
+}
+
 #define pcd_run_cpus_normal pcd_run_cpus
 //#define pcd_run_cpus_lockstep pcd_run_cpus
 
@@ -315,6 +463,8 @@ static void SekSyncM68k(void);
 
 void pcd_run_cpus_normal(int m68k_cycles)
 {
+  unsigned int target, writes;
+
   Pico.t.m68c_aim += m68k_cycles;
   if (SekShouldInterrupt() || Pico_mcd->m.m68k_poll_cnt < 12)
     Pico_mcd->m.m68k_poll_cnt = 0;
@@ -329,13 +479,29 @@ void pcd_run_cpus_normal(int m68k_cycles)
     Pico.t.m68c_cnt = Pico.t.m68c_aim - (s68k_left * 40220 >> 16);
   }
 
-  while (CYCLES_GT(Pico.t.m68c_aim, Pico.t.m68c_cnt)) {
+  target = Pico.t.m68c_aim;
+  while (CYCLES_GT(target, Pico.t.m68c_cnt)) {
+    int quantum = 1 << quantum_shift;
+    int limited = CYCLES_GT(target, Pico.t.m68c_cnt + quantum);
+
+    Pico.t.m68c_aim = limited ? Pico.t.m68c_cnt + quantum : target;
+    quantum_hist[quantum_shift]++;
+    writes = pcd_shared_writes;
+
     SekRunM68kOnce();
-    if (Pico_mcd->m.need_sync) {
+    if (Pico_mcd->m.need_sync || limited) {
       Pico_mcd->m.need_sync = 0;
       pcd_sync_s68k(Pico.t.m68c_cnt, 0);
     }
+
+    if (pcd_shared_writes != writes) {
+      if (quantum_shift > QUANTUM_MIN_SHIFT)
+        quantum_shift--;
+    }
+    else if (quantum_shift < QUANTUM_MAX_SHIFT)
+      quantum_shift++;
   }
+  Pico.t.m68c_aim = target;
 }
 
 void pcd_run_cpus_lockstep(int m68k_cycles)
@@ -382,11 +548,13 @@ void pcd_state_loaded(void)
 
   pcd_set_cycle_mult();
   pcd_state_loaded_mem();
+  sched_rebuild(&pcd_sched);
 
   memset(Pico_mcd->pcm_mixbuf, 0, sizeof(Pico_mcd->pcm_mixbuf));
   Pico_mcd->pcm_mixbuf_dirty = 0;
   Pico_mcd->pcm_mixpos = 0;
   Pico_mcd->pcm_regs_dirty = 1;
+  pcd_pcm_ram_dirty(0xffff);
 
   // old savestates..
   cycles = pcd_cycles_m68k_to_s68k(Pico.t.m68c_aim);
@@ -406,8 +574,6 @@ void pcd_state_loaded(void)
   if ((unsigned int)diff > 12500000/50)
     Pico_mcd->pcm.update_cycles = cycles;
 
-  // reschedule
-  event_time_next = 0;
   pcd_run_events(SekCycleCntS68k);
 }
 
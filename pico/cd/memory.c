@@ -66,6 +66,10 @@ static void remap_word_ram(u32 r3);
 #define POLL_LIMIT 16
 #define POLL_CYCLES 64
 
+// count of writes to registers shared between m68k and s68k (memory
+// mode and comm), used to adapt the cpu interleave in mcd.c
+unsigned int pcd_shared_writes;
+
 void m68k_comm_check(u32 a)
 {
   pcd_sync_s68k(SekCyclesDone(), 0);
@@ -185,6 +189,8 @@ void m68k_reg_write8(u32 a, u32 d)
     case 3:
       dold = Pico_mcd->s68k_regs[3];
       elprintf(EL_CDREG3, "m68k_regs w3: %02x @%06x", (u8)d, SekPc);
+      // word RAM handshake, counts even if the register doesn't change
+      pcd_shared_writes++;
       if ((d ^ dold) & 0xc0) {
         elprintf(EL_CDREGS, "m68k: prg bank: %i -> %i",
           (Pico_mcd->s68k_regs[a]>>6), ((d>>6)&3));
@@ -229,6 +235,7 @@ write_comm:
     return;
 
   pcd_sync_s68k(SekCyclesDone(), 0);
+  pcd_shared_writes++;
   Pico_mcd->s68k_regs[a] = d;
   if (Pico_mcd->m.s68k_poll_a == (a & ~1))
   {
@@ -478,6 +485,7 @@ void s68k_reg_write8(u32 a, u32 d)
 
 write_comm:
   Pico_mcd->s68k_regs[a] = (u8) d;
+  pcd_shared_writes++;
   if (Pico_mcd->m.m68k_poll_cnt)
     SekEndRunS68k(0);
   Pico_mcd->m.m68k_poll_cnt = 0;
@@ -537,6 +545,7 @@ void s68k_reg_write16(u32 a, u32 d)
 write_comm:
   r[a] = d >> 8;
   r[a + 1] = d;
+  pcd_shared_writes++;
   if (Pico_mcd->m.m68k_poll_cnt)
     SekEndRunS68k(0);
   Pico_mcd->m.m68k_poll_cnt = 0;
@@ -976,8 +985,10 @@ static void PicoWriteS68k8_pr(u32 a, u32 d)
   // PCM
   if ((a & 0x8000) == 0x0000) {
     a &= 0x7fff;
-    if (a >= 0x2000)
+    if (a >= 0x2000) {
       Pico_mcd->pcm_ram_b[Pico_mcd->pcm.bank][(a>>1)&0xfff] = d;
+      pcd_pcm_ram_dirty(1 << Pico_mcd->pcm.bank);
+    }
     else if (a < 0x12)
       pcd_pcm_write(a>>1, d);
     return;
@@ -999,8 +1010,10 @@ static void PicoWriteS68k16_pr(u32 a, u32 d)
   // PCM
   if ((a & 0x8000) == 0x0000) {
     a &= 0x7fff;
-    if (a >= 0x2000)
+    if (a >= 0x2000) {
       Pico_mcd->pcm_ram_b[Pico_mcd->pcm.bank][(a>>1)&0xfff] = d;
+      pcd_pcm_ram_dirty(1 << Pico_mcd->pcm.bank);
+    }
     else if (a < 0x12)
       pcd_pcm_write(a>>1, d & 0xff);
     return;
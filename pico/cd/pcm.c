@@ -7,9 +7,103 @@
  */
 
 #include "../pico_int.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 #define PCM_STEP_SHIFT 11
 
+// bitmap of loop markers (0xff) in pcm_ram, rebuilt for written 4K banks
+static u32 pcm_markers[0x10000 / 32];
+static unsigned int pcm_markers_dirty = 0xffff;
+
+// must be called for all changes of pcm_ram, bank_mask has a bit per 4K bank
+void pcd_pcm_ram_dirty(unsigned int bank_mask)
+{
+  pcm_markers_dirty |= bank_mask;
+}
+
+static void pcm_markers_update(void)
+{
+  const u8 *ram;
+  u32 bits;
+  int b, w, i;
+
+  for (b = 0; b < 0x10; b++) {
+    if (!(pcm_markers_dirty & (1 << b)))
+      continue;
+    ram = Pico_mcd->pcm_ram_b[b];
+    for (w = 0; w < 0x1000 / 32; w++, ram += 32) {
+      for (bits = i = 0; i < 32; i++)
+        bits |= (u32)(ram[i] == 0xff) << i;
+      pcm_markers[b * 0x1000 / 32 + w] = bits;
+    }
+  }
+  pcm_markers_dirty = 0;
+}
+
+// number of steps (up to max) before addr reaches a loop marker or wraps
+static int pcm_run_len(unsigned int addr, int inc, int max)
+{
+  unsigned int p = addr >> PCM_STEP_SHIFT, end;
+  u32 bits;
+  int w, n;
+
+  w = p >> 5;
+  bits = pcm_markers[w] & (~0u << (p & 31));
+  while (bits == 0 && ++w < 0x10000 / 32)
+    bits = pcm_markers[w];
+  if (bits == 0)
+    end = 0x10000;
+  else
+    for (end = w << 5; !(bits & 1); bits >>= 1)
+      end++;
+
+  if (end == p)
+    return 0;
+  if (inc == 0)
+    return max;
+  n = ((end << PCM_STEP_SHIFT) - addr + inc - 1) / inc;
+  return n < max ? n : max;
+}
+
+// out[] += smp[] * mul for count samples, stereo interleaved
+static void pcm_mix(int *out, const s16 *smp, int count, int mul_l, int mul_r)
+{
+  int i = 0;
+
+#if defined(__SSE2__)
+  __m128i mul = _mm_set_epi32(mul_r, mul_l, mul_r, mul_l);
+  __m128i zero = _mm_setzero_si128();
+
+  for (; i + 4 <= count; i += 4, out += 8) {
+    // (s, 0) 16 bit pairs, each sample twice for left and right
+    __m128i s = _mm_unpacklo_epi16(_mm_loadl_epi64((__m128i *)(smp + i)), zero);
+    __m128i o0 = _mm_loadu_si128((__m128i *)out);
+    __m128i o1 = _mm_loadu_si128((__m128i *)(out + 4));
+    o0 = _mm_add_epi32(o0, _mm_madd_epi16(_mm_unpacklo_epi32(s, s), mul));
+    o1 = _mm_add_epi32(o1, _mm_madd_epi16(_mm_unpackhi_epi32(s, s), mul));
+    _mm_storeu_si128((__m128i *)out, o0);
+    _mm_storeu_si128((__m128i *)(out + 4), o1);
+  }
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+  int16x4_t mul = { mul_l, mul_r, mul_l, mul_r };
+
+  for (; i + 4 <= count; i += 4, out += 8) {
+    int16x4_t s = vld1_s16(smp + i);
+    int16x4x2_t z = vzip_s16(s, s);
+    vst1q_s32(out,     vmlal_s16(vld1q_s32(out),     z.val[0], mul));
+    vst1q_s32(out + 4, vmlal_s16(vld1q_s32(out + 4), z.val[1], mul));
+  }
+#endif
+  for (; i < count; i++, out += 2) {
+    out[0] += smp[i] * mul_l; // max 128 * 119 = 15232
+    out[1] += smp[i] * mul_r;
+  }
+}
+
 void pcd_pcm_write(unsigned int a, unsigned int d)
 {
   unsigned int cycles = SekCyclesDoneS68k();
@@ -55,7 +149,8 @@ void pcd_pcm_sync(unsigned int to)
   int mul_l, mul_r, inc, smp;
   struct pcm_chan *ch;
   unsigned int addr;
-  int c, s, steps;
+  int c, s, i, n, run, steps;
+  s16 run_buf[64];
   int enabled;
   int *out;
 
@@ -77,6 +172,8 @@ void pcd_pcm_sync(unsigned int to)
   out = Pico_mcd->pcm_mixbuf + Pico_mcd->pcm_mixpos * 2;
   Pico_mcd->pcm_mixbuf_dirty = 1;
   Pico_mcd->pcm_regs_dirty = 0;
+  if (pcm_markers_dirty)
+    pcm_markers_update();
 
   for (c = 0; c < 8; c++)
   {
@@ -94,6 +191,22 @@ void pcd_pcm_sync(unsigned int to)
 
     for (s = 0; s < steps; s++, addr = (addr + inc) & 0x7FFFFFF)
     {
+      // mix samples up to the next loop marker in batches
+      run = pcm_run_len(addr, inc, steps - s);
+      while (run > 0) {
+        n = run < 64 ? run : 64;
+        for (i = 0; i < n; i++, addr += inc) {
+          smp = Pico_mcd->pcm_ram[addr >> PCM_STEP_SHIFT];
+          run_buf[i] = (smp & 0x80) ? -(smp & 0x7f) : smp;
+        }
+        pcm_mix(out + s*2, run_buf, n, mul_l, mul_r);
+        s += n;
+        run -= n;
+      }
+      addr &= 0x7FFFFFF;
+      if (s >= steps)
+        break;
+
       smp = Pico_mcd->pcm_ram[addr >> PCM_STEP_SHIFT];
 
       // test for loop signal
@@ -547,6 +547,355 @@ void pevt_dump(void)
 }
 #endif
 
+#ifdef MEM_STATS
+#define MST_PAGES 256
+#define MST_HANDLERS 512
+
+static struct mst_page {
+  unsigned int reads[2];        // direct, handler
+  unsigned int writes[2];
+  const void *handler;          // last handler seen
+  int handlers;                 // more than one handler seen if > 1
+} mst_pages[MST_CPU_CNT][MST_PAGES];
+
+static struct mst_handler {
+  const void *func;
+  unsigned int count;
+  int cpu;
+} mst_handlers[MST_HANDLERS];
+
+static unsigned int mst_frames;
+
+void mem_stats_log(int cpu, unsigned int page, const void *handler, int is_write)
+{
+  struct mst_page *p = &mst_pages[cpu][page & (MST_PAGES-1)];
+  int i;
+
+  if (is_write)
+    p->writes[handler != NULL]++;
+  else
+    p->reads[handler != NULL]++;
+  if (handler == NULL)
+    return;
+
+  if (p->handler != handler) {
+    p->handler = handler;
+    p->handlers++;
+  }
+
+  // open addressing, on cpu and handler pointer (both SH2s share handlers)
+  i = (((uptr)handler >> 2) + cpu) * 0x9e3779b1u % MST_HANDLERS;
+  while (mst_handlers[i].func != NULL &&
+         (mst_handlers[i].func != handler || mst_handlers[i].cpu != cpu))
+    i = (i + 1) % MST_HANDLERS;
+  mst_handlers[i].func = handler;
+  mst_handlers[i].cpu = cpu;
+  mst_handlers[i].count++;
+}
+
+static unsigned int mst_page_total(const struct mst_page *p)
+{
+  return p->reads[0] + p->reads[1] + p->writes[0] + p->writes[1];
+}
+
+static const struct mst_page *mst_sort_base;
+
+static int mst_page_cmp(const void *p1, const void *p2)
+{
+  unsigned int t1 = mst_page_total(&mst_sort_base[*(const int *)p1]);
+  unsigned int t2 = mst_page_total(&mst_sort_base[*(const int *)p2]);
+  return t1 < t2 ? 1 : t1 > t2 ? -1 : 0;
+}
+
+static int mst_handler_cmp(const void *p1, const void *p2)
+{
+  const struct mst_handler *h1 = p1, *h2 = p2;
+  return h1->count < h2->count ? 1 : h1->count > h2->count ? -1 : 0;
+}
+
+void mem_stats_dump(void)
+{
+  static const char *cpu_names[MST_CPU_CNT] =
+    { "m68k", "s68k", "z80", "msh2", "ssh2" };
+  // page address shift for each cpu
+  static const int shifts[MST_CPU_CNT] = { 16, 16, 13, 25, 25 };
+  int order[MST_PAGES];
+  int c, i, n;
+
+  qsort(mst_handlers, MST_HANDLERS, sizeof(mst_handlers[0]), mst_handler_cmp);
+
+  printf("memory access stats, %u frames:\n", mst_frames);
+  for (c = 0; c < MST_CPU_CNT; c++) {
+    unsigned int total = 0;
+
+    for (i = 0; i < MST_PAGES; i++) {
+      order[i] = i;
+      total += mst_page_total(&mst_pages[c][i]);
+    }
+    if (total == 0)
+      continue;
+    mst_sort_base = mst_pages[c];
+    qsort(order, MST_PAGES, sizeof(order[0]), mst_page_cmp);
+
+    printf("%s: %u accesses\n", cpu_names[c], total);
+    printf("  page     %%    rd direct  rd handler   wr direct  wr handler\n");
+    for (n = 0; n < 16; n++) {
+      const struct mst_page *p = &mst_pages[c][order[n]];
+      unsigned int t = mst_page_total(p);
+      if (t == 0)
+        break;
+      printf("  %08x %3u %11u %11u %11u %11u", order[n] << shifts[c],
+        (unsigned int)((unsigned long long)t * 100 / total),
+        p->reads[0], p->reads[1], p->writes[0], p->writes[1]);
+      // a frequently read page always served by the same handler may be
+      // mappable directly
+      if (p->handlers == 1 && p->reads[1] >= total / 16)
+        printf("  hot handler %p", p->handler);
+      printf("\n");
+    }
+
+    printf("  handler            calls\n");
+    for (i = n = 0; i < MST_HANDLERS && n < 8 && mst_handlers[i].count; i++) {
+      if (mst_handlers[i].cpu != c)
+        continue;
+      printf("  %p %11u\n", mst_handlers[i].func, mst_handlers[i].count);
+      n++;
+    }
+  }
+  printf("\n");
+
+  memset(mst_pages, 0, sizeof(mst_pages));
+  memset(mst_handlers, 0, sizeof(mst_handlers));
+  mst_frames = 0;
+}
+
+void mem_stats_frame(void)
+{
+  mst_frames++;
+#ifdef MEM_STATS_PERIOD
+  if (mst_frames >= MEM_STATS_PERIOD)
+    mem_stats_dump();
+#endif
+}
+#endif
+
+#ifdef PC_PROF
+#ifndef NO_32X
+#include "../cpu/sh2/compiler.h"
+#endif
+#ifndef PC_PROF_RATE
+#define PC_PROF_RATE 1
+#endif
+#ifndef PC_PROF_TOP
+#define PC_PROF_TOP 20
+#endif
+#define PCP_HASH 0x4000
+
+static struct pcp_ent {
+  unsigned int pc;
+  unsigned int count;
+} pcp_hist[PCP_CPU_CNT][PCP_HASH];
+
+static unsigned int pcp_samples[PCP_CPU_CNT];
+static unsigned int pcp_other[PCP_CPU_CNT]; // samples not fitting in the hash
+static unsigned int pcp_used[PCP_CPU_CNT];
+static int pcp_countdown;
+static int pcp_run_cycles[PCP_CPU_CNT]; // m68k cycles run since last sample
+
+static void pcp_add(int cpu, unsigned int pc)
+{
+  struct pcp_ent *h = pcp_hist[cpu];
+  int i = (pc * 0x9e3779b1u) >> 18;
+
+  pcp_samples[cpu]++;
+  // open addressing, pc 0 can't be told from an empty slot but that hardly
+  // matters for a profile
+  while (h[i].count != 0 && h[i].pc != pc)
+    i = (i + 1) & (PCP_HASH - 1);
+  if (h[i].count == 0) {
+    if (pcp_used[cpu] >= PCP_HASH * 3 / 4) {
+      pcp_other[cpu]++;
+      return;
+    }
+    pcp_used[cpu]++;
+    h[i].pc = pc;
+  }
+  h[i].count++;
+}
+
+// sample the PCs of the CPUs running in line order, every PC_PROF_RATE
+// scanlines
+void pc_prof_line(void)
+{
+  if (--pcp_countdown > 0)
+    return;
+  pcp_countdown = PC_PROF_RATE;
+
+  if (PicoIn.AHW & PAHW_SMS) {
+    pcp_add(PCP_Z80, z80_pc());
+    return;
+  }
+
+  pcp_add(PCP_M68K, SekPc & 0xffffff);
+  if (PicoIn.AHW & PAHW_MCD)
+    pcp_add(PCP_S68K, SekPcS68k & 0xffffff);
+}
+
+// the MD z80 and the SH2s are synced lazily, their PCs at a line boundary
+// are wherever their last slice stopped. Sample them at the end of each
+// slice they ran instead, once per PC_PROF_RATE lines worth of cycles.
+void pc_prof_run(int cpu, unsigned int pc, int m68k_cycles)
+{
+  pcp_run_cycles[cpu] += m68k_cycles;
+  while (pcp_run_cycles[cpu] >= PC_PROF_RATE * 488) {
+    pcp_run_cycles[cpu] -= PC_PROF_RATE * 488;
+    pcp_add(cpu, pc);
+  }
+}
+
+static int pcp_cmp(const void *p1, const void *p2)
+{
+  const struct pcp_ent *e1 = p1, *e2 = p2;
+  return e1->count < e2->count ? 1 : e1->count > e2->count ? -1 : 0;
+}
+
+void pc_prof_dump(void)
+{
+  static const char *cpu_names[PCP_CPU_CNT] =
+    { "m68k", "s68k", "z80", "msh2", "ssh2" };
+  int c, i;
+
+  printf("PC profile, 1 sample per %d lines:\n", PC_PROF_RATE);
+  for (c = 0; c < PCP_CPU_CNT; c++) {
+    struct pcp_ent *h = pcp_hist[c];
+    unsigned int total = pcp_samples[c];
+
+    if (total == 0)
+      continue;
+    qsort(h, PCP_HASH, sizeof(h[0]), pcp_cmp);
+
+    printf("%s: %u samples, %u distinct PCs", cpu_names[c], total, pcp_used[c]);
+    if (pcp_other[c])
+      printf(", %u samples dropped (table full)", pcp_other[c]);
+    printf("\n");
+    for (i = 0; i < PC_PROF_TOP && h[i].count != 0; i++) {
+      printf("  %08x %5.2f%% %10u", h[i].pc, h[i].count * 100.0 / total,
+        h[i].count);
+#ifndef NO_32X
+      // which translated block the PC is in, as far as it's still cached
+      if ((c == PCP_MSH2 || c == PCP_SSH2) && (PicoIn.opt & POPT_EN_DRC)) {
+        unsigned int start, end;
+        int ret = sh2_drc_find_block(h[i].pc, c == PCP_SSH2, &start, &end);
+        if (ret)
+          printf("  block %08x-%08x%s", start, end, ret == 2 ? " entry" : "");
+      }
+#endif
+      printf("\n");
+    }
+  }
+  printf("\n");
+
+  memset(pcp_hist, 0, sizeof(pcp_hist));
+  memset(pcp_samples, 0, sizeof(pcp_samples));
+  memset(pcp_other, 0, sizeof(pcp_other));
+  memset(pcp_used, 0, sizeof(pcp_used));
+}
+#endif
+
+#ifdef STARTUP_PROF
+#include <time.h>
+
+#define STP_MAX_PHASES 16
+
+static struct {
+  const char *name;
+  unsigned int us;
+} stp_phases[STP_MAX_PHASES];
+static int stp_count, stp_active;
+static unsigned long long stp_t0, stp_last;
+
+static unsigned long long stp_now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static void stp_close_phase(unsigned long long now)
+{
+  if (stp_count > 0)
+    stp_phases[stp_count - 1].us = now - stp_last;
+  stp_last = now;
+}
+
+// start a session, unless one is already running
+void startup_prof_begin(void)
+{
+  if (stp_active)
+    return;
+  stp_active = 1;
+  stp_count = 0;
+  stp_t0 = stp_last = stp_now();
+}
+
+// end the running phase and start a new one
+void startup_prof_phase(const char *name)
+{
+  unsigned long long now;
+
+  if (!stp_active)
+    return;
+  now = stp_now();
+  stp_close_phase(now);
+  if (stp_count < STP_MAX_PHASES) {
+    stp_phases[stp_count].name = name;
+    stp_phases[stp_count++].us = 0;
+  }
+}
+
+// report the session under 'title', or just drop it if title is NULL
+void startup_prof_end(const char *title)
+{
+  unsigned long long now;
+  int i;
+
+  if (!stp_active)
+    return;
+  stp_active = 0;
+  if (title == NULL)
+    return;
+
+  now = stp_now();
+  stp_close_phase(now);
+  printf("startup %s: %.3f ms total\n", title, (now - stp_t0) / 1000.0);
+  for (i = 0; i < stp_count; i++)
+    printf("  %-14s %9.3f ms\n", stp_phases[i].name, stp_phases[i].us / 1000.0);
+}
+
+// called after each frame, finishes a media load session at the first one
+void startup_prof_frame(void)
+{
+  const char *media = "MD";
+
+  if (!stp_active)
+    return;
+  if ((PicoIn.AHW & (PAHW_MCD|PAHW_32X)) == (PAHW_MCD|PAHW_32X))
+    media = "CD+32X";
+  else if (PicoIn.AHW & PAHW_32X)
+    media = "32X";
+  else if (PicoIn.AHW & PAHW_MCD)
+    media = "CD";
+  else if (PicoIn.AHW & PAHW_SVP)
+    media = "SVP";
+  else if (PicoIn.AHW & PAHW_SMS)
+    media = "SMS";
+  else if (PicoIn.AHW & PAHW_PICO)
+    media = "Pico";
+
+  startup_prof_end(media);
+}
+#endif
+
 #if defined(CPU_CMP_R) || defined(CPU_CMP_W) || defined(DRC_CMP)
 static FILE *tl_f;
 
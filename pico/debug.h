@@ -15,6 +15,8 @@ enum ctl_byte {
   CTL_68K_PC = 0x04,
   CTL_68K_SR = 0x05,
   CTL_68K_CYCLES = 0x06,
+  CTL_68K_WRCOUNT = 0x07,
+  CTL_68K_WRHASH = 0x08,
   CTL_68K_R = 0x10, // .. 0x20
   CTL_MASTERSLAVE = 0x80,
   CTL_EA = 0x82,
@@ -1790,6 +1790,15 @@ PICO_INTERNAL void PicoFrameStart(void)
   int dirty = ((Pico.est.rendstatus & PDRAW_SONIC_MODE) || Pico.m.dirtyPal);
   int sprep = Pico.est.rendstatus & (PDRAW_SPRITES_MOVED|PDRAW_DIRTY_SPRITES);
 
+  if (PicoIn.skipFrame) {
+    // nothing is drawn. Keep sprite parsing pending for the next drawn frame,
+    // mode changes and palette backups are handled when drawing resumes
+    sprep |= Pico.est.rendstatus & PDRAW_PARSE_SPRITES;
+    Pico.est.rendstatus = (sprep ? PDRAW_DIRTY_SPRITES : 0);
+    Pico.est.DrawScanline = 0;
+    return;
+  }
+
   // prepare to do this frame
   Pico.est.rendstatus = 0;
   if ((Pico.video.reg[12] & 6) == 6)
@@ -205,6 +205,8 @@ enum media_type_e PicoLoadMedia(const char *filename,
   int cd_region = 0;
   int ret;
 
+  startup_prof_begin();
+  startup_prof_phase("detect");
   media_type = detect_media(filename);
   if (media_type == PM_BAD_DETECT)
     goto out;
@@ -242,6 +244,7 @@ enum media_type_e PicoLoadMedia(const char *filename,
     PicoIn.AHW = PAHW_SMS;
   }
 
+  startup_prof_phase("rom read");
   rom = pm_open(rom_fname);
   if (rom == NULL) {
     lprintf("Failed to open ROM\n");
@@ -291,6 +294,7 @@ enum media_type_e PicoLoadMedia(const char *filename,
 
   // insert CD if it was detected
   if (cd_img_type != CIT_NOT_CD) {
+    startup_prof_phase("cd insert");
     ret = cdd_load(filename, cd_img_type);
     if (ret != 0) {
       PicoCartUnload();
@@ -306,6 +310,8 @@ enum media_type_e PicoLoadMedia(const char *filename,
 out:
   if (rom_data)
     free(rom_data);
+  if (media_type < 0)
+    startup_prof_end(NULL);
   return media_type;
 }
 
@@ -946,9 +946,7 @@ static int ym2612_write_local(u32 a, u32 d, int is_from_z80)
   {
     int cycles = is_from_z80 ? z80_cyclesDone() : z80_cycles_from_68k();
     //elprintf(EL_STATUS, "%03i dac w %08x z80 %i", cycles, d, is_from_z80);
-    if (ym2612.dacen)
-      PsndDoDAC(cycles);
-    ym2612.dacout = ((int)d - 0x80) << 6;
+    PsndFMWrite(cycles, 0x2a, d);
     return 0;
   }
 
@@ -1009,6 +1007,13 @@ static int ym2612_write_local(u32 a, u32 d, int is_from_z80)
           int old_mode = ym2612.OPN.ST.mode;
           int cycles = is_from_z80 ? z80_cyclesDone() : z80_cycles_from_68k();
 
+          // render with the old mode up to now
+          if ((d ^ old_mode) & 0xc0) {
+#ifdef __GP2X__
+            if (!(PicoIn.opt & POPT_EXT_FM))
+#endif
+            PsndDoFM(cycles);
+          }
           ym2612.OPN.ST.mode = d;
 
           elprintf(EL_YMTIMER, "st mode %02x", d);
@@ -1026,16 +1031,19 @@ static int ym2612_write_local(u32 a, u32 d, int is_from_z80)
 #ifdef __GP2X__
             if (PicoIn.opt & POPT_EXT_FM) return YM2612Write_940(a, d, get_scanline(is_from_z80));
 #endif
-            PsndDoFM(cycles);
             return 1;
           }
           return 0;
         }
         case 0x2b: { /* DAC Sel  (YM2612) */
-          ym2612.dacen = d & 0x80;
 #ifdef __GP2X__
-          if (PicoIn.opt & POPT_EXT_FM) YM2612Write_940(a, d, get_scanline(is_from_z80));
+          if (PicoIn.opt & POPT_EXT_FM) {
+            ym2612.dacen = d & 0x80;
+            YM2612Write_940(a, d, get_scanline(is_from_z80));
+            return 0;
+          }
 #endif
+          PsndFMWrite(is_from_z80 ? z80_cyclesDone() : z80_cycles_from_68k(), addr, d);
           return 0;
         }
       }
@@ -1062,8 +1070,8 @@ static int ym2612_write_local(u32 a, u32 d, int is_from_z80)
   if (PicoIn.opt & POPT_EXT_FM)
     return YM2612Write_940(a, d, get_scanline(is_from_z80));
 #endif
-  PsndDoFM(is_from_z80 ? z80_cyclesDone() : z80_cycles_from_68k());
-  return YM2612Write_(a, d);
+  PsndFMWrite(is_from_z80 ? z80_cyclesDone() : z80_cycles_from_68k(), addr, d);
+  return 0;
 }
 
 
@@ -1146,6 +1154,8 @@ void ym2612_unpack_state(void)
     ym2612_write_local(2, i, 0);
     ym2612_write_local(3, ym2612.REGS[i|0x100], 0);
   }
+  // apply the queued writes before restoring the chip internals
+  PsndDoFM(z80_cycles_from_68k());
 
 #ifdef __GP2X__
   if (PicoIn.opt & POPT_EXT_FM)
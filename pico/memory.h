@@ -54,12 +54,22 @@ void m68k_map_unmap(int start_addr, int end_addr);
 #define MAP_FLAG ((uptr)1 << (sizeof(uptr) * 8 - 1))
 #define map_flag_set(x) ((x) & MAP_FLAG)
 
+// memory access stats, per map page
+#define mem_stats_is_s68k(m)                    \
+  ((m) == s68k_read8_map || (m) == s68k_read16_map || \
+   (m) == s68k_write8_map || (m) == s68k_write16_map)
+#define mem_stats_68k(map, a, v, is_write)      \
+  mem_stats_log(mem_stats_is_s68k((const uptr *)(map)) ? MST_S68K : MST_M68K, \
+    (a) >> M68K_MEM_SHIFT, map_flag_set(v) ? (void *)((v) << 1) : NULL, \
+    is_write)
+
 #define MAKE_68K_READ8(name, map)               \
 u32 name(u32 a)                                 \
 {                                               \
   uptr v;                                       \
   a &= 0x00ffffff;                              \
   v = map[a >> M68K_MEM_SHIFT];                 \
+  mem_stats_68k(map, a, v, 0);                  \
   if (map_flag_set(v))                          \
     return ((cpu68k_read_f *)(v << 1))(a);      \
   else                                          \
@@ -72,6 +82,7 @@ u32 name(u32 a)                                 \
   uptr v;                                       \
   a &= 0x00fffffe;                              \
   v = map[a >> M68K_MEM_SHIFT];                 \
+  mem_stats_68k(map, a, v, 0);                  \
   if (map_flag_set(v))                          \
     return ((cpu68k_read_f *)(v << 1))(a);      \
   else                                          \
@@ -85,6 +96,7 @@ u32 name(u32 a)                                 \
   u32 d;                                        \
   a &= 0x00fffffe;                              \
   v = map[a >> M68K_MEM_SHIFT];                 \
+  mem_stats_68k(map, a, v, 0);                  \
   vs = v << 1;                                  \
   if (map_flag_set(v)) {                        \
     d  = ((cpu68k_read_f *)vs)(a) << 16;        \
@@ -102,7 +114,9 @@ void name(u32 a, u8 d)                          \
 {                                               \
   uptr v;                                       \
   a &= 0x00ffffff;                              \
+  SekTraceWrite(a, d, 1);                       \
   v = map[a >> M68K_MEM_SHIFT];                 \
+  mem_stats_68k(map, a, v, 1);                  \
   if (map_flag_set(v))                          \
     ((cpu68k_write_f *)(v << 1))(a, d);         \
   else                                          \
@@ -114,7 +128,9 @@ void name(u32 a, u16 d)                         \
 {                                               \
   uptr v;                                       \
   a &= 0x00fffffe;                              \
+  SekTraceWrite(a, d, 2);                       \
   v = map[a >> M68K_MEM_SHIFT];                 \
+  mem_stats_68k(map, a, v, 1);                  \
   if (map_flag_set(v))                          \
     ((cpu68k_write_f *)(v << 1))(a, d);         \
   else                                          \
@@ -126,7 +142,10 @@ void name(u32 a, u32 d)                         \
 {                                               \
   uptr v, vs;                                   \
   a &= 0x00fffffe;                              \
+  SekTraceWrite(a, d >> 16, 2);                 \
+  SekTraceWrite(a + 2, d & 0xffff, 2);          \
   v = map[a >> M68K_MEM_SHIFT];                 \
+  mem_stats_68k(map, a, v, 1);                  \
   vs = v << 1;                                  \
   if (map_flag_set(v)) {                        \
     ((cpu68k_write_f *)vs)(a, d >> 16);         \
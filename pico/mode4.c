@@ -18,6 +18,7 @@
 static void (*FinalizeLineM4)(int line);
 static int skip_next_line;
 static int screen_offset, line_offset;
+static int sprite_status_line;
 
 static void TileBGM4(int sx, int pal)
 {
@@ -25,84 +26,72 @@ static void TileBGM4(int sx, int pal)
   pd[0] = pd[1] = pal ? 0x10101010 : 0;
 }
 
-#define PLANAR_PIXELL(x,p) \
-  t = pack & (0x80808080 >> p); \
-  t = ((t >> (7-p)) | (t >> (14-p)) | (t >> (21-p)) | (t >> (28-p))) & 0x0f; \
-  pd[x] = pal|t;
+// planar to chunky conversion table: one bitplane byte to 8 pixels with the
+// plane bit in bit 0, in memory order, normal and h-flipped. 4 pixels fit
+// a word, so all 8 pixels of a tile row are converted with 4 lookups+ORs.
+static u32 planar_lut[2][256][2];
 
-static void TileNormM4Low(int sx, unsigned int pack, int pal)
+static void planar_lut_init(void)
 {
-  unsigned char *pd = Pico.est.HighCol + sx;
-  unsigned int t;
-
-  PLANAR_PIXELL(0, 0)
-  PLANAR_PIXELL(1, 1)
-  PLANAR_PIXELL(2, 2)
-  PLANAR_PIXELL(3, 3)
-  PLANAR_PIXELL(4, 4)
-  PLANAR_PIXELL(5, 5)
-  PLANAR_PIXELL(6, 6)
-  PLANAR_PIXELL(7, 7)
+  u8 px[8];
+  int b, x;
+
+  for (b = 0; b < 256; b++) {
+    for (x = 0; x < 8; x++)
+      px[x] = (b >> (7-x)) & 1;
+    memcpy(planar_lut[0][b], px, sizeof(px));
+    for (x = 0; x < 8; x++)
+      px[x] = (b >> x) & 1;
+    memcpy(planar_lut[1][b], px, sizeof(px));
+  }
 }
 
-static void TileFlipM4Low(int sx, unsigned int pack, int pal)
-{
-  unsigned char *pd = Pico.est.HighCol + sx;
-  unsigned int t;
-
-  PLANAR_PIXELL(0, 7)
-  PLANAR_PIXELL(1, 6)
-  PLANAR_PIXELL(2, 5)
-  PLANAR_PIXELL(3, 4)
-  PLANAR_PIXELL(4, 3)
-  PLANAR_PIXELL(5, 2)
-  PLANAR_PIXELL(6, 1)
-  PLANAR_PIXELL(7, 0)
+// byte n of pack holds bitplane n (pixel bit n)
+#define PLANAR_TO_CHUNKY(px, pack, flip) { \
+  const u32 (*lut)[2] = planar_lut[flip]; \
+  const u32 *p0 = lut[pack & 0xff], *p1 = lut[(pack >> 8) & 0xff]; \
+  const u32 *p2 = lut[(pack >> 16) & 0xff], *p3 = lut[pack >> 24]; \
+  px[0] = p0[0] | (p1[0] << 1) | (p2[0] << 2) | (p3[0] << 3); \
+  px[1] = p0[1] | (p1[1] << 1) | (p2[1] << 2) | (p3[1] << 3); \
 }
 
-#define PLANAR_PIXEL(x,p) \
-  t = pack & (0x80808080 >> p); \
-  if (t) { \
-    t = ((t >> (7-p)) | (t >> (14-p)) | (t >> (21-p)) | (t >> (28-p))) & 0x0f; \
-    pd[x] = pal|t; \
-  }
-
-static void TileNormM4(int sx, unsigned int pack, int pal)
+static void TileM4Low(int sx, unsigned int pack, int pal, int flip)
 {
   unsigned char *pd = Pico.est.HighCol + sx;
-  unsigned int t;
+  u32 px[2];
 
-  PLANAR_PIXEL(0, 0)
-  PLANAR_PIXEL(1, 1)
-  PLANAR_PIXEL(2, 2)
-  PLANAR_PIXEL(3, 3)
-  PLANAR_PIXEL(4, 4)
-  PLANAR_PIXEL(5, 5)
-  PLANAR_PIXEL(6, 6)
-  PLANAR_PIXEL(7, 7)
+  PLANAR_TO_CHUNKY(px, pack, flip);
+  px[0] |= pal * 0x01010101;
+  px[1] |= pal * 0x01010101;
+  memcpy(pd, px, sizeof(px));
 }
 
-static void TileFlipM4(int sx, unsigned int pack, int pal)
+// pixel 0 is transparent: merge through a mask of the non-zero pixels
+static void TileM4(int sx, unsigned int pack, int pal, int flip)
 {
   unsigned char *pd = Pico.est.HighCol + sx;
-  unsigned int t;
+  u32 px[2], d[2], m;
+  int i;
 
-  PLANAR_PIXEL(0, 7)
-  PLANAR_PIXEL(1, 6)
-  PLANAR_PIXEL(2, 5)
-  PLANAR_PIXEL(3, 4)
-  PLANAR_PIXEL(4, 3)
-  PLANAR_PIXEL(5, 2)
-  PLANAR_PIXEL(6, 1)
-  PLANAR_PIXEL(7, 0)
+  PLANAR_TO_CHUNKY(px, pack, flip);
+  memcpy(d, pd, sizeof(d));
+  for (i = 0; i < 2; i++) {
+    m = ((px[i] + 0x7f7f7f7f) & 0x80808080) >> 7; // pixels are < 0x10
+    m *= 0xff;
+    d[i] = (d[i] & ~m) | ((px[i] | pal * 0x01010101) & m);
+  }
+  memcpy(pd, d, sizeof(d));
 }
 
-static void draw_sprites(int scanline)
+#define TileNormM4Low(sx, pack, pal) TileM4Low(sx, pack, pal, 0)
+#define TileFlipM4Low(sx, pack, pal) TileM4Low(sx, pack, pal, 1)
+#define TileNormM4(sx, pack, pal)    TileM4(sx, pack, pal, 0)
+#define TileFlipM4(sx, pack, pal)    TileM4(sx, pack, pal, 1)
+
+// find sprites on a line and update the status register collision/overflow bits
+static int find_sprites(int scanline, unsigned int *sprites_addr, unsigned int *sprites_x)
 {
   struct PicoVideo *pv = &Pico.video;
-  unsigned int sprites_addr[8];
-  unsigned int sprites_x[8];
-  unsigned int pack;
   unsigned char *sat;
   int xoff = 8; // relative to HighCol, which is (screen - 8)
   int sprite_base, addr_mask;
@@ -143,6 +132,18 @@ static void draw_sprites(int scanline)
   if (s > 1)
     pv->status |= SR_C;
 
+  return s;
+}
+
+static void draw_sprites(int scanline)
+{
+  unsigned int sprites_addr[8];
+  unsigned int sprites_x[8];
+  unsigned int pack;
+  int s;
+
+  s = find_sprites(scanline, sprites_addr, sprites_x);
+
   // now draw all sprites backwards
   for (--s; s >= 0; s--) {
     pack = *(unsigned int *)(PicoMem.vram + sprites_addr[s]);
@@ -150,6 +151,28 @@ static void draw_sprites(int scanline)
   }
 }
 
+// in skipped frames nothing is drawn, but the status register must still see
+// sprite collision/overflow. evaluate sprites of lines up to 'to' on demand.
+void PicoSpriteStatusMode4(int to)
+{
+  struct PicoVideo *pv = &Pico.video;
+  unsigned int sprites_addr[8];
+  unsigned int sprites_x[8];
+
+  if (to > 192)
+    to = 192;
+  if (!(pv->reg[1] & 0x40)) {
+    sprite_status_line = to; // display disabled, no sprite processing
+    return;
+  }
+
+  for (; sprite_status_line < to; sprite_status_line++) {
+    if ((pv->status & (SR_SOVR|SR_C)) == (SR_SOVR|SR_C))
+      break; // nothing more to find
+    find_sprites(sprite_status_line, sprites_addr, sprites_x);
+  }
+  sprite_status_line = to;
+}
 
 // tilex_ty_prio merged to reduce register pressure
 static void draw_strip_low(const unsigned short *nametab, int dx, int cells, int tilex_ty_prio)
@@ -275,7 +298,11 @@ static void DrawDisplayM4(int scanline)
 void PicoFrameStartMode4(void)
 {
   int lines = 192;
+
+  if (planar_lut[0][1][1] == 0)
+    planar_lut_init();
   skip_next_line = 0;
+  sprite_status_line = 0;
   screen_offset = 24;
   Pico.est.rendstatus = PDRAW_32_COLS;
 
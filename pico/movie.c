@@ -0,0 +1,428 @@
+/*
+ * PicoDrive
+ * input movie recording and replay
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ *
+ * A movie consists of a header, the savestate the recording was started
+ * from, and a stream of records. There's one record per frame with the pad
+ * state and, if enabled, hashes of the video output, sound output and RAM
+ * at the end of that frame. Resets and disc changes are stored as event
+ * records in front of the frame they happened before.
+ * All numbers are stored little endian.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico_int.h"
+#include "state.h"
+#include "sound/mix.h"
+
+#define PMOV_MAGIC    "PMOV"
+#define PMOV_VERSION  1
+
+enum { PMOV_REC_FRAME, PMOV_REC_RESET, PMOV_REC_DISC };
+enum { PMOV_IDLE, PMOV_RECORD, PMOV_PLAY };
+
+int pmov_active;
+
+static struct {
+  FILE *f;
+  int mode;                     // PMOV_IDLE, PMOV_RECORD or PMOV_PLAY
+  int flags;                    // PMOV_HASH_*
+  unsigned int frame;           // frames since movie start
+  unsigned int mismatches;
+  unsigned int first_mismatch;
+  unsigned short pad[2];        // pad state of the current frame
+  unsigned short skip_frame;    // frontend's PicoIn.skipFrame
+  u32 snd_hash;                 // sound output of the current frame
+  u32 hashes[3];                // expected hashes of the current frame
+} pmov;
+
+static const char * const hash_names[3] = { "video", "sound", "RAM" };
+
+static void put_le(u8 *b, u32 v, int len)
+{
+  for (; len > 0; len--, v >>= 8)
+    *b++ = v;
+}
+
+static u32 get_le(const u8 *b, int len)
+{
+  u32 v = 0;
+  for (b += len; len > 0; len--)
+    v = (v << 8) | *--b;
+  return v;
+}
+
+// FNV-1a, a word at a time
+static u32 pmov_hash(u32 h, const void *data, int len)
+{
+  const u32 *w = data;
+  const u8 *b;
+
+  for (; len >= 4; len -= 4)
+    h = (h ^ *w++) * 0x01000193;
+  for (b = (const u8 *)w; len > 0; len--)
+    h = (h ^ *b++) * 0x01000193;
+  return h;
+}
+
+// the sound output depends on render positions and filter state which
+// aren't in the savestate, start recording and replay from the same point
+static void pmov_reset_sound(void)
+{
+  PsndRerate(1);
+  mix_reset();
+}
+
+static int frame_rec_size(void)
+{
+  int i, size = 5;
+  for (i = 0; i < 3; i++)
+    if (pmov.flags & (1 << i))
+      size += 4;
+  return size;
+}
+
+// memory reader for loading the embedded savestate
+struct mem_file {
+  const u8 *data;
+  size_t size, pos;
+};
+
+static size_t mem_read(void *p, size_t _size, size_t _n, void *file)
+{
+  struct mem_file *m = file;
+  size_t len = _size * _n;
+
+  if (len > m->size - m->pos)
+    len = m->size - m->pos;
+  memcpy(p, m->data + m->pos, len);
+  m->pos += len;
+  return len;
+}
+
+static size_t mem_eof(void *file)
+{
+  struct mem_file *m = file;
+  return m->pos >= m->size;
+}
+
+static int mem_seek(void *file, long offset, int whence)
+{
+  struct mem_file *m = file;
+
+  switch (whence) {
+    case SEEK_SET: m->pos = offset; break;
+    case SEEK_CUR: m->pos += offset; break;
+    case SEEK_END: m->pos = m->size + offset; break;
+  }
+  if (m->pos > m->size)
+    m->pos = m->size;
+  return 0;
+}
+
+int PicoMovieRecord(const char *fname, int hash_flags)
+{
+  u8 hdr[16];
+  long start, end;
+
+  if (Pico.romsize <= 0)
+    return -1;
+  PicoMovieStop();
+
+  pmov.f = fopen(fname, "wb");
+  if (pmov.f == NULL) {
+    elprintf(EL_STATUS, "movie: can't create %s", fname);
+    return -1;
+  }
+
+  memcpy(hdr, PMOV_MAGIC, 4);
+  put_le(hdr + 4, PMOV_VERSION, 4);
+  put_le(hdr + 8, hash_flags & PMOV_HASH_ALL, 4);
+  put_le(hdr + 12, 0, 4); // state size, filled in below
+  fwrite(hdr, 1, sizeof(hdr), pmov.f);
+
+  start = ftell(pmov.f);
+  if (PicoStateFP(pmov.f, 1, NULL, (arearw *) fwrite, NULL,
+      (areaseek *) fseek) != 0)
+    goto fail;
+  end = ftell(pmov.f);
+  put_le(hdr + 12, end - start, 4);
+  if (fseek(pmov.f, 12, SEEK_SET) != 0 || fwrite(hdr + 12, 1, 4, pmov.f) != 4
+      || fseek(pmov.f, end, SEEK_SET) != 0)
+    goto fail;
+
+  pmov_reset_sound();
+  pmov.flags = hash_flags & PMOV_HASH_ALL;
+  pmov.frame = pmov.mismatches = 0;
+  pmov.mode = PMOV_RECORD;
+  pmov_active = 1;
+  elprintf(EL_STATUS, "movie: recording to %s", fname);
+  return 0;
+
+fail:
+  elprintf(EL_STATUS, "movie: failed to write %s", fname);
+  fclose(pmov.f);
+  pmov.f = NULL;
+  return -1;
+}
+
+int PicoMoviePlay(const char *fname)
+{
+  struct mem_file m = { NULL, 0, 0 };
+  u8 hdr[16];
+  u8 *state = NULL;
+  int ret;
+
+  if (Pico.romsize <= 0)
+    return -1;
+  PicoMovieStop();
+
+  pmov.f = fopen(fname, "rb");
+  if (pmov.f == NULL) {
+    elprintf(EL_STATUS, "movie: can't open %s", fname);
+    return -1;
+  }
+
+  if (fread(hdr, 1, sizeof(hdr), pmov.f) != sizeof(hdr)
+      || memcmp(hdr, PMOV_MAGIC, 4) != 0) {
+    elprintf(EL_STATUS, "movie: %s is not a movie", fname);
+    goto fail;
+  }
+  if (get_le(hdr + 4, 4) != PMOV_VERSION) {
+    elprintf(EL_STATUS, "movie: unsupported version %u", get_le(hdr + 4, 4));
+    goto fail;
+  }
+
+  m.size = get_le(hdr + 12, 4);
+  state = malloc(m.size);
+  if (state == NULL || fread(state, 1, m.size, pmov.f) != m.size) {
+    elprintf(EL_STATUS, "movie: failed to read the savestate");
+    goto fail;
+  }
+  m.data = state;
+  ret = PicoStateFP(&m, 0, mem_read, NULL, mem_eof, mem_seek);
+  free(state);
+  state = NULL;
+  if (ret != 0) {
+    elprintf(EL_STATUS, "movie: failed to load the savestate");
+    goto fail;
+  }
+
+  pmov_reset_sound();
+  pmov.flags = get_le(hdr + 8, 4) & PMOV_HASH_ALL;
+  pmov.frame = pmov.mismatches = 0;
+  pmov.mode = PMOV_PLAY;
+  pmov_active = 1;
+  elprintf(EL_STATUS, "movie: playing %s", fname);
+  return 0;
+
+fail:
+  free(state);
+  fclose(pmov.f);
+  pmov.f = NULL;
+  return -1;
+}
+
+// returns the number of frames with hash mismatches
+int PicoMovieStop(void)
+{
+  if (pmov.mode == PMOV_IDLE)
+    return 0;
+
+  if (pmov.mode == PMOV_PLAY) {
+    elprintf(EL_STATUS, "movie: %u frames played, %u mismatched",
+      pmov.frame, pmov.mismatches);
+    if (pmov.mismatches)
+      elprintf(EL_STATUS, "movie: first mismatch in frame %u",
+        pmov.first_mismatch);
+    if (PicoIn.osdMessage)
+      PicoIn.osdMessage(pmov.mismatches ? "Movie ended, MISMATCH"
+                                        : "Movie ended");
+  } else
+    elprintf(EL_STATUS, "movie: %u frames recorded", pmov.frame);
+
+  fclose(pmov.f);
+  pmov.f = NULL;
+  pmov.mode = PMOV_IDLE;
+  pmov_active = 0;
+  return pmov.mismatches;
+}
+
+// returns 1 while recording or playing
+int PicoMovieStatus(unsigned int *frame, unsigned int *mismatches)
+{
+  if (frame)
+    *frame = pmov.frame;
+  if (mismatches)
+    *mismatches = pmov.mismatches;
+  return pmov.mode != PMOV_IDLE;
+}
+
+static void pmov_write(const void *data, int len)
+{
+  if (fwrite(data, 1, len, pmov.f) != len) {
+    elprintf(EL_STATUS, "movie: write error, recording stopped");
+    PicoMovieStop();
+  }
+}
+
+// apply the events up to the next frame and load its record
+static void pmov_play_next(void)
+{
+  u8 rec[1+4+3*4];
+  char name[256];
+  int type, len;
+
+  while ((type = fgetc(pmov.f)) != EOF) {
+    switch (type) {
+      case PMOV_REC_FRAME:
+        len = frame_rec_size() - 1;
+        if (fread(rec, 1, len, pmov.f) != len)
+          goto end;
+        pmov.pad[0] = get_le(rec, 2);
+        pmov.pad[1] = get_le(rec + 2, 2);
+        for (type = 0, len = 4; type < 3; type++) {
+          if (pmov.flags & (1 << type)) {
+            pmov.hashes[type] = get_le(rec + len, 4);
+            len += 4;
+          }
+        }
+        PicoIn.pad[0] = pmov.pad[0];
+        PicoIn.pad[1] = pmov.pad[1];
+        return;
+
+      case PMOV_REC_RESET:
+        elprintf(EL_STATUS, "movie: reset before frame %u", pmov.frame);
+        PicoReset();
+        break;
+
+      case PMOV_REC_DISC:
+        if (fread(rec, 1, 3, pmov.f) != 3)
+          goto end;
+        len = get_le(rec + 1, 2);
+        if (len >= sizeof(name) || fread(name, 1, len, pmov.f) != len)
+          goto end;
+        name[len] = 0;
+        elprintf(EL_STATUS, "movie: disc change '%s' before frame %u",
+          name, pmov.frame);
+        if (len)
+          cdd_load(name, rec[0]);
+        else
+          cdd_unload();
+        break;
+
+      default:
+        elprintf(EL_STATUS, "movie: bad record %02x", type);
+        goto end;
+    }
+  }
+
+end:
+  PicoMovieStop();
+}
+
+void pmov_frame_start(void)
+{
+  if (pmov.mode == PMOV_PLAY)
+    pmov_play_next();
+  else {
+    pmov.pad[0] = PicoIn.pad[0];
+    pmov.pad[1] = PicoIn.pad[1];
+  }
+  pmov.snd_hash = 0x811c9dc5;
+  if (pmov.mode == PMOV_IDLE) // replay ended
+    return;
+
+  // frameskip depends on host timing, and skipped frames aren't drawn (and
+  // may have no sound), which would change the hashes and the sprite status
+  // bits. Draw every frame, the frontend still decides what it shows.
+  pmov.skip_frame = PicoIn.skipFrame;
+  PicoIn.skipFrame = 0;
+}
+
+void pmov_frame_end(void)
+{
+  u8 rec[1+4+3*4];
+  u32 hashes[3] = { 0, };
+  int i, len;
+
+  if (pmov.mode == PMOV_IDLE)
+    return;
+  PicoIn.skipFrame = pmov.skip_frame;
+
+  // the top 224 lines of the output buffer
+  if ((pmov.flags & PMOV_HASH_VIDEO) && DrawLineDestBase)
+    hashes[0] = pmov_hash(0x811c9dc5, DrawLineDestBase,
+                  224 * DrawLineDestIncrement);
+  hashes[1] = pmov.snd_hash;
+  if (pmov.flags & PMOV_HASH_RAM) {
+    hashes[2] = pmov_hash(0x811c9dc5, PicoMem.ram, sizeof(PicoMem.ram));
+    hashes[2] = pmov_hash(hashes[2], PicoMem.zram, sizeof(PicoMem.zram));
+  }
+
+  if (pmov.mode == PMOV_RECORD) {
+    rec[0] = PMOV_REC_FRAME;
+    put_le(rec + 1, pmov.pad[0], 2);
+    put_le(rec + 3, pmov.pad[1], 2);
+    for (i = 0, len = 5; i < 3; i++) {
+      if (pmov.flags & (1 << i)) {
+        put_le(rec + len, hashes[i], 4);
+        len += 4;
+      }
+    }
+    pmov.frame++;
+    pmov_write(rec, len);
+    return;
+  }
+
+  for (i = 0; i < 3; i++) {
+    if ((pmov.flags & (1 << i)) && pmov.hashes[i] != hashes[i]) {
+      elprintf(EL_STATUS, "movie: frame %u: %s hash %08x, expected %08x",
+        pmov.frame, hash_names[i], hashes[i], pmov.hashes[i]);
+      if (pmov.mismatches++ == 0)
+        pmov.first_mismatch = pmov.frame;
+      break;
+    }
+  }
+  pmov.frame++;
+}
+
+void pmov_sound(const void *buf, int len)
+{
+  if ((pmov.flags & PMOV_HASH_SOUND) && buf != NULL)
+    pmov.snd_hash = pmov_hash(pmov.snd_hash, buf, len);
+}
+
+void pmov_reset(void)
+{
+  u8 type = PMOV_REC_RESET;
+
+  if (pmov.mode == PMOV_RECORD)
+    pmov_write(&type, 1);
+}
+
+void pmov_disc(const char *fname, int type)
+{
+  u8 rec[4];
+  int len = fname ? strlen(fname) : 0;
+
+  if (pmov.mode != PMOV_RECORD)
+    return;
+  if (len >= 256) {
+    elprintf(EL_STATUS, "movie: disc name too long, not recorded");
+    return;
+  }
+  rec[0] = PMOV_REC_DISC;
+  rec[1] = type;
+  put_le(rec + 2, len, 2);
+  pmov_write(rec, 4);
+  if (len && pmov.f)
+    pmov_write(fname, len);
+}
+
+// vim:shiftwidth=2:ts=2:expandtab
@@ -38,7 +38,6 @@ void PicoInit(void)
   PicoInitMCD();
   PicoSVPInit();
   Pico32xInit();
-  PsndInit();
 
   PicoDrawInit();
   PicoDraw2Init();
@@ -57,6 +56,9 @@ void PicoExit(void)
   Pico.sv.data = NULL;
   Pico.sv.start = Pico.sv.end = 0;
   pevt_dump();
+  mem_stats_dump();
+  pc_prof_dump();
+  cpu_trace_stop();
 }
 
 void PicoPower(void)
@@ -158,6 +160,9 @@ int PicoReset(void)
   PicoIn.opt |= POPT_DIS_VDP_FIFO|POPT_DIS_IDLE_DET;
 #endif
 
+  if (pmov_active)
+    pmov_reset();
+
   /* must call now, so that banking is reset, and correct vectors get fetched */
   if (PicoResetHook)
     PicoResetHook();
@@ -243,8 +248,11 @@ PICO_INTERNAL void PicoSyncZ80(unsigned int m68k_cycles_done)
     Pico.t.z80c_cnt, Pico.t.z80c_cnt * 15 / 7 / 488,
     Pico.t.z80c_aim, Pico.t.z80c_aim * 15 / 7 / 488);
 
-  if (cnt > 0)
-    Pico.t.z80c_cnt += z80_run(cnt);
+  if (cnt > 0) {
+    cnt = z80_run(cnt);
+    Pico.t.z80c_cnt += cnt;
+    pc_prof_run(PCP_Z80, z80_pc(), cnt * 15 / 7);
+  }
 
   pprof_end(z80);
 }
@@ -254,6 +262,9 @@ void PicoFrame(void)
 {
   pprof_start(frame);
 
+  if (pmov_active)
+    pmov_frame_start();
+
   Pico.m.frame_count++;
 
   if (PicoIn.AHW & PAHW_SMS) {
@@ -277,6 +288,10 @@ void PicoFrame(void)
   PicoFrameHints();
 
 end:
+  if (pmov_active)
+    pmov_frame_end();
+  mem_stats_frame();
+  startup_prof_frame();
   pprof_end(frame);
 }
 
@@ -57,14 +57,14 @@ extern void *p32x_bios_g, *p32x_bios_m, *p32x_bios_s;
 #define POPT_EN_STEREO      (1<< 3)
 #define POPT_ALT_RENDERER   (1<< 4) // 00 00x0
 #define POPT_EN_YM2413      (1<< 5)
-// unused                   (1<< 6)
+#define POPT_EN_MCD_FASTCD  (1<< 6)
 #define POPT_ACC_SPRITES    (1<< 7)
 #define POPT_DIS_32C_BORDER (1<< 8) // 00 0x00
 #define POPT_EXT_FM         (1<< 9)
 #define POPT_EN_MCD_PCM     (1<<10)
 #define POPT_EN_MCD_CDDA    (1<<11)
 #define POPT_EN_MCD_GFX     (1<<12) // 00 x000
-// unused                   (1<<13)
+#define POPT_EN_FM_FILTER   (1<<13)
 #define POPT_EN_SOFTSCALE   (1<<14)
 #define POPT_EN_MCD_RAMCART (1<<15)
 #define POPT_DIS_VDP_FIFO   (1<<16) // 0x 0000
@@ -150,6 +150,16 @@ void *PicoTmpStateSave(void);
 void  PicoTmpStateRestore(void *data);
 extern void (*PicoStateProgressCB)(const char *str);
 
+// movie.c
+#define PMOV_HASH_VIDEO (1<<0) // output buffer
+#define PMOV_HASH_SOUND (1<<1) // sound output
+#define PMOV_HASH_RAM   (1<<2) // 68k and z80 RAM
+#define PMOV_HASH_ALL   (PMOV_HASH_VIDEO|PMOV_HASH_SOUND|PMOV_HASH_RAM)
+int  PicoMovieRecord(const char *fname, int hash_flags);
+int  PicoMoviePlay(const char *fname);
+int  PicoMovieStop(void);
+int  PicoMovieStatus(unsigned int *frame, unsigned int *mismatches);
+
 // cd/cdd.c
 int cdd_load(const char *filename, int type);
 int cdd_unload(void);
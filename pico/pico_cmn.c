@@ -44,8 +44,17 @@ static void SekSyncM68k(void)
   pprof_start(m68k);
   pevt_log_m68k_o(EVT_RUN_START);
 
-  while ((cyc_do = Pico.t.m68c_aim - Pico.t.m68c_cnt) > 0)
+  while ((cyc_do = Pico.t.m68c_aim - Pico.t.m68c_cnt) > 0) {
+#ifdef CPU_CMP_STEP
+    // compare states every few instructions instead of once per run
+    if (cyc_do > CPU_CMP_STEP)
+      cyc_do = CPU_CMP_STEP;
     SekExecM68k(cyc_do);
+    SekTrace(0);
+#else
+    SekExecM68k(cyc_do);
+#endif
+  }
 
   SekTrace(0);
   pevt_log_m68k_o(EVT_RUN_END);
@@ -151,6 +160,7 @@ static int PicoFrameHints(void)
     do_timing_hacks_end(pv);
 
     if (PicoLineHook) PicoLineHook();
+    pc_prof_line();
     pevt_log_m68k_o(EVT_NEXT_LINE);
   }
 
@@ -218,6 +228,7 @@ static int PicoFrameHints(void)
   do_timing_hacks_end(pv);
 
   if (PicoLineHook) PicoLineHook();
+  pc_prof_line();
   pevt_log_m68k_o(EVT_NEXT_LINE);
 
   if (Pico.m.pal) {
@@ -255,6 +266,7 @@ static int PicoFrameHints(void)
     do_timing_hacks_end(pv);
 
     if (PicoLineHook) PicoLineHook();
+    pc_prof_line();
     pevt_log_m68k_o(EVT_NEXT_LINE);
   }
 
@@ -294,6 +306,7 @@ static int PicoFrameHints(void)
   do_timing_hacks_end(pv);
 
   if (PicoLineHook) PicoLineHook();
+  pc_prof_line();
   pevt_log_m68k_o(EVT_NEXT_LINE);
 
   // sync cpus
@@ -680,6 +680,7 @@ PICO_INTERNAL void PicoFrameFull();
 // mode4.c
 void PicoFrameStartMode4(void);
 void PicoLineMode4(int line);
+void PicoSpriteStatusMode4(int to);
 void PicoDoHighPal555M4(void);
 void PicoDrawSetOutputMode4(pdso_t which);
 
@@ -713,6 +714,7 @@ int cdd_context_load_old(unsigned char *state);
 void cdd_read_data(unsigned char *dst);
 void cdd_read_audio(unsigned int samples);
 void cdd_update(void);
+int  cdd_update_period(void);
 void cdd_process(void);
 
 // cd/cd_image.c
@@ -735,6 +737,7 @@ unsigned int PicoRead16_mcd_io(unsigned int a);
 void PicoWrite8_mcd_io(unsigned int a, unsigned int d);
 void PicoWrite16_mcd_io(unsigned int a, unsigned int d);
 void pcd_state_loaded_mem(void);
+extern unsigned int pcd_shared_writes;
 
 // pico.c
 extern struct Pico Pico;
@@ -781,6 +784,7 @@ void pcd_pcm_sync(unsigned int to);
 void pcd_pcm_update(int *buffer, int length, int stereo);
 void pcd_pcm_write(unsigned int a, unsigned int d);
 unsigned int pcd_pcm_read(unsigned int a);
+void pcd_pcm_ram_dirty(unsigned int bank_mask);
 
 // pico/pico.c
 PICO_INTERNAL void PicoInitPico(void);
@@ -803,8 +807,10 @@ void SekInitIdleDet(void);
 void SekFinishIdleDet(void);
 #if defined(CPU_CMP_R) || defined(CPU_CMP_W)
 void SekTrace(int is_s68k);
+void SekTraceWrite(u32 a, u32 d, int size);
 #else
 #define SekTrace(x)
+#define SekTraceWrite(a, d, size)
 #endif
 
 // cd/sek.c
@@ -887,6 +893,34 @@ void EEPROM_write8(unsigned int a, unsigned int d);
 void EEPROM_write16(unsigned int d);
 unsigned int EEPROM_read(void);
 
+// movie.c
+extern int pmov_active;
+void pmov_frame_start(void);
+void pmov_frame_end(void);
+void pmov_sound(const void *buf, int len);
+void pmov_reset(void);
+void pmov_disc(const char *fname, int type);
+
+// sched.c
+#define SCHED_MAX_EVENTS 8
+typedef void (sched_cb)(unsigned int now);
+struct sched {
+  unsigned int *times;          // per event, 0 if not scheduled
+  sched_cb * const *cbs;
+  int count;                    // number of events
+  int log_mask;
+  const char *name;
+  unsigned int next;            // time of the next event, 0 if none
+  int heap_len;
+  unsigned char heap[SCHED_MAX_EVENTS]; // scheduled events, min-heap by time
+  unsigned char pos[SCHED_MAX_EVENTS];  // heap index+1 of each event, 0 if none
+};
+#define SCHED_INIT(times, cbs, log_mask, name) \
+  { times, cbs, sizeof(times)/sizeof(times[0]), log_mask, name }
+void sched_event(struct sched *s, int event, unsigned int when);
+void sched_run(struct sched *s, unsigned int until);
+void sched_rebuild(struct sched *s);
+
 // z80 functionality wrappers
 PICO_INTERNAL void z80_init(void);
 PICO_INTERNAL void z80_pack(void *data);
@@ -899,14 +933,14 @@ PICO_INTERNAL_ASM void wram_2M_to_1M(unsigned char *m);
 PICO_INTERNAL_ASM void wram_1M_to_2M(unsigned char *m);
 
 // sound/sound.c
-PICO_INTERNAL void PsndInit(void);
 PICO_INTERNAL void PsndExit(void);
 PICO_INTERNAL void PsndReset(void);
 PICO_INTERNAL void PsndStartFrame(void);
 PICO_INTERNAL void PsndDoDAC(int cycle_to);
 PICO_INTERNAL void PsndDoPSG(int line_to);
 PICO_INTERNAL void PsndDoYM2413(int line_to);
-PICO_INTERNAL void PsndDoFM(int line_to);
+PICO_INTERNAL void PsndDoFM(int cyc_to);
+PICO_INTERNAL void PsndFMWrite(int cycles, int addr, int d);
 PICO_INTERNAL void PsndClear(void);
 PICO_INTERNAL void PsndGetSamples(int y);
 PICO_INTERNAL void PsndGetSamplesMS(int y);
@@ -1074,6 +1108,7 @@ static __inline int isspace_(int c)
 #define EL_PWM     0x00100000 /* 32X PWM stuff (LOTS of output) */
 #define EL_32XP    0x00200000 /* 32X peripherals */
 #define EL_CD      0x00400000 /* MCD */
+#define EL_SOUND   0x00800000 /* sound render call stats */
 
 #define EL_STATUS  0x40000000 /* status messages */
 #define EL_ANOMALY 0x80000000 /* some unexpected conditions (during emulation) */
@@ -1140,6 +1175,67 @@ void pevt_dump(void);
 #define pevt_dump()
 #endif
 
+#ifdef MEM_STATS
+enum mst_cpu {
+  MST_M68K,
+  MST_S68K,
+  MST_Z80,
+  MST_MSH2,
+  MST_SSH2,
+  MST_CPU_CNT
+};
+
+// handler is NULL for directly mapped pages
+void mem_stats_log(int cpu, unsigned int page, const void *handler, int is_write);
+void mem_stats_frame(void);
+void mem_stats_dump(void);
+#else
+#define mem_stats_log(cpu, page, handler, is_write)
+#define mem_stats_frame()
+#define mem_stats_dump()
+#endif
+
+#ifdef PC_PROF
+enum pcp_cpu {
+  PCP_M68K,
+  PCP_S68K,
+  PCP_Z80,
+  PCP_MSH2,
+  PCP_SSH2,
+  PCP_CPU_CNT
+};
+
+void pc_prof_line(void);
+void pc_prof_run(int cpu, unsigned int pc, int m68k_cycles);
+void pc_prof_dump(void);
+#else
+#define pc_prof_line()
+#define pc_prof_run(cpu, pc, m68k_cycles)
+#define pc_prof_dump()
+#endif
+
+#ifdef CPU_TRACE
+// binary instruction trace, the format is in trace.h
+void cpu_trace_m68k(int is_sub, u32 pc, u32 op, u32 sr);
+void cpu_trace_stop(void);
+#else
+#define cpu_trace_m68k(is_sub, pc, op, sr)
+#define cpu_trace_stop()
+#endif
+
+#ifdef STARTUP_PROF
+// wall clock time of startup phases, reported at the first emulated frame
+void startup_prof_begin(void);
+void startup_prof_phase(const char *name);
+void startup_prof_end(const char *title);
+void startup_prof_frame(void);
+#else
+#define startup_prof_begin()
+#define startup_prof_phase(name)
+#define startup_prof_end(title)
+#define startup_prof_frame()
+#endif
+
 #ifdef __cplusplus
 } // End of extern "C"
 #endif
@@ -0,0 +1,123 @@
+/*
+ * cycle stamped event scheduler, used for MCD and 32X events
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ *
+ * Scheduled events are kept in a small binary min-heap ordered by time,
+ * so that scheduling is O(log n) and the next event is always at the top.
+ * The per event times array remains the reference, it is what savestates
+ * contain. Time 0 means "not scheduled", so scheduled times are always odd.
+ * Times are cycle counters which may wrap, all comparisons are relative.
+ */
+
+#include "pico_int.h"
+
+#define TIME(s, i) (s)->times[(s)->heap[i]]
+
+static void heap_swap(struct sched *s, int i, int j)
+{
+  unsigned char t = s->heap[i];
+  s->heap[i] = s->heap[j];
+  s->heap[j] = t;
+  s->pos[s->heap[i]] = i + 1;
+  s->pos[s->heap[j]] = j + 1;
+}
+
+static void heap_up(struct sched *s, int i)
+{
+  while (i > 0 && CYCLES_GT(TIME(s, (i-1)/2), TIME(s, i))) {
+    heap_swap(s, i, (i-1)/2);
+    i = (i-1)/2;
+  }
+}
+
+static void heap_down(struct sched *s, int i)
+{
+  int c;
+
+  while ((c = 2*i+1) < s->heap_len) {
+    if (c+1 < s->heap_len && CYCLES_GT(TIME(s, c), TIME(s, c+1)))
+      c++;
+    if (!CYCLES_GT(TIME(s, i), TIME(s, c)))
+      break;
+    heap_swap(s, i, c);
+    i = c;
+  }
+}
+
+static void heap_remove(struct sched *s, int event)
+{
+  int i = s->pos[event] - 1;
+  int moved;
+
+  s->heap_len--;
+  if (i != s->heap_len) {
+    // move the last entry into the hole and restore heap order
+    heap_swap(s, i, s->heap_len);
+    moved = s->heap[i];
+    heap_up(s, i);
+    heap_down(s, s->pos[moved] - 1);
+  }
+  s->pos[event] = 0;
+}
+
+static void update_next(struct sched *s)
+{
+  s->next = s->heap_len ? TIME(s, 0) : 0;
+}
+
+// (re)schedule an event at 'when', 0 cancels it
+void sched_event(struct sched *s, int event, unsigned int when)
+{
+  if (s->pos[event])
+    heap_remove(s, event);
+
+  s->times[event] = when;
+  if (when != 0) {
+    s->heap[s->heap_len] = event;
+    s->pos[event] = ++s->heap_len;
+    heap_up(s, s->heap_len - 1);
+  }
+  update_next(s);
+}
+
+// run all events due at 'until', in time order
+void sched_run(struct sched *s, unsigned int until)
+{
+  unsigned int time;
+  int event;
+
+  while (s->heap_len && CYCLES_GE(until, TIME(s, 0))) {
+    event = s->heap[0];
+    time = s->times[event];
+    heap_remove(s, event);
+    s->times[event] = 0;
+    update_next(s);
+    elprintf(s->log_mask, "%s: run event #%d %u", s->name, event, time);
+    s->cbs[event](time);
+  }
+
+  if (s->heap_len)
+    elprintf(s->log_mask, "%s: next event #%d at %u",
+      s->name, s->heap[0], s->next);
+}
+
+// rebuild the heap from the times array, i.e. after loading a state
+void sched_rebuild(struct sched *s)
+{
+  int i;
+
+  s->heap_len = 0;
+  for (i = 0; i < s->count; i++) {
+    s->pos[i] = 0;
+    if (s->times[i] != 0) {
+      s->heap[s->heap_len] = i;
+      s->pos[i] = ++s->heap_len;
+      heap_up(s, s->heap_len - 1);
+    }
+  }
+  update_next(s);
+}
+
+// vim:shiftwidth=2:ts=2:expandtab
@@ -443,6 +443,9 @@ void SekFinishIdleDet(void)
 
 #if defined(CPU_CMP_R) || defined(CPU_CMP_W)
 #include "debug.h"
+#ifdef CPU_CMP_R
+#include "../cpu/musashi/m68k.h"
+#endif
 
 struct ref_68k {
   u32 dar[16];
@@ -450,10 +453,75 @@ struct ref_68k {
   u32 sr;
   u32 cycles;
   u32 pc_prev;
+  u32 wr_count;
+  u32 wr_hash;
 };
 struct ref_68k ref_68ks[2];
 static int current_68k;
 
+// 68k bus writes since startup, as a count and a sum of per write hashes.
+// The sum doesn't depend on the order, since cores split long writes
+// differently (i.e. predecrement writes the low word first in FAME).
+static u32 wr_count, wr_hash;
+static struct {
+  u32 a, d;
+  int size;
+} wr_last[16];
+
+void SekTraceWrite(u32 a, u32 d, int size)
+{
+  int i = wr_count++ & 15;
+  u32 h = 0x811c9dc5;
+
+  wr_last[i].a = a;
+  wr_last[i].d = d;
+  wr_last[i].size = size;
+  h = (h ^ a) * 0x01000193;
+  h = (h ^ d) * 0x01000193;
+  h = (h ^ size) * 0x01000193;
+  wr_hash += h;
+}
+
+#ifdef CPU_CMP_R
+// for the disassembler, don't touch I/O
+unsigned int m68k_read_disassembler_16(unsigned int a)
+{
+  a &= 0xffffff;
+  if (0xa00000 <= a && a < 0xe00000)
+    return 0;
+  return m68k_read16(a);
+}
+
+unsigned int m68k_read_disassembler_32(unsigned int a)
+{
+  return (m68k_read_disassembler_16(a) << 16) | m68k_read_disassembler_16(a+2);
+}
+
+unsigned int m68k_read_disassembler_8(unsigned int a)
+{
+  return m68k_read_disassembler_16(a & ~1) >> ((~a & 1) * 8) & 0xff;
+}
+
+// disassemble from the last matching PC up to a bit past the current one
+static void dump_dasm(u32 from, u32 pc)
+{
+  char buff[128];
+  int i, len, after = 4;
+
+  from &= 0xffffff;
+  pc &= 0xffffff;
+  if (pc - from > 0x100)
+    from = pc;
+  for (i = 0; i < 64 && after > 0; i++) {
+    len = m68k_disassemble(buff, from, M68K_CPU_TYPE_68000) & 0xff;
+    printf("%c %06x: %s\n", from == pc ? '>' : ' ', from, buff);
+    if (from >= pc)
+      after--;
+    from += len ? len : 2;
+  }
+}
+#endif
+
 void SekTrace(int is_s68k)
 {
   struct ref_68k *x68k = &ref_68ks[is_s68k];
@@ -485,6 +553,12 @@ void SekTrace(int is_s68k)
       tl_write_uint(CTL_68K_R + i, r);
     }
   }
+  if (wr_count != x68k->wr_count) {
+    x68k->wr_count = wr_count;
+    x68k->wr_hash = wr_hash;
+    tl_write_uint(CTL_68K_WRCOUNT, wr_count);
+    tl_write_uint(CTL_68K_WRHASH, wr_hash);
+  }
   tl_write_uint(CTL_68K_CYCLES, cycles);
 #else
   int i, bad = 0;
@@ -507,6 +581,12 @@ void SekTrace(int is_s68k)
     case CTL_68K_SR:
       tl_read_uint(&x68k->sr);
       break;
+    case CTL_68K_WRCOUNT:
+      tl_read_uint(&x68k->wr_count);
+      break;
+    case CTL_68K_WRHASH:
+      tl_read_uint(&x68k->wr_hash);
+      break;
     case CTL_68K_CYCLES:
       tl_read_uint(&x68k->cycles);
       goto breakloop;
@@ -543,12 +623,25 @@ breakloop:
       bad = 1;
     }
   }
+  if (wr_count != x68k->wr_count || wr_hash != x68k->wr_hash) {
+    printf("bad writes: %u %08x, %u %08x\n", wr_count, wr_hash,
+      x68k->wr_count, x68k->wr_hash);
+    for (i = 16; i > 0; i--) {
+      int j = (wr_count - i) & 15;
+      if (wr_count >= i)
+        printf("  write%d %06x = %x\n", wr_last[j].size * 8,
+          wr_last[j].a & 0xffffff, wr_last[j].d);
+    }
+    bad = 1;
+  }
   if (bad) {
     for (i = 0; i < 8; i++)
 			printf("D%d: %08x  A%d: %08x\n", i, x68k->dar[i],
         i, x68k->dar[i + 8]);
 		printf("PC: %08x, %08x\n", x68k->pc, x68k->pc_prev);
 		printf("SR: %04x\n", x68k->sr);
+    if (!is_s68k)
+      dump_dasm(x68k->pc_prev, pc);
 
     PDebugDumpMem();
     exit(1);
@@ -558,7 +651,13 @@ breakloop:
 }
 #endif // CPU_CMP_*
 
-#if defined(EMU_M68K) && M68K_INSTRUCTION_HOOK == OPT_SPECIFY_HANDLER
+#if defined(EMU_M68K) && defined(CPU_TRACE)
+void instruction_hook(void)
+{
+  cpu_trace_m68k(m68ki_cpu_p == &PicoCpuMS68k, REG_PC,
+    m68k_read_immediate_16(REG_PC), m68ki_get_sr());
+}
+#elif defined(EMU_M68K) && M68K_INSTRUCTION_HOOK == OPT_SPECIFY_HANDLER
 static unsigned char op_flags[0x400000/2] = { 0, };
 static int atexit_set = 0;
 
@@ -40,6 +40,8 @@ static unsigned char vdp_ctl_read(void)
   unsigned char d;
 
   z80_int_assert(0);
+  if (PicoIn.skipFrame)
+    PicoSpriteStatusMode4(Pico.m.scanline + 1);
   d = pv->status | (pv->pending_ints << 7);
   pv->pending = pv->pending_ints = 0;
   pv->status = 0;
@@ -106,6 +108,10 @@ static unsigned char z80_sms_in(unsigned short a)
 {
   unsigned char d = 0;
 
+  // VDP ports are by far the most used, handle them first
+  if ((a & 0xc0) == 0x80)
+    return (a & 1) ? vdp_ctl_read() : vdp_data_read();
+
   elprintf(EL_IO, "z80 port %04x read", a);
   if((a&0xff)>= 0xf0){
     if (PicoIn.opt & POPT_EN_YM2413){
@@ -144,14 +150,6 @@ static unsigned char z80_sms_in(unsigned short a)
         elprintf(EL_HVCNT, "H counter read: %02x", d);
         break;
 
-      case 0x80:
-        d = vdp_data_read();
-        break;
-
-      case 0x81:
-        d = vdp_ctl_read();
-        break;
-
       case 0xc0: /* I/O port A and B */
         d = ~((PicoIn.pad[0] & 0x3f) | (PicoIn.pad[1] << 6));
         break;
@@ -168,6 +166,14 @@ static unsigned char z80_sms_in(unsigned short a)
 
 static void z80_sms_out(unsigned short a, unsigned char d)
 {
+  if ((a & 0xc0) == 0x80) {
+    if (a & 1)
+      vdp_ctl_write(d);
+    else
+      vdp_data_write(d);
+    return;
+  }
+
   elprintf(EL_IO, "z80 port %04x write %02x", a, d);
 
   if((a&0xff)>= 0xf0){
@@ -207,19 +213,23 @@ static void z80_sms_out(unsigned short a, unsigned char d)
         SN76496Write(d);
         break;
 
-      case 0x80:
-        vdp_data_write(d);
-        break;
-
-      case 0x81:
-        vdp_ctl_write(d);
-        break;
     }
   }
 }
 
 static int bank_mask;
 
+// map ROM bank d to slot 1 (0x4000-0x7fff) or 2 (0x8000-0xbfff)
+static void map_bank(int slot, unsigned char d)
+{
+  int start = slot << 14;
+
+  z80_map_set(z80_read_map, start, start + 0x3fff, Pico.rom + (d << 14), 0);
+#ifdef _USE_CZ80
+  Cz80_Set_Fetch(&CZ80, start, start + 0x3fff, (FPTR)Pico.rom + (d << 14));
+#endif
+}
+
 static void write_bank(unsigned short a, unsigned char d)
 {
   elprintf(EL_Z80BNK, "bank %04x %02x @ %04x", a, d, z80_pc());
@@ -233,18 +243,11 @@ static void write_bank(unsigned short a, unsigned char d)
         elprintf(EL_STATUS|EL_ANOMALY, "bank0 changed to %d!", d);
       break;
     case 0x0e:
-      d &= bank_mask;
-      z80_map_set(z80_read_map, 0x4000, 0x7fff, Pico.rom + (d << 14), 0);
-#ifdef _USE_CZ80
-      Cz80_Set_Fetch(&CZ80, 0x4000, 0x7fff, (FPTR)Pico.rom + (d << 14));
-#endif
-      break;
     case 0x0f:
+      // games often rewrite the current bank, only remap on change
       d &= bank_mask;
-      z80_map_set(z80_read_map, 0x8000, 0xbfff, Pico.rom + (d << 14), 0);
-#ifdef _USE_CZ80
-      Cz80_Set_Fetch(&CZ80, 0x8000, 0xbfff, (FPTR)Pico.rom + (d << 14));
-#endif
+      if (d != Pico.ms.carthw[a & 0x0f])
+        map_bank((a & 0x0f) - 0x0d, d);
       break;
   }
   Pico.ms.carthw[a & 0x0f] = d;
@@ -316,8 +319,10 @@ void PicoMemSetupMS(void)
 
 void PicoStateLoadedMS(void)
 {
-  write_bank(0xfffe, Pico.ms.carthw[0x0e]);
-  write_bank(0xffff, Pico.ms.carthw[0x0f]);
+  Pico.ms.carthw[0x0e] &= bank_mask;
+  Pico.ms.carthw[0x0f] &= bank_mask;
+  map_bank(1, Pico.ms.carthw[0x0e]);
+  map_bank(2, Pico.ms.carthw[0x0f]);
 }
 
 void PicoFrameMS(void)
@@ -351,6 +356,8 @@ void PicoFrameMS(void)
 
     if (y < lines_vis && !skip)
       PicoLineMode4(y);
+    else if (y == lines_vis && skip)
+      PicoSpriteStatusMode4(lines_vis); // lines not yet evaluated on demand
 
     if (y <= lines_vis)
     {
@@ -374,6 +381,7 @@ void PicoFrameMS(void)
 
     cycles_aim += cycles_line;
     cycles_done += z80_run((cycles_aim - cycles_done) >> 8) << 8;
+    pc_prof_line();
   }
 
   if (PicoIn.sndOut)
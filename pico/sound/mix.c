@@ -7,6 +7,11 @@
  */
 
 #include "string.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 #define MAXOUT		(+32767)
 #define MINOUT		(-32768)
@@ -46,6 +51,150 @@ static inline int filter_null(struct iir2 *fi2, int x)
 	return x;
 }
 
+// vectorized mixing. The filter recursion is inherently serial, so L/R are
+// filtered in parallel while the input mixing and saturation is done for 4
+// stereo samples at once. The operations are the same as in filter_exp and
+// Limit16, hence the results are bit identical to the scalar code. Like the
+// scalar code, both channels use the left channel of dest as input.
+// Returns the number of samples done, the remainder is left to the caller.
+#if defined(__SSE2__)
+#define HAVE_MIX_SIMD
+
+static inline __m128i filter_exp_x2(__m128i *y, __m128i x)
+{
+	__m128i xf = _mm_sub_epi32(_mm_slli_epi32(x, QB), *y);
+	*y = _mm_add_epi32(*y, _mm_srai_epi32(xf, 13));
+	xf = _mm_sub_epi32(xf, _mm_srai_epi32(xf, 2));
+	return _mm_srai_epi32(xf, QB);
+}
+
+static int mix_32_to_16l_stereo_simd(short *dest, int *src, int count, int lv)
+{
+	__m128i y = _mm_set_epi32(0, 0, rfi2.y[0], lfi2.y[0]);
+	__m128i sh = _mm_cvtsi32_si128(lv);
+	__m128i d, x0, x1, o0, o1;
+	int n;
+
+	for (n = count & ~3; count >= 4; count -= 4, dest += 8, src += 8)
+	{
+		d = _mm_loadu_si128((__m128i *)dest);
+		d = _mm_srai_epi32(_mm_slli_epi32(d, 16), 16);
+		x0 = _mm_unpacklo_epi32(d, d);
+		x1 = _mm_unpackhi_epi32(d, d);
+		x0 = _mm_add_epi32(x0, _mm_sra_epi32(_mm_loadu_si128((__m128i *)src), sh));
+		x1 = _mm_add_epi32(x1, _mm_sra_epi32(_mm_loadu_si128((__m128i *)src+1), sh));
+
+		o0 = filter_exp_x2(&y, x0);
+		o0 = _mm_unpacklo_epi64(o0, filter_exp_x2(&y, _mm_srli_si128(x0, 8)));
+		o1 = filter_exp_x2(&y, x1);
+		o1 = _mm_unpacklo_epi64(o1, filter_exp_x2(&y, _mm_srli_si128(x1, 8)));
+		_mm_storeu_si128((__m128i *)dest, _mm_packs_epi32(o0, o1));
+	}
+
+	lfi2.y[0] = _mm_cvtsi128_si32(y);
+	rfi2.y[0] = _mm_cvtsi128_si32(_mm_srli_si128(y, 4));
+	return n;
+}
+
+static int mix_32_to_16_mono_simd(short *dest, int *src, int count)
+{
+	int y = lfi2.y[0], xf, n, i;
+	int x[8];
+	__m128i d, x0, x1;
+
+	for (n = count & ~7; count >= 8; count -= 8, dest += 8, src += 8)
+	{
+		d = _mm_loadu_si128((__m128i *)dest);
+		x0 = _mm_srai_epi32(_mm_unpacklo_epi16(d, d), 16);
+		x1 = _mm_srai_epi32(_mm_unpackhi_epi16(d, d), 16);
+		x0 = _mm_add_epi32(x0, _mm_loadu_si128((__m128i *)src));
+		x1 = _mm_add_epi32(x1, _mm_loadu_si128((__m128i *)src+1));
+		_mm_storeu_si128((__m128i *)x, x0);
+		_mm_storeu_si128((__m128i *)x+1, x1);
+
+		for (i = 0; i < 8; i++) {
+			xf = (x[i]<<QB) - y;
+			y += xf >> 13;
+			xf -= xf >> 2;
+			x[i] = xf>>QB;
+		}
+		x0 = _mm_loadu_si128((__m128i *)x);
+		x1 = _mm_loadu_si128((__m128i *)x+1);
+		_mm_storeu_si128((__m128i *)dest, _mm_packs_epi32(x0, x1));
+	}
+
+	lfi2.y[0] = y;
+	return n;
+}
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define HAVE_MIX_SIMD
+
+static inline int32x2_t filter_exp_x2(int32x2_t *y, int32x2_t x)
+{
+	int32x2_t xf = vsub_s32(vshl_n_s32(x, QB), *y);
+	*y = vadd_s32(*y, vshr_n_s32(xf, 13));
+	xf = vsub_s32(xf, vshr_n_s32(xf, 2));
+	return vshr_n_s32(xf, QB);
+}
+
+static int mix_32_to_16l_stereo_simd(short *dest, int *src, int count, int lv)
+{
+	int32x2_t y = vset_lane_s32(rfi2.y[0], vdup_n_s32(lfi2.y[0]), 1);
+	int32x4_t sh = vdupq_n_s32(-lv);
+	int32x4_t d, x0, x1;
+	int32x4x2_t l;
+	int32x2_t o0, o1, o2, o3;
+	int n;
+
+	for (n = count & ~3; count >= 4; count -= 4, dest += 8, src += 8)
+	{
+		d = vreinterpretq_s32_s16(vld1q_s16(dest));
+		d = vshrq_n_s32(vshlq_n_s32(d, 16), 16);
+		l = vzipq_s32(d, d);
+		x0 = vaddq_s32(l.val[0], vshlq_s32(vld1q_s32(src), sh));
+		x1 = vaddq_s32(l.val[1], vshlq_s32(vld1q_s32(src+4), sh));
+
+		o0 = filter_exp_x2(&y, vget_low_s32(x0));
+		o1 = filter_exp_x2(&y, vget_high_s32(x0));
+		o2 = filter_exp_x2(&y, vget_low_s32(x1));
+		o3 = filter_exp_x2(&y, vget_high_s32(x1));
+		vst1q_s16(dest, vcombine_s16(vqmovn_s32(vcombine_s32(o0, o1)),
+					     vqmovn_s32(vcombine_s32(o2, o3))));
+	}
+
+	lfi2.y[0] = vget_lane_s32(y, 0);
+	rfi2.y[0] = vget_lane_s32(y, 1);
+	return n;
+}
+
+static int mix_32_to_16_mono_simd(short *dest, int *src, int count)
+{
+	int y = lfi2.y[0], xf, n, i;
+	int x[8];
+	int16x8_t d;
+
+	for (n = count & ~7; count >= 8; count -= 8, dest += 8, src += 8)
+	{
+		d = vld1q_s16(dest);
+		vst1q_s32(x,   vaddq_s32(vmovl_s16(vget_low_s16(d)),  vld1q_s32(src)));
+		vst1q_s32(x+4, vaddq_s32(vmovl_s16(vget_high_s16(d)), vld1q_s32(src+4)));
+
+		for (i = 0; i < 8; i++) {
+			xf = (x[i]<<QB) - y;
+			y += xf >> 13;
+			xf -= xf >> 2;
+			x[i] = xf>>QB;
+		}
+		vst1q_s16(dest, vcombine_s16(vqmovn_s32(vld1q_s32(x)),
+					     vqmovn_s32(vld1q_s32(x+4))));
+	}
+
+	lfi2.y[0] = y;
+	return n;
+}
+#endif
+
 #define mix_32_to_16l_stereo_core(dest, src, count, lv, fl) {	\
 	int l, r;						\
 								\
@@ -65,11 +214,19 @@ static inline int filter_null(struct iir2 *fi2, int x)
 
 void mix_32_to_16l_stereo_lvl(short *dest, int *src, int count)
 {
+#ifdef HAVE_MIX_SIMD
+	int n = mix_32_to_16l_stereo_simd(dest, src, count, mix_32_to_16l_level);
+	dest += 2*n, src += 2*n, count -= n;
+#endif
 	mix_32_to_16l_stereo_core(dest, src, count, mix_32_to_16l_level, filter_exp);
 }
 
 void mix_32_to_16l_stereo(short *dest, int *src, int count)
 {
+#ifdef HAVE_MIX_SIMD
+	int n = mix_32_to_16l_stereo_simd(dest, src, count, 0);
+	dest += 2*n, src += 2*n, count -= n;
+#endif
 	mix_32_to_16l_stereo_core(dest, src, count, 0, filter_exp);
 }
 
@@ -77,6 +234,11 @@ void mix_32_to_16_mono(short *dest, int *src, int count)
 {
 	int l;
 
+#ifdef HAVE_MIX_SIMD
+	int n = mix_32_to_16_mono_simd(dest, src, count);
+	dest += n, src += n, count -= n;
+#endif
+
 	for (; count > 0; count--)
 	{
 		l = *dest;
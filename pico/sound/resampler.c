@@ -0,0 +1,189 @@
+/*
+ * PicoDrive
+ * polyphase FIR resampler
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "resampler.h"
+
+// number of filter phases between 2 input samples (nearest phase is used)
+#define RS_PHASES_BITS 8
+#define RS_PHASES   (1 << RS_PHASES_BITS)
+// coefficient fixpoint precision
+#define RS_QB       14
+#define RS_MAX_TAPS 64
+
+struct resampler {
+  int taps;             // filter length, even
+  int stereo;
+  unsigned in_rate;
+  unsigned out_rate;
+  unsigned pos;         // fractional input position, 0..out_rate-1
+  unsigned long long phase_mult; // pos -> phase, Q32
+  s16 *coeffs;          // [RS_PHASES][taps]
+  s32 *buffer;          // taps history samples + input for one update
+  int buffer_len;       // in samples (not counting stereo)
+  get_samples_func *get_samples;
+};
+
+static double blackman(double x) // x in [0,1]
+{
+  return 0.42 - 0.5 * cos(2*M_PI * x) + 0.08 * cos(4*M_PI * x);
+}
+
+static void make_coeffs(resampler_t *rs)
+{
+  int taps = rs->taps;
+  // cutoff in cycles per input sample, leave some room for the transition band
+  double fc = 0.5 * 0.85;
+  int p, k;
+
+  if (rs->out_rate < rs->in_rate)
+    fc = fc * rs->out_rate / rs->in_rate;
+
+  for (p = 0; p < RS_PHASES; p++) {
+    s16 *c = rs->coeffs + p * taps;
+    double h[RS_MAX_TAPS], sum = 0;
+    int isum = 0;
+
+    for (k = 0; k < taps; k++) {
+      // distance of the tap from the output position
+      double d = (k - (taps/2 - 1)) - (double)p / RS_PHASES;
+      double s = (d == 0 ? 1.0 : sin(2*M_PI * fc * d) / (2*M_PI * fc * d));
+      h[k] = s * blackman((d + taps/2) / taps);
+      sum += h[k];
+    }
+    // normalize to unity DC gain for each phase
+    for (k = 0; k < taps; k++) {
+      c[k] = floor(h[k] / sum * (1 << RS_QB) + 0.5);
+      isum += c[k];
+    }
+    c[taps/2 - 1] += (1 << RS_QB) - isum;
+  }
+}
+
+resampler_t *resampler_new(unsigned taps, unsigned in_rate, unsigned out_rate,
+  int stereo, get_samples_func *get_samples)
+{
+  resampler_t *rs;
+
+  rs = calloc(1, sizeof(*rs));
+  if (rs == NULL)
+    return NULL;
+
+  if (taps > RS_MAX_TAPS)
+    taps = RS_MAX_TAPS;
+  rs->taps = (taps + 1) & ~1;
+  rs->stereo = !!stereo;
+  rs->in_rate = in_rate;
+  rs->out_rate = out_rate;
+  rs->phase_mult = ((unsigned long long)RS_PHASES << 32) / out_rate;
+  rs->get_samples = get_samples;
+  rs->coeffs = malloc(RS_PHASES * rs->taps * sizeof(*rs->coeffs));
+  if (rs->coeffs == NULL) {
+    free(rs);
+    return NULL;
+  }
+  make_coeffs(rs);
+  resampler_reset(rs);
+  return rs;
+}
+
+void resampler_free(resampler_t *rs)
+{
+  if (rs == NULL)
+    return;
+  free(rs->coeffs);
+  free(rs->buffer);
+  free(rs);
+}
+
+void resampler_reset(resampler_t *rs)
+{
+  rs->pos = 0;
+  if (rs->buffer)
+    memset(rs->buffer, 0, (rs->buffer_len << rs->stereo) * sizeof(*rs->buffer));
+}
+
+// plain dot products, simple enough for the compiler to vectorize them
+static void filter_mono(s32 *out, const s32 *in, const s16 *c, int taps)
+{
+  long long acc = 0;
+  int k;
+
+  for (k = 0; k < taps; k++)
+    acc += (long long)in[k] * c[k];
+  *out = acc >> RS_QB;
+}
+
+static void filter_stereo(s32 *out, const s32 *in, const s16 *c, int taps)
+{
+  long long l = 0, r = 0;
+  int k;
+
+  for (k = 0; k < taps; k++) {
+    l += (long long)in[2*k  ] * c[k];
+    r += (long long)in[2*k+1] * c[k];
+  }
+  out[0] = l >> RS_QB;
+  out[1] = r >> RS_QB;
+}
+
+void resampler_update(resampler_t *rs, s32 *buffer, int length)
+{
+  int taps = rs->taps, stereo = rs->stereo;
+  unsigned long long end;
+  int need, idx, phase;
+  s32 *in;
+
+  if (length <= 0)
+    return;
+
+  // number of new input samples this update advances over
+  end = rs->pos + (unsigned long long)length * rs->in_rate;
+  need = end / rs->out_rate;
+
+  if (taps + need > rs->buffer_len) {
+    int len = taps + need + 16;
+    s32 *b = realloc(rs->buffer, (len << stereo) * sizeof(*b));
+    if (b == NULL)
+      return;
+    if (rs->buffer == NULL)
+      memset(b, 0, (taps << stereo) * sizeof(*b));
+    rs->buffer = b;
+    rs->buffer_len = len;
+  }
+
+  // buffer holds the filter history, append new input to it
+  if (need > 0)
+    rs->get_samples(rs->buffer + (taps << stereo), need, stereo);
+
+  for (idx = 0; length > 0; length--) {
+    phase = (rs->pos * rs->phase_mult) >> 32;
+    in = rs->buffer + (idx << stereo);
+    if (stereo) {
+      filter_stereo(buffer, in, rs->coeffs + phase * taps, taps);
+      buffer += 2;
+    } else {
+      filter_mono(buffer, in, rs->coeffs + phase * taps, taps);
+      buffer += 1;
+    }
+
+    rs->pos += rs->in_rate;
+    while (rs->pos >= rs->out_rate) {
+      rs->pos -= rs->out_rate;
+      idx++;
+    }
+  }
+
+  // keep the last taps samples as history for the next update
+  memmove(rs->buffer, rs->buffer + (need << stereo),
+    (taps << stereo) * sizeof(*rs->buffer));
+}
+
+// vim:shiftwidth=2:ts=2:expandtab
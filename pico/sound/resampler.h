@@ -0,0 +1,27 @@
+/*
+ * PicoDrive
+ * polyphase FIR resampler
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ */
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include "../pico_types.h"
+
+typedef struct resampler resampler_t;
+
+// get_samples must fill buffer with exactly length input samples
+// (interleaved L/R if stereo)
+typedef void (get_samples_func)(s32 *buffer, int length, int stereo);
+
+resampler_t *resampler_new(unsigned taps, unsigned in_rate, unsigned out_rate,
+  int stereo, get_samples_func *get_samples);
+void resampler_free(resampler_t *rs);
+void resampler_reset(resampler_t *rs);
+
+// write length output samples to buffer, pulling input as needed
+void resampler_update(resampler_t *rs, s32 *buffer, int length);
+
+#endif
@@ -13,6 +13,7 @@
 #include "../pico_int.h"
 #include "../cd/cue.h"
 #include "mix.h"
+#include "resampler.h"
 #include "emu2413/emu2413.h"
 
 void (*PsndMix_32_to_16l)(short *dest, int *src, int count) = mix_32_to_16l_stereo;
@@ -23,6 +24,41 @@ static int PsndBuffer[2*(44100+100)/50];
 // cdda output buffer
 short cdda_out_buffer[2*1152];
 
+// FM filtering (POPT_EN_FM_FILTER): the YM2612 runs at its native rate into
+// fm_buffer, and is resampled to the output rate at the end of the frame
+#define FM_NATIVE_RATE(clk) ((clk) / 7 / 144)
+static int fm_buffer[2*(FM_NATIVE_RATE(OSC_NTSC)/50 + 100)];
+static int fm_buffer_max;               // fm_buffer size in samples
+static int fm_leftover;                 // samples rendered ahead of output
+static unsigned int fm_clkl_mult;       // native samples per z80 clock in Q20
+static int fm_rate;
+static resampler_t *fm_resampler;
+
+// cdda resampling for rates other than 44, 22 and 11 kHz
+static resampler_t *cdda_resampler;
+
+// YM2612 writes are queued with their z80 cycle and replayed in order when
+// the FM output is needed (at frame end, or when the queue is full). This
+// keeps rendering out of the register write path and in one place. Runs of
+// DAC writes are filled in one pass, and FM is only rendered up to writes
+// which change its output, which gives the same output as rendering at each
+// write.
+#define FM_QUEUE_LEN 1024
+static struct fm_write {
+  int cycles;
+  unsigned short addr;                  // register, A1 in bit 8
+  unsigned short data;
+} fm_queue[FM_QUEUE_LEN];
+static int fm_queue_len;
+
+// render call statistics, logged per frame with EL_SOUND
+static struct {
+  int fm, dac, psg, writes;
+} snd_calls;
+
+static void PsndFMUpdate(s32 *buffer, int length, int stereo);
+static resampler_t *cdda_resampler_new(void);
+
 // sn76496
 extern int *sn76496_regs;
 
@@ -33,17 +69,14 @@ static OPLL *opll = NULL;
 unsigned YM2413_reg;
 
 
-PICO_INTERNAL void PsndInit(void)
-{
-  opll = OPLL_new(YM2413_CLK, PicoIn.sndRate);
-  OPLL_setChipType(opll,0);
-  OPLL_reset(opll);
-}
-
 PICO_INTERNAL void PsndExit(void)
 {
-  OPLL_delete(opll);
+  if (opll != NULL)
+    OPLL_delete(opll);
   opll = NULL;
+
+  resampler_free(fm_resampler); fm_resampler = NULL;
+  resampler_free(cdda_resampler); cdda_resampler = NULL;
 }
 
 PICO_INTERNAL void PsndReset(void)
@@ -61,6 +94,10 @@ void PsndRerate(int preserve_state)
   void *state = NULL;
   int target_fps = Pico.m.pal ? 50 : 60;
   int target_lines = Pico.m.pal ? 313 : 262;
+  int fm_clock = Pico.m.pal ? OSC_PAL : OSC_NTSC;
+
+  // apply any still queued writes to the chip
+  PsndDoFM(0);
 
   if (preserve_state) {
     state = malloc(0x204);
@@ -68,7 +105,18 @@ void PsndRerate(int preserve_state)
     ym2612_pack_state();
     memcpy(state, YM2612GetRegs(), 0x204);
   }
-  YM2612Init(Pico.m.pal ? OSC_PAL/7 : OSC_NTSC/7, PicoIn.sndRate, !(PicoIn.opt&POPT_DIS_FM_SSGEG));
+
+  // FM is either rendered at output rate or at its native rate (and resampled)
+  resampler_free(fm_resampler);
+  fm_resampler = NULL;
+  fm_rate = PicoIn.sndRate;
+  if (PicoIn.opt & POPT_EN_FM_FILTER) {
+    fm_resampler = resampler_new(32, FM_NATIVE_RATE(fm_clock), PicoIn.sndRate,
+                          PicoIn.opt & POPT_EN_STEREO, PsndFMUpdate);
+    if (fm_resampler)
+      fm_rate = FM_NATIVE_RATE(fm_clock);
+  }
+  YM2612Init(fm_clock/7, fm_rate, !(PicoIn.opt&POPT_DIS_FM_SSGEG));
   if (preserve_state) {
     // feed it back it's own registers, just like after loading state
     memcpy(YM2612GetRegs(), state, 0x204);
@@ -79,6 +127,12 @@ void PsndRerate(int preserve_state)
   SN76496_init(Pico.m.pal ? OSC_PAL/15 : OSC_NTSC/15, PicoIn.sndRate);
   if (preserve_state) memcpy(sn76496_regs, state, 28*4); // restore old state
 
+  // only SMS has a YM2413, create it when the first SMS game is powered on
+  if (opll == NULL && (PicoIn.AHW & PAHW_SMS)) {
+    opll = OPLL_new(YM2413_CLK, PicoIn.sndRate);
+    if (opll != NULL)
+      OPLL_setChipType(opll,0);
+  }
   if(opll != NULL){
     if (preserve_state) memcpy(&old_opll, opll, sizeof(OPLL)); // remember old state
     OPLL_setRate(opll, PicoIn.sndRate);
@@ -98,6 +152,16 @@ void PsndRerate(int preserve_state)
   // samples per z80 clock (Q20)
   Pico.snd.clkl_mult = 16 * Pico.snd.smpl_mult * 15/7 / 488;
 
+  // native FM samples per z80 clock (Q20), same for output rate rendering
+  fm_clkl_mult = 16 * (unsigned)(65536LL * fm_rate / (target_fps*target_lines)) * 15/7 / 488;
+  fm_buffer_max = sizeof(fm_buffer)/sizeof(fm_buffer[0]) >> 1;
+  fm_leftover = 0;
+
+  resampler_free(cdda_resampler);
+  cdda_resampler = NULL;
+  if (PicoIn.AHW & PAHW_MCD)
+    cdda_resampler = cdda_resampler_new();
+
   // clear all buffers
   memset32(PsndBuffer, 0, sizeof(PsndBuffer)/4);
   memset(cdda_out_buffer, 0, sizeof(cdda_out_buffer));
@@ -145,6 +209,8 @@ PICO_INTERNAL void PsndDoDAC(int cyc_to)
   if (!PicoIn.sndOut)
     return;
 
+  snd_calls.dac++;
+
   // fill buffer, applying a rather weak order 1 bessel IIR on the way
   // y[n] = (x[n] + x[n-1])*(1/2) (3dB cutoff at 11025 Hz, no gain)
   // 1 sample delay for correct IIR filtering over audio frame boundaries
@@ -180,6 +246,7 @@ PICO_INTERNAL void PsndDoPSG(int line_to)
   if (!PicoIn.sndOut || !(PicoIn.opt & POPT_EN_PSG))
     return;
 
+  snd_calls.psg++;
   if (PicoIn.opt & POPT_EN_STEREO) {
     stereo = 1;
     pos <<= 1;
@@ -221,6 +288,15 @@ PICO_INTERNAL void PsndDoYM2413(int line_to)
 }
 #endif
 
+static void ym2413_render(short *buf, int len, int stereo)
+{
+  while (len-- > 0) {
+    int16_t getdata = OPLL_calc(opll) * 3;
+    *buf += getdata;
+    buf += 1<<stereo;
+  }
+}
+
 void YM2413_regWrite(unsigned data){
   OPLL_writeIO(opll,0,data);
 }
@@ -229,16 +305,17 @@ void YM2413_dataWrite(unsigned data){
 }
 
 
-PICO_INTERNAL void PsndDoFM(int cyc_to)
+static void fm_render(int cyc_to)
 {
   int pos, len;
   int stereo = 0;
+  int *buf = PsndBuffer;
 
   // Q16, number of samples since last call
-  len = (cyc_to * Pico.snd.clkl_mult) - Pico.snd.fm_pos;
+  len = (cyc_to * fm_clkl_mult) - Pico.snd.fm_pos;
 
   // don't do this too often (about once every canline)
-  if (len >> 16 <= PicoIn.sndRate >> 10)
+  if (len >> 16 <= fm_rate >> 10)
     return;
 
   // update position and calculate buffer offset and length
@@ -246,20 +323,262 @@ PICO_INTERNAL void PsndDoFM(int cyc_to)
   Pico.snd.fm_pos += len;
   len = ((Pico.snd.fm_pos+0x80000) >> 20) - pos;
 
+  if (fm_resampler) {
+    // native rate, rendered to fm_buffer and resampled at frame end
+    buf = fm_buffer;
+    if (pos + len > fm_buffer_max)
+      len = fm_buffer_max - pos;
+    if (len <= 0)
+      return;
+  }
+
   // fill buffer
   if (PicoIn.opt & POPT_EN_STEREO) {
     stereo = 1;
     pos <<= 1;
   }
-  if (PicoIn.opt & POPT_EN_FM)
-    YM2612UpdateOne(PsndBuffer + pos, len, stereo, 1);
+  if (PicoIn.opt & POPT_EN_FM) {
+    snd_calls.fm++;
+    YM2612UpdateOne(buf + pos, len, stereo, 1);
+  }
+}
+
+static void fm_write(int cycles, int addr, int d)
+{
+  int address, addr_A1;
+
+  switch (addr) {
+    case 0x2a: /* DAC data */
+      if (ym2612.dacen)
+        PsndDoDAC(cycles);
+      ym2612.dacout = ((int)d - 0x80) << 6;
+      break;
+    case 0x2b: /* DAC Sel */
+      ym2612.dacen = d & 0x80;
+      break;
+    default:
+      // render up to the write, then write with the queued address
+      fm_render(cycles);
+      address = ym2612.OPN.ST.address;
+      addr_A1 = ym2612.addr_A1;
+      ym2612.OPN.ST.address = addr;
+      ym2612.addr_A1 = addr >> 8;
+      YM2612Write_(1 | ((addr >> 7) & 2), d);
+      ym2612.OPN.ST.address = address;
+      ym2612.addr_A1 = addr_A1;
+      break;
+  }
+}
+
+// whether a register write can change the FM output, mirrors the return
+// value of YM2612Write_. Rendering is only needed before those.
+static int fm_write_audible(int addr, int d)
+{
+  int r = addr & 0xff;
+
+  if (r < 0x30)
+    return addr == 0x22 || (addr == 0x28 && (d & 3) != 3);
+  if ((r & 3) == 3 || r >= 0xc0)
+    return 0;
+  switch (r & 0xfc) {
+    case 0xa4: case 0xac: // FNUM2/BLK latches, used by the next FNUM1 write
+    case 0xb8: case 0xbc:
+      return 0;
+    case 0xa8:            // 3CH FNUM1, port 0 only
+      return addr < 0x100;
+  }
+  return 1;
+}
+
+// fill the DAC output for a run of consecutive DAC data writes in one pass,
+// same as calling PsndDoDAC at each of them. Returns the entry after the run.
+static struct fm_write *fm_dac_run(struct fm_write *w, struct fm_write *end)
+{
+  int stereo = !!(PicoIn.opt & POPT_EN_STEREO);
+  unsigned int dac_pos = Pico.snd.dac_pos;
+  int val = Pico.snd.dac_val, val2 = Pico.snd.dac_val2;
+  int dout = ym2612.dacout;
+  int pos, len, filled = 0;
+  short *d;
+
+  for (; w < end && w->addr == 0x2a; w++) {
+    if (ym2612.dacen) {
+      len = (w->cycles * Pico.snd.clkl_mult) - dac_pos;
+      pos = (dac_pos+0x80000) >> 20;
+      dac_pos += len;
+      len = ((dac_pos+0x80000) >> 20) - pos;
+      if (pos+len == 0)
+        len = 1, dac_pos += 0x80000;
+
+      if (len > 0) {
+        // order 1 bessel IIR as in PsndDoDAC, left channel only in stereo
+        d = PicoIn.sndOut + (pos << stereo);
+        *d += val2, d += 1 << stereo;
+        while (--len) *d += val, d += 1 << stereo;
+        val2 = (val + dout) >> 1;
+        val = dout;
+        filled = 1;
+      }
+    }
+    dout = ((int)w->data - 0x80) << 6;
+  }
+
+  Pico.snd.dac_pos = dac_pos;
+  Pico.snd.dac_val = val, Pico.snd.dac_val2 = val2;
+  ym2612.dacout = dout;
+  snd_calls.dac += filled;
+  return w;
+}
+
+// apply queued writes and render FM up to cyc_to
+PICO_INTERNAL void PsndDoFM(int cyc_to)
+{
+  struct fm_write *w = fm_queue, *end = fm_queue + fm_queue_len;
+  int address, addr_A1;
+
+  // no output, just update the chip
+  if (!PicoIn.sndOut)
+    for (; w < end; w++)
+      fm_write(w->cycles, w->addr, w->data);
+
+  while (w < end) {
+    if (w->addr == 0x2a) {
+      w = fm_dac_run(w, end);
+      continue;
+    }
+    if (w->addr == 0x2b) {
+      // the DAC replaces FM channel 6
+      if ((w->data ^ ym2612.dacen) & 0x80)
+        fm_render(w->cycles);
+      ym2612.dacen = w->data & 0x80;
+    } else {
+      // render up to the write only if it changes what is rendered
+      if (fm_write_audible(w->addr, w->data))
+        fm_render(w->cycles);
+      address = ym2612.OPN.ST.address;
+      addr_A1 = ym2612.addr_A1;
+      ym2612.OPN.ST.address = w->addr;
+      ym2612.addr_A1 = w->addr >> 8;
+      YM2612Write_(1 | ((w->addr >> 7) & 2), w->data);
+      ym2612.OPN.ST.address = address;
+      ym2612.addr_A1 = addr_A1;
+    }
+    w++;
+  }
+  fm_queue_len = 0;
+
+  fm_render(cyc_to);
+}
+
+// queue a YM2612 DAC or register write (addr has A1 in bit 8)
+PICO_INTERNAL void PsndFMWrite(int cycles, int addr, int d)
+{
+  struct fm_write *w;
+
+  snd_calls.writes++;
+  // nothing to render, just update the chip
+  if (!PicoIn.sndOut) {
+    fm_write(cycles, addr, d);
+    return;
+  }
+
+  if (fm_queue_len >= FM_QUEUE_LEN)
+    PsndDoFM(fm_queue[fm_queue_len-1].cycles);
+
+  w = &fm_queue[fm_queue_len++];
+  w->cycles = cycles;
+  w->addr = addr;
+  w->data = d;
+}
+
+// resampler input: samples rendered during the frame, and the rest on demand
+static void PsndFMUpdate(s32 *buffer, int length, int stereo)
+{
+  int fmlen = (Pico.snd.fm_pos+0x80000) >> 20;
+  int len;
+
+  if (fmlen > fm_buffer_max)
+    fmlen = fm_buffer_max;
+  len = (fmlen < length ? fmlen : length);
+  if (len > 0)
+    memcpy(buffer, fm_buffer, (len << stereo) * sizeof(*buffer));
+  if (length > len) {
+    buffer += len << stereo;
+    if (PicoIn.opt & POPT_EN_FM)
+      YM2612UpdateOne(buffer, length - len, stereo, 1);
+    else
+      memset32(buffer, 0, (length - len) << stereo);
+  }
+
+  // timing and resampling don't exactly agree on the sample count per frame.
+  // keep samples rendered in advance for the next frame.
+  fm_leftover = fmlen - len;
+  if (fm_leftover > 0)
+    memmove(fm_buffer, fm_buffer + (len << stereo),
+      (fm_leftover << stereo) * sizeof(*fm_buffer));
+  else
+    fm_leftover = 0;
 }
 
 // cdda
+static void cdda_raw_update_resampled(s32 *buffer, int length, int stereo)
+{
+  int ret, cdda_bytes, len, i;
+
+  // read 44.1 kHz stereo data in chunks fitting into cdda_out_buffer
+  for (; length > 0; length -= len) {
+    len = length;
+    if (len > sizeof(cdda_out_buffer) / 4)
+      len = sizeof(cdda_out_buffer) / 4;
+
+    cdda_bytes = len*4;
+    ret = 0;
+    if (Pico_mcd->cdda_stream != NULL)
+      ret = pm_read(cdda_out_buffer, cdda_bytes, Pico_mcd->cdda_stream);
+    if (ret < cdda_bytes) {
+      memset((char *)cdda_out_buffer + ret, 0, cdda_bytes - ret);
+      Pico_mcd->cdda_stream = NULL;
+    }
+
+    if (stereo)
+      for (i = 0; i < len*2; i++)
+        *buffer++ = cdda_out_buffer[i] >> 1;
+    else
+      for (i = 0; i < len; i++)
+        *buffer++ = (cdda_out_buffer[2*i] + cdda_out_buffer[2*i+1]) >> 2;
+  }
+}
+
+static resampler_t *cdda_resampler_new(void)
+{
+  int rate = PicoIn.sndRate;
+
+  if ((rate >= 44100 - 100 && rate <= 44100 + 100) ||
+      (rate >= 22050 - 100 && rate <= 22050 + 100) ||
+      (rate >= 11025 - 100 && rate <= 11025 + 100))
+    return NULL; // handled by plain decimation
+
+  return resampler_new(32, 44100, rate, PicoIn.opt & POPT_EN_STEREO,
+                       cdda_raw_update_resampled);
+}
+
 static void cdda_raw_update(int *buffer, int length)
 {
   int ret, cdda_bytes, mult = 1;
 
+  if (cdda_resampler) {
+    static s32 cdda_buffer[2*(44100+100)/50];
+    int i;
+
+    if (length > sizeof(cdda_buffer) / 8)
+      length = sizeof(cdda_buffer) / 8;
+    resampler_update(cdda_resampler, cdda_buffer, length);
+    length <<= !!(PicoIn.opt & POPT_EN_STEREO);
+    for (i = 0; i < length; i++)
+      buffer[i] += cdda_buffer[i];
+    return;
+  }
+
   cdda_bytes = length*4;
   if (PicoIn.sndRate <= 22050 + 100) mult = 2;
   if (PicoIn.sndRate <  22050 - 100) mult = 4;
@@ -318,6 +637,9 @@ PICO_INTERNAL void PsndClear(void)
     memset32(PsndBuffer, 0, PicoIn.opt & POPT_EN_STEREO ? len*2 : len);
   // drop pos remainder to avoid rounding errors (not entirely correct though)
   Pico.snd.dac_pos = Pico.snd.fm_pos = Pico.snd.psg_pos = Pico.snd.ym2413_pos = 0;
+  // FM samples already rendered for the next frame
+  if (fm_resampler)
+    Pico.snd.fm_pos = fm_leftover << 20;
 }
 
 
@@ -338,6 +660,13 @@ static int PsndRender(int offset, int length)
     return length;
   }
 
+  // replay writes still queued, rendering what's before them
+  if (fm_queue_len) {
+    PsndDoFM(fm_queue[fm_queue_len-1].cycles);
+    fmlen = ((Pico.snd.fm_pos+0x80000) >> 20);
+    daclen = ((Pico.snd.dac_pos+0x80000) >> 20);
+  }
+
   // Fill up DAC output in case of missing samples (Q16 rounding errors)
   if (length-daclen > 0) {
     short *dacbuf = PicoIn.sndOut + (daclen << stereo);
@@ -359,8 +688,12 @@ static int PsndRender(int offset, int length)
       SN76496Update(psgbuf, length-psglen, stereo);
   }
 
+  if (fm_resampler) {
+    // resample native rate FM output, rendering what's missing
+    resampler_update(fm_resampler, buf32, length-offset);
+  }
   // Add in parts of the FM buffer not yet done
-  if (length-fmlen > 0) {
+  else if (length-fmlen > 0) {
     int *fmbuf = buf32 + ((fmlen-offset) << stereo);
     Pico.snd.fm_pos += (length-fmlen) << 20;
     if (PicoIn.opt & POPT_EN_FM)
@@ -402,10 +735,16 @@ PICO_INTERNAL void PsndGetSamples(int y)
 
   curr_pos  = PsndRender(0, Pico.snd.len_use);
 
+  if (pmov_active)
+    pmov_sound(PicoIn.sndOut, curr_pos * ((PicoIn.opt & POPT_EN_STEREO) ? 4 : 2));
   if (PicoIn.writeSound)
     PicoIn.writeSound(curr_pos * ((PicoIn.opt & POPT_EN_STEREO) ? 4 : 2));
   // clear sound buffer
   PsndClear();
+
+  elprintf(EL_SOUND, "render calls: fm %d dac %d psg %d, %d writes",
+    snd_calls.fm, snd_calls.dac, snd_calls.psg, snd_calls.writes);
+  memset(&snd_calls, 0, sizeof(snd_calls));
 }
 
 static int PsndRenderMS(int offset, int length)
@@ -427,14 +766,8 @@ static int PsndRenderMS(int offset, int length)
   if (length-ym2413len > 0) {
     short *ym2413buf = PicoIn.sndOut + (ym2413len << stereo);
     Pico.snd.ym2413_pos += (length-ym2413len) << 16;
-    int len = (length-ym2413len);
-    if (PicoIn.opt & POPT_EN_YM2413){
-      while (len-- > 0) {
-        int16_t getdata = OPLL_calc(opll) * 3;
-        *ym2413buf += getdata;
-        ym2413buf += 1<<stereo;
-      }
-    }
+    if (PicoIn.opt & POPT_EN_YM2413)
+      ym2413_render(ym2413buf, length-ym2413len, stereo);
   }
 
   // upmix to "stereo" if needed
@@ -456,6 +789,8 @@ PICO_INTERNAL void PsndGetSamplesMS(int y)
 
   curr_pos  = PsndRenderMS(0, Pico.snd.len_use);
 
+  if (pmov_active)
+    pmov_sound(PicoIn.sndOut, curr_pos * ((PicoIn.opt & POPT_EN_STEREO) ? 4 : 2));
   if (PicoIn.writeSound != NULL)
     PicoIn.writeSound(curr_pos * ((PicoIn.opt & POPT_EN_STEREO) ? 4 : 2));
   PsndClear();
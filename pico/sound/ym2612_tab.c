@@ -0,0 +1,7686 @@
+/* generated by tools/make_ym2612_tab, do not modify */
+const UINT16 ym_tl_tab[TL_TAB_LEN] = {
+  0x0019, 0x004b, 0x007d, 0x00af, 0x00e1, 0x0113, 0x0145, 0x0178, 0x01aa, 0x01dc, 0x020e, 0x0241, 0x0271, 0x02a4, 0x02d6, 0x0309,
+  0x033b, 0x036b, 0x039e, 0x03cf, 0x0400, 0x0433, 0x0466, 0x0494, 0x04c8, 0x04f8, 0x052c, 0x055c, 0x058d, 0x05c0, 0x05f0, 0x0623,
+  0x0652, 0x0683, 0x06b5, 0x06e5, 0x0715, 0x0747, 0x077a, 0x07a9, 0x07da, 0x080c, 0x0838, 0x086c, 0x089c, 0x08cc, 0x08fc, 0x0928,
+  0x095c, 0x098a, 0x09b8, 0x09e8, 0x0a18, 0x0a4a, 0x0a7c, 0x0aa8, 0x0ad6, 0x0b0a, 0x0b38, 0x0b68, 0x0b90, 0x0bc0, 0x0bf2, 0x0c1c,
+  0x0c4e, 0x0c78, 0x0cae, 0x0cda, 0x0d06, 0x0d34, 0x0d62, 0x0d90, 0x0dc0, 0x0de6, 0x0e16, 0x0e48, 0x0e70, 0x0e98, 0x0eca, 0x0ef4,
+  0x0f1e, 0x0f52, 0x0f7e, 0x0fa8, 0x0fd4, 0x1000, 0x102c, 0x1050, 0x107c, 0x10a8, 0x10d8, 0x10fc, 0x112c, 0x1150, 0x1180, 0x11a4,
+  0x11d4, 0x11f8, 0x1220, 0x1250, 0x1278, 0x12a0, 0x12c4, 0x12ec, 0x1314, 0x133c, 0x1364, 0x138c, 0x13b4, 0x13e0, 0x1408, 0x1430,
+  0x1450, 0x1478, 0x14a4, 0x14c0, 0x14ec, 0x1518, 0x1534, 0x1560, 0x1580, 0x15ac, 0x15c8, 0x15f8, 0x1614, 0x1634, 0x1664, 0x1680,
+  0x16a0, 0x16c0, 0x16f0, 0x1710, 0x1730, 0x1750, 0x1770, 0x1790, 0x17b0, 0x17d4, 0x17f4, 0x1814, 0x1838, 0x1858, 0x1878, 0x189c,
+  0x18c0, 0x18e0, 0x18f0, 0x1914, 0x1938, 0x195c, 0x197c, 0x1990, 0x19b4, 0x19d8, 0x19e8, 0x1a0c, 0x1a20, 0x1a44, 0x1a68, 0x1a78,
+  0x1aa0, 0x1ab0, 0x1ad4, 0x1ae8, 0x1afc, 0x1b20, 0x1b34, 0x1b58, 0x1b6c, 0x1b80, 0x1ba4, 0x1bb8, 0x1bcc, 0x1bf4, 0x1c08, 0x1c18,
+  0x1c2c, 0x1c40, 0x1c68, 0x1c7c, 0x1c90, 0x1ca4, 0x1cb8, 0x1ccc, 0x1ce0, 0x1cf4, 0x1d08, 0x1d1c, 0x1d30, 0x1d44, 0x1d58, 0x1d6c,
+  0x1d80, 0x1d94, 0x1da8, 0x1dc0, 0x1dd4, 0x1de8, 0x1dfc, 0x1dfc, 0x1e10, 0x1e28, 0x1e3c, 0x1e3c, 0x1e50, 0x1e64, 0x1e7c, 0x1e7c,
+  0x1e90, 0x1ea4, 0x1ea4, 0x1eb8, 0x1ed0, 0x1ed0, 0x1ee4, 0x1ee4, 0x1efc, 0x1f10, 0x1f10, 0x1f24, 0x1f24, 0x1f3c, 0x1f3c, 0x1f50,
+  0x1f50, 0x1f50, 0x1f68, 0x1f68, 0x1f7c, 0x1f7c, 0x1f7c, 0x1f90, 0x1f90, 0x1f90, 0x1fa8, 0x1fa8, 0x1fa8, 0x1fbc, 0x1fbc, 0x1fbc,
+  0x1fbc, 0x1fd4, 0x1fd4, 0x1fd4, 0x1fd4, 0x1fd4, 0x1fd4, 0x1fd4, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8, 0x1fe8,
+  0x0018, 0x0049, 0x007a, 0x00ab, 0x00dc, 0x010d, 0x013e, 0x0170, 0x01a0, 0x01d1, 0x0203, 0x0234, 0x0264, 0x0296, 0x02c6, 0x02f8,
+  0x0329, 0x0358, 0x038a, 0x03ba, 0x03ea, 0x041c, 0x044e, 0x047b, 0x04ae, 0x04dc, 0x0510, 0x053e, 0x056f, 0x05a0, 0x05d0, 0x0601,
+  0x0630, 0x065f, 0x0691, 0x06bf, 0x06ee, 0x071f, 0x0751, 0x077f, 0x07ae, 0x07df, 0x080c, 0x083e, 0x086c, 0x089c, 0x08cc, 0x08f6,
+  0x0928, 0x0956, 0x0984, 0x09b2, 0x09e2, 0x0a12, 0x0a44, 0x0a6e, 0x0a9a, 0x0ace, 0x0afc, 0x0b2a, 0x0b50, 0x0b80, 0x0bb0, 0x0bd8,
+  0x0c0a, 0x0c34, 0x0c68, 0x0c92, 0x0cbe, 0x0cec, 0x0d18, 0x0d46, 0x0d74, 0x0d9a, 0x0dca, 0x0dfa, 0x0e20, 0x0e48, 0x0e7a, 0x0ea2,
+  0x0eca, 0x0efe, 0x0f28, 0x0f52, 0x0f7e, 0x0fa8, 0x0fd4, 0x0ff4, 0x1020, 0x1050, 0x107c, 0x10a0, 0x10cc, 0x10f0, 0x1120, 0x1144,
+  0x1174, 0x1198, 0x11bc, 0x11ec, 0x1214, 0x1238, 0x1260, 0x1284, 0x12ac, 0x12d4, 0x12f8, 0x1320, 0x1348, 0x1370, 0x139c, 0x13c4,
+  0x13e0, 0x1408, 0x1430, 0x1450, 0x1478, 0x14a4, 0x14c0, 0x14ec, 0x1508, 0x1534, 0x1550, 0x1580, 0x159c, 0x15bc, 0x15e8, 0x1604,
+  0x1624, 0x1644, 0x1670, 0x1690, 0x16b0, 0x16d0, 0x16f0, 0x1710, 0x1730, 0x1750, 0x1770, 0x1790, 0x17b0, 0x17d4, 0x17f4, 0x1814,
+  0x1838, 0x1858, 0x1868, 0x188c, 0x18ac, 0x18d0, 0x18f0, 0x1904, 0x1924, 0x1948, 0x195c, 0x197c, 0x1990, 0x19b4, 0x19d8, 0x19e8,
+  0x1a0c, 0x1a20, 0x1a44, 0x1a54, 0x1a68, 0x1a8c, 0x1aa0, 0x1ac4, 0x1ad4, 0x1ae8, 0x1b10, 0x1b20, 0x1b34, 0x1b58, 0x1b6c, 0x1b80,
+  0x1b94, 0x1ba4, 0x1bcc, 0x1be0, 0x1bf4, 0x1c08, 0x1c18, 0x1c2c, 0x1c40, 0x1c54, 0x1c68, 0x1c7c, 0x1c90, 0x1ca4, 0x1cb8, 0x1ccc,
+  0x1ce0, 0x1cf4, 0x1d08, 0x1d1c, 0x1d30, 0x1d44, 0x1d58, 0x1d58, 0x1d6c, 0x1d80, 0x1d94, 0x1d94, 0x1da8, 0x1dc0, 0x1dd4, 0x1dd4,
+  0x1de8, 0x1dfc, 0x1dfc, 0x1e10, 0x1e28, 0x1e28, 0x1e3c, 0x1e3c, 0x1e50, 0x1e64, 0x1e64, 0x1e7c, 0x1e7c, 0x1e90, 0x1e90, 0x1ea4,
+  0x1ea4, 0x1ea4, 0x1eb8, 0x1eb8, 0x1ed0, 0x1ed0, 0x1ed0, 0x1ee4, 0x1ee4, 0x1ee4, 0x1efc, 0x1efc, 0x1efc, 0x1f10, 0x1f10, 0x1f10,
+  0x1f10, 0x1f24, 0x1f24, 0x1f24, 0x1f24, 0x1f24, 0x1f24, 0x1f24, 0x1f3c, 0x1f3c, 0x1f3c, 0x1f3c, 0x1f3c, 0x1f3c, 0x1f3c, 0x1f3c,
+  0x0018, 0x0048, 0x0077, 0x00a7, 0x00d7, 0x0107, 0x0138, 0x0168, 0x0197, 0x01c7, 0x01f7, 0x0228, 0x0257, 0x0288, 0x02b7, 0x02e8,
+  0x0318, 0x0346, 0x0377, 0x03a6, 0x03d4, 0x0406, 0x0436, 0x0463, 0x0494, 0x04c2, 0x04f4, 0x0522, 0x0551, 0x0581, 0x05b0, 0x05e0,
+  0x060e, 0x063c, 0x066d, 0x069a, 0x06c8, 0x06f8, 0x0729, 0x0756, 0x0784, 0x07b4, 0x07df, 0x0810, 0x083e, 0x086c, 0x089c, 0x08c6,
+  0x08f6, 0x0922, 0x0950, 0x097c, 0x09ac, 0x09da, 0x0a0c, 0x0a36, 0x0a60, 0x0a92, 0x0ac0, 0x0aec, 0x0b12, 0x0b40, 0x0b70, 0x0b98,
+  0x0bc8, 0x0bf2, 0x0c24, 0x0c4e, 0x0c78, 0x0ca4, 0x0cd0, 0x0cfe, 0x0d2a, 0x0d50, 0x0d7e, 0x0dac, 0x0dd2, 0x0dfa, 0x0e2a, 0x0e52,
+  0x0e7a, 0x0eac, 0x0ed4, 0x0efe, 0x0f28, 0x0f52, 0x0f7e, 0x0f9e, 0x0fc8, 0x0ff4, 0x1020, 0x1044, 0x1070, 0x1094, 0x10c0, 0x10e4,
+  0x1114, 0x1138, 0x115c, 0x118c, 0x11b0, 0x11d4, 0x11f8, 0x1220, 0x1244, 0x126c, 0x1290, 0x12b8, 0x12e0, 0x1308, 0x1330, 0x1358,
+  0x1370, 0x139c, 0x13c4, 0x13e0, 0x1408, 0x1430, 0x1450, 0x1478, 0x1494, 0x14c0, 0x14dc, 0x1508, 0x1524, 0x1544, 0x1570, 0x158c,
+  0x15ac, 0x15c8, 0x15f8, 0x1614, 0x1634, 0x1654, 0x1670, 0x1690, 0x16b0, 0x16d0, 0x16f0, 0x1710, 0x1730, 0x1750, 0x1770, 0x1790,
+  0x17b0, 0x17d4, 0x17e4, 0x1804, 0x1824, 0x1848, 0x1868, 0x1878, 0x189c, 0x18c0, 0x18d0, 0x18f0, 0x1904, 0x1924, 0x1948, 0x195c,
+  0x197c, 0x1990, 0x19b4, 0x19c4, 0x19d8, 0x19fc, 0x1a0c, 0x1a30, 0x1a44, 0x1a54, 0x1a78, 0x1a8c, 0x1aa0, 0x1ac4, 0x1ad4, 0x1ae8,
+  0x1afc, 0x1b10, 0x1b34, 0x1b48, 0x1b58, 0x1b6c, 0x1b80, 0x1b94, 0x1ba4, 0x1bb8, 0x1bcc, 0x1be0, 0x1bf4, 0x1c08, 0x1c18, 0x1c2c,
+  0x1c40, 0x1c54, 0x1c68, 0x1c7c, 0x1c90, 0x1ca4, 0x1cb8, 0x1cb8, 0x1ccc, 0x1ce0, 0x1cf4, 0x1cf4, 0x1d08, 0x1d1c, 0x1d30, 0x1d30,
+  0x1d44, 0x1d58, 0x1d58, 0x1d6c, 0x1d80, 0x1d80, 0x1d94, 0x1d94, 0x1da8, 0x1dc0, 0x1dc0, 0x1dd4, 0x1dd4, 0x1de8, 0x1de8, 0x1dfc,
+  0x1dfc, 0x1dfc, 0x1e10, 0x1e10, 0x1e28, 0x1e28, 0x1e28, 0x1e3c, 0x1e3c, 0x1e3c, 0x1e50, 0x1e50, 0x1e50, 0x1e64, 0x1e64, 0x1e64,
+  0x1e64, 0x1e7c, 0x1e7c, 0x1e7c, 0x1e7c, 0x1e7c, 0x1e7c, 0x1e7c, 0x1e90, 0x1e90, 0x1e90, 0x1e90, 0x1e90, 0x1e90, 0x1e90, 0x1e90,
+  0x0017, 0x0046, 0x0075, 0x00a4, 0x00d3, 0x0102, 0x0131, 0x0160, 0x018f, 0x01be, 0x01ed, 0x021c, 0x024a, 0x027a, 0x02a8, 0x02d8,
+  0x0307, 0x0334, 0x0364, 0x0392, 0x03bf, 0x03ef, 0x041f, 0x044b, 0x047b, 0x04a8, 0x04d9, 0x0506, 0x0534, 0x0563, 0x0591, 0x05c0,
+  0x05ec, 0x061a, 0x0649, 0x0676, 0x06a3, 0x06d2, 0x0702, 0x072e, 0x075b, 0x078a, 0x07b4, 0x07e4, 0x0810, 0x083e, 0x086c, 0x0896,
+  0x08c6, 0x08f0, 0x091c, 0x0948, 0x0976, 0x09a4, 0x09d4, 0x09fe, 0x0a28, 0x0a58, 0x0a84, 0x0ab0, 0x0ad6, 0x0b02, 0x0b32, 0x0b58,
+  0x0b88, 0x0bb0, 0x0be0, 0x0c0a, 0x0c34, 0x0c60, 0x0c8a, 0x0cb6, 0x0ce2, 0x0d06, 0x0d34, 0x0d62, 0x0d88, 0x0dac, 0x0ddc, 0x0e04,
+  0x0e2a, 0x0e5c, 0x0e84, 0x0eac, 0x0ed4, 0x0efe, 0x0f28, 0x0f48, 0x0f72, 0x0f9e, 0x0fc8, 0x0fea, 0x1018, 0x1038, 0x1064, 0x1088,
+  0x10b4, 0x10d8, 0x10fc, 0x112c, 0x1150, 0x1174, 0x1198, 0x11bc, 0x11e0, 0x1208, 0x122c, 0x1250, 0x1278, 0x12a0, 0x12c4, 0x12ec,
+  0x1308, 0x1330, 0x1358, 0x1370, 0x139c, 0x13c4, 0x13e0, 0x1408, 0x1424, 0x1450, 0x146c, 0x1494, 0x14b0, 0x14d0, 0x14f8, 0x1518,
+  0x1534, 0x1550, 0x1580, 0x159c, 0x15bc, 0x15d8, 0x15f8, 0x1614, 0x1634, 0x1654, 0x1670, 0x1690, 0x16b0, 0x16d0, 0x16f0, 0x1710,
+  0x1730, 0x1750, 0x1760, 0x1780, 0x17a0, 0x17c0, 0x17e4, 0x17f4, 0x1814, 0x1838, 0x1848, 0x1868, 0x1878, 0x189c, 0x18c0, 0x18d0,
+  0x18f0, 0x1904, 0x1924, 0x1938, 0x1948, 0x196c, 0x197c, 0x19a0, 0x19b4, 0x19c4, 0x19e8, 0x19fc, 0x1a0c, 0x1a30, 0x1a44, 0x1a54,
+  0x1a68, 0x1a78, 0x1aa0, 0x1ab0, 0x1ac4, 0x1ad4, 0x1ae8, 0x1afc, 0x1b10, 0x1b20, 0x1b34, 0x1b48, 0x1b58, 0x1b6c, 0x1b80, 0x1b94,
+  0x1ba4, 0x1bb8, 0x1bcc, 0x1be0, 0x1bf4, 0x1c08, 0x1c18, 0x1c18, 0x1c2c, 0x1c40, 0x1c54, 0x1c54, 0x1c68, 0x1c7c, 0x1c90, 0x1c90,
+  0x1ca4, 0x1cb8, 0x1cb8, 0x1ccc, 0x1ce0, 0x1ce0, 0x1cf4, 0x1cf4, 0x1d08, 0x1d1c, 0x1d1c, 0x1d30, 0x1d30, 0x1d44, 0x1d44, 0x1d58,
+  0x1d58, 0x1d58, 0x1d6c, 0x1d6c, 0x1d80, 0x1d80, 0x1d80, 0x1d94, 0x1d94, 0x1d94, 0x1da8, 0x1da8, 0x1da8, 0x1dc0, 0x1dc0, 0x1dc0,
+  0x1dc0, 0x1dd4, 0x1dd4, 0x1dd4, 0x1dd4, 0x1dd4, 0x1dd4, 0x1dd4, 0x1de8, 0x1de8, 0x1de8, 0x1de8, 0x1de8, 0x1de8, 0x1de8, 0x1de8,
+  0x0017, 0x0045, 0x0072, 0x00a0, 0x00ce, 0x00fc, 0x012a, 0x0158, 0x0186, 0x01b4, 0x01e2, 0x0211, 0x023d, 0x026c, 0x029a, 0x02c8,
+  0x02f6, 0x0322, 0x0351, 0x037e, 0x03ab, 0x03da, 0x0408, 0x0433, 0x0463, 0x048e, 0x04be, 0x04ea, 0x0517, 0x0546, 0x0572, 0x05a0,
+  0x05cc, 0x05f9, 0x0627, 0x0652, 0x067f, 0x06ac, 0x06db, 0x0706, 0x0733, 0x0760, 0x078a, 0x07b9, 0x07e4, 0x0810, 0x083e, 0x0866,
+  0x0896, 0x08c0, 0x08ea, 0x0916, 0x0942, 0x0970, 0x099e, 0x09c6, 0x09f0, 0x0a20, 0x0a4a, 0x0a76, 0x0a9a, 0x0ac6, 0x0af4, 0x0b1a,
+  0x0b48, 0x0b70, 0x0ba0, 0x0bc8, 0x0bf2, 0x0c1c, 0x0c46, 0x0c70, 0x0c9c, 0x0cbe, 0x0cec, 0x0d18, 0x0d3c, 0x0d62, 0x0d90, 0x0db6,
+  0x0ddc, 0x0e0c, 0x0e34, 0x0e5c, 0x0e84, 0x0eac, 0x0ed4, 0x0ef4, 0x0f1e, 0x0f48, 0x0f72, 0x0f92, 0x0fbe, 0x0fde, 0x100c, 0x102c,
+  0x1058, 0x107c, 0x10a0, 0x10cc, 0x10f0, 0x1114, 0x1138, 0x115c, 0x1180, 0x11a4, 0x11c8, 0x11ec, 0x1214, 0x1238, 0x1260, 0x1284,
+  0x12a0, 0x12c4, 0x12ec, 0x1308, 0x1330, 0x1358, 0x1370, 0x139c, 0x13b4, 0x13e0, 0x13fc, 0x1424, 0x1440, 0x145c, 0x1488, 0x14a4,
+  0x14c0, 0x14dc, 0x1508, 0x1524, 0x1544, 0x1560, 0x1580, 0x159c, 0x15bc, 0x15d8, 0x15f8, 0x1614, 0x1634, 0x1654, 0x1670, 0x1690,
+  0x16b0, 0x16d0, 0x16e0, 0x1700, 0x1720, 0x1740, 0x1760, 0x1770, 0x1790, 0x17b0, 0x17c0, 0x17e4, 0x17f4, 0x1814, 0x1838, 0x1848,
+  0x1868, 0x1878, 0x189c, 0x18ac, 0x18c0, 0x18e0, 0x18f0, 0x1914, 0x1924, 0x1938, 0x195c, 0x196c, 0x197c, 0x19a0, 0x19b4, 0x19c4,
+  0x19d8, 0x19e8, 0x1a0c, 0x1a20, 0x1a30, 0x1a44, 0x1a54, 0x1a68, 0x1a78, 0x1a8c, 0x1aa0, 0x1ab0, 0x1ac4, 0x1ad4, 0x1ae8, 0x1afc,
+  0x1b10, 0x1b20, 0x1b34, 0x1b48, 0x1b58, 0x1b6c, 0x1b80, 0x1b80, 0x1b94, 0x1ba4, 0x1bb8, 0x1bb8, 0x1bcc, 0x1be0, 0x1bf4, 0x1bf4,
+  0x1c08, 0x1c18, 0x1c18, 0x1c2c, 0x1c40, 0x1c40, 0x1c54, 0x1c54, 0x1c68, 0x1c7c, 0x1c7c, 0x1c90, 0x1c90, 0x1ca4, 0x1ca4, 0x1cb8,
+  0x1cb8, 0x1cb8, 0x1ccc, 0x1ccc, 0x1ce0, 0x1ce0, 0x1ce0, 0x1cf4, 0x1cf4, 0x1cf4, 0x1d08, 0x1d08, 0x1d08, 0x1d1c, 0x1d1c, 0x1d1c,
+  0x1d1c, 0x1d30, 0x1d30, 0x1d30, 0x1d30, 0x1d30, 0x1d30, 0x1d30, 0x1d44, 0x1d44, 0x1d44, 0x1d44, 0x1d44, 0x1d44, 0x1d44, 0x1d44,
+  0x0016, 0x0043, 0x0070, 0x009d, 0x00ca, 0x00f7, 0x0124, 0x0151, 0x017e, 0x01ab, 0x01d8, 0x0205, 0x0231, 0x025f, 0x028b, 0x02b9,
+  0x02e6, 0x0311, 0x033f, 0x036b, 0x0397, 0x03c5, 0x03f2, 0x041c, 0x044b, 0x0475, 0x04a4, 0x04cf, 0x04fb, 0x0529, 0x0554, 0x0581,
+  0x05ac, 0x05d8, 0x0605, 0x0630, 0x065b, 0x0688, 0x06b5, 0x06e0, 0x070b, 0x0738, 0x0760, 0x078f, 0x07b9, 0x07e4, 0x0810, 0x0838,
+  0x0866, 0x0890, 0x08ba, 0x08e4, 0x0910, 0x093c, 0x096a, 0x0990, 0x09b8, 0x09e8, 0x0a12, 0x0a3c, 0x0a60, 0x0a8c, 0x0ab8, 0x0ade,
+  0x0b0a, 0x0b32, 0x0b60, 0x0b88, 0x0bb0, 0x0bd8, 0x0c02, 0x0c2c, 0x0c56, 0x0c78, 0x0ca4, 0x0cd0, 0x0cf4, 0x0d18, 0x0d46, 0x0d6a,
+  0x0d90, 0x0dc0, 0x0de6, 0x0e0c, 0x0e34, 0x0e5c, 0x0e84, 0x0ea2, 0x0eca, 0x0ef4, 0x0f1e, 0x0f3e, 0x0f68, 0x0f88, 0x0fb4, 0x0fd4,
+  0x1000, 0x1020, 0x1044, 0x1070, 0x1094, 0x10b4, 0x10d8, 0x10fc, 0x1120, 0x1144, 0x1168, 0x118c, 0x11b0, 0x11d4, 0x11f8, 0x1220,
+  0x1238, 0x1260, 0x1284, 0x12a0, 0x12c4, 0x12ec, 0x1308, 0x1330, 0x1348, 0x1370, 0x138c, 0x13b4, 0x13d0, 0x13ec, 0x1418, 0x1430,
+  0x1450, 0x146c, 0x1494, 0x14b0, 0x14d0, 0x14ec, 0x1508, 0x1524, 0x1544, 0x1560, 0x1580, 0x159c, 0x15bc, 0x15d8, 0x15f8, 0x1614,
+  0x1634, 0x1654, 0x1664, 0x1680, 0x16a0, 0x16c0, 0x16e0, 0x16f0, 0x1710, 0x1730, 0x1740, 0x1760, 0x1770, 0x1790, 0x17b0, 0x17c0,
+  0x17e4, 0x17f4, 0x1814, 0x1824, 0x1838, 0x1858, 0x1868, 0x188c, 0x189c, 0x18ac, 0x18d0, 0x18e0, 0x18f0, 0x1914, 0x1924, 0x1938,
+  0x1948, 0x195c, 0x197c, 0x1990, 0x19a0, 0x19b4, 0x19c4, 0x19d8, 0x19e8, 0x19fc, 0x1a0c, 0x1a20, 0x1a30, 0x1a44, 0x1a54, 0x1a68,
+  0x1a78, 0x1a8c, 0x1aa0, 0x1ab0, 0x1ac4, 0x1ad4, 0x1ae8, 0x1ae8, 0x1afc, 0x1b10, 0x1b20, 0x1b20, 0x1b34, 0x1b48, 0x1b58, 0x1b58,
+  0x1b6c, 0x1b80, 0x1b80, 0x1b94, 0x1ba4, 0x1ba4, 0x1bb8, 0x1bb8, 0x1bcc, 0x1be0, 0x1be0, 0x1bf4, 0x1bf4, 0x1c08, 0x1c08, 0x1c18,
+  0x1c18, 0x1c18, 0x1c2c, 0x1c2c, 0x1c40, 0x1c40, 0x1c40, 0x1c54, 0x1c54, 0x1c54, 0x1c68, 0x1c68, 0x1c68, 0x1c7c, 0x1c7c, 0x1c7c,
+  0x1c7c, 0x1c90, 0x1c90, 0x1c90, 0x1c90, 0x1c90, 0x1c90, 0x1c90, 0x1ca4, 0x1ca4, 0x1ca4, 0x1ca4, 0x1ca4, 0x1ca4, 0x1ca4, 0x1ca4,
+  0x0016, 0x0042, 0x006e, 0x0099, 0x00c6, 0x00f1, 0x011e, 0x014a, 0x0176, 0x01a2, 0x01ce, 0x01fa, 0x0225, 0x0252, 0x027d, 0x02aa,
+  0x02d6, 0x0300, 0x032d, 0x0358, 0x0383, 0x03b0, 0x03dc, 0x0406, 0x0433, 0x045d, 0x048b, 0x04b5, 0x04e0, 0x050c, 0x0537, 0x0563,
+  0x058d, 0x05b8, 0x05e4, 0x060e, 0x0638, 0x0664, 0x0691, 0x06ba, 0x06e5, 0x0710, 0x0738, 0x0765, 0x078f, 0x07b9, 0x07e4, 0x080c,
+  0x0838, 0x0860, 0x088a, 0x08b4, 0x08de, 0x090a, 0x0936, 0x095c, 0x0984, 0x09b2, 0x09da, 0x0a04, 0x0a28, 0x0a52, 0x0a7c, 0x0aa2,
+  0x0ace, 0x0af4, 0x0b22, 0x0b48, 0x0b70, 0x0b98, 0x0bc0, 0x0bea, 0x0c12, 0x0c34, 0x0c60, 0x0c8a, 0x0cae, 0x0cd0, 0x0cfe, 0x0d22,
+  0x0d46, 0x0d74, 0x0d9a, 0x0dc0, 0x0de6, 0x0e0c, 0x0e34, 0x0e52, 0x0e7a, 0x0ea2, 0x0eca, 0x0eea, 0x0f14, 0x0f32, 0x0f5c, 0x0f7e,
+  0x0fa8, 0x0fc8, 0x0fea, 0x1018, 0x1038, 0x1058, 0x107c, 0x10a0, 0x10c0, 0x10e4, 0x1108, 0x112c, 0x1150, 0x1174, 0x1198, 0x11bc,
+  0x11d4, 0x11f8, 0x1220, 0x1238, 0x1260, 0x1284, 0x12a0, 0x12c4, 0x12e0, 0x1308, 0x1320, 0x1348, 0x1364, 0x1380, 0x13a8, 0x13c4,
+  0x13e0, 0x13fc, 0x1424, 0x1440, 0x145c, 0x1478, 0x1494, 0x14b0, 0x14d0, 0x14ec, 0x1508, 0x1524, 0x1544, 0x1560, 0x1580, 0x159c,
+  0x15bc, 0x15d8, 0x15e8, 0x1604, 0x1624, 0x1644, 0x1664, 0x1670, 0x1690, 0x16b0, 0x16c0, 0x16e0, 0x16f0, 0x1710, 0x1730, 0x1740,
+  0x1760, 0x1770, 0x1790, 0x17a0, 0x17b0, 0x17d4, 0x17e4, 0x1804, 0x1814, 0x1824, 0x1848, 0x1858, 0x1868, 0x188c, 0x189c, 0x18ac,
+  0x18c0, 0x18d0, 0x18f0, 0x1904, 0x1914, 0x1924, 0x1938, 0x1948, 0x195c, 0x196c, 0x197c, 0x1990, 0x19a0, 0x19b4, 0x19c4, 0x19d8,
+  0x19e8, 0x19fc, 0x1a0c, 0x1a20, 0x1a30, 0x1a44, 0x1a54, 0x1a54, 0x1a68, 0x1a78, 0x1a8c, 0x1a8c, 0x1aa0, 0x1ab0, 0x1ac4, 0x1ac4,
+  0x1ad4, 0x1ae8, 0x1ae8, 0x1afc, 0x1b10, 0x1b10, 0x1b20, 0x1b20, 0x1b34, 0x1b48, 0x1b48, 0x1b58, 0x1b58, 0x1b6c, 0x1b6c, 0x1b80,
+  0x1b80, 0x1b80, 0x1b94, 0x1b94, 0x1ba4, 0x1ba4, 0x1ba4, 0x1bb8, 0x1bb8, 0x1bb8, 0x1bcc, 0x1bcc, 0x1bcc, 0x1be0, 0x1be0, 0x1be0,
+  0x1be0, 0x1bf4, 0x1bf4, 0x1bf4, 0x1bf4, 0x1bf4, 0x1bf4, 0x1bf4, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c08, 0x1c08,
+  0x0015, 0x0040, 0x006b, 0x0096, 0x00c1, 0x00ec, 0x0118, 0x0143, 0x016e, 0x0199, 0x01c4, 0x01ef, 0x0219, 0x0245, 0x0270, 0x029b,
+  0x02c6, 0x02f0, 0x031c, 0x0346, 0x0370, 0x039c, 0x03c7, 0x03ef, 0x041c, 0x0445, 0x0472, 0x049b, 0x04c5, 0x04f1, 0x051b, 0x0546,
+  0x056f, 0x0599, 0x05c4, 0x05ec, 0x0616, 0x0641, 0x066d, 0x0695, 0x06bf, 0x06e9, 0x0710, 0x073d, 0x0765, 0x078f, 0x07b9, 0x07df,
+  0x080c, 0x0832, 0x085a, 0x0884, 0x08ae, 0x08d8, 0x0904, 0x0928, 0x0950, 0x097c, 0x09a4, 0x09ce, 0x09f0, 0x0a18, 0x0a44, 0x0a68,
+  0x0a92, 0x0ab8, 0x0ae4, 0x0b0a, 0x0b32, 0x0b58, 0x0b80, 0x0ba8, 0x0bd0, 0x0bf2, 0x0c1c, 0x0c46, 0x0c68, 0x0c8a, 0x0cb6, 0x0cda,
+  0x0cfe, 0x0d2a, 0x0d50, 0x0d74, 0x0d9a, 0x0dc0, 0x0de6, 0x0e04, 0x0e2a, 0x0e52, 0x0e7a, 0x0e98, 0x0ec0, 0x0ee0, 0x0f08, 0x0f28,
+  0x0f52, 0x0f72, 0x0f92, 0x0fbe, 0x0fde, 0x1000, 0x1020, 0x1044, 0x1064, 0x1088, 0x10a8, 0x10cc, 0x10f0, 0x1114, 0x1138, 0x115c,
+  0x1174, 0x1198, 0x11bc, 0x11d4, 0x11f8, 0x1220, 0x1238, 0x1260, 0x1278, 0x12a0, 0x12b8, 0x12e0, 0x12f8, 0x1314, 0x133c, 0x1358,
+  0x1370, 0x138c, 0x13b4, 0x13d0, 0x13ec, 0x1408, 0x1424, 0x1440, 0x145c, 0x1478, 0x1494, 0x14b0, 0x14d0, 0x14ec, 0x1508, 0x1524,
+  0x1544, 0x1560, 0x1570, 0x158c, 0x15ac, 0x15c8, 0x15e8, 0x15f8, 0x1614, 0x1634, 0x1644, 0x1664, 0x1670, 0x1690, 0x16b0, 0x16c0,
+  0x16e0, 0x16f0, 0x1710, 0x1720, 0x1730, 0x1750, 0x1760, 0x1780, 0x1790, 0x17a0, 0x17c0, 0x17d4, 0x17e4, 0x1804, 0x1814, 0x1824,
+  0x1838, 0x1848, 0x1868, 0x1878, 0x188c, 0x189c, 0x18ac, 0x18c0, 0x18d0, 0x18e0, 0x18f0, 0x1904, 0x1914, 0x1924, 0x1938, 0x1948,
+  0x195c, 0x196c, 0x197c, 0x1990, 0x19a0, 0x19b4, 0x19c4, 0x19c4, 0x19d8, 0x19e8, 0x19fc, 0x19fc, 0x1a0c, 0x1a20, 0x1a30, 0x1a30,
+  0x1a44, 0x1a54, 0x1a54, 0x1a68, 0x1a78, 0x1a78, 0x1a8c, 0x1a8c, 0x1aa0, 0x1ab0, 0x1ab0, 0x1ac4, 0x1ac4, 0x1ad4, 0x1ad4, 0x1ae8,
+  0x1ae8, 0x1ae8, 0x1afc, 0x1afc, 0x1b10, 0x1b10, 0x1b10, 0x1b20, 0x1b20, 0x1b20, 0x1b34, 0x1b34, 0x1b34, 0x1b48, 0x1b48, 0x1b48,
+  0x1b48, 0x1b58, 0x1b58, 0x1b58, 0x1b58, 0x1b58, 0x1b58, 0x1b58, 0x1b6c, 0x1b6c, 0x1b6c, 0x1b6c, 0x1b6c, 0x1b6c, 0x1b6c, 0x1b6c,
+  0x0015, 0x003f, 0x0069, 0x0093, 0x00bd, 0x00e7, 0x0112, 0x013c, 0x0166, 0x0190, 0x01ba, 0x01e5, 0x020e, 0x0239, 0x0262, 0x028d,
+  0x02b7, 0x02e0, 0x030b, 0x0334, 0x035d, 0x0388, 0x03b2, 0x03da, 0x0406, 0x042d, 0x045a, 0x0482, 0x04ab, 0x04d6, 0x04ff, 0x0529,
+  0x0551, 0x057a, 0x05a4, 0x05cc, 0x05f5, 0x061e, 0x0649, 0x0671, 0x069a, 0x06c4, 0x06e9, 0x0715, 0x073d, 0x0765, 0x078f, 0x07b4,
+  0x07df, 0x0806, 0x082c, 0x0854, 0x087e, 0x08a8, 0x08d2, 0x08f6, 0x091c, 0x0948, 0x0970, 0x0998, 0x09b8, 0x09e2, 0x0a0c, 0x0a2e,
+  0x0a58, 0x0a7c, 0x0aa8, 0x0ace, 0x0af4, 0x0b1a, 0x0b40, 0x0b68, 0x0b90, 0x0bb0, 0x0bd8, 0x0c02, 0x0c24, 0x0c46, 0x0c70, 0x0c92,
+  0x0cb6, 0x0ce2, 0x0d06, 0x0d2a, 0x0d50, 0x0d74, 0x0d9a, 0x0db6, 0x0ddc, 0x0e04, 0x0e2a, 0x0e48, 0x0e70, 0x0e8e, 0x0eb6, 0x0ed4,
+  0x0efe, 0x0f1e, 0x0f3e, 0x0f68, 0x0f88, 0x0fa8, 0x0fc8, 0x0fea, 0x100c, 0x102c, 0x1050, 0x1070, 0x1094, 0x10b4, 0x10d8, 0x10fc,
+  0x1114, 0x1138, 0x115c, 0x1174, 0x1198, 0x11bc, 0x11d4, 0x11f8, 0x1214, 0x1238, 0x1250, 0x1278, 0x1290, 0x12ac, 0x12d4, 0x12ec,
+  0x1308, 0x1320, 0x1348, 0x1364, 0x1380, 0x139c, 0x13b4, 0x13d0, 0x13ec, 0x1408, 0x1424, 0x1440, 0x145c, 0x1478, 0x1494, 0x14b0,
+  0x14d0, 0x14ec, 0x14f8, 0x1518, 0x1534, 0x1550, 0x1570, 0x1580, 0x159c, 0x15bc, 0x15c8, 0x15e8, 0x15f8, 0x1614, 0x1634, 0x1644,
+  0x1664, 0x1670, 0x1690, 0x16a0, 0x16b0, 0x16d0, 0x16e0, 0x1700, 0x1710, 0x1720, 0x1740, 0x1750, 0x1760, 0x1780, 0x1790, 0x17a0,
+  0x17b0, 0x17c0, 0x17e4, 0x17f4, 0x1804, 0x1814, 0x1824, 0x1838, 0x1848, 0x1858, 0x1868, 0x1878, 0x188c, 0x189c, 0x18ac, 0x18c0,
+  0x18d0, 0x18e0, 0x18f0, 0x1904, 0x1914, 0x1924, 0x1938, 0x1938, 0x1948, 0x195c, 0x196c, 0x196c, 0x197c, 0x1990, 0x19a0, 0x19a0,
+  0x19b4, 0x19c4, 0x19c4, 0x19d8, 0x19e8, 0x19e8, 0x19fc, 0x19fc, 0x1a0c, 0x1a20, 0x1a20, 0x1a30, 0x1a30, 0x1a44, 0x1a44, 0x1a54,
+  0x1a54, 0x1a54, 0x1a68, 0x1a68, 0x1a78, 0x1a78, 0x1a78, 0x1a8c, 0x1a8c, 0x1a8c, 0x1aa0, 0x1aa0, 0x1aa0, 0x1ab0, 0x1ab0, 0x1ab0,
+  0x1ab0, 0x1ac4, 0x1ac4, 0x1ac4, 0x1ac4, 0x1ac4, 0x1ac4, 0x1ac4, 0x1ad4, 0x1ad4, 0x1ad4, 0x1ad4, 0x1ad4, 0x1ad4, 0x1ad4, 0x1ad4,
+  0x0014, 0x003d, 0x0067, 0x0090, 0x00b9, 0x00e2, 0x010c, 0x0135, 0x015e, 0x0187, 0x01b1, 0x01da, 0x0203, 0x022d, 0x0255, 0x027f,
+  0x02a8, 0x02d0, 0x02fa, 0x0322, 0x034a, 0x0374, 0x039e, 0x03c5, 0x03ef, 0x0416, 0x0442, 0x0469, 0x0491, 0x04bb, 0x04e3, 0x050c,
+  0x0534, 0x055c, 0x0585, 0x05ac, 0x05d4, 0x05fd, 0x0627, 0x064e, 0x0676, 0x069e, 0x06c4, 0x06ee, 0x0715, 0x073d, 0x0765, 0x078a,
+  0x07b4, 0x07da, 0x0800, 0x0828, 0x0850, 0x0878, 0x08a2, 0x08c6, 0x08ea, 0x0916, 0x093c, 0x0962, 0x0984, 0x09ac, 0x09d4, 0x09f6,
+  0x0a20, 0x0a44, 0x0a6e, 0x0a92, 0x0ab8, 0x0ade, 0x0b02, 0x0b2a, 0x0b50, 0x0b70, 0x0b98, 0x0bc0, 0x0be0, 0x0c02, 0x0c2c, 0x0c4e,
+  0x0c70, 0x0c9c, 0x0cbe, 0x0ce2, 0x0d06, 0x0d2a, 0x0d50, 0x0d6a, 0x0d90, 0x0db6, 0x0ddc, 0x0dfa, 0x0e20, 0x0e3e, 0x0e66, 0x0e84,
+  0x0eac, 0x0eca, 0x0eea, 0x0f14, 0x0f32, 0x0f52, 0x0f72, 0x0f92, 0x0fb4, 0x0fd4, 0x0ff4, 0x1018, 0x1038, 0x1058, 0x107c, 0x10a0,
+  0x10b4, 0x10d8, 0x10fc, 0x1114, 0x1138, 0x115c, 0x1174, 0x1198, 0x11b0, 0x11d4, 0x11ec, 0x1214, 0x122c, 0x1244, 0x126c, 0x1284,
+  0x12a0, 0x12b8, 0x12e0, 0x12f8, 0x1314, 0x1330, 0x1348, 0x1364, 0x1380, 0x139c, 0x13b4, 0x13d0, 0x13ec, 0x1408, 0x1424, 0x1440,
+  0x145c, 0x1478, 0x1488, 0x14a4, 0x14c0, 0x14dc, 0x14f8, 0x1508, 0x1524, 0x1544, 0x1550, 0x1570, 0x1580, 0x159c, 0x15bc, 0x15c8,
+  0x15e8, 0x15f8, 0x1614, 0x1624, 0x1634, 0x1654, 0x1664, 0x1680, 0x1690, 0x16a0, 0x16c0, 0x16d0, 0x16e0, 0x1700, 0x1710, 0x1720,
+  0x1730, 0x1740, 0x1760, 0x1770, 0x1780, 0x1790, 0x17a0, 0x17b0, 0x17c0, 0x17d4, 0x17e4, 0x17f4, 0x1804, 0x1814, 0x1824, 0x1838,
+  0x1848, 0x1858, 0x1868, 0x1878, 0x188c, 0x189c, 0x18ac, 0x18ac, 0x18c0, 0x18d0, 0x18e0, 0x18e0, 0x18f0, 0x1904, 0x1914, 0x1914,
+  0x1924, 0x1938, 0x1938, 0x1948, 0x195c, 0x195c, 0x196c, 0x196c, 0x197c, 0x1990, 0x1990, 0x19a0, 0x19a0, 0x19b4, 0x19b4, 0x19c4,
+  0x19c4, 0x19c4, 0x19d8, 0x19d8, 0x19e8, 0x19e8, 0x19e8, 0x19fc, 0x19fc, 0x19fc, 0x1a0c, 0x1a0c, 0x1a0c, 0x1a20, 0x1a20, 0x1a20,
+  0x1a20, 0x1a30, 0x1a30, 0x1a30, 0x1a30, 0x1a30, 0x1a30, 0x1a30, 0x1a44, 0x1a44, 0x1a44, 0x1a44, 0x1a44, 0x1a44, 0x1a44, 0x1a44,
+  0x0014, 0x003c, 0x0064, 0x008d, 0x00b5, 0x00dd, 0x0106, 0x012e, 0x0157, 0x017f, 0x01a7, 0x01d0, 0x01f7, 0x0221, 0x0248, 0x0271,
+  0x029a, 0x02c0, 0x02ea, 0x0311, 0x0338, 0x0362, 0x038a, 0x03b0, 0x03da, 0x0400, 0x042a, 0x0451, 0x0478, 0x04a1, 0x04c8, 0x04f1,
+  0x0517, 0x053e, 0x0567, 0x058d, 0x05b4, 0x05dc, 0x0605, 0x062b, 0x0652, 0x067a, 0x069e, 0x06c8, 0x06ee, 0x0715, 0x073d, 0x0760,
+  0x078a, 0x07ae, 0x07d4, 0x07fa, 0x0822, 0x084a, 0x0872, 0x0896, 0x08ba, 0x08e4, 0x090a, 0x0930, 0x0950, 0x0976, 0x099e, 0x09c0,
+  0x09e8, 0x0a0c, 0x0a36, 0x0a58, 0x0a7c, 0x0aa2, 0x0ac6, 0x0aec, 0x0b12, 0x0b32, 0x0b58, 0x0b80, 0x0ba0, 0x0bc0, 0x0bea, 0x0c0a,
+  0x0c2c, 0x0c56, 0x0c78, 0x0c9c, 0x0cbe, 0x0ce2, 0x0d06, 0x0d22, 0x0d46, 0x0d6a, 0x0d90, 0x0dac, 0x0dd2, 0x0df0, 0x0e16, 0x0e34,
+  0x0e5c, 0x0e7a, 0x0e98, 0x0ec0, 0x0ee0, 0x0efe, 0x0f1e, 0x0f3e, 0x0f5c, 0x0f7e, 0x0f9e, 0x0fbe, 0x0fde, 0x1000, 0x1020, 0x1044,
+  0x1058, 0x107c, 0x10a0, 0x10b4, 0x10d8, 0x10fc, 0x1114, 0x1138, 0x1150, 0x1174, 0x118c, 0x11b0, 0x11c8, 0x11e0, 0x1208, 0x1220,
+  0x1238, 0x1250, 0x1278, 0x1290, 0x12ac, 0x12c4, 0x12e0, 0x12f8, 0x1314, 0x1330, 0x1348, 0x1364, 0x1380, 0x139c, 0x13b4, 0x13d0,
+  0x13ec, 0x1408, 0x1418, 0x1430, 0x1450, 0x146c, 0x1488, 0x1494, 0x14b0, 0x14d0, 0x14dc, 0x14f8, 0x1508, 0x1524, 0x1544, 0x1550,
+  0x1570, 0x1580, 0x159c, 0x15ac, 0x15bc, 0x15d8, 0x15e8, 0x1604, 0x1614, 0x1624, 0x1644, 0x1654, 0x1664, 0x1680, 0x1690, 0x16a0,
+  0x16b0, 0x16c0, 0x16e0, 0x16f0, 0x1700, 0x1710, 0x1720, 0x1730, 0x1740, 0x1750, 0x1760, 0x1770, 0x1780, 0x1790, 0x17a0, 0x17b0,
+  0x17c0, 0x17d4, 0x17e4, 0x17f4, 0x1804, 0x1814, 0x1824, 0x1824, 0x1838, 0x1848, 0x1858, 0x1858, 0x1868, 0x1878, 0x188c, 0x188c,
+  0x189c, 0x18ac, 0x18ac, 0x18c0, 0x18d0, 0x18d0, 0x18e0, 0x18e0, 0x18f0, 0x1904, 0x1904, 0x1914, 0x1914, 0x1924, 0x1924, 0x1938,
+  0x1938, 0x1938, 0x1948, 0x1948, 0x195c, 0x195c, 0x195c, 0x196c, 0x196c, 0x196c, 0x197c, 0x197c, 0x197c, 0x1990, 0x1990, 0x1990,
+  0x1990, 0x19a0, 0x19a0, 0x19a0, 0x19a0, 0x19a0, 0x19a0, 0x19a0, 0x19b4, 0x19b4, 0x19b4, 0x19b4, 0x19b4, 0x19b4, 0x19b4, 0x19b4,
+  0x0013, 0x003b, 0x0062, 0x008a, 0x00b1, 0x00d9, 0x0100, 0x0128, 0x014f, 0x0177, 0x019e, 0x01c6, 0x01ed, 0x0215, 0x023c, 0x0264,
+  0x028b, 0x02b1, 0x02da, 0x0300, 0x0327, 0x034f, 0x0377, 0x039c, 0x03c5, 0x03ea, 0x0414, 0x0439, 0x0460, 0x0488, 0x04ae, 0x04d6,
+  0x04fb, 0x0522, 0x0549, 0x056f, 0x0595, 0x05bc, 0x05e4, 0x0609, 0x0630, 0x0657, 0x067a, 0x06a3, 0x06c8, 0x06ee, 0x0715, 0x0738,
+  0x0760, 0x0784, 0x07a9, 0x07cf, 0x07f5, 0x081c, 0x0844, 0x0866, 0x088a, 0x08b4, 0x08d8, 0x08fc, 0x091c, 0x0942, 0x096a, 0x098a,
+  0x09b2, 0x09d4, 0x09fe, 0x0a20, 0x0a44, 0x0a68, 0x0a8c, 0x0ab0, 0x0ad6, 0x0af4, 0x0b1a, 0x0b40, 0x0b60, 0x0b80, 0x0ba8, 0x0bc8,
+  0x0bea, 0x0c12, 0x0c34, 0x0c56, 0x0c78, 0x0c9c, 0x0cbe, 0x0cda, 0x0cfe, 0x0d22, 0x0d46, 0x0d62, 0x0d88, 0x0da4, 0x0dca, 0x0de6,
+  0x0e0c, 0x0e2a, 0x0e48, 0x0e70, 0x0e8e, 0x0eac, 0x0eca, 0x0eea, 0x0f08, 0x0f28, 0x0f48, 0x0f68, 0x0f88, 0x0fa8, 0x0fc8, 0x0fea,
+  0x1000, 0x1020, 0x1044, 0x1058, 0x107c, 0x10a0, 0x10b4, 0x10d8, 0x10f0, 0x1114, 0x112c, 0x1150, 0x1168, 0x1180, 0x11a4, 0x11bc,
+  0x11d4, 0x11ec, 0x1214, 0x122c, 0x1244, 0x1260, 0x1278, 0x1290, 0x12ac, 0x12c4, 0x12e0, 0x12f8, 0x1314, 0x1330, 0x1348, 0x1364,
+  0x1380, 0x139c, 0x13a8, 0x13c4, 0x13e0, 0x13fc, 0x1418, 0x1424, 0x1440, 0x145c, 0x146c, 0x1488, 0x1494, 0x14b0, 0x14d0, 0x14dc,
+  0x14f8, 0x1508, 0x1524, 0x1534, 0x1544, 0x1560, 0x1570, 0x158c, 0x159c, 0x15ac, 0x15c8, 0x15d8, 0x15e8, 0x1604, 0x1614, 0x1624,
+  0x1634, 0x1644, 0x1664, 0x1670, 0x1680, 0x1690, 0x16a0, 0x16b0, 0x16c0, 0x16d0, 0x16e0, 0x16f0, 0x1700, 0x1710, 0x1720, 0x1730,
+  0x1740, 0x1750, 0x1760, 0x1770, 0x1780, 0x1790, 0x17a0, 0x17a0, 0x17b0, 0x17c0, 0x17d4, 0x17d4, 0x17e4, 0x17f4, 0x1804, 0x1804,
+  0x1814, 0x1824, 0x1824, 0x1838, 0x1848, 0x1848, 0x1858, 0x1858, 0x1868, 0x1878, 0x1878, 0x188c, 0x188c, 0x189c, 0x189c, 0x18ac,
+  0x18ac, 0x18ac, 0x18c0, 0x18c0, 0x18d0, 0x18d0, 0x18d0, 0x18e0, 0x18e0, 0x18e0, 0x18f0, 0x18f0, 0x18f0, 0x1904, 0x1904, 0x1904,
+  0x1904, 0x1914, 0x1914, 0x1914, 0x1914, 0x1914, 0x1914, 0x1914, 0x1924, 0x1924, 0x1924, 0x1924, 0x1924, 0x1924, 0x1924, 0x1924,
+  0x0013, 0x003a, 0x0060, 0x0087, 0x00ad, 0x00d4, 0x00fb, 0x0122, 0x0148, 0x016f, 0x0195, 0x01bc, 0x01e2, 0x020a, 0x0230, 0x0257,
+  0x027d, 0x02a3, 0x02ca, 0x02f0, 0x0315, 0x033d, 0x0364, 0x0388, 0x03b0, 0x03d4, 0x03fd, 0x0422, 0x0448, 0x046f, 0x0494, 0x04bb,
+  0x04e0, 0x0506, 0x052c, 0x0551, 0x0576, 0x059c, 0x05c4, 0x05e8, 0x060e, 0x0634, 0x0657, 0x067f, 0x06a3, 0x06c8, 0x06ee, 0x0710,
+  0x0738, 0x075b, 0x077f, 0x07a4, 0x07c9, 0x07ef, 0x0816, 0x0838, 0x085a, 0x0884, 0x08a8, 0x08cc, 0x08ea, 0x0910, 0x0936, 0x0956,
+  0x097c, 0x099e, 0x09c6, 0x09e8, 0x0a0c, 0x0a2e, 0x0a52, 0x0a76, 0x0a9a, 0x0ab8, 0x0ade, 0x0b02, 0x0b22, 0x0b40, 0x0b68, 0x0b88,
+  0x0ba8, 0x0bd0, 0x0bf2, 0x0c12, 0x0c34, 0x0c56, 0x0c78, 0x0c92, 0x0cb6, 0x0cda, 0x0cfe, 0x0d18, 0x0d3c, 0x0d58, 0x0d7e, 0x0d9a,
+  0x0dc0, 0x0ddc, 0x0dfa, 0x0e20, 0x0e3e, 0x0e5c, 0x0e7a, 0x0e98, 0x0eb6, 0x0ed4, 0x0ef4, 0x0f14, 0x0f32, 0x0f52, 0x0f72, 0x0f92,
+  0x0fa8, 0x0fc8, 0x0fea, 0x1000, 0x1020, 0x1044, 0x1058, 0x107c, 0x1094, 0x10b4, 0x10cc, 0x10f0, 0x1108, 0x1120, 0x1144, 0x115c,
+  0x1174, 0x118c, 0x11b0, 0x11c8, 0x11e0, 0x11f8, 0x1214, 0x122c, 0x1244, 0x1260, 0x1278, 0x1290, 0x12ac, 0x12c4, 0x12e0, 0x12f8,
+  0x1314, 0x1330, 0x133c, 0x1358, 0x1370, 0x138c, 0x13a8, 0x13b4, 0x13d0, 0x13ec, 0x13fc, 0x1418, 0x1424, 0x1440, 0x145c, 0x146c,
+  0x1488, 0x1494, 0x14b0, 0x14c0, 0x14d0, 0x14ec, 0x14f8, 0x1518, 0x1524, 0x1534, 0x1550, 0x1560, 0x1570, 0x158c, 0x159c, 0x15ac,
+  0x15bc, 0x15c8, 0x15e8, 0x15f8, 0x1604, 0x1614, 0x1624, 0x1634, 0x1644, 0x1654, 0x1664, 0x1670, 0x1680, 0x1690, 0x16a0, 0x16b0,
+  0x16c0, 0x16d0, 0x16e0, 0x16f0, 0x1700, 0x1710, 0x1720, 0x1720, 0x1730, 0x1740, 0x1750, 0x1750, 0x1760, 0x1770, 0x1780, 0x1780,
+  0x1790, 0x17a0, 0x17a0, 0x17b0, 0x17c0, 0x17c0, 0x17d4, 0x17d4, 0x17e4, 0x17f4, 0x17f4, 0x1804, 0x1804, 0x1814, 0x1814, 0x1824,
+  0x1824, 0x1824, 0x1838, 0x1838, 0x1848, 0x1848, 0x1848, 0x1858, 0x1858, 0x1858, 0x1868, 0x1868, 0x1868, 0x1878, 0x1878, 0x1878,
+  0x1878, 0x188c, 0x188c, 0x188c, 0x188c, 0x188c, 0x188c, 0x188c, 0x189c, 0x189c, 0x189c, 0x189c, 0x189c, 0x189c, 0x189c, 0x189c,
+  0x0012, 0x0038, 0x005e, 0x0084, 0x00aa, 0x00cf, 0x00f5, 0x011b, 0x0141, 0x0167, 0x018d, 0x01b3, 0x01d8, 0x01fe, 0x0224, 0x024a,
+  0x0270, 0x0294, 0x02bb, 0x02e0, 0x0304, 0x032b, 0x0351, 0x0374, 0x039c, 0x03bf, 0x03e7, 0x040b, 0x0430, 0x0457, 0x047b, 0x04a1,
+  0x04c5, 0x04ea, 0x0510, 0x0534, 0x0558, 0x057e, 0x05a4, 0x05c8, 0x05ec, 0x0612, 0x0634, 0x065b, 0x067f, 0x06a3, 0x06c8, 0x06e9,
+  0x0710, 0x0733, 0x0756, 0x077a, 0x079f, 0x07c4, 0x07ea, 0x080c, 0x082c, 0x0854, 0x0878, 0x089c, 0x08ba, 0x08de, 0x0904, 0x0922,
+  0x0948, 0x096a, 0x0990, 0x09b2, 0x09d4, 0x09f6, 0x0a18, 0x0a3c, 0x0a60, 0x0a7c, 0x0aa2, 0x0ac6, 0x0ae4, 0x0b02, 0x0b2a, 0x0b48,
+  0x0b68, 0x0b90, 0x0bb0, 0x0bd0, 0x0bf2, 0x0c12, 0x0c34, 0x0c4e, 0x0c70, 0x0c92, 0x0cb6, 0x0cd0, 0x0cf4, 0x0d10, 0x0d34, 0x0d50,
+  0x0d74, 0x0d90, 0x0dac, 0x0dd2, 0x0df0, 0x0e0c, 0x0e2a, 0x0e48, 0x0e66, 0x0e84, 0x0ea2, 0x0ec0, 0x0ee0, 0x0efe, 0x0f1e, 0x0f3e,
+  0x0f52, 0x0f72, 0x0f92, 0x0fa8, 0x0fc8, 0x0fea, 0x1000, 0x1020, 0x1038, 0x1058, 0x1070, 0x1094, 0x10a8, 0x10c0, 0x10e4, 0x10fc,
+  0x1114, 0x112c, 0x1150, 0x1168, 0x1180, 0x1198, 0x11b0, 0x11c8, 0x11e0, 0x11f8, 0x1214, 0x122c, 0x1244, 0x1260, 0x1278, 0x1290,
+  0x12ac, 0x12c4, 0x12d4, 0x12ec, 0x1308, 0x1320, 0x133c, 0x1348, 0x1364, 0x1380, 0x138c, 0x13a8, 0x13b4, 0x13d0, 0x13ec, 0x13fc,
+  0x1418, 0x1424, 0x1440, 0x1450, 0x145c, 0x1478, 0x1488, 0x14a4, 0x14b0, 0x14c0, 0x14dc, 0x14ec, 0x14f8, 0x1518, 0x1524, 0x1534,
+  0x1544, 0x1550, 0x1570, 0x1580, 0x158c, 0x159c, 0x15ac, 0x15bc, 0x15c8, 0x15d8, 0x15e8, 0x15f8, 0x1604, 0x1614, 0x1624, 0x1634,
+  0x1644, 0x1654, 0x1664, 0x1670, 0x1680, 0x1690, 0x16a0, 0x16a0, 0x16b0, 0x16c0, 0x16d0, 0x16d0, 0x16e0, 0x16f0, 0x1700, 0x1700,
+  0x1710, 0x1720, 0x1720, 0x1730, 0x1740, 0x1740, 0x1750, 0x1750, 0x1760, 0x1770, 0x1770, 0x1780, 0x1780, 0x1790, 0x1790, 0x17a0,
+  0x17a0, 0x17a0, 0x17b0, 0x17b0, 0x17c0, 0x17c0, 0x17c0, 0x17d4, 0x17d4, 0x17d4, 0x17e4, 0x17e4, 0x17e4, 0x17f4, 0x17f4, 0x17f4,
+  0x17f4, 0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1804, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814, 0x1814,
+  0x0012, 0x0037, 0x005c, 0x0081, 0x00a6, 0x00cb, 0x00f0, 0x0115, 0x013a, 0x015f, 0x0184, 0x01aa, 0x01ce, 0x01f3, 0x0218, 0x023d,
+  0x0262, 0x0286, 0x02ac, 0x02d0, 0x02f4, 0x031a, 0x033f, 0x0362, 0x0388, 0x03ab, 0x03d2, 0x03f5, 0x0419, 0x043f, 0x0463, 0x0488,
+  0x04ab, 0x04cf, 0x04f4, 0x0517, 0x053b, 0x0560, 0x0585, 0x05a8, 0x05cc, 0x05f0, 0x0612, 0x0638, 0x065b, 0x067f, 0x06a3, 0x06c4,
+  0x06e9, 0x070b, 0x072e, 0x0751, 0x0775, 0x0799, 0x07bf, 0x07df, 0x0800, 0x0828, 0x084a, 0x086c, 0x088a, 0x08ae, 0x08d2, 0x08f0,
+  0x0916, 0x0936, 0x095c, 0x097c, 0x099e, 0x09c0, 0x09e2, 0x0a04, 0x0a28, 0x0a44, 0x0a68, 0x0a8c, 0x0aa8, 0x0ac6, 0x0aec, 0x0b0a,
+  0x0b2a, 0x0b50, 0x0b70, 0x0b90, 0x0bb0, 0x0bd0, 0x0bf2, 0x0c0a, 0x0c2c, 0x0c4e, 0x0c70, 0x0c8a, 0x0cae, 0x0cc8, 0x0cec, 0x0d06,
+  0x0d2a, 0x0d46, 0x0d62, 0x0d88, 0x0da4, 0x0dc0, 0x0ddc, 0x0dfa, 0x0e16, 0x0e34, 0x0e52, 0x0e70, 0x0e8e, 0x0eac, 0x0eca, 0x0eea,
+  0x0efe, 0x0f1e, 0x0f3e, 0x0f52, 0x0f72, 0x0f92, 0x0fa8, 0x0fc8, 0x0fde, 0x1000, 0x1018, 0x1038, 0x1050, 0x1064, 0x1088, 0x10a0,
+  0x10b4, 0x10cc, 0x10f0, 0x1108, 0x1120, 0x1138, 0x1150, 0x1168, 0x1180, 0x1198, 0x11b0, 0x11c8, 0x11e0, 0x11f8, 0x1214, 0x122c,
+  0x1244, 0x1260, 0x126c, 0x1284, 0x12a0, 0x12b8, 0x12d4, 0x12e0, 0x12f8, 0x1314, 0x1320, 0x133c, 0x1348, 0x1364, 0x1380, 0x138c,
+  0x13a8, 0x13b4, 0x13d0, 0x13e0, 0x13ec, 0x1408, 0x1418, 0x1430, 0x1440, 0x1450, 0x146c, 0x1478, 0x1488, 0x14a4, 0x14b0, 0x14c0,
+  0x14d0, 0x14dc, 0x14f8, 0x1508, 0x1518, 0x1524, 0x1534, 0x1544, 0x1550, 0x1560, 0x1570, 0x1580, 0x158c, 0x159c, 0x15ac, 0x15bc,
+  0x15c8, 0x15d8, 0x15e8, 0x15f8, 0x1604, 0x1614, 0x1624, 0x1624, 0x1634, 0x1644, 0x1654, 0x1654, 0x1664, 0x1670, 0x1680, 0x1680,
+  0x1690, 0x16a0, 0x16a0, 0x16b0, 0x16c0, 0x16c0, 0x16d0, 0x16d0, 0x16e0, 0x16f0, 0x16f0, 0x1700, 0x1700, 0x1710, 0x1710, 0x1720,
+  0x1720, 0x1720, 0x1730, 0x1730, 0x1740, 0x1740, 0x1740, 0x1750, 0x1750, 0x1750, 0x1760, 0x1760, 0x1760, 0x1770, 0x1770, 0x1770,
+  0x1770, 0x1780, 0x1780, 0x1780, 0x1780, 0x1780, 0x1780, 0x1780, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790, 0x1790,
+  0x0012, 0x0036, 0x005a, 0x007e, 0x00a2, 0x00c7, 0x00eb, 0x010f, 0x0133, 0x0158, 0x017c, 0x01a0, 0x01c4, 0x01e9, 0x020c, 0x0231,
+  0x0255, 0x0278, 0x029d, 0x02c0, 0x02e4, 0x0309, 0x032d, 0x034f, 0x0374, 0x0397, 0x03bd, 0x03df, 0x0403, 0x0428, 0x044b, 0x046f,
+  0x0491, 0x04b5, 0x04d9, 0x04fb, 0x051e, 0x0542, 0x0567, 0x0589, 0x05ac, 0x05d0, 0x05f0, 0x0616, 0x0638, 0x065b, 0x067f, 0x069e,
+  0x06c4, 0x06e5, 0x0706, 0x0729, 0x074c, 0x0770, 0x0794, 0x07b4, 0x07d4, 0x07fa, 0x081c, 0x083e, 0x085a, 0x087e, 0x08a2, 0x08c0,
+  0x08e4, 0x0904, 0x0928, 0x0948, 0x096a, 0x098a, 0x09ac, 0x09ce, 0x09f0, 0x0a0c, 0x0a2e, 0x0a52, 0x0a6e, 0x0a8c, 0x0ab0, 0x0ace,
+  0x0aec, 0x0b12, 0x0b32, 0x0b50, 0x0b70, 0x0b90, 0x0bb0, 0x0bc8, 0x0bea, 0x0c0a, 0x0c2c, 0x0c46, 0x0c68, 0x0c82, 0x0ca4, 0x0cbe,
+  0x0ce2, 0x0cfe, 0x0d18, 0x0d3c, 0x0d58, 0x0d74, 0x0d90, 0x0dac, 0x0dca, 0x0de6, 0x0e04, 0x0e20, 0x0e3e, 0x0e5c, 0x0e7a, 0x0e98,
+  0x0eac, 0x0eca, 0x0eea, 0x0efe, 0x0f1e, 0x0f3e, 0x0f52, 0x0f72, 0x0f88, 0x0fa8, 0x0fbe, 0x0fde, 0x0ff4, 0x100c, 0x102c, 0x1044,
+  0x1058, 0x1070, 0x1094, 0x10a8, 0x10c0, 0x10d8, 0x10f0, 0x1108, 0x1120, 0x1138, 0x1150, 0x1168, 0x1180, 0x1198, 0x11b0, 0x11c8,
+  0x11e0, 0x11f8, 0x1208, 0x1220, 0x1238, 0x1250, 0x126c, 0x1278, 0x1290, 0x12ac, 0x12b8, 0x12d4, 0x12e0, 0x12f8, 0x1314, 0x1320,
+  0x133c, 0x1348, 0x1364, 0x1370, 0x1380, 0x139c, 0x13a8, 0x13c4, 0x13d0, 0x13e0, 0x13fc, 0x1408, 0x1418, 0x1430, 0x1440, 0x1450,
+  0x145c, 0x146c, 0x1488, 0x1494, 0x14a4, 0x14b0, 0x14c0, 0x14d0, 0x14dc, 0x14ec, 0x14f8, 0x1508, 0x1518, 0x1524, 0x1534, 0x1544,
+  0x1550, 0x1560, 0x1570, 0x1580, 0x158c, 0x159c, 0x15ac, 0x15ac, 0x15bc, 0x15c8, 0x15d8, 0x15d8, 0x15e8, 0x15f8, 0x1604, 0x1604,
+  0x1614, 0x1624, 0x1624, 0x1634, 0x1644, 0x1644, 0x1654, 0x1654, 0x1664, 0x1670, 0x1670, 0x1680, 0x1680, 0x1690, 0x1690, 0x16a0,
+  0x16a0, 0x16a0, 0x16b0, 0x16b0, 0x16c0, 0x16c0, 0x16c0, 0x16d0, 0x16d0, 0x16d0, 0x16e0, 0x16e0, 0x16e0, 0x16f0, 0x16f0, 0x16f0,
+  0x16f0, 0x1700, 0x1700, 0x1700, 0x1700, 0x1700, 0x1700, 0x1700, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710, 0x1710,
+  0x0011, 0x0035, 0x0058, 0x007b, 0x009f, 0x00c2, 0x00e6, 0x010a, 0x012d, 0x0150, 0x0174, 0x0197, 0x01ba, 0x01de, 0x0201, 0x0225,
+  0x0248, 0x026b, 0x028f, 0x02b1, 0x02d4, 0x02f8, 0x031c, 0x033d, 0x0362, 0x0383, 0x03a8, 0x03ca, 0x03ed, 0x0411, 0x0433, 0x0457,
+  0x0478, 0x049b, 0x04be, 0x04e0, 0x0502, 0x0525, 0x0549, 0x056b, 0x058d, 0x05b0, 0x05d0, 0x05f5, 0x0616, 0x0638, 0x065b, 0x067a,
+  0x069e, 0x06bf, 0x06e0, 0x0702, 0x0724, 0x0747, 0x076a, 0x078a, 0x07a9, 0x07cf, 0x07ef, 0x0810, 0x082c, 0x0850, 0x0872, 0x0890,
+  0x08b4, 0x08d2, 0x08f6, 0x0916, 0x0936, 0x0956, 0x0976, 0x0998, 0x09b8, 0x09d4, 0x09f6, 0x0a18, 0x0a36, 0x0a52, 0x0a76, 0x0a92,
+  0x0ab0, 0x0ad6, 0x0af4, 0x0b12, 0x0b32, 0x0b50, 0x0b70, 0x0b88, 0x0ba8, 0x0bc8, 0x0bea, 0x0c02, 0x0c24, 0x0c3c, 0x0c60, 0x0c78,
+  0x0c9c, 0x0cb6, 0x0cd0, 0x0cf4, 0x0d10, 0x0d2a, 0x0d46, 0x0d62, 0x0d7e, 0x0d9a, 0x0db6, 0x0dd2, 0x0df0, 0x0e0c, 0x0e2a, 0x0e48,
+  0x0e5c, 0x0e7a, 0x0e98, 0x0eac, 0x0eca, 0x0eea, 0x0efe, 0x0f1e, 0x0f32, 0x0f52, 0x0f68, 0x0f88, 0x0f9e, 0x0fb4, 0x0fd4, 0x0fea,
+  0x1000, 0x1018, 0x1038, 0x1050, 0x1064, 0x107c, 0x1094, 0x10a8, 0x10c0, 0x10d8, 0x10f0, 0x1108, 0x1120, 0x1138, 0x1150, 0x1168,
+  0x1180, 0x1198, 0x11a4, 0x11bc, 0x11d4, 0x11ec, 0x1208, 0x1214, 0x122c, 0x1244, 0x1250, 0x126c, 0x1278, 0x1290, 0x12ac, 0x12b8,
+  0x12d4, 0x12e0, 0x12f8, 0x1308, 0x1314, 0x1330, 0x133c, 0x1358, 0x1364, 0x1370, 0x138c, 0x139c, 0x13a8, 0x13c4, 0x13d0, 0x13e0,
+  0x13ec, 0x13fc, 0x1418, 0x1424, 0x1430, 0x1440, 0x1450, 0x145c, 0x146c, 0x1478, 0x1488, 0x1494, 0x14a4, 0x14b0, 0x14c0, 0x14d0,
+  0x14dc, 0x14ec, 0x14f8, 0x1508, 0x1518, 0x1524, 0x1534, 0x1534, 0x1544, 0x1550, 0x1560, 0x1560, 0x1570, 0x1580, 0x158c, 0x158c,
+  0x159c, 0x15ac, 0x15ac, 0x15bc, 0x15c8, 0x15c8, 0x15d8, 0x15d8, 0x15e8, 0x15f8, 0x15f8, 0x1604, 0x1604, 0x1614, 0x1614, 0x1624,
+  0x1624, 0x1624, 0x1634, 0x1634, 0x1644, 0x1644, 0x1644, 0x1654, 0x1654, 0x1654, 0x1664, 0x1664, 0x1664, 0x1670, 0x1670, 0x1670,
+  0x1670, 0x1680, 0x1680, 0x1680, 0x1680, 0x1680, 0x1680, 0x1680, 0x1690, 0x1690, 0x1690, 0x1690, 0x1690, 0x1690, 0x1690, 0x1690,
+  0x0011, 0x0034, 0x0056, 0x0079, 0x009c, 0x00be, 0x00e1, 0x0104, 0x0126, 0x0149, 0x016c, 0x018f, 0x01b1, 0x01d4, 0x01f6, 0x0219,
+  0x023c, 0x025d, 0x0281, 0x02a3, 0x02c4, 0x02e8, 0x030b, 0x032b, 0x034f, 0x0370, 0x0394, 0x03b5, 0x03d7, 0x03fa, 0x041c, 0x043f,
+  0x0460, 0x0482, 0x04a4, 0x04c5, 0x04e7, 0x0509, 0x052c, 0x054d, 0x056f, 0x0591, 0x05b0, 0x05d4, 0x05f5, 0x0616, 0x0638, 0x0657,
+  0x067a, 0x069a, 0x06ba, 0x06db, 0x06fd, 0x071f, 0x0742, 0x0760, 0x077f, 0x07a4, 0x07c4, 0x07e4, 0x0800, 0x0822, 0x0844, 0x0860,
+  0x0884, 0x08a2, 0x08c6, 0x08e4, 0x0904, 0x0922, 0x0942, 0x0962, 0x0984, 0x099e, 0x09c0, 0x09e2, 0x09fe, 0x0a18, 0x0a3c, 0x0a58,
+  0x0a76, 0x0a9a, 0x0ab8, 0x0ad6, 0x0af4, 0x0b12, 0x0b32, 0x0b48, 0x0b68, 0x0b88, 0x0ba8, 0x0bc0, 0x0be0, 0x0bfa, 0x0c1c, 0x0c34,
+  0x0c56, 0x0c70, 0x0c8a, 0x0cae, 0x0cc8, 0x0ce2, 0x0cfe, 0x0d18, 0x0d34, 0x0d50, 0x0d6a, 0x0d88, 0x0da4, 0x0dc0, 0x0ddc, 0x0dfa,
+  0x0e0c, 0x0e2a, 0x0e48, 0x0e5c, 0x0e7a, 0x0e98, 0x0eac, 0x0eca, 0x0ee0, 0x0efe, 0x0f14, 0x0f32, 0x0f48, 0x0f5c, 0x0f7e, 0x0f92,
+  0x0fa8, 0x0fbe, 0x0fde, 0x0ff4, 0x100c, 0x1020, 0x1038, 0x1050, 0x1064, 0x107c, 0x1094, 0x10a8, 0x10c0, 0x10d8, 0x10f0, 0x1108,
+  0x1120, 0x1138, 0x1144, 0x115c, 0x1174, 0x118c, 0x11a4, 0x11b0, 0x11c8, 0x11e0, 0x11ec, 0x1208, 0x1214, 0x122c, 0x1244, 0x1250,
+  0x126c, 0x1278, 0x1290, 0x12a0, 0x12ac, 0x12c4, 0x12d4, 0x12ec, 0x12f8, 0x1308, 0x1320, 0x1330, 0x133c, 0x1358, 0x1364, 0x1370,
+  0x1380, 0x138c, 0x13a8, 0x13b4, 0x13c4, 0x13d0, 0x13e0, 0x13ec, 0x13fc, 0x1408, 0x1418, 0x1424, 0x1430, 0x1440, 0x1450, 0x145c,
+  0x146c, 0x1478, 0x1488, 0x1494, 0x14a4, 0x14b0, 0x14c0, 0x14c0, 0x14d0, 0x14dc, 0x14ec, 0x14ec, 0x14f8, 0x1508, 0x1518, 0x1518,
+  0x1524, 0x1534, 0x1534, 0x1544, 0x1550, 0x1550, 0x1560, 0x1560, 0x1570, 0x1580, 0x1580, 0x158c, 0x158c, 0x159c, 0x159c, 0x15ac,
+  0x15ac, 0x15ac, 0x15bc, 0x15bc, 0x15c8, 0x15c8, 0x15c8, 0x15d8, 0x15d8, 0x15d8, 0x15e8, 0x15e8, 0x15e8, 0x15f8, 0x15f8, 0x15f8,
+  0x15f8, 0x1604, 0x1604, 0x1604, 0x1604, 0x1604, 0x1604, 0x1604, 0x1614, 0x1614, 0x1614, 0x1614, 0x1614, 0x1614, 0x1614, 0x1614,
+  0x0010, 0x0032, 0x0054, 0x0076, 0x0098, 0x00ba, 0x00dc, 0x00fe, 0x0120, 0x0142, 0x0164, 0x0186, 0x01a7, 0x01ca, 0x01eb, 0x020e,
+  0x0230, 0x0250, 0x0273, 0x0294, 0x02b5, 0x02d8, 0x02fa, 0x031a, 0x033d, 0x035d, 0x0381, 0x03a1, 0x03c2, 0x03e4, 0x0406, 0x0428,
+  0x0448, 0x0469, 0x048b, 0x04ab, 0x04cc, 0x04ed, 0x0510, 0x0530, 0x0551, 0x0572, 0x0591, 0x05b4, 0x05d4, 0x05f5, 0x0616, 0x0634,
+  0x0657, 0x0676, 0x0695, 0x06b5, 0x06d6, 0x06f8, 0x071a, 0x0738, 0x0756, 0x077a, 0x0799, 0x07b9, 0x07d4, 0x07f5, 0x0816, 0x0832,
+  0x0854, 0x0872, 0x0896, 0x08b4, 0x08d2, 0x08f0, 0x0910, 0x0930, 0x0950, 0x096a, 0x098a, 0x09ac, 0x09c6, 0x09e2, 0x0a04, 0x0a20,
+  0x0a3c, 0x0a60, 0x0a7c, 0x0a9a, 0x0ab8, 0x0ad6, 0x0af4, 0x0b0a, 0x0b2a, 0x0b48, 0x0b68, 0x0b80, 0x0ba0, 0x0bb8, 0x0bd8, 0x0bf2,
+  0x0c12, 0x0c2c, 0x0c46, 0x0c68, 0x0c82, 0x0c9c, 0x0cb6, 0x0cd0, 0x0cec, 0x0d06, 0x0d22, 0x0d3c, 0x0d58, 0x0d74, 0x0d90, 0x0dac,
+  0x0dc0, 0x0ddc, 0x0dfa, 0x0e0c, 0x0e2a, 0x0e48, 0x0e5c, 0x0e7a, 0x0e8e, 0x0eac, 0x0ec0, 0x0ee0, 0x0ef4, 0x0f08, 0x0f28, 0x0f3e,
+  0x0f52, 0x0f68, 0x0f88, 0x0f9e, 0x0fb4, 0x0fc8, 0x0fde, 0x0ff4, 0x100c, 0x1020, 0x1038, 0x1050, 0x1064, 0x107c, 0x1094, 0x10a8,
+  0x10c0, 0x10d8, 0x10e4, 0x10fc, 0x1114, 0x112c, 0x1144, 0x1150, 0x1168, 0x1180, 0x118c, 0x11a4, 0x11b0, 0x11c8, 0x11e0, 0x11ec,
+  0x1208, 0x1214, 0x122c, 0x1238, 0x1244, 0x1260, 0x126c, 0x1284, 0x1290, 0x12a0, 0x12b8, 0x12c4, 0x12d4, 0x12ec, 0x12f8, 0x1308,
+  0x1314, 0x1320, 0x133c, 0x1348, 0x1358, 0x1364, 0x1370, 0x1380, 0x138c, 0x139c, 0x13a8, 0x13b4, 0x13c4, 0x13d0, 0x13e0, 0x13ec,
+  0x13fc, 0x1408, 0x1418, 0x1424, 0x1430, 0x1440, 0x1450, 0x1450, 0x145c, 0x146c, 0x1478, 0x1478, 0x1488, 0x1494, 0x14a4, 0x14a4,
+  0x14b0, 0x14c0, 0x14c0, 0x14d0, 0x14dc, 0x14dc, 0x14ec, 0x14ec, 0x14f8, 0x1508, 0x1508, 0x1518, 0x1518, 0x1524, 0x1524, 0x1534,
+  0x1534, 0x1534, 0x1544, 0x1544, 0x1550, 0x1550, 0x1550, 0x1560, 0x1560, 0x1560, 0x1570, 0x1570, 0x1570, 0x1580, 0x1580, 0x1580,
+  0x1580, 0x158c, 0x158c, 0x158c, 0x158c, 0x158c, 0x158c, 0x158c, 0x159c, 0x159c, 0x159c, 0x159c, 0x159c, 0x159c, 0x159c, 0x159c,
+  0x0010, 0x0031, 0x0053, 0x0074, 0x0095, 0x00b6, 0x00d7, 0x00f9, 0x011a, 0x013b, 0x015c, 0x017e, 0x019e, 0x01c0, 0x01e1, 0x0203,
+  0x0224, 0x0244, 0x0266, 0x0286, 0x02a6, 0x02c8, 0x02ea, 0x0309, 0x032b, 0x034a, 0x036d, 0x038d, 0x03ad, 0x03cf, 0x03ef, 0x0411,
+  0x0430, 0x0451, 0x0472, 0x0491, 0x04b1, 0x04d2, 0x04f4, 0x0514, 0x0534, 0x0554, 0x0572, 0x0595, 0x05b4, 0x05d4, 0x05f5, 0x0612,
+  0x0634, 0x0652, 0x0671, 0x0691, 0x06b1, 0x06d2, 0x06f3, 0x0710, 0x072e, 0x0751, 0x0770, 0x078f, 0x07a9, 0x07c9, 0x07ea, 0x0806,
+  0x0828, 0x0844, 0x0866, 0x0884, 0x08a2, 0x08c0, 0x08de, 0x08fc, 0x091c, 0x0936, 0x0956, 0x0976, 0x0990, 0x09ac, 0x09ce, 0x09e8,
+  0x0a04, 0x0a28, 0x0a44, 0x0a60, 0x0a7c, 0x0a9a, 0x0ab8, 0x0ace, 0x0aec, 0x0b0a, 0x0b2a, 0x0b40, 0x0b60, 0x0b78, 0x0b98, 0x0bb0,
+  0x0bd0, 0x0bea, 0x0c02, 0x0c24, 0x0c3c, 0x0c56, 0x0c70, 0x0c8a, 0x0ca4, 0x0cbe, 0x0cda, 0x0cf4, 0x0d10, 0x0d2a, 0x0d46, 0x0d62,
+  0x0d74, 0x0d90, 0x0dac, 0x0dc0, 0x0ddc, 0x0dfa, 0x0e0c, 0x0e2a, 0x0e3e, 0x0e5c, 0x0e70, 0x0e8e, 0x0ea2, 0x0eb6, 0x0ed4, 0x0eea,
+  0x0efe, 0x0f14, 0x0f32, 0x0f48, 0x0f5c, 0x0f72, 0x0f88, 0x0f9e, 0x0fb4, 0x0fc8, 0x0fde, 0x0ff4, 0x100c, 0x1020, 0x1038, 0x1050,
+  0x1064, 0x107c, 0x1088, 0x10a0, 0x10b4, 0x10cc, 0x10e4, 0x10f0, 0x1108, 0x1120, 0x112c, 0x1144, 0x1150, 0x1168, 0x1180, 0x118c,
+  0x11a4, 0x11b0, 0x11c8, 0x11d4, 0x11e0, 0x11f8, 0x1208, 0x1220, 0x122c, 0x1238, 0x1250, 0x1260, 0x126c, 0x1284, 0x1290, 0x12a0,
+  0x12ac, 0x12b8, 0x12d4, 0x12e0, 0x12ec, 0x12f8, 0x1308, 0x1314, 0x1320, 0x1330, 0x133c, 0x1348, 0x1358, 0x1364, 0x1370, 0x1380,
+  0x138c, 0x139c, 0x13a8, 0x13b4, 0x13c4, 0x13d0, 0x13e0, 0x13e0, 0x13ec, 0x13fc, 0x1408, 0x1408, 0x1418, 0x1424, 0x1430, 0x1430,
+  0x1440, 0x1450, 0x1450, 0x145c, 0x146c, 0x146c, 0x1478, 0x1478, 0x1488, 0x1494, 0x1494, 0x14a4, 0x14a4, 0x14b0, 0x14b0, 0x14c0,
+  0x14c0, 0x14c0, 0x14d0, 0x14d0, 0x14dc, 0x14dc, 0x14dc, 0x14ec, 0x14ec, 0x14ec, 0x14f8, 0x14f8, 0x14f8, 0x1508, 0x1508, 0x1508,
+  0x1508, 0x1518, 0x1518, 0x1518, 0x1518, 0x1518, 0x1518, 0x1518, 0x1524, 0x1524, 0x1524, 0x1524, 0x1524, 0x1524, 0x1524, 0x1524,
+  0x0010, 0x0030, 0x0051, 0x0071, 0x0092, 0x00b2, 0x00d3, 0x00f3, 0x0114, 0x0134, 0x0155, 0x0176, 0x0195, 0x01b6, 0x01d6, 0x01f7,
+  0x0218, 0x0237, 0x0258, 0x0278, 0x0298, 0x02b9, 0x02da, 0x02f8, 0x031a, 0x0338, 0x035a, 0x0379, 0x0399, 0x03ba, 0x03da, 0x03fa,
+  0x0419, 0x0439, 0x045a, 0x0478, 0x0498, 0x04b8, 0x04d9, 0x04f8, 0x0517, 0x0537, 0x0554, 0x0576, 0x0595, 0x05b4, 0x05d4, 0x05f0,
+  0x0612, 0x0630, 0x064e, 0x066d, 0x068c, 0x06ac, 0x06cd, 0x06e9, 0x0706, 0x0729, 0x0747, 0x0765, 0x077f, 0x079f, 0x07bf, 0x07da,
+  0x07fa, 0x0816, 0x0838, 0x0854, 0x0872, 0x0890, 0x08ae, 0x08cc, 0x08ea, 0x0904, 0x0922, 0x0942, 0x095c, 0x0976, 0x0998, 0x09b2,
+  0x09ce, 0x09f0, 0x0a0c, 0x0a28, 0x0a44, 0x0a60, 0x0a7c, 0x0a92, 0x0ab0, 0x0ace, 0x0aec, 0x0b02, 0x0b22, 0x0b38, 0x0b58, 0x0b70,
+  0x0b90, 0x0ba8, 0x0bc0, 0x0be0, 0x0bfa, 0x0c12, 0x0c2c, 0x0c46, 0x0c60, 0x0c78, 0x0c92, 0x0cae, 0x0cc8, 0x0ce2, 0x0cfe, 0x0d18,
+  0x0d2a, 0x0d46, 0x0d62, 0x0d74, 0x0d90, 0x0dac, 0x0dc0, 0x0ddc, 0x0df0, 0x0e0c, 0x0e20, 0x0e3e, 0x0e52, 0x0e66, 0x0e84, 0x0e98,
+  0x0eac, 0x0ec0, 0x0ee0, 0x0ef4, 0x0f08, 0x0f1e, 0x0f32, 0x0f48, 0x0f5c, 0x0f72, 0x0f88, 0x0f9e, 0x0fb4, 0x0fc8, 0x0fde, 0x0ff4,
+  0x100c, 0x1020, 0x102c, 0x1044, 0x1058, 0x1070, 0x1088, 0x1094, 0x10a8, 0x10c0, 0x10cc, 0x10e4, 0x10f0, 0x1108, 0x1120, 0x112c,
+  0x1144, 0x1150, 0x1168, 0x1174, 0x1180, 0x1198, 0x11a4, 0x11bc, 0x11c8, 0x11d4, 0x11ec, 0x11f8, 0x1208, 0x1220, 0x122c, 0x1238,
+  0x1244, 0x1250, 0x126c, 0x1278, 0x1284, 0x1290, 0x12a0, 0x12ac, 0x12b8, 0x12c4, 0x12d4, 0x12e0, 0x12ec, 0x12f8, 0x1308, 0x1314,
+  0x1320, 0x1330, 0x133c, 0x1348, 0x1358, 0x1364, 0x1370, 0x1370, 0x1380, 0x138c, 0x139c, 0x139c, 0x13a8, 0x13b4, 0x13c4, 0x13c4,
+  0x13d0, 0x13e0, 0x13e0, 0x13ec, 0x13fc, 0x13fc, 0x1408, 0x1408, 0x1418, 0x1424, 0x1424, 0x1430, 0x1430, 0x1440, 0x1440, 0x1450,
+  0x1450, 0x1450, 0x145c, 0x145c, 0x146c, 0x146c, 0x146c, 0x1478, 0x1478, 0x1478, 0x1488, 0x1488, 0x1488, 0x1494, 0x1494, 0x1494,
+  0x1494, 0x14a4, 0x14a4, 0x14a4, 0x14a4, 0x14a4, 0x14a4, 0x14a4, 0x14b0, 0x14b0, 0x14b0, 0x14b0, 0x14b0, 0x14b0, 0x14b0, 0x14b0,
+  0x000f, 0x002f, 0x004f, 0x006f, 0x008f, 0x00ae, 0x00ce, 0x00ee, 0x010e, 0x012e, 0x014d, 0x016e, 0x018d, 0x01ad, 0x01cc, 0x01ed,
+  0x020c, 0x022b, 0x024c, 0x026b, 0x028a, 0x02aa, 0x02ca, 0x02e8, 0x0309, 0x0327, 0x0348, 0x0366, 0x0385, 0x03a6, 0x03c5, 0x03e4,
+  0x0403, 0x0422, 0x0442, 0x0460, 0x047e, 0x049e, 0x04be, 0x04dc, 0x04fb, 0x051b, 0x0537, 0x0558, 0x0576, 0x0595, 0x05b4, 0x05d0,
+  0x05f0, 0x060e, 0x062b, 0x0649, 0x0668, 0x0688, 0x06a8, 0x06c4, 0x06e0, 0x0702, 0x071f, 0x073d, 0x0756, 0x0775, 0x0794, 0x07ae,
+  0x07cf, 0x07ea, 0x080c, 0x0828, 0x0844, 0x0860, 0x087e, 0x089c, 0x08ba, 0x08d2, 0x08f0, 0x0910, 0x0928, 0x0942, 0x0962, 0x097c,
+  0x0998, 0x09b8, 0x09d4, 0x09f0, 0x0a0c, 0x0a28, 0x0a44, 0x0a58, 0x0a76, 0x0a92, 0x0ab0, 0x0ac6, 0x0ae4, 0x0afc, 0x0b1a, 0x0b32,
+  0x0b50, 0x0b68, 0x0b80, 0x0ba0, 0x0bb8, 0x0bd0, 0x0bea, 0x0c02, 0x0c1c, 0x0c34, 0x0c4e, 0x0c68, 0x0c82, 0x0c9c, 0x0cb6, 0x0cd0,
+  0x0ce2, 0x0cfe, 0x0d18, 0x0d2a, 0x0d46, 0x0d62, 0x0d74, 0x0d90, 0x0da4, 0x0dc0, 0x0dd2, 0x0df0, 0x0e04, 0x0e16, 0x0e34, 0x0e48,
+  0x0e5c, 0x0e70, 0x0e8e, 0x0ea2, 0x0eb6, 0x0eca, 0x0ee0, 0x0ef4, 0x0f08, 0x0f1e, 0x0f32, 0x0f48, 0x0f5c, 0x0f72, 0x0f88, 0x0f9e,
+  0x0fb4, 0x0fc8, 0x0fd4, 0x0fea, 0x1000, 0x1018, 0x102c, 0x1038, 0x1050, 0x1064, 0x1070, 0x1088, 0x1094, 0x10a8, 0x10c0, 0x10cc,
+  0x10e4, 0x10f0, 0x1108, 0x1114, 0x1120, 0x1138, 0x1144, 0x115c, 0x1168, 0x1174, 0x118c, 0x1198, 0x11a4, 0x11bc, 0x11c8, 0x11d4,
+  0x11e0, 0x11ec, 0x1208, 0x1214, 0x1220, 0x122c, 0x1238, 0x1244, 0x1250, 0x1260, 0x126c, 0x1278, 0x1284, 0x1290, 0x12a0, 0x12ac,
+  0x12b8, 0x12c4, 0x12d4, 0x12e0, 0x12ec, 0x12f8, 0x1308, 0x1308, 0x1314, 0x1320, 0x1330, 0x1330, 0x133c, 0x1348, 0x1358, 0x1358,
+  0x1364, 0x1370, 0x1370, 0x1380, 0x138c, 0x138c, 0x139c, 0x139c, 0x13a8, 0x13b4, 0x13b4, 0x13c4, 0x13c4, 0x13d0, 0x13d0, 0x13e0,
+  0x13e0, 0x13e0, 0x13ec, 0x13ec, 0x13fc, 0x13fc, 0x13fc, 0x1408, 0x1408, 0x1408, 0x1418, 0x1418, 0x1418, 0x1424, 0x1424, 0x1424,
+  0x1424, 0x1430, 0x1430, 0x1430, 0x1430, 0x1430, 0x1430, 0x1430, 0x1440, 0x1440, 0x1440, 0x1440, 0x1440, 0x1440, 0x1440, 0x1440,
+  0x000f, 0x002e, 0x004d, 0x006c, 0x008c, 0x00ab, 0x00ca, 0x00e9, 0x0108, 0x0127, 0x0146, 0x0166, 0x0184, 0x01a4, 0x01c2, 0x01e2,
+  0x0201, 0x021f, 0x023f, 0x025d, 0x027c, 0x029b, 0x02bb, 0x02d8, 0x02f8, 0x0315, 0x0336, 0x0354, 0x0372, 0x0392, 0x03b0, 0x03cf,
+  0x03ed, 0x040b, 0x042a, 0x0448, 0x0466, 0x0485, 0x04a4, 0x04c2, 0x04e0, 0x04ff, 0x051b, 0x053b, 0x0558, 0x0576, 0x0595, 0x05b0,
+  0x05d0, 0x05ec, 0x0609, 0x0627, 0x0645, 0x0664, 0x0683, 0x069e, 0x06ba, 0x06db, 0x06f8, 0x0715, 0x072e, 0x074c, 0x076a, 0x0784,
+  0x07a4, 0x07bf, 0x07df, 0x07fa, 0x0816, 0x0832, 0x0850, 0x086c, 0x088a, 0x08a2, 0x08c0, 0x08de, 0x08f6, 0x0910, 0x0930, 0x0948,
+  0x0962, 0x0984, 0x099e, 0x09b8, 0x09d4, 0x09f0, 0x0a0c, 0x0a20, 0x0a3c, 0x0a58, 0x0a76, 0x0a8c, 0x0aa8, 0x0ac0, 0x0ade, 0x0af4,
+  0x0b12, 0x0b2a, 0x0b40, 0x0b60, 0x0b78, 0x0b90, 0x0ba8, 0x0bc0, 0x0bd8, 0x0bf2, 0x0c0a, 0x0c24, 0x0c3c, 0x0c56, 0x0c70, 0x0c8a,
+  0x0c9c, 0x0cb6, 0x0cd0, 0x0ce2, 0x0cfe, 0x0d18, 0x0d2a, 0x0d46, 0x0d58, 0x0d74, 0x0d88, 0x0da4, 0x0db6, 0x0dca, 0x0de6, 0x0dfa,
+  0x0e0c, 0x0e20, 0x0e3e, 0x0e52, 0x0e66, 0x0e7a, 0x0e8e, 0x0ea2, 0x0eb6, 0x0eca, 0x0ee0, 0x0ef4, 0x0f08, 0x0f1e, 0x0f32, 0x0f48,
+  0x0f5c, 0x0f72, 0x0f7e, 0x0f92, 0x0fa8, 0x0fbe, 0x0fd4, 0x0fde, 0x0ff4, 0x100c, 0x1018, 0x102c, 0x1038, 0x1050, 0x1064, 0x1070,
+  0x1088, 0x1094, 0x10a8, 0x10b4, 0x10c0, 0x10d8, 0x10e4, 0x10fc, 0x1108, 0x1114, 0x112c, 0x1138, 0x1144, 0x115c, 0x1168, 0x1174,
+  0x1180, 0x118c, 0x11a4, 0x11b0, 0x11bc, 0x11c8, 0x11d4, 0x11e0, 0x11ec, 0x11f8, 0x1208, 0x1214, 0x1220, 0x122c, 0x1238, 0x1244,
+  0x1250, 0x1260, 0x126c, 0x1278, 0x1284, 0x1290, 0x12a0, 0x12a0, 0x12ac, 0x12b8, 0x12c4, 0x12c4, 0x12d4, 0x12e0, 0x12ec, 0x12ec,
+  0x12f8, 0x1308, 0x1308, 0x1314, 0x1320, 0x1320, 0x1330, 0x1330, 0x133c, 0x1348, 0x1348, 0x1358, 0x1358, 0x1364, 0x1364, 0x1370,
+  0x1370, 0x1370, 0x1380, 0x1380, 0x138c, 0x138c, 0x138c, 0x139c, 0x139c, 0x139c, 0x13a8, 0x13a8, 0x13a8, 0x13b4, 0x13b4, 0x13b4,
+  0x13b4, 0x13c4, 0x13c4, 0x13c4, 0x13c4, 0x13c4, 0x13c4, 0x13c4, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0, 0x13d0,
+  0x000f, 0x002d, 0x004c, 0x006a, 0x0089, 0x00a7, 0x00c6, 0x00e4, 0x0102, 0x0121, 0x013f, 0x015e, 0x017c, 0x019b, 0x01b9, 0x01d8,
+  0x01f6, 0x0214, 0x0233, 0x0250, 0x026e, 0x028d, 0x02ac, 0x02c8, 0x02e8, 0x0304, 0x0324, 0x0341, 0x035f, 0x037e, 0x039c, 0x03ba,
+  0x03d7, 0x03f5, 0x0414, 0x0430, 0x044e, 0x046c, 0x048b, 0x04a8, 0x04c5, 0x04e3, 0x04ff, 0x051e, 0x053b, 0x0558, 0x0576, 0x0591,
+  0x05b0, 0x05cc, 0x05e8, 0x0605, 0x0623, 0x0641, 0x065f, 0x067a, 0x0695, 0x06b5, 0x06d2, 0x06ee, 0x0706, 0x0724, 0x0742, 0x075b,
+  0x077a, 0x0794, 0x07b4, 0x07cf, 0x07ea, 0x0806, 0x0822, 0x083e, 0x085a, 0x0872, 0x0890, 0x08ae, 0x08c6, 0x08de, 0x08fc, 0x0916,
+  0x0930, 0x0950, 0x096a, 0x0984, 0x099e, 0x09b8, 0x09d4, 0x09e8, 0x0a04, 0x0a20, 0x0a3c, 0x0a52, 0x0a6e, 0x0a84, 0x0aa2, 0x0ab8,
+  0x0ad6, 0x0aec, 0x0b02, 0x0b22, 0x0b38, 0x0b50, 0x0b68, 0x0b80, 0x0b98, 0x0bb0, 0x0bc8, 0x0be0, 0x0bfa, 0x0c12, 0x0c2c, 0x0c46,
+  0x0c56, 0x0c70, 0x0c8a, 0x0c9c, 0x0cb6, 0x0cd0, 0x0ce2, 0x0cfe, 0x0d10, 0x0d2a, 0x0d3c, 0x0d58, 0x0d6a, 0x0d7e, 0x0d9a, 0x0dac,
+  0x0dc0, 0x0dd2, 0x0df0, 0x0e04, 0x0e16, 0x0e2a, 0x0e3e, 0x0e52, 0x0e66, 0x0e7a, 0x0e8e, 0x0ea2, 0x0eb6, 0x0eca, 0x0ee0, 0x0ef4,
+  0x0f08, 0x0f1e, 0x0f28, 0x0f3e, 0x0f52, 0x0f68, 0x0f7e, 0x0f88, 0x0f9e, 0x0fb4, 0x0fbe, 0x0fd4, 0x0fde, 0x0ff4, 0x100c, 0x1018,
+  0x102c, 0x1038, 0x1050, 0x1058, 0x1064, 0x107c, 0x1088, 0x10a0, 0x10a8, 0x10b4, 0x10cc, 0x10d8, 0x10e4, 0x10fc, 0x1108, 0x1114,
+  0x1120, 0x112c, 0x1144, 0x1150, 0x115c, 0x1168, 0x1174, 0x1180, 0x118c, 0x1198, 0x11a4, 0x11b0, 0x11bc, 0x11c8, 0x11d4, 0x11e0,
+  0x11ec, 0x11f8, 0x1208, 0x1214, 0x1220, 0x122c, 0x1238, 0x1238, 0x1244, 0x1250, 0x1260, 0x1260, 0x126c, 0x1278, 0x1284, 0x1284,
+  0x1290, 0x12a0, 0x12a0, 0x12ac, 0x12b8, 0x12b8, 0x12c4, 0x12c4, 0x12d4, 0x12e0, 0x12e0, 0x12ec, 0x12ec, 0x12f8, 0x12f8, 0x1308,
+  0x1308, 0x1308, 0x1314, 0x1314, 0x1320, 0x1320, 0x1320, 0x1330, 0x1330, 0x1330, 0x133c, 0x133c, 0x133c, 0x1348, 0x1348, 0x1348,
+  0x1348, 0x1358, 0x1358, 0x1358, 0x1358, 0x1358, 0x1358, 0x1358, 0x1364, 0x1364, 0x1364, 0x1364, 0x1364, 0x1364, 0x1364, 0x1364,
+  0x000e, 0x002c, 0x004a, 0x0068, 0x0086, 0x00a3, 0x00c1, 0x00df, 0x00fd, 0x011b, 0x0138, 0x0157, 0x0174, 0x0192, 0x01af, 0x01ce,
+  0x01eb, 0x0208, 0x0227, 0x0244, 0x0261, 0x027f, 0x029d, 0x02b9, 0x02d8, 0x02f4, 0x0313, 0x032f, 0x034d, 0x036b, 0x0388, 0x03a6,
+  0x03c2, 0x03df, 0x03fd, 0x0419, 0x0436, 0x0454, 0x0472, 0x048e, 0x04ab, 0x04c8, 0x04e3, 0x0502, 0x051e, 0x053b, 0x0558, 0x0572,
+  0x0591, 0x05ac, 0x05c8, 0x05e4, 0x0601, 0x061e, 0x063c, 0x0657, 0x0671, 0x0691, 0x06ac, 0x06c8, 0x06e0, 0x06fd, 0x071a, 0x0733,
+  0x0751, 0x076a, 0x078a, 0x07a4, 0x07bf, 0x07da, 0x07f5, 0x0810, 0x082c, 0x0844, 0x0860, 0x087e, 0x0896, 0x08ae, 0x08cc, 0x08e4,
+  0x08fc, 0x091c, 0x0936, 0x0950, 0x096a, 0x0984, 0x099e, 0x09b2, 0x09ce, 0x09e8, 0x0a04, 0x0a18, 0x0a36, 0x0a4a, 0x0a68, 0x0a7c,
+  0x0a9a, 0x0ab0, 0x0ac6, 0x0ae4, 0x0afc, 0x0b12, 0x0b2a, 0x0b40, 0x0b58, 0x0b70, 0x0b88, 0x0ba0, 0x0bb8, 0x0bd0, 0x0bea, 0x0c02,
+  0x0c12, 0x0c2c, 0x0c46, 0x0c56, 0x0c70, 0x0c8a, 0x0c9c, 0x0cb6, 0x0cc8, 0x0ce2, 0x0cf4, 0x0d10, 0x0d22, 0x0d34, 0x0d50, 0x0d62,
+  0x0d74, 0x0d88, 0x0da4, 0x0db6, 0x0dca, 0x0ddc, 0x0df0, 0x0e04, 0x0e16, 0x0e2a, 0x0e3e, 0x0e52, 0x0e66, 0x0e7a, 0x0e8e, 0x0ea2,
+  0x0eb6, 0x0eca, 0x0ed4, 0x0eea, 0x0efe, 0x0f14, 0x0f28, 0x0f32, 0x0f48, 0x0f5c, 0x0f68, 0x0f7e, 0x0f88, 0x0f9e, 0x0fb4, 0x0fbe,
+  0x0fd4, 0x0fde, 0x0ff4, 0x1000, 0x100c, 0x1020, 0x102c, 0x1044, 0x1050, 0x1058, 0x1070, 0x107c, 0x1088, 0x10a0, 0x10a8, 0x10b4,
+  0x10c0, 0x10cc, 0x10e4, 0x10f0, 0x10fc, 0x1108, 0x1114, 0x1120, 0x112c, 0x1138, 0x1144, 0x1150, 0x115c, 0x1168, 0x1174, 0x1180,
+  0x118c, 0x1198, 0x11a4, 0x11b0, 0x11bc, 0x11c8, 0x11d4, 0x11d4, 0x11e0, 0x11ec, 0x11f8, 0x11f8, 0x1208, 0x1214, 0x1220, 0x1220,
+  0x122c, 0x1238, 0x1238, 0x1244, 0x1250, 0x1250, 0x1260, 0x1260, 0x126c, 0x1278, 0x1278, 0x1284, 0x1284, 0x1290, 0x1290, 0x12a0,
+  0x12a0, 0x12a0, 0x12ac, 0x12ac, 0x12b8, 0x12b8, 0x12b8, 0x12c4, 0x12c4, 0x12c4, 0x12d4, 0x12d4, 0x12d4, 0x12e0, 0x12e0, 0x12e0,
+  0x12e0, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x12f8, 0x12f8, 0x12f8, 0x12f8, 0x12f8, 0x12f8, 0x12f8, 0x12f8,
+  0x000e, 0x002b, 0x0048, 0x0065, 0x0083, 0x00a0, 0x00bd, 0x00da, 0x00f7, 0x0115, 0x0132, 0x014f, 0x016c, 0x0189, 0x01a6, 0x01c4,
+  0x01e1, 0x01fd, 0x021b, 0x0237, 0x0254, 0x0271, 0x028f, 0x02aa, 0x02c8, 0x02e4, 0x0302, 0x031e, 0x033b, 0x0358, 0x0374, 0x0392,
+  0x03ad, 0x03ca, 0x03e7, 0x0403, 0x041f, 0x043c, 0x045a, 0x0475, 0x0491, 0x04ae, 0x04c8, 0x04e7, 0x0502, 0x051e, 0x053b, 0x0554,
+  0x0572, 0x058d, 0x05a8, 0x05c4, 0x05e0, 0x05fd, 0x061a, 0x0634, 0x064e, 0x066d, 0x0688, 0x06a3, 0x06ba, 0x06d6, 0x06f3, 0x070b,
+  0x0729, 0x0742, 0x0760, 0x077a, 0x0794, 0x07ae, 0x07c9, 0x07e4, 0x0800, 0x0816, 0x0832, 0x0850, 0x0866, 0x087e, 0x089c, 0x08b4,
+  0x08cc, 0x08ea, 0x0904, 0x091c, 0x0936, 0x0950, 0x096a, 0x097c, 0x0998, 0x09b2, 0x09ce, 0x09e2, 0x09fe, 0x0a12, 0x0a2e, 0x0a44,
+  0x0a60, 0x0a76, 0x0a8c, 0x0aa8, 0x0ac0, 0x0ad6, 0x0aec, 0x0b02, 0x0b1a, 0x0b32, 0x0b48, 0x0b60, 0x0b78, 0x0b90, 0x0ba8, 0x0bc0,
+  0x0bd0, 0x0bea, 0x0c02, 0x0c12, 0x0c2c, 0x0c46, 0x0c56, 0x0c70, 0x0c82, 0x0c9c, 0x0cae, 0x0cc8, 0x0cda, 0x0cec, 0x0d06, 0x0d18,
+  0x0d2a, 0x0d3c, 0x0d58, 0x0d6a, 0x0d7e, 0x0d90, 0x0da4, 0x0db6, 0x0dca, 0x0ddc, 0x0df0, 0x0e04, 0x0e16, 0x0e2a, 0x0e3e, 0x0e52,
+  0x0e66, 0x0e7a, 0x0e84, 0x0e98, 0x0eac, 0x0ec0, 0x0ed4, 0x0ee0, 0x0ef4, 0x0f08, 0x0f14, 0x0f28, 0x0f32, 0x0f48, 0x0f5c, 0x0f68,
+  0x0f7e, 0x0f88, 0x0f9e, 0x0fa8, 0x0fb4, 0x0fc8, 0x0fd4, 0x0fea, 0x0ff4, 0x1000, 0x1018, 0x1020, 0x102c, 0x1044, 0x1050, 0x1058,
+  0x1064, 0x1070, 0x1088, 0x1094, 0x10a0, 0x10a8, 0x10b4, 0x10c0, 0x10cc, 0x10d8, 0x10e4, 0x10f0, 0x10fc, 0x1108, 0x1114, 0x1120,
+  0x112c, 0x1138, 0x1144, 0x1150, 0x115c, 0x1168, 0x1174, 0x1174, 0x1180, 0x118c, 0x1198, 0x1198, 0x11a4, 0x11b0, 0x11bc, 0x11bc,
+  0x11c8, 0x11d4, 0x11d4, 0x11e0, 0x11ec, 0x11ec, 0x11f8, 0x11f8, 0x1208, 0x1214, 0x1214, 0x1220, 0x1220, 0x122c, 0x122c, 0x1238,
+  0x1238, 0x1238, 0x1244, 0x1244, 0x1250, 0x1250, 0x1250, 0x1260, 0x1260, 0x1260, 0x126c, 0x126c, 0x126c, 0x1278, 0x1278, 0x1278,
+  0x1278, 0x1284, 0x1284, 0x1284, 0x1284, 0x1284, 0x1284, 0x1284, 0x1290, 0x1290, 0x1290, 0x1290, 0x1290, 0x1290, 0x1290, 0x1290,
+  0x000e, 0x002a, 0x0047, 0x0063, 0x0080, 0x009c, 0x00b9, 0x00d6, 0x00f2, 0x010f, 0x012b, 0x0148, 0x0164, 0x0181, 0x019d, 0x01ba,
+  0x01d6, 0x01f2, 0x020f, 0x022b, 0x0247, 0x0264, 0x0281, 0x029b, 0x02b9, 0x02d4, 0x02f2, 0x030d, 0x0329, 0x0346, 0x0362, 0x037e,
+  0x0399, 0x03b5, 0x03d2, 0x03ed, 0x0408, 0x0425, 0x0442, 0x045d, 0x0478, 0x0494, 0x04ae, 0x04cc, 0x04e7, 0x0502, 0x051e, 0x0537,
+  0x0554, 0x056f, 0x0589, 0x05a4, 0x05c0, 0x05dc, 0x05f9, 0x0612, 0x062b, 0x0649, 0x0664, 0x067f, 0x0695, 0x06b1, 0x06cd, 0x06e5,
+  0x0702, 0x071a, 0x0738, 0x0751, 0x076a, 0x0784, 0x079f, 0x07b9, 0x07d4, 0x07ea, 0x0806, 0x0822, 0x0838, 0x0850, 0x086c, 0x0884,
+  0x089c, 0x08ba, 0x08d2, 0x08ea, 0x0904, 0x091c, 0x0936, 0x0948, 0x0962, 0x097c, 0x0998, 0x09ac, 0x09c6, 0x09da, 0x09f6, 0x0a0c,
+  0x0a28, 0x0a3c, 0x0a52, 0x0a6e, 0x0a84, 0x0a9a, 0x0ab0, 0x0ac6, 0x0ade, 0x0af4, 0x0b0a, 0x0b22, 0x0b38, 0x0b50, 0x0b68, 0x0b80,
+  0x0b90, 0x0ba8, 0x0bc0, 0x0bd0, 0x0bea, 0x0c02, 0x0c12, 0x0c2c, 0x0c3c, 0x0c56, 0x0c68, 0x0c82, 0x0c92, 0x0ca4, 0x0cbe, 0x0cd0,
+  0x0ce2, 0x0cf4, 0x0d10, 0x0d22, 0x0d34, 0x0d46, 0x0d58, 0x0d6a, 0x0d7e, 0x0d90, 0x0da4, 0x0db6, 0x0dca, 0x0ddc, 0x0df0, 0x0e04,
+  0x0e16, 0x0e2a, 0x0e34, 0x0e48, 0x0e5c, 0x0e70, 0x0e84, 0x0e8e, 0x0ea2, 0x0eb6, 0x0ec0, 0x0ed4, 0x0ee0, 0x0ef4, 0x0f08, 0x0f14,
+  0x0f28, 0x0f32, 0x0f48, 0x0f52, 0x0f5c, 0x0f72, 0x0f7e, 0x0f92, 0x0f9e, 0x0fa8, 0x0fbe, 0x0fc8, 0x0fd4, 0x0fea, 0x0ff4, 0x1000,
+  0x100c, 0x1018, 0x102c, 0x1038, 0x1044, 0x1050, 0x1058, 0x1064, 0x1070, 0x107c, 0x1088, 0x1094, 0x10a0, 0x10a8, 0x10b4, 0x10c0,
+  0x10cc, 0x10d8, 0x10e4, 0x10f0, 0x10fc, 0x1108, 0x1114, 0x1114, 0x1120, 0x112c, 0x1138, 0x1138, 0x1144, 0x1150, 0x115c, 0x115c,
+  0x1168, 0x1174, 0x1174, 0x1180, 0x118c, 0x118c, 0x1198, 0x1198, 0x11a4, 0x11b0, 0x11b0, 0x11bc, 0x11bc, 0x11c8, 0x11c8, 0x11d4,
+  0x11d4, 0x11d4, 0x11e0, 0x11e0, 0x11ec, 0x11ec, 0x11ec, 0x11f8, 0x11f8, 0x11f8, 0x1208, 0x1208, 0x1208, 0x1214, 0x1214, 0x1214,
+  0x1214, 0x1220, 0x1220, 0x1220, 0x1220, 0x1220, 0x1220, 0x1220, 0x122c, 0x122c, 0x122c, 0x122c, 0x122c, 0x122c, 0x122c, 0x122c,
+  0x000d, 0x0029, 0x0045, 0x0061, 0x007d, 0x0099, 0x00b5, 0x00d1, 0x00ed, 0x0109, 0x0125, 0x0141, 0x015c, 0x0179, 0x0194, 0x01b1,
+  0x01cc, 0x01e7, 0x0204, 0x021f, 0x023a, 0x0257, 0x0273, 0x028d, 0x02aa, 0x02c4, 0x02e2, 0x02fc, 0x0318, 0x0334, 0x034f, 0x036b,
+  0x0385, 0x03a1, 0x03bd, 0x03d7, 0x03f2, 0x040e, 0x042a, 0x0445, 0x0460, 0x047b, 0x0494, 0x04b1, 0x04cc, 0x04e7, 0x0502, 0x051b,
+  0x0537, 0x0551, 0x056b, 0x0585, 0x05a0, 0x05bc, 0x05d8, 0x05f0, 0x0609, 0x0627, 0x0641, 0x065b, 0x0671, 0x068c, 0x06a8, 0x06bf,
+  0x06db, 0x06f3, 0x0710, 0x0729, 0x0742, 0x075b, 0x0775, 0x078f, 0x07a9, 0x07bf, 0x07da, 0x07f5, 0x080c, 0x0822, 0x083e, 0x0854,
+  0x086c, 0x088a, 0x08a2, 0x08ba, 0x08d2, 0x08ea, 0x0904, 0x0916, 0x0930, 0x0948, 0x0962, 0x0976, 0x0990, 0x09a4, 0x09c0, 0x09d4,
+  0x09f0, 0x0a04, 0x0a18, 0x0a36, 0x0a4a, 0x0a60, 0x0a76, 0x0a8c, 0x0aa2, 0x0ab8, 0x0ace, 0x0ae4, 0x0afc, 0x0b12, 0x0b2a, 0x0b40,
+  0x0b50, 0x0b68, 0x0b80, 0x0b90, 0x0ba8, 0x0bc0, 0x0bd0, 0x0bea, 0x0bfa, 0x0c12, 0x0c24, 0x0c3c, 0x0c4e, 0x0c60, 0x0c78, 0x0c8a,
+  0x0c9c, 0x0cae, 0x0cc8, 0x0cda, 0x0cec, 0x0cfe, 0x0d10, 0x0d22, 0x0d34, 0x0d46, 0x0d58, 0x0d6a, 0x0d7e, 0x0d90, 0x0da4, 0x0db6,
+  0x0dca, 0x0ddc, 0x0de6, 0x0dfa, 0x0e0c, 0x0e20, 0x0e34, 0x0e3e, 0x0e52, 0x0e66, 0x0e70, 0x0e84, 0x0e8e, 0x0ea2, 0x0eb6, 0x0ec0,
+  0x0ed4, 0x0ee0, 0x0ef4, 0x0efe, 0x0f08, 0x0f1e, 0x0f28, 0x0f3e, 0x0f48, 0x0f52, 0x0f68, 0x0f72, 0x0f7e, 0x0f92, 0x0f9e, 0x0fa8,
+  0x0fb4, 0x0fbe, 0x0fd4, 0x0fde, 0x0fea, 0x0ff4, 0x1000, 0x100c, 0x1018, 0x1020, 0x102c, 0x1038, 0x1044, 0x1050, 0x1058, 0x1064,
+  0x1070, 0x107c, 0x1088, 0x1094, 0x10a0, 0x10a8, 0x10b4, 0x10b4, 0x10c0, 0x10cc, 0x10d8, 0x10d8, 0x10e4, 0x10f0, 0x10fc, 0x10fc,
+  0x1108, 0x1114, 0x1114, 0x1120, 0x112c, 0x112c, 0x1138, 0x1138, 0x1144, 0x1150, 0x1150, 0x115c, 0x115c, 0x1168, 0x1168, 0x1174,
+  0x1174, 0x1174, 0x1180, 0x1180, 0x118c, 0x118c, 0x118c, 0x1198, 0x1198, 0x1198, 0x11a4, 0x11a4, 0x11a4, 0x11b0, 0x11b0, 0x11b0,
+  0x11b0, 0x11bc, 0x11bc, 0x11bc, 0x11bc, 0x11bc, 0x11bc, 0x11bc, 0x11c8, 0x11c8, 0x11c8, 0x11c8, 0x11c8, 0x11c8, 0x11c8, 0x11c8,
+  0x000d, 0x0029, 0x0044, 0x005f, 0x007a, 0x0096, 0x00b1, 0x00cd, 0x00e8, 0x0103, 0x011e, 0x013a, 0x0155, 0x0171, 0x018c, 0x01a7,
+  0x01c2, 0x01dd, 0x01f9, 0x0214, 0x022e, 0x024a, 0x0266, 0x027f, 0x029b, 0x02b5, 0x02d2, 0x02ec, 0x0307, 0x0322, 0x033d, 0x0358,
+  0x0372, 0x038d, 0x03a8, 0x03c2, 0x03dc, 0x03f7, 0x0414, 0x042d, 0x0448, 0x0463, 0x047b, 0x0498, 0x04b1, 0x04cc, 0x04e7, 0x04ff,
+  0x051b, 0x0534, 0x054d, 0x0567, 0x0581, 0x059c, 0x05b8, 0x05d0, 0x05e8, 0x0605, 0x061e, 0x0638, 0x064e, 0x0668, 0x0683, 0x069a,
+  0x06b5, 0x06cd, 0x06e9, 0x0702, 0x071a, 0x0733, 0x074c, 0x0765, 0x077f, 0x0794, 0x07ae, 0x07c9, 0x07df, 0x07f5, 0x0810, 0x0828,
+  0x083e, 0x085a, 0x0872, 0x088a, 0x08a2, 0x08ba, 0x08d2, 0x08e4, 0x08fc, 0x0916, 0x0930, 0x0942, 0x095c, 0x0970, 0x098a, 0x099e,
+  0x09b8, 0x09ce, 0x09e2, 0x09fe, 0x0a12, 0x0a28, 0x0a3c, 0x0a52, 0x0a68, 0x0a7c, 0x0a92, 0x0aa8, 0x0ac0, 0x0ad6, 0x0aec, 0x0b02,
+  0x0b12, 0x0b2a, 0x0b40, 0x0b50, 0x0b68, 0x0b80, 0x0b90, 0x0ba8, 0x0bb8, 0x0bd0, 0x0be0, 0x0bfa, 0x0c0a, 0x0c1c, 0x0c34, 0x0c46,
+  0x0c56, 0x0c68, 0x0c82, 0x0c92, 0x0ca4, 0x0cb6, 0x0cc8, 0x0cda, 0x0cec, 0x0cfe, 0x0d10, 0x0d22, 0x0d34, 0x0d46, 0x0d58, 0x0d6a,
+  0x0d7e, 0x0d90, 0x0d9a, 0x0dac, 0x0dc0, 0x0dd2, 0x0de6, 0x0df0, 0x0e04, 0x0e16, 0x0e20, 0x0e34, 0x0e3e, 0x0e52, 0x0e66, 0x0e70,
+  0x0e84, 0x0e8e, 0x0ea2, 0x0eac, 0x0eb6, 0x0eca, 0x0ed4, 0x0eea, 0x0ef4, 0x0efe, 0x0f14, 0x0f1e, 0x0f28, 0x0f3e, 0x0f48, 0x0f52,
+  0x0f5c, 0x0f68, 0x0f7e, 0x0f88, 0x0f92, 0x0f9e, 0x0fa8, 0x0fb4, 0x0fbe, 0x0fc8, 0x0fd4, 0x0fde, 0x0fea, 0x0ff4, 0x1000, 0x100c,
+  0x1018, 0x1020, 0x102c, 0x1038, 0x1044, 0x1050, 0x1058, 0x1058, 0x1064, 0x1070, 0x107c, 0x107c, 0x1088, 0x1094, 0x10a0, 0x10a0,
+  0x10a8, 0x10b4, 0x10b4, 0x10c0, 0x10cc, 0x10cc, 0x10d8, 0x10d8, 0x10e4, 0x10f0, 0x10f0, 0x10fc, 0x10fc, 0x1108, 0x1108, 0x1114,
+  0x1114, 0x1114, 0x1120, 0x1120, 0x112c, 0x112c, 0x112c, 0x1138, 0x1138, 0x1138, 0x1144, 0x1144, 0x1144, 0x1150, 0x1150, 0x1150,
+  0x1150, 0x115c, 0x115c, 0x115c, 0x115c, 0x115c, 0x115c, 0x115c, 0x1168, 0x1168, 0x1168, 0x1168, 0x1168, 0x1168, 0x1168, 0x1168,
+  0x000d, 0x0028, 0x0042, 0x005d, 0x0078, 0x0093, 0x00ad, 0x00c8, 0x00e3, 0x00fd, 0x0118, 0x0133, 0x014d, 0x0169, 0x0183, 0x019e,
+  0x01b9, 0x01d3, 0x01ee, 0x0208, 0x0222, 0x023d, 0x0258, 0x0271, 0x028d, 0x02a6, 0x02c2, 0x02dc, 0x02f6, 0x0311, 0x032b, 0x0346,
+  0x035f, 0x0379, 0x0394, 0x03ad, 0x03c7, 0x03e2, 0x03fd, 0x0416, 0x0430, 0x044b, 0x0463, 0x047e, 0x0498, 0x04b1, 0x04cc, 0x04e3,
+  0x04ff, 0x0517, 0x0530, 0x0549, 0x0563, 0x057e, 0x0599, 0x05b0, 0x05c8, 0x05e4, 0x05fd, 0x0616, 0x062b, 0x0645, 0x065f, 0x0676,
+  0x0691, 0x06a8, 0x06c4, 0x06db, 0x06f3, 0x070b, 0x0724, 0x073d, 0x0756, 0x076a, 0x0784, 0x079f, 0x07b4, 0x07c9, 0x07e4, 0x07fa,
+  0x0810, 0x082c, 0x0844, 0x085a, 0x0872, 0x088a, 0x08a2, 0x08b4, 0x08cc, 0x08e4, 0x08fc, 0x0910, 0x0928, 0x093c, 0x0956, 0x096a,
+  0x0984, 0x0998, 0x09ac, 0x09c6, 0x09da, 0x09f0, 0x0a04, 0x0a18, 0x0a2e, 0x0a44, 0x0a58, 0x0a6e, 0x0a84, 0x0a9a, 0x0ab0, 0x0ac6,
+  0x0ad6, 0x0aec, 0x0b02, 0x0b12, 0x0b2a, 0x0b40, 0x0b50, 0x0b68, 0x0b78, 0x0b90, 0x0ba0, 0x0bb8, 0x0bc8, 0x0bd8, 0x0bf2, 0x0c02,
+  0x0c12, 0x0c24, 0x0c3c, 0x0c4e, 0x0c60, 0x0c70, 0x0c82, 0x0c92, 0x0ca4, 0x0cb6, 0x0cc8, 0x0cda, 0x0cec, 0x0cfe, 0x0d10, 0x0d22,
+  0x0d34, 0x0d46, 0x0d50, 0x0d62, 0x0d74, 0x0d88, 0x0d9a, 0x0da4, 0x0db6, 0x0dca, 0x0dd2, 0x0de6, 0x0df0, 0x0e04, 0x0e16, 0x0e20,
+  0x0e34, 0x0e3e, 0x0e52, 0x0e5c, 0x0e66, 0x0e7a, 0x0e84, 0x0e98, 0x0ea2, 0x0eac, 0x0ec0, 0x0eca, 0x0ed4, 0x0eea, 0x0ef4, 0x0efe,
+  0x0f08, 0x0f14, 0x0f28, 0x0f32, 0x0f3e, 0x0f48, 0x0f52, 0x0f5c, 0x0f68, 0x0f72, 0x0f7e, 0x0f88, 0x0f92, 0x0f9e, 0x0fa8, 0x0fb4,
+  0x0fbe, 0x0fc8, 0x0fd4, 0x0fde, 0x0fea, 0x0ff4, 0x1000, 0x1000, 0x100c, 0x1018, 0x1020, 0x1020, 0x102c, 0x1038, 0x1044, 0x1044,
+  0x1050, 0x1058, 0x1058, 0x1064, 0x1070, 0x1070, 0x107c, 0x107c, 0x1088, 0x1094, 0x1094, 0x10a0, 0x10a0, 0x10a8, 0x10a8, 0x10b4,
+  0x10b4, 0x10b4, 0x10c0, 0x10c0, 0x10cc, 0x10cc, 0x10cc, 0x10d8, 0x10d8, 0x10d8, 0x10e4, 0x10e4, 0x10e4, 0x10f0, 0x10f0, 0x10f0,
+  0x10f0, 0x10fc, 0x10fc, 0x10fc, 0x10fc, 0x10fc, 0x10fc, 0x10fc, 0x1108, 0x1108, 0x1108, 0x1108, 0x1108, 0x1108, 0x1108, 0x1108,
+  0x000d, 0x0027, 0x0041, 0x005b, 0x0075, 0x008f, 0x00aa, 0x00c4, 0x00de, 0x00f8, 0x0112, 0x012d, 0x0146, 0x0161, 0x017b, 0x0195,
+  0x01af, 0x01c9, 0x01e3, 0x01fd, 0x0216, 0x0231, 0x024c, 0x0264, 0x027f, 0x0298, 0x02b3, 0x02cc, 0x02e6, 0x0300, 0x031a, 0x0334,
+  0x034d, 0x0366, 0x0381, 0x0399, 0x03b2, 0x03cc, 0x03e7, 0x0400, 0x0419, 0x0433, 0x044b, 0x0466, 0x047e, 0x0498, 0x04b1, 0x04c8,
+  0x04e3, 0x04fb, 0x0514, 0x052c, 0x0546, 0x0560, 0x057a, 0x0591, 0x05a8, 0x05c4, 0x05dc, 0x05f5, 0x0609, 0x0623, 0x063c, 0x0652,
+  0x066d, 0x0683, 0x069e, 0x06b5, 0x06cd, 0x06e5, 0x06fd, 0x0715, 0x072e, 0x0742, 0x075b, 0x0775, 0x078a, 0x079f, 0x07b9, 0x07cf,
+  0x07e4, 0x0800, 0x0816, 0x082c, 0x0844, 0x085a, 0x0872, 0x0884, 0x089c, 0x08b4, 0x08cc, 0x08de, 0x08f6, 0x090a, 0x0922, 0x0936,
+  0x0950, 0x0962, 0x0976, 0x0990, 0x09a4, 0x09b8, 0x09ce, 0x09e2, 0x09f6, 0x0a0c, 0x0a20, 0x0a36, 0x0a4a, 0x0a60, 0x0a76, 0x0a8c,
+  0x0a9a, 0x0ab0, 0x0ac6, 0x0ad6, 0x0aec, 0x0b02, 0x0b12, 0x0b2a, 0x0b38, 0x0b50, 0x0b60, 0x0b78, 0x0b88, 0x0b98, 0x0bb0, 0x0bc0,
+  0x0bd0, 0x0be0, 0x0bfa, 0x0c0a, 0x0c1c, 0x0c2c, 0x0c3c, 0x0c4e, 0x0c60, 0x0c70, 0x0c82, 0x0c92, 0x0ca4, 0x0cb6, 0x0cc8, 0x0cda,
+  0x0cec, 0x0cfe, 0x0d06, 0x0d18, 0x0d2a, 0x0d3c, 0x0d50, 0x0d58, 0x0d6a, 0x0d7e, 0x0d88, 0x0d9a, 0x0da4, 0x0db6, 0x0dca, 0x0dd2,
+  0x0de6, 0x0df0, 0x0e04, 0x0e0c, 0x0e16, 0x0e2a, 0x0e34, 0x0e48, 0x0e52, 0x0e5c, 0x0e70, 0x0e7a, 0x0e84, 0x0e98, 0x0ea2, 0x0eac,
+  0x0eb6, 0x0ec0, 0x0ed4, 0x0ee0, 0x0eea, 0x0ef4, 0x0efe, 0x0f08, 0x0f14, 0x0f1e, 0x0f28, 0x0f32, 0x0f3e, 0x0f48, 0x0f52, 0x0f5c,
+  0x0f68, 0x0f72, 0x0f7e, 0x0f88, 0x0f92, 0x0f9e, 0x0fa8, 0x0fa8, 0x0fb4, 0x0fbe, 0x0fc8, 0x0fc8, 0x0fd4, 0x0fde, 0x0fea, 0x0fea,
+  0x0ff4, 0x1000, 0x1000, 0x100c, 0x1018, 0x1018, 0x1020, 0x1020, 0x102c, 0x1038, 0x1038, 0x1044, 0x1044, 0x1050, 0x1050, 0x1058,
+  0x1058, 0x1058, 0x1064, 0x1064, 0x1070, 0x1070, 0x1070, 0x107c, 0x107c, 0x107c, 0x1088, 0x1088, 0x1088, 0x1094, 0x1094, 0x1094,
+  0x1094, 0x10a0, 0x10a0, 0x10a0, 0x10a0, 0x10a0, 0x10a0, 0x10a0, 0x10a8, 0x10a8, 0x10a8, 0x10a8, 0x10a8, 0x10a8, 0x10a8, 0x10a8,
+  0x000c, 0x0026, 0x0040, 0x0059, 0x0073, 0x008c, 0x00a6, 0x00c0, 0x00d9, 0x00f3, 0x010c, 0x0126, 0x013f, 0x0159, 0x0173, 0x018d,
+  0x01a6, 0x01bf, 0x01d9, 0x01f2, 0x020b, 0x0225, 0x023f, 0x0257, 0x0271, 0x028a, 0x02a4, 0x02bd, 0x02d6, 0x02f0, 0x0309, 0x0322,
+  0x033b, 0x0354, 0x036d, 0x0385, 0x039e, 0x03b8, 0x03d2, 0x03ea, 0x0403, 0x041c, 0x0433, 0x044e, 0x0466, 0x047e, 0x0498, 0x04ae,
+  0x04c8, 0x04e0, 0x04f8, 0x0510, 0x0529, 0x0542, 0x055c, 0x0572, 0x0589, 0x05a4, 0x05bc, 0x05d4, 0x05e8, 0x0601, 0x061a, 0x0630,
+  0x0649, 0x065f, 0x067a, 0x0691, 0x06a8, 0x06bf, 0x06d6, 0x06ee, 0x0706, 0x071a, 0x0733, 0x074c, 0x0760, 0x0775, 0x078f, 0x07a4,
+  0x07b9, 0x07d4, 0x07ea, 0x0800, 0x0816, 0x082c, 0x0844, 0x0854, 0x086c, 0x0884, 0x089c, 0x08ae, 0x08c6, 0x08d8, 0x08f0, 0x0904,
+  0x091c, 0x0930, 0x0942, 0x095c, 0x0970, 0x0984, 0x0998, 0x09ac, 0x09c0, 0x09d4, 0x09e8, 0x09fe, 0x0a12, 0x0a28, 0x0a3c, 0x0a52,
+  0x0a60, 0x0a76, 0x0a8c, 0x0a9a, 0x0ab0, 0x0ac6, 0x0ad6, 0x0aec, 0x0afc, 0x0b12, 0x0b22, 0x0b38, 0x0b48, 0x0b58, 0x0b70, 0x0b80,
+  0x0b90, 0x0ba0, 0x0bb8, 0x0bc8, 0x0bd8, 0x0bea, 0x0bfa, 0x0c0a, 0x0c1c, 0x0c2c, 0x0c3c, 0x0c4e, 0x0c60, 0x0c70, 0x0c82, 0x0c92,
+  0x0ca4, 0x0cb6, 0x0cbe, 0x0cd0, 0x0ce2, 0x0cf4, 0x0d06, 0x0d10, 0x0d22, 0x0d34, 0x0d3c, 0x0d50, 0x0d58, 0x0d6a, 0x0d7e, 0x0d88,
+  0x0d9a, 0x0da4, 0x0db6, 0x0dc0, 0x0dca, 0x0ddc, 0x0de6, 0x0dfa, 0x0e04, 0x0e0c, 0x0e20, 0x0e2a, 0x0e34, 0x0e48, 0x0e52, 0x0e5c,
+  0x0e66, 0x0e70, 0x0e84, 0x0e8e, 0x0e98, 0x0ea2, 0x0eac, 0x0eb6, 0x0ec0, 0x0eca, 0x0ed4, 0x0ee0, 0x0eea, 0x0ef4, 0x0efe, 0x0f08,
+  0x0f14, 0x0f1e, 0x0f28, 0x0f32, 0x0f3e, 0x0f48, 0x0f52, 0x0f52, 0x0f5c, 0x0f68, 0x0f72, 0x0f72, 0x0f7e, 0x0f88, 0x0f92, 0x0f92,
+  0x0f9e, 0x0fa8, 0x0fa8, 0x0fb4, 0x0fbe, 0x0fbe, 0x0fc8, 0x0fc8, 0x0fd4, 0x0fde, 0x0fde, 0x0fea, 0x0fea, 0x0ff4, 0x0ff4, 0x1000,
+  0x1000, 0x1000, 0x100c, 0x100c, 0x1018, 0x1018, 0x1018, 0x1020, 0x1020, 0x1020, 0x102c, 0x102c, 0x102c, 0x1038, 0x1038, 0x1038,
+  0x1038, 0x1044, 0x1044, 0x1044, 0x1044, 0x1044, 0x1044, 0x1044, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050,
+  0x000c, 0x0025, 0x003e, 0x0057, 0x0070, 0x0089, 0x00a2, 0x00bc, 0x00d5, 0x00ee, 0x0107, 0x0120, 0x0138, 0x0152, 0x016b, 0x0184,
+  0x019d, 0x01b5, 0x01cf, 0x01e7, 0x0200, 0x0219, 0x0233, 0x024a, 0x0264, 0x027c, 0x0296, 0x02ae, 0x02c6, 0x02e0, 0x02f8, 0x0311,
+  0x0329, 0x0341, 0x035a, 0x0372, 0x038a, 0x03a3, 0x03bd, 0x03d4, 0x03ed, 0x0406, 0x041c, 0x0436, 0x044e, 0x0466, 0x047e, 0x0494,
+  0x04ae, 0x04c5, 0x04dc, 0x04f4, 0x050c, 0x0525, 0x053e, 0x0554, 0x056b, 0x0585, 0x059c, 0x05b4, 0x05c8, 0x05e0, 0x05f9, 0x060e,
+  0x0627, 0x063c, 0x0657, 0x066d, 0x0683, 0x069a, 0x06b1, 0x06c8, 0x06e0, 0x06f3, 0x070b, 0x0724, 0x0738, 0x074c, 0x0765, 0x077a,
+  0x078f, 0x07a9, 0x07bf, 0x07d4, 0x07ea, 0x0800, 0x0816, 0x0828, 0x083e, 0x0854, 0x086c, 0x087e, 0x0896, 0x08a8, 0x08c0, 0x08d2,
+  0x08ea, 0x08fc, 0x0910, 0x0928, 0x093c, 0x0950, 0x0962, 0x0976, 0x098a, 0x099e, 0x09b2, 0x09c6, 0x09da, 0x09f0, 0x0a04, 0x0a18,
+  0x0a28, 0x0a3c, 0x0a52, 0x0a60, 0x0a76, 0x0a8c, 0x0a9a, 0x0ab0, 0x0ac0, 0x0ad6, 0x0ae4, 0x0afc, 0x0b0a, 0x0b1a, 0x0b32, 0x0b40,
+  0x0b50, 0x0b60, 0x0b78, 0x0b88, 0x0b98, 0x0ba8, 0x0bb8, 0x0bc8, 0x0bd8, 0x0bea, 0x0bfa, 0x0c0a, 0x0c1c, 0x0c2c, 0x0c3c, 0x0c4e,
+  0x0c60, 0x0c70, 0x0c78, 0x0c8a, 0x0c9c, 0x0cae, 0x0cbe, 0x0cc8, 0x0cda, 0x0cec, 0x0cf4, 0x0d06, 0x0d10, 0x0d22, 0x0d34, 0x0d3c,
+  0x0d50, 0x0d58, 0x0d6a, 0x0d74, 0x0d7e, 0x0d90, 0x0d9a, 0x0dac, 0x0db6, 0x0dc0, 0x0dd2, 0x0ddc, 0x0de6, 0x0dfa, 0x0e04, 0x0e0c,
+  0x0e16, 0x0e20, 0x0e34, 0x0e3e, 0x0e48, 0x0e52, 0x0e5c, 0x0e66, 0x0e70, 0x0e7a, 0x0e84, 0x0e8e, 0x0e98, 0x0ea2, 0x0eac, 0x0eb6,
+  0x0ec0, 0x0eca, 0x0ed4, 0x0ee0, 0x0eea, 0x0ef4, 0x0efe, 0x0efe, 0x0f08, 0x0f14, 0x0f1e, 0x0f1e, 0x0f28, 0x0f32, 0x0f3e, 0x0f3e,
+  0x0f48, 0x0f52, 0x0f52, 0x0f5c, 0x0f68, 0x0f68, 0x0f72, 0x0f72, 0x0f7e, 0x0f88, 0x0f88, 0x0f92, 0x0f92, 0x0f9e, 0x0f9e, 0x0fa8,
+  0x0fa8, 0x0fa8, 0x0fb4, 0x0fb4, 0x0fbe, 0x0fbe, 0x0fbe, 0x0fc8, 0x0fc8, 0x0fc8, 0x0fd4, 0x0fd4, 0x0fd4, 0x0fde, 0x0fde, 0x0fde,
+  0x0fde, 0x0fea, 0x0fea, 0x0fea, 0x0fea, 0x0fea, 0x0fea, 0x0fea, 0x0ff4, 0x0ff4, 0x0ff4, 0x0ff4, 0x0ff4, 0x0ff4, 0x0ff4, 0x0ff4,
+  0x000c, 0x0024, 0x003d, 0x0055, 0x006e, 0x0086, 0x009f, 0x00b8, 0x00d0, 0x00e8, 0x0101, 0x011a, 0x0132, 0x014b, 0x0163, 0x017c,
+  0x0194, 0x01ac, 0x01c5, 0x01dd, 0x01f5, 0x020e, 0x0227, 0x023d, 0x0257, 0x026e, 0x0288, 0x029f, 0x02b7, 0x02d0, 0x02e8, 0x0300,
+  0x0318, 0x032f, 0x0348, 0x035f, 0x0377, 0x038f, 0x03a8, 0x03bf, 0x03d7, 0x03ef, 0x0406, 0x041f, 0x0436, 0x044e, 0x0466, 0x047b,
+  0x0494, 0x04ab, 0x04c2, 0x04d9, 0x04f1, 0x0509, 0x0522, 0x0537, 0x054d, 0x0567, 0x057e, 0x0595, 0x05a8, 0x05c0, 0x05d8, 0x05ec,
+  0x0605, 0x061a, 0x0634, 0x0649, 0x065f, 0x0676, 0x068c, 0x06a3, 0x06ba, 0x06cd, 0x06e5, 0x06fd, 0x0710, 0x0724, 0x073d, 0x0751,
+  0x0765, 0x077f, 0x0794, 0x07a9, 0x07bf, 0x07d4, 0x07ea, 0x07fa, 0x0810, 0x0828, 0x083e, 0x0850, 0x0866, 0x0878, 0x0890, 0x08a2,
+  0x08ba, 0x08cc, 0x08de, 0x08f6, 0x090a, 0x091c, 0x0930, 0x0942, 0x0956, 0x096a, 0x097c, 0x0990, 0x09a4, 0x09b8, 0x09ce, 0x09e2,
+  0x09f0, 0x0a04, 0x0a18, 0x0a28, 0x0a3c, 0x0a52, 0x0a60, 0x0a76, 0x0a84, 0x0a9a, 0x0aa8, 0x0ac0, 0x0ace, 0x0ade, 0x0af4, 0x0b02,
+  0x0b12, 0x0b22, 0x0b38, 0x0b48, 0x0b58, 0x0b68, 0x0b78, 0x0b88, 0x0b98, 0x0ba8, 0x0bb8, 0x0bc8, 0x0bd8, 0x0bea, 0x0bfa, 0x0c0a,
+  0x0c1c, 0x0c2c, 0x0c34, 0x0c46, 0x0c56, 0x0c68, 0x0c78, 0x0c82, 0x0c92, 0x0ca4, 0x0cae, 0x0cbe, 0x0cc8, 0x0cda, 0x0cec, 0x0cf4,
+  0x0d06, 0x0d10, 0x0d22, 0x0d2a, 0x0d34, 0x0d46, 0x0d50, 0x0d62, 0x0d6a, 0x0d74, 0x0d88, 0x0d90, 0x0d9a, 0x0dac, 0x0db6, 0x0dc0,
+  0x0dca, 0x0dd2, 0x0de6, 0x0df0, 0x0dfa, 0x0e04, 0x0e0c, 0x0e16, 0x0e20, 0x0e2a, 0x0e34, 0x0e3e, 0x0e48, 0x0e52, 0x0e5c, 0x0e66,
+  0x0e70, 0x0e7a, 0x0e84, 0x0e8e, 0x0e98, 0x0ea2, 0x0eac, 0x0eac, 0x0eb6, 0x0ec0, 0x0eca, 0x0eca, 0x0ed4, 0x0ee0, 0x0eea, 0x0eea,
+  0x0ef4, 0x0efe, 0x0efe, 0x0f08, 0x0f14, 0x0f14, 0x0f1e, 0x0f1e, 0x0f28, 0x0f32, 0x0f32, 0x0f3e, 0x0f3e, 0x0f48, 0x0f48, 0x0f52,
+  0x0f52, 0x0f52, 0x0f5c, 0x0f5c, 0x0f68, 0x0f68, 0x0f68, 0x0f72, 0x0f72, 0x0f72, 0x0f7e, 0x0f7e, 0x0f7e, 0x0f88, 0x0f88, 0x0f88,
+  0x0f88, 0x0f92, 0x0f92, 0x0f92, 0x0f92, 0x0f92, 0x0f92, 0x0f92, 0x0f9e, 0x0f9e, 0x0f9e, 0x0f9e, 0x0f9e, 0x0f9e, 0x0f9e, 0x0f9e,
+  0x000c, 0x0024, 0x003b, 0x0053, 0x006b, 0x0083, 0x009c, 0x00b4, 0x00cb, 0x00e3, 0x00fb, 0x0114, 0x012b, 0x0144, 0x015b, 0x0174,
+  0x018c, 0x01a3, 0x01bb, 0x01d3, 0x01ea, 0x0203, 0x021b, 0x0231, 0x024a, 0x0261, 0x027a, 0x0291, 0x02a8, 0x02c0, 0x02d8, 0x02f0,
+  0x0307, 0x031e, 0x0336, 0x034d, 0x0364, 0x037c, 0x0394, 0x03ab, 0x03c2, 0x03da, 0x03ef, 0x0408, 0x041f, 0x0436, 0x044e, 0x0463,
+  0x047b, 0x0491, 0x04a8, 0x04be, 0x04d6, 0x04ed, 0x0506, 0x051b, 0x0530, 0x0549, 0x0560, 0x0576, 0x0589, 0x05a0, 0x05b8, 0x05cc,
+  0x05e4, 0x05f9, 0x0612, 0x0627, 0x063c, 0x0652, 0x0668, 0x067f, 0x0695, 0x06a8, 0x06bf, 0x06d6, 0x06e9, 0x06fd, 0x0715, 0x0729,
+  0x073d, 0x0756, 0x076a, 0x077f, 0x0794, 0x07a9, 0x07bf, 0x07cf, 0x07e4, 0x07fa, 0x0810, 0x0822, 0x0838, 0x084a, 0x0860, 0x0872,
+  0x088a, 0x089c, 0x08ae, 0x08c6, 0x08d8, 0x08ea, 0x08fc, 0x0910, 0x0922, 0x0936, 0x0948, 0x095c, 0x0970, 0x0984, 0x0998, 0x09ac,
+  0x09b8, 0x09ce, 0x09e2, 0x09f0, 0x0a04, 0x0a18, 0x0a28, 0x0a3c, 0x0a4a, 0x0a60, 0x0a6e, 0x0a84, 0x0a92, 0x0aa2, 0x0ab8, 0x0ac6,
+  0x0ad6, 0x0ae4, 0x0afc, 0x0b0a, 0x0b1a, 0x0b2a, 0x0b38, 0x0b48, 0x0b58, 0x0b68, 0x0b78, 0x0b88, 0x0b98, 0x0ba8, 0x0bb8, 0x0bc8,
+  0x0bd8, 0x0bea, 0x0bf2, 0x0c02, 0x0c12, 0x0c24, 0x0c34, 0x0c3c, 0x0c4e, 0x0c60, 0x0c68, 0x0c78, 0x0c82, 0x0c92, 0x0ca4, 0x0cae,
+  0x0cbe, 0x0cc8, 0x0cda, 0x0ce2, 0x0cec, 0x0cfe, 0x0d06, 0x0d18, 0x0d22, 0x0d2a, 0x0d3c, 0x0d46, 0x0d50, 0x0d62, 0x0d6a, 0x0d74,
+  0x0d7e, 0x0d88, 0x0d9a, 0x0da4, 0x0dac, 0x0db6, 0x0dc0, 0x0dca, 0x0dd2, 0x0ddc, 0x0de6, 0x0df0, 0x0dfa, 0x0e04, 0x0e0c, 0x0e16,
+  0x0e20, 0x0e2a, 0x0e34, 0x0e3e, 0x0e48, 0x0e52, 0x0e5c, 0x0e5c, 0x0e66, 0x0e70, 0x0e7a, 0x0e7a, 0x0e84, 0x0e8e, 0x0e98, 0x0e98,
+  0x0ea2, 0x0eac, 0x0eac, 0x0eb6, 0x0ec0, 0x0ec0, 0x0eca, 0x0eca, 0x0ed4, 0x0ee0, 0x0ee0, 0x0eea, 0x0eea, 0x0ef4, 0x0ef4, 0x0efe,
+  0x0efe, 0x0efe, 0x0f08, 0x0f08, 0x0f14, 0x0f14, 0x0f14, 0x0f1e, 0x0f1e, 0x0f1e, 0x0f28, 0x0f28, 0x0f28, 0x0f32, 0x0f32, 0x0f32,
+  0x0f32, 0x0f3e, 0x0f3e, 0x0f3e, 0x0f3e, 0x0f3e, 0x0f3e, 0x0f3e, 0x0f48, 0x0f48, 0x0f48, 0x0f48, 0x0f48, 0x0f48, 0x0f48, 0x0f48,
+  0x000b, 0x0023, 0x003a, 0x0052, 0x0069, 0x0081, 0x0098, 0x00b0, 0x00c7, 0x00df, 0x00f6, 0x010e, 0x0125, 0x013d, 0x0154, 0x016c,
+  0x0183, 0x019a, 0x01b2, 0x01c9, 0x01df, 0x01f7, 0x020f, 0x0225, 0x023d, 0x0254, 0x026c, 0x0283, 0x029a, 0x02b1, 0x02c8, 0x02e0,
+  0x02f6, 0x030d, 0x0324, 0x033b, 0x0351, 0x0369, 0x0381, 0x0397, 0x03ad, 0x03c5, 0x03da, 0x03f2, 0x0408, 0x041f, 0x0436, 0x044b,
+  0x0463, 0x0478, 0x048e, 0x04a4, 0x04bb, 0x04d2, 0x04ea, 0x04ff, 0x0514, 0x052c, 0x0542, 0x0558, 0x056b, 0x0581, 0x0599, 0x05ac,
+  0x05c4, 0x05d8, 0x05f0, 0x0605, 0x061a, 0x0630, 0x0645, 0x065b, 0x0671, 0x0683, 0x069a, 0x06b1, 0x06c4, 0x06d6, 0x06ee, 0x0702,
+  0x0715, 0x072e, 0x0742, 0x0756, 0x076a, 0x077f, 0x0794, 0x07a4, 0x07b9, 0x07cf, 0x07e4, 0x07f5, 0x080c, 0x081c, 0x0832, 0x0844,
+  0x085a, 0x086c, 0x087e, 0x0896, 0x08a8, 0x08ba, 0x08cc, 0x08de, 0x08f0, 0x0904, 0x0916, 0x0928, 0x093c, 0x0950, 0x0962, 0x0976,
+  0x0984, 0x0998, 0x09ac, 0x09b8, 0x09ce, 0x09e2, 0x09f0, 0x0a04, 0x0a12, 0x0a28, 0x0a36, 0x0a4a, 0x0a58, 0x0a68, 0x0a7c, 0x0a8c,
+  0x0a9a, 0x0aa8, 0x0ac0, 0x0ace, 0x0ade, 0x0aec, 0x0afc, 0x0b0a, 0x0b1a, 0x0b2a, 0x0b38, 0x0b48, 0x0b58, 0x0b68, 0x0b78, 0x0b88,
+  0x0b98, 0x0ba8, 0x0bb0, 0x0bc0, 0x0bd0, 0x0be0, 0x0bf2, 0x0bfa, 0x0c0a, 0x0c1c, 0x0c24, 0x0c34, 0x0c3c, 0x0c4e, 0x0c60, 0x0c68,
+  0x0c78, 0x0c82, 0x0c92, 0x0c9c, 0x0ca4, 0x0cb6, 0x0cbe, 0x0cd0, 0x0cda, 0x0ce2, 0x0cf4, 0x0cfe, 0x0d06, 0x0d18, 0x0d22, 0x0d2a,
+  0x0d34, 0x0d3c, 0x0d50, 0x0d58, 0x0d62, 0x0d6a, 0x0d74, 0x0d7e, 0x0d88, 0x0d90, 0x0d9a, 0x0da4, 0x0dac, 0x0db6, 0x0dc0, 0x0dca,
+  0x0dd2, 0x0ddc, 0x0de6, 0x0df0, 0x0dfa, 0x0e04, 0x0e0c, 0x0e0c, 0x0e16, 0x0e20, 0x0e2a, 0x0e2a, 0x0e34, 0x0e3e, 0x0e48, 0x0e48,
+  0x0e52, 0x0e5c, 0x0e5c, 0x0e66, 0x0e70, 0x0e70, 0x0e7a, 0x0e7a, 0x0e84, 0x0e8e, 0x0e8e, 0x0e98, 0x0e98, 0x0ea2, 0x0ea2, 0x0eac,
+  0x0eac, 0x0eac, 0x0eb6, 0x0eb6, 0x0ec0, 0x0ec0, 0x0ec0, 0x0eca, 0x0eca, 0x0eca, 0x0ed4, 0x0ed4, 0x0ed4, 0x0ee0, 0x0ee0, 0x0ee0,
+  0x0ee0, 0x0eea, 0x0eea, 0x0eea, 0x0eea, 0x0eea, 0x0eea, 0x0eea, 0x0ef4, 0x0ef4, 0x0ef4, 0x0ef4, 0x0ef4, 0x0ef4, 0x0ef4, 0x0ef4,
+  0x000b, 0x0022, 0x0039, 0x0050, 0x0067, 0x007e, 0x0095, 0x00ac, 0x00c3, 0x00da, 0x00f1, 0x0108, 0x011e, 0x0136, 0x014d, 0x0164,
+  0x017b, 0x0191, 0x01a8, 0x01bf, 0x01d5, 0x01ed, 0x0204, 0x0219, 0x0231, 0x0247, 0x025f, 0x0275, 0x028b, 0x02a3, 0x02b9, 0x02d0,
+  0x02e6, 0x02fc, 0x0313, 0x0329, 0x033f, 0x0356, 0x036d, 0x0383, 0x0399, 0x03b0, 0x03c5, 0x03dc, 0x03f2, 0x0408, 0x041f, 0x0433,
+  0x044b, 0x0460, 0x0475, 0x048b, 0x04a1, 0x04b8, 0x04cf, 0x04e3, 0x04f8, 0x0510, 0x0525, 0x053b, 0x054d, 0x0563, 0x057a, 0x058d,
+  0x05a4, 0x05b8, 0x05d0, 0x05e4, 0x05f9, 0x060e, 0x0623, 0x0638, 0x064e, 0x065f, 0x0676, 0x068c, 0x069e, 0x06b1, 0x06c8, 0x06db,
+  0x06ee, 0x0706, 0x071a, 0x072e, 0x0742, 0x0756, 0x076a, 0x077a, 0x078f, 0x07a4, 0x07b9, 0x07c9, 0x07df, 0x07ef, 0x0806, 0x0816,
+  0x082c, 0x083e, 0x0850, 0x0866, 0x0878, 0x088a, 0x089c, 0x08ae, 0x08c0, 0x08d2, 0x08e4, 0x08f6, 0x090a, 0x091c, 0x0930, 0x0942,
+  0x0950, 0x0962, 0x0976, 0x0984, 0x0998, 0x09ac, 0x09b8, 0x09ce, 0x09da, 0x09f0, 0x09fe, 0x0a12, 0x0a20, 0x0a2e, 0x0a44, 0x0a52,
+  0x0a60, 0x0a6e, 0x0a84, 0x0a92, 0x0aa2, 0x0ab0, 0x0ac0, 0x0ace, 0x0ade, 0x0aec, 0x0afc, 0x0b0a, 0x0b1a, 0x0b2a, 0x0b38, 0x0b48,
+  0x0b58, 0x0b68, 0x0b70, 0x0b80, 0x0b90, 0x0ba0, 0x0bb0, 0x0bb8, 0x0bc8, 0x0bd8, 0x0be0, 0x0bf2, 0x0bfa, 0x0c0a, 0x0c1c, 0x0c24,
+  0x0c34, 0x0c3c, 0x0c4e, 0x0c56, 0x0c60, 0x0c70, 0x0c78, 0x0c8a, 0x0c92, 0x0c9c, 0x0cae, 0x0cb6, 0x0cbe, 0x0cd0, 0x0cda, 0x0ce2,
+  0x0cec, 0x0cf4, 0x0d06, 0x0d10, 0x0d18, 0x0d22, 0x0d2a, 0x0d34, 0x0d3c, 0x0d46, 0x0d50, 0x0d58, 0x0d62, 0x0d6a, 0x0d74, 0x0d7e,
+  0x0d88, 0x0d90, 0x0d9a, 0x0da4, 0x0dac, 0x0db6, 0x0dc0, 0x0dc0, 0x0dca, 0x0dd2, 0x0ddc, 0x0ddc, 0x0de6, 0x0df0, 0x0dfa, 0x0dfa,
+  0x0e04, 0x0e0c, 0x0e0c, 0x0e16, 0x0e20, 0x0e20, 0x0e2a, 0x0e2a, 0x0e34, 0x0e3e, 0x0e3e, 0x0e48, 0x0e48, 0x0e52, 0x0e52, 0x0e5c,
+  0x0e5c, 0x0e5c, 0x0e66, 0x0e66, 0x0e70, 0x0e70, 0x0e70, 0x0e7a, 0x0e7a, 0x0e7a, 0x0e84, 0x0e84, 0x0e84, 0x0e8e, 0x0e8e, 0x0e8e,
+  0x0e8e, 0x0e98, 0x0e98, 0x0e98, 0x0e98, 0x0e98, 0x0e98, 0x0e98, 0x0ea2, 0x0ea2, 0x0ea2, 0x0ea2, 0x0ea2, 0x0ea2, 0x0ea2, 0x0ea2,
+  0x000b, 0x0021, 0x0038, 0x004e, 0x0065, 0x007b, 0x0092, 0x00a8, 0x00bf, 0x00d5, 0x00ec, 0x0102, 0x0118, 0x012f, 0x0145, 0x015c,
+  0x0173, 0x0188, 0x019f, 0x01b5, 0x01cb, 0x01e2, 0x01f9, 0x020e, 0x0225, 0x023a, 0x0252, 0x0267, 0x027d, 0x0294, 0x02aa, 0x02c0,
+  0x02d6, 0x02ec, 0x0302, 0x0318, 0x032d, 0x0344, 0x035a, 0x0370, 0x0385, 0x039c, 0x03b0, 0x03c7, 0x03dc, 0x03f2, 0x0408, 0x041c,
+  0x0433, 0x0448, 0x045d, 0x0472, 0x0488, 0x049e, 0x04b5, 0x04c8, 0x04dc, 0x04f4, 0x0509, 0x051e, 0x0530, 0x0546, 0x055c, 0x056f,
+  0x0585, 0x0599, 0x05b0, 0x05c4, 0x05d8, 0x05ec, 0x0601, 0x0616, 0x062b, 0x063c, 0x0652, 0x0668, 0x067a, 0x068c, 0x06a3, 0x06b5,
+  0x06c8, 0x06e0, 0x06f3, 0x0706, 0x071a, 0x072e, 0x0742, 0x0751, 0x0765, 0x077a, 0x078f, 0x079f, 0x07b4, 0x07c4, 0x07da, 0x07ea,
+  0x0800, 0x0810, 0x0822, 0x0838, 0x084a, 0x085a, 0x086c, 0x087e, 0x0890, 0x08a2, 0x08b4, 0x08c6, 0x08d8, 0x08ea, 0x08fc, 0x0910,
+  0x091c, 0x0930, 0x0942, 0x0950, 0x0962, 0x0976, 0x0984, 0x0998, 0x09a4, 0x09b8, 0x09c6, 0x09da, 0x09e8, 0x09f6, 0x0a0c, 0x0a18,
+  0x0a28, 0x0a36, 0x0a4a, 0x0a58, 0x0a68, 0x0a76, 0x0a84, 0x0a92, 0x0aa2, 0x0ab0, 0x0ac0, 0x0ace, 0x0ade, 0x0aec, 0x0afc, 0x0b0a,
+  0x0b1a, 0x0b2a, 0x0b32, 0x0b40, 0x0b50, 0x0b60, 0x0b70, 0x0b78, 0x0b88, 0x0b98, 0x0ba0, 0x0bb0, 0x0bb8, 0x0bc8, 0x0bd8, 0x0be0,
+  0x0bf2, 0x0bfa, 0x0c0a, 0x0c12, 0x0c1c, 0x0c2c, 0x0c34, 0x0c46, 0x0c4e, 0x0c56, 0x0c68, 0x0c70, 0x0c78, 0x0c8a, 0x0c92, 0x0c9c,
+  0x0ca4, 0x0cae, 0x0cbe, 0x0cc8, 0x0cd0, 0x0cda, 0x0ce2, 0x0cec, 0x0cf4, 0x0cfe, 0x0d06, 0x0d10, 0x0d18, 0x0d22, 0x0d2a, 0x0d34,
+  0x0d3c, 0x0d46, 0x0d50, 0x0d58, 0x0d62, 0x0d6a, 0x0d74, 0x0d74, 0x0d7e, 0x0d88, 0x0d90, 0x0d90, 0x0d9a, 0x0da4, 0x0dac, 0x0dac,
+  0x0db6, 0x0dc0, 0x0dc0, 0x0dca, 0x0dd2, 0x0dd2, 0x0ddc, 0x0ddc, 0x0de6, 0x0df0, 0x0df0, 0x0dfa, 0x0dfa, 0x0e04, 0x0e04, 0x0e0c,
+  0x0e0c, 0x0e0c, 0x0e16, 0x0e16, 0x0e20, 0x0e20, 0x0e20, 0x0e2a, 0x0e2a, 0x0e2a, 0x0e34, 0x0e34, 0x0e34, 0x0e3e, 0x0e3e, 0x0e3e,
+  0x0e3e, 0x0e48, 0x0e48, 0x0e48, 0x0e48, 0x0e48, 0x0e48, 0x0e48, 0x0e52, 0x0e52, 0x0e52, 0x0e52, 0x0e52, 0x0e52, 0x0e52, 0x0e52,
+  0x000b, 0x0021, 0x0037, 0x004c, 0x0063, 0x0078, 0x008f, 0x00a5, 0x00bb, 0x00d1, 0x00e7, 0x00fd, 0x0112, 0x0129, 0x013e, 0x0155,
+  0x016b, 0x0180, 0x0196, 0x01ac, 0x01c1, 0x01d8, 0x01ee, 0x0203, 0x0219, 0x022e, 0x0245, 0x025a, 0x0270, 0x0286, 0x029b, 0x02b1,
+  0x02c6, 0x02dc, 0x02f2, 0x0307, 0x031c, 0x0332, 0x0348, 0x035d, 0x0372, 0x0388, 0x039c, 0x03b2, 0x03c7, 0x03dc, 0x03f2, 0x0406,
+  0x041c, 0x0430, 0x0445, 0x045a, 0x046f, 0x0485, 0x049b, 0x04ae, 0x04c2, 0x04d9, 0x04ed, 0x0502, 0x0514, 0x0529, 0x053e, 0x0551,
+  0x0567, 0x057a, 0x0591, 0x05a4, 0x05b8, 0x05cc, 0x05e0, 0x05f5, 0x0609, 0x061a, 0x0630, 0x0645, 0x0657, 0x0668, 0x067f, 0x0691,
+  0x06a3, 0x06ba, 0x06cd, 0x06e0, 0x06f3, 0x0706, 0x071a, 0x0729, 0x073d, 0x0751, 0x0765, 0x0775, 0x078a, 0x0799, 0x07ae, 0x07bf,
+  0x07d4, 0x07e4, 0x07f5, 0x080c, 0x081c, 0x082c, 0x083e, 0x0850, 0x0860, 0x0872, 0x0884, 0x0896, 0x08a8, 0x08ba, 0x08cc, 0x08de,
+  0x08ea, 0x08fc, 0x0910, 0x091c, 0x0930, 0x0942, 0x0950, 0x0962, 0x0970, 0x0984, 0x0990, 0x09a4, 0x09b2, 0x09c0, 0x09d4, 0x09e2,
+  0x09f0, 0x09fe, 0x0a12, 0x0a20, 0x0a2e, 0x0a3c, 0x0a4a, 0x0a58, 0x0a68, 0x0a76, 0x0a84, 0x0a92, 0x0aa2, 0x0ab0, 0x0ac0, 0x0ace,
+  0x0ade, 0x0aec, 0x0af4, 0x0b02, 0x0b12, 0x0b22, 0x0b32, 0x0b38, 0x0b48, 0x0b58, 0x0b60, 0x0b70, 0x0b78, 0x0b88, 0x0b98, 0x0ba0,
+  0x0bb0, 0x0bb8, 0x0bc8, 0x0bd0, 0x0bd8, 0x0bea, 0x0bf2, 0x0c02, 0x0c0a, 0x0c12, 0x0c24, 0x0c2c, 0x0c34, 0x0c46, 0x0c4e, 0x0c56,
+  0x0c60, 0x0c68, 0x0c78, 0x0c82, 0x0c8a, 0x0c92, 0x0c9c, 0x0ca4, 0x0cae, 0x0cb6, 0x0cbe, 0x0cc8, 0x0cd0, 0x0cda, 0x0ce2, 0x0cec,
+  0x0cf4, 0x0cfe, 0x0d06, 0x0d10, 0x0d18, 0x0d22, 0x0d2a, 0x0d2a, 0x0d34, 0x0d3c, 0x0d46, 0x0d46, 0x0d50, 0x0d58, 0x0d62, 0x0d62,
+  0x0d6a, 0x0d74, 0x0d74, 0x0d7e, 0x0d88, 0x0d88, 0x0d90, 0x0d90, 0x0d9a, 0x0da4, 0x0da4, 0x0dac, 0x0dac, 0x0db6, 0x0db6, 0x0dc0,
+  0x0dc0, 0x0dc0, 0x0dca, 0x0dca, 0x0dd2, 0x0dd2, 0x0dd2, 0x0ddc, 0x0ddc, 0x0ddc, 0x0de6, 0x0de6, 0x0de6, 0x0df0, 0x0df0, 0x0df0,
+  0x0df0, 0x0dfa, 0x0dfa, 0x0dfa, 0x0dfa, 0x0dfa, 0x0dfa, 0x0dfa, 0x0e04, 0x0e04, 0x0e04, 0x0e04, 0x0e04, 0x0e04, 0x0e04, 0x0e04,
+  0x000a, 0x0020, 0x0035, 0x004b, 0x0060, 0x0076, 0x008c, 0x00a1, 0x00b7, 0x00cc, 0x00e2, 0x00f7, 0x010c, 0x0122, 0x0138, 0x014d,
+  0x0163, 0x0178, 0x018e, 0x01a3, 0x01b8, 0x01ce, 0x01e3, 0x01f7, 0x020e, 0x0222, 0x0239, 0x024d, 0x0262, 0x0278, 0x028d, 0x02a3,
+  0x02b7, 0x02cc, 0x02e2, 0x02f6, 0x030b, 0x0320, 0x0336, 0x034a, 0x035f, 0x0374, 0x0388, 0x039e, 0x03b2, 0x03c7, 0x03dc, 0x03ef,
+  0x0406, 0x0419, 0x042d, 0x0442, 0x0457, 0x046c, 0x0482, 0x0494, 0x04a8, 0x04be, 0x04d2, 0x04e7, 0x04f8, 0x050c, 0x0522, 0x0534,
+  0x0549, 0x055c, 0x0572, 0x0585, 0x0599, 0x05ac, 0x05c0, 0x05d4, 0x05e8, 0x05f9, 0x060e, 0x0623, 0x0634, 0x0645, 0x065b, 0x066d,
+  0x067f, 0x0695, 0x06a8, 0x06ba, 0x06cd, 0x06e0, 0x06f3, 0x0702, 0x0715, 0x0729, 0x073d, 0x074c, 0x0760, 0x0770, 0x0784, 0x0794,
+  0x07a9, 0x07b9, 0x07c9, 0x07df, 0x07ef, 0x0800, 0x0810, 0x0822, 0x0832, 0x0844, 0x0854, 0x0866, 0x0878, 0x088a, 0x089c, 0x08ae,
+  0x08ba, 0x08cc, 0x08de, 0x08ea, 0x08fc, 0x0910, 0x091c, 0x0930, 0x093c, 0x0950, 0x095c, 0x0970, 0x097c, 0x098a, 0x099e, 0x09ac,
+  0x09b8, 0x09c6, 0x09da, 0x09e8, 0x09f6, 0x0a04, 0x0a12, 0x0a20, 0x0a2e, 0x0a3c, 0x0a4a, 0x0a58, 0x0a68, 0x0a76, 0x0a84, 0x0a92,
+  0x0aa2, 0x0ab0, 0x0ab8, 0x0ac6, 0x0ad6, 0x0ae4, 0x0af4, 0x0afc, 0x0b0a, 0x0b1a, 0x0b22, 0x0b32, 0x0b38, 0x0b48, 0x0b58, 0x0b60,
+  0x0b70, 0x0b78, 0x0b88, 0x0b90, 0x0b98, 0x0ba8, 0x0bb0, 0x0bc0, 0x0bc8, 0x0bd0, 0x0be0, 0x0bea, 0x0bf2, 0x0c02, 0x0c0a, 0x0c12,
+  0x0c1c, 0x0c24, 0x0c34, 0x0c3c, 0x0c46, 0x0c4e, 0x0c56, 0x0c60, 0x0c68, 0x0c70, 0x0c78, 0x0c82, 0x0c8a, 0x0c92, 0x0c9c, 0x0ca4,
+  0x0cae, 0x0cb6, 0x0cbe, 0x0cc8, 0x0cd0, 0x0cda, 0x0ce2, 0x0ce2, 0x0cec, 0x0cf4, 0x0cfe, 0x0cfe, 0x0d06, 0x0d10, 0x0d18, 0x0d18,
+  0x0d22, 0x0d2a, 0x0d2a, 0x0d34, 0x0d3c, 0x0d3c, 0x0d46, 0x0d46, 0x0d50, 0x0d58, 0x0d58, 0x0d62, 0x0d62, 0x0d6a, 0x0d6a, 0x0d74,
+  0x0d74, 0x0d74, 0x0d7e, 0x0d7e, 0x0d88, 0x0d88, 0x0d88, 0x0d90, 0x0d90, 0x0d90, 0x0d9a, 0x0d9a, 0x0d9a, 0x0da4, 0x0da4, 0x0da4,
+  0x0da4, 0x0dac, 0x0dac, 0x0dac, 0x0dac, 0x0dac, 0x0dac, 0x0dac, 0x0db6, 0x0db6, 0x0db6, 0x0db6, 0x0db6, 0x0db6, 0x0db6, 0x0db6,
+  0x000a, 0x001f, 0x0034, 0x0049, 0x005e, 0x0073, 0x0089, 0x009e, 0x00b3, 0x00c8, 0x00dd, 0x00f2, 0x0107, 0x011c, 0x0131, 0x0146,
+  0x015b, 0x0170, 0x0185, 0x019a, 0x01ae, 0x01c4, 0x01d9, 0x01ed, 0x0203, 0x0216, 0x022d, 0x0241, 0x0255, 0x026b, 0x027f, 0x0294,
+  0x02a8, 0x02bd, 0x02d2, 0x02e6, 0x02fa, 0x030f, 0x0324, 0x0338, 0x034d, 0x0362, 0x0374, 0x038a, 0x039e, 0x03b2, 0x03c7, 0x03da,
+  0x03ef, 0x0403, 0x0416, 0x042a, 0x043f, 0x0454, 0x0469, 0x047b, 0x048e, 0x04a4, 0x04b8, 0x04cc, 0x04dc, 0x04f1, 0x0506, 0x0517,
+  0x052c, 0x053e, 0x0554, 0x0567, 0x057a, 0x058d, 0x05a0, 0x05b4, 0x05c8, 0x05d8, 0x05ec, 0x0601, 0x0612, 0x0623, 0x0638, 0x0649,
+  0x065b, 0x0671, 0x0683, 0x0695, 0x06a8, 0x06ba, 0x06cd, 0x06db, 0x06ee, 0x0702, 0x0715, 0x0724, 0x0738, 0x0747, 0x075b, 0x076a,
+  0x077f, 0x078f, 0x079f, 0x07b4, 0x07c4, 0x07d4, 0x07e4, 0x07f5, 0x0806, 0x0816, 0x0828, 0x0838, 0x084a, 0x085a, 0x086c, 0x087e,
+  0x088a, 0x089c, 0x08ae, 0x08ba, 0x08cc, 0x08de, 0x08ea, 0x08fc, 0x090a, 0x091c, 0x0928, 0x093c, 0x0948, 0x0956, 0x096a, 0x0976,
+  0x0984, 0x0990, 0x09a4, 0x09b2, 0x09c0, 0x09ce, 0x09da, 0x09e8, 0x09f6, 0x0a04, 0x0a12, 0x0a20, 0x0a2e, 0x0a3c, 0x0a4a, 0x0a58,
+  0x0a68, 0x0a76, 0x0a7c, 0x0a8c, 0x0a9a, 0x0aa8, 0x0ab8, 0x0ac0, 0x0ace, 0x0ade, 0x0ae4, 0x0af4, 0x0afc, 0x0b0a, 0x0b1a, 0x0b22,
+  0x0b32, 0x0b38, 0x0b48, 0x0b50, 0x0b58, 0x0b68, 0x0b70, 0x0b80, 0x0b88, 0x0b90, 0x0ba0, 0x0ba8, 0x0bb0, 0x0bc0, 0x0bc8, 0x0bd0,
+  0x0bd8, 0x0be0, 0x0bf2, 0x0bfa, 0x0c02, 0x0c0a, 0x0c12, 0x0c1c, 0x0c24, 0x0c2c, 0x0c34, 0x0c3c, 0x0c46, 0x0c4e, 0x0c56, 0x0c60,
+  0x0c68, 0x0c70, 0x0c78, 0x0c82, 0x0c8a, 0x0c92, 0x0c9c, 0x0c9c, 0x0ca4, 0x0cae, 0x0cb6, 0x0cb6, 0x0cbe, 0x0cc8, 0x0cd0, 0x0cd0,
+  0x0cda, 0x0ce2, 0x0ce2, 0x0cec, 0x0cf4, 0x0cf4, 0x0cfe, 0x0cfe, 0x0d06, 0x0d10, 0x0d10, 0x0d18, 0x0d18, 0x0d22, 0x0d22, 0x0d2a,
+  0x0d2a, 0x0d2a, 0x0d34, 0x0d34, 0x0d3c, 0x0d3c, 0x0d3c, 0x0d46, 0x0d46, 0x0d46, 0x0d50, 0x0d50, 0x0d50, 0x0d58, 0x0d58, 0x0d58,
+  0x0d58, 0x0d62, 0x0d62, 0x0d62, 0x0d62, 0x0d62, 0x0d62, 0x0d62, 0x0d6a, 0x0d6a, 0x0d6a, 0x0d6a, 0x0d6a, 0x0d6a, 0x0d6a, 0x0d6a,
+  0x000a, 0x001e, 0x0033, 0x0048, 0x005c, 0x0071, 0x0086, 0x009a, 0x00af, 0x00c3, 0x00d8, 0x00ed, 0x0101, 0x0116, 0x012a, 0x013f,
+  0x0154, 0x0168, 0x017d, 0x0191, 0x01a5, 0x01ba, 0x01cf, 0x01e2, 0x01f7, 0x020b, 0x0221, 0x0234, 0x0248, 0x025d, 0x0271, 0x0286,
+  0x029a, 0x02ae, 0x02c2, 0x02d6, 0x02ea, 0x02fe, 0x0313, 0x0327, 0x033b, 0x034f, 0x0362, 0x0377, 0x038a, 0x039e, 0x03b2, 0x03c5,
+  0x03da, 0x03ed, 0x0400, 0x0414, 0x0428, 0x043c, 0x0451, 0x0463, 0x0475, 0x048b, 0x049e, 0x04b1, 0x04c2, 0x04d6, 0x04ea, 0x04fb,
+  0x0510, 0x0522, 0x0537, 0x0549, 0x055c, 0x056f, 0x0581, 0x0595, 0x05a8, 0x05b8, 0x05cc, 0x05e0, 0x05f0, 0x0601, 0x0616, 0x0627,
+  0x0638, 0x064e, 0x065f, 0x0671, 0x0683, 0x0695, 0x06a8, 0x06b5, 0x06c8, 0x06db, 0x06ee, 0x06fd, 0x0710, 0x071f, 0x0733, 0x0742,
+  0x0756, 0x0765, 0x0775, 0x078a, 0x0799, 0x07a9, 0x07b9, 0x07c9, 0x07da, 0x07ea, 0x07fa, 0x080c, 0x081c, 0x082c, 0x083e, 0x0850,
+  0x085a, 0x086c, 0x087e, 0x088a, 0x089c, 0x08ae, 0x08ba, 0x08cc, 0x08d8, 0x08ea, 0x08f6, 0x090a, 0x0916, 0x0922, 0x0936, 0x0942,
+  0x0950, 0x095c, 0x0970, 0x097c, 0x098a, 0x0998, 0x09a4, 0x09b2, 0x09c0, 0x09ce, 0x09da, 0x09e8, 0x09f6, 0x0a04, 0x0a12, 0x0a20,
+  0x0a2e, 0x0a3c, 0x0a44, 0x0a52, 0x0a60, 0x0a6e, 0x0a7c, 0x0a84, 0x0a92, 0x0aa2, 0x0aa8, 0x0ab8, 0x0ac0, 0x0ace, 0x0ade, 0x0ae4,
+  0x0af4, 0x0afc, 0x0b0a, 0x0b12, 0x0b1a, 0x0b2a, 0x0b32, 0x0b40, 0x0b48, 0x0b50, 0x0b60, 0x0b68, 0x0b70, 0x0b80, 0x0b88, 0x0b90,
+  0x0b98, 0x0ba0, 0x0bb0, 0x0bb8, 0x0bc0, 0x0bc8, 0x0bd0, 0x0bd8, 0x0be0, 0x0bea, 0x0bf2, 0x0bfa, 0x0c02, 0x0c0a, 0x0c12, 0x0c1c,
+  0x0c24, 0x0c2c, 0x0c34, 0x0c3c, 0x0c46, 0x0c4e, 0x0c56, 0x0c56, 0x0c60, 0x0c68, 0x0c70, 0x0c70, 0x0c78, 0x0c82, 0x0c8a, 0x0c8a,
+  0x0c92, 0x0c9c, 0x0c9c, 0x0ca4, 0x0cae, 0x0cae, 0x0cb6, 0x0cb6, 0x0cbe, 0x0cc8, 0x0cc8, 0x0cd0, 0x0cd0, 0x0cda, 0x0cda, 0x0ce2,
+  0x0ce2, 0x0ce2, 0x0cec, 0x0cec, 0x0cf4, 0x0cf4, 0x0cf4, 0x0cfe, 0x0cfe, 0x0cfe, 0x0d06, 0x0d06, 0x0d06, 0x0d10, 0x0d10, 0x0d10,
+  0x0d10, 0x0d18, 0x0d18, 0x0d18, 0x0d18, 0x0d18, 0x0d18, 0x0d18, 0x0d22, 0x0d22, 0x0d22, 0x0d22, 0x0d22, 0x0d22, 0x0d22, 0x0d22,
+  0x000a, 0x001e, 0x0032, 0x0046, 0x005a, 0x006e, 0x0083, 0x0097, 0x00ab, 0x00bf, 0x00d3, 0x00e8, 0x00fb, 0x0110, 0x0124, 0x0138,
+  0x014d, 0x0160, 0x0175, 0x0188, 0x019c, 0x01b1, 0x01c5, 0x01d8, 0x01ed, 0x0200, 0x0215, 0x0228, 0x023c, 0x0250, 0x0264, 0x0278,
+  0x028b, 0x029f, 0x02b3, 0x02c6, 0x02da, 0x02ee, 0x0302, 0x0315, 0x0329, 0x033d, 0x034f, 0x0364, 0x0377, 0x038a, 0x039e, 0x03b0,
+  0x03c5, 0x03d7, 0x03ea, 0x03fd, 0x0411, 0x0425, 0x0439, 0x044b, 0x045d, 0x0472, 0x0485, 0x0498, 0x04a8, 0x04bb, 0x04cf, 0x04e0,
+  0x04f4, 0x0506, 0x051b, 0x052c, 0x053e, 0x0551, 0x0563, 0x0576, 0x0589, 0x0599, 0x05ac, 0x05c0, 0x05d0, 0x05e0, 0x05f5, 0x0605,
+  0x0616, 0x062b, 0x063c, 0x064e, 0x065f, 0x0671, 0x0683, 0x0691, 0x06a3, 0x06b5, 0x06c8, 0x06d6, 0x06e9, 0x06f8, 0x070b, 0x071a,
+  0x072e, 0x073d, 0x074c, 0x0760, 0x0770, 0x077f, 0x078f, 0x079f, 0x07ae, 0x07bf, 0x07cf, 0x07df, 0x07ef, 0x0800, 0x0810, 0x0822,
+  0x082c, 0x083e, 0x0850, 0x085a, 0x086c, 0x087e, 0x088a, 0x089c, 0x08a8, 0x08ba, 0x08c6, 0x08d8, 0x08e4, 0x08f0, 0x0904, 0x0910,
+  0x091c, 0x0928, 0x093c, 0x0948, 0x0956, 0x0962, 0x0970, 0x097c, 0x098a, 0x0998, 0x09a4, 0x09b2, 0x09c0, 0x09ce, 0x09da, 0x09e8,
+  0x09f6, 0x0a04, 0x0a0c, 0x0a18, 0x0a28, 0x0a36, 0x0a44, 0x0a4a, 0x0a58, 0x0a68, 0x0a6e, 0x0a7c, 0x0a84, 0x0a92, 0x0aa2, 0x0aa8,
+  0x0ab8, 0x0ac0, 0x0ace, 0x0ad6, 0x0ade, 0x0aec, 0x0af4, 0x0b02, 0x0b0a, 0x0b12, 0x0b22, 0x0b2a, 0x0b32, 0x0b40, 0x0b48, 0x0b50,
+  0x0b58, 0x0b60, 0x0b70, 0x0b78, 0x0b80, 0x0b88, 0x0b90, 0x0b98, 0x0ba0, 0x0ba8, 0x0bb0, 0x0bb8, 0x0bc0, 0x0bc8, 0x0bd0, 0x0bd8,
+  0x0be0, 0x0bea, 0x0bf2, 0x0bfa, 0x0c02, 0x0c0a, 0x0c12, 0x0c12, 0x0c1c, 0x0c24, 0x0c2c, 0x0c2c, 0x0c34, 0x0c3c, 0x0c46, 0x0c46,
+  0x0c4e, 0x0c56, 0x0c56, 0x0c60, 0x0c68, 0x0c68, 0x0c70, 0x0c70, 0x0c78, 0x0c82, 0x0c82, 0x0c8a, 0x0c8a, 0x0c92, 0x0c92, 0x0c9c,
+  0x0c9c, 0x0c9c, 0x0ca4, 0x0ca4, 0x0cae, 0x0cae, 0x0cae, 0x0cb6, 0x0cb6, 0x0cb6, 0x0cbe, 0x0cbe, 0x0cbe, 0x0cc8, 0x0cc8, 0x0cc8,
+  0x0cc8, 0x0cd0, 0x0cd0, 0x0cd0, 0x0cd0, 0x0cd0, 0x0cd0, 0x0cd0, 0x0cda, 0x0cda, 0x0cda, 0x0cda, 0x0cda, 0x0cda, 0x0cda, 0x0cda,
+  0x0009, 0x001d, 0x0031, 0x0045, 0x0058, 0x006c, 0x0080, 0x0094, 0x00a7, 0x00bb, 0x00cf, 0x00e3, 0x00f6, 0x010a, 0x011e, 0x0132,
+  0x0145, 0x0158, 0x016d, 0x0180, 0x0193, 0x01a7, 0x01bb, 0x01ce, 0x01e2, 0x01f5, 0x020a, 0x021c, 0x0230, 0x0244, 0x0257, 0x026b,
+  0x027d, 0x0291, 0x02a4, 0x02b7, 0x02ca, 0x02de, 0x02f2, 0x0304, 0x0318, 0x032b, 0x033d, 0x0351, 0x0364, 0x0377, 0x038a, 0x039c,
+  0x03b0, 0x03c2, 0x03d4, 0x03e7, 0x03fa, 0x040e, 0x0422, 0x0433, 0x0445, 0x045a, 0x046c, 0x047e, 0x048e, 0x04a1, 0x04b5, 0x04c5,
+  0x04d9, 0x04ea, 0x04ff, 0x0510, 0x0522, 0x0534, 0x0546, 0x0558, 0x056b, 0x057a, 0x058d, 0x05a0, 0x05b0, 0x05c0, 0x05d4, 0x05e4,
+  0x05f5, 0x0609, 0x061a, 0x062b, 0x063c, 0x064e, 0x065f, 0x066d, 0x067f, 0x0691, 0x06a3, 0x06b1, 0x06c4, 0x06d2, 0x06e5, 0x06f3,
+  0x0706, 0x0715, 0x0724, 0x0738, 0x0747, 0x0756, 0x0765, 0x0775, 0x0784, 0x0794, 0x07a4, 0x07b4, 0x07c4, 0x07d4, 0x07e4, 0x07f5,
+  0x0800, 0x0810, 0x0822, 0x082c, 0x083e, 0x0850, 0x085a, 0x086c, 0x0878, 0x088a, 0x0896, 0x08a8, 0x08b4, 0x08c0, 0x08d2, 0x08de,
+  0x08ea, 0x08f6, 0x090a, 0x0916, 0x0922, 0x0930, 0x093c, 0x0948, 0x0956, 0x0962, 0x0970, 0x097c, 0x098a, 0x0998, 0x09a4, 0x09b2,
+  0x09c0, 0x09ce, 0x09d4, 0x09e2, 0x09f0, 0x09fe, 0x0a0c, 0x0a12, 0x0a20, 0x0a2e, 0x0a36, 0x0a44, 0x0a4a, 0x0a58, 0x0a68, 0x0a6e,
+  0x0a7c, 0x0a84, 0x0a92, 0x0a9a, 0x0aa2, 0x0ab0, 0x0ab8, 0x0ac6, 0x0ace, 0x0ad6, 0x0ae4, 0x0aec, 0x0af4, 0x0b02, 0x0b0a, 0x0b12,
+  0x0b1a, 0x0b22, 0x0b32, 0x0b38, 0x0b40, 0x0b48, 0x0b50, 0x0b58, 0x0b60, 0x0b68, 0x0b70, 0x0b78, 0x0b80, 0x0b88, 0x0b90, 0x0b98,
+  0x0ba0, 0x0ba8, 0x0bb0, 0x0bb8, 0x0bc0, 0x0bc8, 0x0bd0, 0x0bd0, 0x0bd8, 0x0be0, 0x0bea, 0x0bea, 0x0bf2, 0x0bfa, 0x0c02, 0x0c02,
+  0x0c0a, 0x0c12, 0x0c12, 0x0c1c, 0x0c24, 0x0c24, 0x0c2c, 0x0c2c, 0x0c34, 0x0c3c, 0x0c3c, 0x0c46, 0x0c46, 0x0c4e, 0x0c4e, 0x0c56,
+  0x0c56, 0x0c56, 0x0c60, 0x0c60, 0x0c68, 0x0c68, 0x0c68, 0x0c70, 0x0c70, 0x0c70, 0x0c78, 0x0c78, 0x0c78, 0x0c82, 0x0c82, 0x0c82,
+  0x0c82, 0x0c8a, 0x0c8a, 0x0c8a, 0x0c8a, 0x0c8a, 0x0c8a, 0x0c8a, 0x0c92, 0x0c92, 0x0c92, 0x0c92, 0x0c92, 0x0c92, 0x0c92, 0x0c92,
+  0x0009, 0x001d, 0x0030, 0x0043, 0x0056, 0x006a, 0x007d, 0x0091, 0x00a4, 0x00b7, 0x00ca, 0x00de, 0x00f1, 0x0105, 0x0118, 0x012b,
+  0x013e, 0x0151, 0x0165, 0x0178, 0x018a, 0x019e, 0x01b2, 0x01c4, 0x01d8, 0x01ea, 0x01fe, 0x0211, 0x0224, 0x0237, 0x024a, 0x025d,
+  0x0270, 0x0283, 0x0296, 0x02a8, 0x02bb, 0x02ce, 0x02e2, 0x02f4, 0x0307, 0x031a, 0x032b, 0x033f, 0x0351, 0x0364, 0x0377, 0x0388,
+  0x039c, 0x03ad, 0x03bf, 0x03d2, 0x03e4, 0x03f7, 0x040b, 0x041c, 0x042d, 0x0442, 0x0454, 0x0466, 0x0475, 0x0488, 0x049b, 0x04ab,
+  0x04be, 0x04cf, 0x04e3, 0x04f4, 0x0506, 0x0517, 0x0529, 0x053b, 0x054d, 0x055c, 0x056f, 0x0581, 0x0591, 0x05a0, 0x05b4, 0x05c4,
+  0x05d4, 0x05e8, 0x05f9, 0x0609, 0x061a, 0x062b, 0x063c, 0x0649, 0x065b, 0x066d, 0x067f, 0x068c, 0x069e, 0x06ac, 0x06bf, 0x06cd,
+  0x06e0, 0x06ee, 0x06fd, 0x0710, 0x071f, 0x072e, 0x073d, 0x074c, 0x075b, 0x076a, 0x077a, 0x078a, 0x0799, 0x07a9, 0x07b9, 0x07c9,
+  0x07d4, 0x07e4, 0x07f5, 0x0800, 0x0810, 0x0822, 0x082c, 0x083e, 0x084a, 0x085a, 0x0866, 0x0878, 0x0884, 0x0890, 0x08a2, 0x08ae,
+  0x08ba, 0x08c6, 0x08d8, 0x08e4, 0x08f0, 0x08fc, 0x090a, 0x0916, 0x0922, 0x0930, 0x093c, 0x0948, 0x0956, 0x0962, 0x0970, 0x097c,
+  0x098a, 0x0998, 0x099e, 0x09ac, 0x09b8, 0x09c6, 0x09d4, 0x09da, 0x09e8, 0x09f6, 0x09fe, 0x0a0c, 0x0a12, 0x0a20, 0x0a2e, 0x0a36,
+  0x0a44, 0x0a4a, 0x0a58, 0x0a60, 0x0a68, 0x0a76, 0x0a7c, 0x0a8c, 0x0a92, 0x0a9a, 0x0aa8, 0x0ab0, 0x0ab8, 0x0ac6, 0x0ace, 0x0ad6,
+  0x0ade, 0x0ae4, 0x0af4, 0x0afc, 0x0b02, 0x0b0a, 0x0b12, 0x0b1a, 0x0b22, 0x0b2a, 0x0b32, 0x0b38, 0x0b40, 0x0b48, 0x0b50, 0x0b58,
+  0x0b60, 0x0b68, 0x0b70, 0x0b78, 0x0b80, 0x0b88, 0x0b90, 0x0b90, 0x0b98, 0x0ba0, 0x0ba8, 0x0ba8, 0x0bb0, 0x0bb8, 0x0bc0, 0x0bc0,
+  0x0bc8, 0x0bd0, 0x0bd0, 0x0bd8, 0x0be0, 0x0be0, 0x0bea, 0x0bea, 0x0bf2, 0x0bfa, 0x0bfa, 0x0c02, 0x0c02, 0x0c0a, 0x0c0a, 0x0c12,
+  0x0c12, 0x0c12, 0x0c1c, 0x0c1c, 0x0c24, 0x0c24, 0x0c24, 0x0c2c, 0x0c2c, 0x0c2c, 0x0c34, 0x0c34, 0x0c34, 0x0c3c, 0x0c3c, 0x0c3c,
+  0x0c3c, 0x0c46, 0x0c46, 0x0c46, 0x0c46, 0x0c46, 0x0c46, 0x0c46, 0x0c4e, 0x0c4e, 0x0c4e, 0x0c4e, 0x0c4e, 0x0c4e, 0x0c4e, 0x0c4e,
+  0x0009, 0x001c, 0x002f, 0x0042, 0x0055, 0x0067, 0x007a, 0x008d, 0x00a0, 0x00b3, 0x00c6, 0x00d9, 0x00ec, 0x00ff, 0x0112, 0x0125,
+  0x0138, 0x014a, 0x015d, 0x0170, 0x0182, 0x0195, 0x01a8, 0x01ba, 0x01ce, 0x01df, 0x01f3, 0x0205, 0x0218, 0x022b, 0x023d, 0x0250,
+  0x0262, 0x0275, 0x0288, 0x029a, 0x02ac, 0x02bf, 0x02d2, 0x02e4, 0x02f6, 0x0309, 0x031a, 0x032d, 0x033f, 0x0351, 0x0364, 0x0374,
+  0x0388, 0x0399, 0x03ab, 0x03bd, 0x03cf, 0x03e2, 0x03f5, 0x0406, 0x0416, 0x042a, 0x043c, 0x044e, 0x045d, 0x046f, 0x0482, 0x0491,
+  0x04a4, 0x04b5, 0x04c8, 0x04d9, 0x04ea, 0x04fb, 0x050c, 0x051e, 0x0530, 0x053e, 0x0551, 0x0563, 0x0572, 0x0581, 0x0595, 0x05a4,
+  0x05b4, 0x05c8, 0x05d8, 0x05e8, 0x05f9, 0x0609, 0x061a, 0x0627, 0x0638, 0x0649, 0x065b, 0x0668, 0x067a, 0x0688, 0x069a, 0x06a8,
+  0x06ba, 0x06c8, 0x06d6, 0x06e9, 0x06f8, 0x0706, 0x0715, 0x0724, 0x0733, 0x0742, 0x0751, 0x0760, 0x0770, 0x077f, 0x078f, 0x079f,
+  0x07a9, 0x07b9, 0x07c9, 0x07d4, 0x07e4, 0x07f5, 0x0800, 0x0810, 0x081c, 0x082c, 0x0838, 0x084a, 0x0854, 0x0860, 0x0872, 0x087e,
+  0x088a, 0x0896, 0x08a8, 0x08b4, 0x08c0, 0x08cc, 0x08d8, 0x08e4, 0x08f0, 0x08fc, 0x090a, 0x0916, 0x0922, 0x0930, 0x093c, 0x0948,
+  0x0956, 0x0962, 0x096a, 0x0976, 0x0984, 0x0990, 0x099e, 0x09a4, 0x09b2, 0x09c0, 0x09c6, 0x09d4, 0x09da, 0x09e8, 0x09f6, 0x09fe,
+  0x0a0c, 0x0a12, 0x0a20, 0x0a28, 0x0a2e, 0x0a3c, 0x0a44, 0x0a52, 0x0a58, 0x0a60, 0x0a6e, 0x0a76, 0x0a7c, 0x0a8c, 0x0a92, 0x0a9a,
+  0x0aa2, 0x0aa8, 0x0ab8, 0x0ac0, 0x0ac6, 0x0ace, 0x0ad6, 0x0ade, 0x0ae4, 0x0aec, 0x0af4, 0x0afc, 0x0b02, 0x0b0a, 0x0b12, 0x0b1a,
+  0x0b22, 0x0b2a, 0x0b32, 0x0b38, 0x0b40, 0x0b48, 0x0b50, 0x0b50, 0x0b58, 0x0b60, 0x0b68, 0x0b68, 0x0b70, 0x0b78, 0x0b80, 0x0b80,
+  0x0b88, 0x0b90, 0x0b90, 0x0b98, 0x0ba0, 0x0ba0, 0x0ba8, 0x0ba8, 0x0bb0, 0x0bb8, 0x0bb8, 0x0bc0, 0x0bc0, 0x0bc8, 0x0bc8, 0x0bd0,
+  0x0bd0, 0x0bd0, 0x0bd8, 0x0bd8, 0x0be0, 0x0be0, 0x0be0, 0x0bea, 0x0bea, 0x0bea, 0x0bf2, 0x0bf2, 0x0bf2, 0x0bfa, 0x0bfa, 0x0bfa,
+  0x0bfa, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c02, 0x0c0a, 0x0c0a, 0x0c0a, 0x0c0a, 0x0c0a, 0x0c0a, 0x0c0a, 0x0c0a,
+  0x0009, 0x001b, 0x002e, 0x0040, 0x0053, 0x0065, 0x0078, 0x008a, 0x009d, 0x00af, 0x00c2, 0x00d5, 0x00e7, 0x00f9, 0x010c, 0x011e,
+  0x0131, 0x0143, 0x0156, 0x0168, 0x017a, 0x018d, 0x019f, 0x01b1, 0x01c4, 0x01d5, 0x01e9, 0x01fa, 0x020c, 0x021f, 0x0231, 0x0244,
+  0x0255, 0x0267, 0x027a, 0x028b, 0x029d, 0x02b0, 0x02c2, 0x02d4, 0x02e6, 0x02f8, 0x0309, 0x031c, 0x032d, 0x033f, 0x0351, 0x0362,
+  0x0374, 0x0385, 0x0397, 0x03a8, 0x03ba, 0x03cc, 0x03df, 0x03ef, 0x0400, 0x0414, 0x0425, 0x0436, 0x0445, 0x0457, 0x0469, 0x0478,
+  0x048b, 0x049b, 0x04ae, 0x04be, 0x04cf, 0x04e0, 0x04f1, 0x0502, 0x0514, 0x0522, 0x0534, 0x0546, 0x0554, 0x0563, 0x0576, 0x0585,
+  0x0595, 0x05a8, 0x05b8, 0x05c8, 0x05d8, 0x05e8, 0x05f9, 0x0605, 0x0616, 0x0627, 0x0638, 0x0645, 0x0657, 0x0664, 0x0676, 0x0683,
+  0x0695, 0x06a3, 0x06b1, 0x06c4, 0x06d2, 0x06e0, 0x06ee, 0x06fd, 0x070b, 0x071a, 0x0729, 0x0738, 0x0747, 0x0756, 0x0765, 0x0775,
+  0x077f, 0x078f, 0x079f, 0x07a9, 0x07b9, 0x07c9, 0x07d4, 0x07e4, 0x07ef, 0x0800, 0x080c, 0x081c, 0x0828, 0x0832, 0x0844, 0x0850,
+  0x085a, 0x0866, 0x0878, 0x0884, 0x0890, 0x089c, 0x08a8, 0x08b4, 0x08c0, 0x08cc, 0x08d8, 0x08e4, 0x08f0, 0x08fc, 0x090a, 0x0916,
+  0x0922, 0x0930, 0x0936, 0x0942, 0x0950, 0x095c, 0x096a, 0x0970, 0x097c, 0x098a, 0x0990, 0x099e, 0x09a4, 0x09b2, 0x09c0, 0x09c6,
+  0x09d4, 0x09da, 0x09e8, 0x09f0, 0x09f6, 0x0a04, 0x0a0c, 0x0a18, 0x0a20, 0x0a28, 0x0a36, 0x0a3c, 0x0a44, 0x0a52, 0x0a58, 0x0a60,
+  0x0a68, 0x0a6e, 0x0a7c, 0x0a84, 0x0a8c, 0x0a92, 0x0a9a, 0x0aa2, 0x0aa8, 0x0ab0, 0x0ab8, 0x0ac0, 0x0ac6, 0x0ace, 0x0ad6, 0x0ade,
+  0x0ae4, 0x0aec, 0x0af4, 0x0afc, 0x0b02, 0x0b0a, 0x0b12, 0x0b12, 0x0b1a, 0x0b22, 0x0b2a, 0x0b2a, 0x0b32, 0x0b38, 0x0b40, 0x0b40,
+  0x0b48, 0x0b50, 0x0b50, 0x0b58, 0x0b60, 0x0b60, 0x0b68, 0x0b68, 0x0b70, 0x0b78, 0x0b78, 0x0b80, 0x0b80, 0x0b88, 0x0b88, 0x0b90,
+  0x0b90, 0x0b90, 0x0b98, 0x0b98, 0x0ba0, 0x0ba0, 0x0ba0, 0x0ba8, 0x0ba8, 0x0ba8, 0x0bb0, 0x0bb0, 0x0bb0, 0x0bb8, 0x0bb8, 0x0bb8,
+  0x0bb8, 0x0bc0, 0x0bc0, 0x0bc0, 0x0bc0, 0x0bc0, 0x0bc0, 0x0bc0, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8, 0x0bc8,
+  0x0009, 0x001b, 0x002d, 0x003f, 0x0051, 0x0063, 0x0075, 0x0087, 0x0099, 0x00ac, 0x00be, 0x00d0, 0x00e2, 0x00f4, 0x0106, 0x0118,
+  0x012a, 0x013c, 0x014e, 0x0160, 0x0172, 0x0184, 0x0196, 0x01a7, 0x01ba, 0x01cb, 0x01de, 0x01ef, 0x0201, 0x0214, 0x0225, 0x0237,
+  0x0248, 0x025a, 0x026c, 0x027d, 0x028f, 0x02a1, 0x02b3, 0x02c4, 0x02d6, 0x02e8, 0x02f8, 0x030b, 0x031c, 0x032d, 0x033f, 0x034f,
+  0x0362, 0x0372, 0x0383, 0x0394, 0x03a6, 0x03b8, 0x03ca, 0x03da, 0x03ea, 0x03fd, 0x040e, 0x041f, 0x042d, 0x043f, 0x0451, 0x0460,
+  0x0472, 0x0482, 0x0494, 0x04a4, 0x04b5, 0x04c5, 0x04d6, 0x04e7, 0x04f8, 0x0506, 0x0517, 0x0529, 0x0537, 0x0546, 0x0558, 0x0567,
+  0x0576, 0x0589, 0x0599, 0x05a8, 0x05b8, 0x05c8, 0x05d8, 0x05e4, 0x05f5, 0x0605, 0x0616, 0x0623, 0x0634, 0x0641, 0x0652, 0x065f,
+  0x0671, 0x067f, 0x068c, 0x069e, 0x06ac, 0x06ba, 0x06c8, 0x06d6, 0x06e5, 0x06f3, 0x0702, 0x0710, 0x071f, 0x072e, 0x073d, 0x074c,
+  0x0756, 0x0765, 0x0775, 0x077f, 0x078f, 0x079f, 0x07a9, 0x07b9, 0x07c4, 0x07d4, 0x07df, 0x07ef, 0x07fa, 0x0806, 0x0816, 0x0822,
+  0x082c, 0x0838, 0x084a, 0x0854, 0x0860, 0x086c, 0x0878, 0x0884, 0x0890, 0x089c, 0x08a8, 0x08b4, 0x08c0, 0x08cc, 0x08d8, 0x08e4,
+  0x08f0, 0x08fc, 0x0904, 0x0910, 0x091c, 0x0928, 0x0936, 0x093c, 0x0948, 0x0956, 0x095c, 0x096a, 0x0970, 0x097c, 0x098a, 0x0990,
+  0x099e, 0x09a4, 0x09b2, 0x09b8, 0x09c0, 0x09ce, 0x09d4, 0x09e2, 0x09e8, 0x09f0, 0x09fe, 0x0a04, 0x0a0c, 0x0a18, 0x0a20, 0x0a28,
+  0x0a2e, 0x0a36, 0x0a44, 0x0a4a, 0x0a52, 0x0a58, 0x0a60, 0x0a68, 0x0a6e, 0x0a76, 0x0a7c, 0x0a84, 0x0a8c, 0x0a92, 0x0a9a, 0x0aa2,
+  0x0aa8, 0x0ab0, 0x0ab8, 0x0ac0, 0x0ac6, 0x0ace, 0x0ad6, 0x0ad6, 0x0ade, 0x0ae4, 0x0aec, 0x0aec, 0x0af4, 0x0afc, 0x0b02, 0x0b02,
+  0x0b0a, 0x0b12, 0x0b12, 0x0b1a, 0x0b22, 0x0b22, 0x0b2a, 0x0b2a, 0x0b32, 0x0b38, 0x0b38, 0x0b40, 0x0b40, 0x0b48, 0x0b48, 0x0b50,
+  0x0b50, 0x0b50, 0x0b58, 0x0b58, 0x0b60, 0x0b60, 0x0b60, 0x0b68, 0x0b68, 0x0b68, 0x0b70, 0x0b70, 0x0b70, 0x0b78, 0x0b78, 0x0b78,
+  0x0b78, 0x0b80, 0x0b80, 0x0b80, 0x0b80, 0x0b80, 0x0b80, 0x0b80, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b88, 0x0b88,
+  0x0008, 0x001a, 0x002c, 0x003d, 0x004f, 0x0061, 0x0073, 0x0085, 0x0096, 0x00a8, 0x00ba, 0x00cb, 0x00dd, 0x00ef, 0x0100, 0x0112,
+  0x0124, 0x0135, 0x0147, 0x0158, 0x016a, 0x017c, 0x018e, 0x019e, 0x01b1, 0x01c1, 0x01d4, 0x01e5, 0x01f6, 0x0208, 0x0219, 0x022b,
+  0x023c, 0x024d, 0x025f, 0x0270, 0x0281, 0x0292, 0x02a4, 0x02b5, 0x02c6, 0x02d8, 0x02e8, 0x02fa, 0x030b, 0x031c, 0x032d, 0x033d,
+  0x034f, 0x035f, 0x0370, 0x0381, 0x0392, 0x03a3, 0x03b5, 0x03c5, 0x03d4, 0x03e7, 0x03f7, 0x0408, 0x0416, 0x0428, 0x0439, 0x0448,
+  0x045a, 0x0469, 0x047b, 0x048b, 0x049b, 0x04ab, 0x04bb, 0x04cc, 0x04dc, 0x04ea, 0x04fb, 0x050c, 0x051b, 0x0529, 0x053b, 0x0549,
+  0x0558, 0x056b, 0x057a, 0x0589, 0x0599, 0x05a8, 0x05b8, 0x05c4, 0x05d4, 0x05e4, 0x05f5, 0x0601, 0x0612, 0x061e, 0x0630, 0x063c,
+  0x064e, 0x065b, 0x0668, 0x067a, 0x0688, 0x0695, 0x06a3, 0x06b1, 0x06bf, 0x06cd, 0x06db, 0x06e9, 0x06f8, 0x0706, 0x0715, 0x0724,
+  0x072e, 0x073d, 0x074c, 0x0756, 0x0765, 0x0775, 0x077f, 0x078f, 0x0799, 0x07a9, 0x07b4, 0x07c4, 0x07cf, 0x07da, 0x07ea, 0x07f5,
+  0x0800, 0x080c, 0x081c, 0x0828, 0x0832, 0x083e, 0x084a, 0x0854, 0x0860, 0x086c, 0x0878, 0x0884, 0x0890, 0x089c, 0x08a8, 0x08b4,
+  0x08c0, 0x08cc, 0x08d2, 0x08de, 0x08ea, 0x08f6, 0x0904, 0x090a, 0x0916, 0x0922, 0x0928, 0x0936, 0x093c, 0x0948, 0x0956, 0x095c,
+  0x096a, 0x0970, 0x097c, 0x0984, 0x098a, 0x0998, 0x099e, 0x09ac, 0x09b2, 0x09b8, 0x09c6, 0x09ce, 0x09d4, 0x09e2, 0x09e8, 0x09f0,
+  0x09f6, 0x09fe, 0x0a0c, 0x0a12, 0x0a18, 0x0a20, 0x0a28, 0x0a2e, 0x0a36, 0x0a3c, 0x0a44, 0x0a4a, 0x0a52, 0x0a58, 0x0a60, 0x0a68,
+  0x0a6e, 0x0a76, 0x0a7c, 0x0a84, 0x0a8c, 0x0a92, 0x0a9a, 0x0a9a, 0x0aa2, 0x0aa8, 0x0ab0, 0x0ab0, 0x0ab8, 0x0ac0, 0x0ac6, 0x0ac6,
+  0x0ace, 0x0ad6, 0x0ad6, 0x0ade, 0x0ae4, 0x0ae4, 0x0aec, 0x0aec, 0x0af4, 0x0afc, 0x0afc, 0x0b02, 0x0b02, 0x0b0a, 0x0b0a, 0x0b12,
+  0x0b12, 0x0b12, 0x0b1a, 0x0b1a, 0x0b22, 0x0b22, 0x0b22, 0x0b2a, 0x0b2a, 0x0b2a, 0x0b32, 0x0b32, 0x0b32, 0x0b38, 0x0b38, 0x0b38,
+  0x0b38, 0x0b40, 0x0b40, 0x0b40, 0x0b40, 0x0b40, 0x0b40, 0x0b40, 0x0b48, 0x0b48, 0x0b48, 0x0b48, 0x0b48, 0x0b48, 0x0b48, 0x0b48,
+  0x0008, 0x001a, 0x002b, 0x003c, 0x004e, 0x005f, 0x0070, 0x0082, 0x0093, 0x00a4, 0x00b6, 0x00c7, 0x00d8, 0x00ea, 0x00fb, 0x010c,
+  0x011e, 0x012e, 0x0140, 0x0151, 0x0162, 0x0174, 0x0185, 0x0195, 0x01a7, 0x01b8, 0x01ca, 0x01da, 0x01eb, 0x01fd, 0x020e, 0x021f,
+  0x0230, 0x0241, 0x0252, 0x0262, 0x0273, 0x0284, 0x0296, 0x02a6, 0x02b7, 0x02c8, 0x02d8, 0x02ea, 0x02fa, 0x030b, 0x031c, 0x032b,
+  0x033d, 0x034d, 0x035d, 0x036d, 0x037e, 0x038f, 0x03a1, 0x03b0, 0x03bf, 0x03d2, 0x03e2, 0x03f2, 0x0400, 0x0411, 0x0422, 0x0430,
+  0x0442, 0x0451, 0x0463, 0x0472, 0x0482, 0x0491, 0x04a1, 0x04b1, 0x04c2, 0x04cf, 0x04e0, 0x04f1, 0x04ff, 0x050c, 0x051e, 0x052c,
+  0x053b, 0x054d, 0x055c, 0x056b, 0x057a, 0x0589, 0x0599, 0x05a4, 0x05b4, 0x05c4, 0x05d4, 0x05e0, 0x05f0, 0x05fd, 0x060e, 0x061a,
+  0x062b, 0x0638, 0x0645, 0x0657, 0x0664, 0x0671, 0x067f, 0x068c, 0x069a, 0x06a8, 0x06b5, 0x06c4, 0x06d2, 0x06e0, 0x06ee, 0x06fd,
+  0x0706, 0x0715, 0x0724, 0x072e, 0x073d, 0x074c, 0x0756, 0x0765, 0x0770, 0x077f, 0x078a, 0x0799, 0x07a4, 0x07ae, 0x07bf, 0x07c9,
+  0x07d4, 0x07df, 0x07ef, 0x07fa, 0x0806, 0x0810, 0x081c, 0x0828, 0x0832, 0x083e, 0x084a, 0x0854, 0x0860, 0x086c, 0x0878, 0x0884,
+  0x0890, 0x089c, 0x08a2, 0x08ae, 0x08ba, 0x08c6, 0x08d2, 0x08d8, 0x08e4, 0x08f0, 0x08f6, 0x0904, 0x090a, 0x0916, 0x0922, 0x0928,
+  0x0936, 0x093c, 0x0948, 0x0950, 0x0956, 0x0962, 0x096a, 0x0976, 0x097c, 0x0984, 0x0990, 0x0998, 0x099e, 0x09ac, 0x09b2, 0x09b8,
+  0x09c0, 0x09c6, 0x09d4, 0x09da, 0x09e2, 0x09e8, 0x09f0, 0x09f6, 0x09fe, 0x0a04, 0x0a0c, 0x0a12, 0x0a18, 0x0a20, 0x0a28, 0x0a2e,
+  0x0a36, 0x0a3c, 0x0a44, 0x0a4a, 0x0a52, 0x0a58, 0x0a60, 0x0a60, 0x0a68, 0x0a6e, 0x0a76, 0x0a76, 0x0a7c, 0x0a84, 0x0a8c, 0x0a8c,
+  0x0a92, 0x0a9a, 0x0a9a, 0x0aa2, 0x0aa8, 0x0aa8, 0x0ab0, 0x0ab0, 0x0ab8, 0x0ac0, 0x0ac0, 0x0ac6, 0x0ac6, 0x0ace, 0x0ace, 0x0ad6,
+  0x0ad6, 0x0ad6, 0x0ade, 0x0ade, 0x0ae4, 0x0ae4, 0x0ae4, 0x0aec, 0x0aec, 0x0aec, 0x0af4, 0x0af4, 0x0af4, 0x0afc, 0x0afc, 0x0afc,
+  0x0afc, 0x0b02, 0x0b02, 0x0b02, 0x0b02, 0x0b02, 0x0b02, 0x0b02, 0x0b0a, 0x0b0a, 0x0b0a, 0x0b0a, 0x0b0a, 0x0b0a, 0x0b0a, 0x0b0a,
+  0x0008, 0x0019, 0x002a, 0x003b, 0x004c, 0x005d, 0x006e, 0x007f, 0x0090, 0x00a1, 0x00b2, 0x00c3, 0x00d3, 0x00e5, 0x00f5, 0x0107,
+  0x0118, 0x0128, 0x0139, 0x014a, 0x015a, 0x016c, 0x017d, 0x018d, 0x019e, 0x01ae, 0x01c0, 0x01d0, 0x01e1, 0x01f2, 0x0203, 0x0214,
+  0x0224, 0x0234, 0x0245, 0x0255, 0x0266, 0x0276, 0x0288, 0x0298, 0x02a8, 0x02b9, 0x02c8, 0x02da, 0x02ea, 0x02fa, 0x030b, 0x031a,
+  0x032b, 0x033b, 0x034a, 0x035a, 0x036b, 0x037c, 0x038d, 0x039c, 0x03ab, 0x03bd, 0x03cc, 0x03dc, 0x03ea, 0x03fa, 0x040b, 0x0419,
+  0x042a, 0x0439, 0x044b, 0x045a, 0x0469, 0x0478, 0x0488, 0x0498, 0x04a8, 0x04b5, 0x04c5, 0x04d6, 0x04e3, 0x04f1, 0x0502, 0x0510,
+  0x051e, 0x0530, 0x053e, 0x054d, 0x055c, 0x056b, 0x057a, 0x0585, 0x0595, 0x05a4, 0x05b4, 0x05c0, 0x05d0, 0x05dc, 0x05ec, 0x05f9,
+  0x0609, 0x0616, 0x0623, 0x0634, 0x0641, 0x064e, 0x065b, 0x0668, 0x0676, 0x0683, 0x0691, 0x069e, 0x06ac, 0x06ba, 0x06c8, 0x06d6,
+  0x06e0, 0x06ee, 0x06fd, 0x0706, 0x0715, 0x0724, 0x072e, 0x073d, 0x0747, 0x0756, 0x0760, 0x0770, 0x077a, 0x0784, 0x0794, 0x079f,
+  0x07a9, 0x07b4, 0x07c4, 0x07cf, 0x07da, 0x07e4, 0x07ef, 0x07fa, 0x0806, 0x0810, 0x081c, 0x0828, 0x0832, 0x083e, 0x084a, 0x0854,
+  0x0860, 0x086c, 0x0872, 0x087e, 0x088a, 0x0896, 0x08a2, 0x08a8, 0x08b4, 0x08c0, 0x08c6, 0x08d2, 0x08d8, 0x08e4, 0x08f0, 0x08f6,
+  0x0904, 0x090a, 0x0916, 0x091c, 0x0922, 0x0930, 0x0936, 0x0942, 0x0948, 0x0950, 0x095c, 0x0962, 0x096a, 0x0976, 0x097c, 0x0984,
+  0x098a, 0x0990, 0x099e, 0x09a4, 0x09ac, 0x09b2, 0x09b8, 0x09c0, 0x09c6, 0x09ce, 0x09d4, 0x09da, 0x09e2, 0x09e8, 0x09f0, 0x09f6,
+  0x09fe, 0x0a04, 0x0a0c, 0x0a12, 0x0a18, 0x0a20, 0x0a28, 0x0a28, 0x0a2e, 0x0a36, 0x0a3c, 0x0a3c, 0x0a44, 0x0a4a, 0x0a52, 0x0a52,
+  0x0a58, 0x0a60, 0x0a60, 0x0a68, 0x0a6e, 0x0a6e, 0x0a76, 0x0a76, 0x0a7c, 0x0a84, 0x0a84, 0x0a8c, 0x0a8c, 0x0a92, 0x0a92, 0x0a9a,
+  0x0a9a, 0x0a9a, 0x0aa2, 0x0aa2, 0x0aa8, 0x0aa8, 0x0aa8, 0x0ab0, 0x0ab0, 0x0ab0, 0x0ab8, 0x0ab8, 0x0ab8, 0x0ac0, 0x0ac0, 0x0ac0,
+  0x0ac0, 0x0ac6, 0x0ac6, 0x0ac6, 0x0ac6, 0x0ac6, 0x0ac6, 0x0ac6, 0x0ace, 0x0ace, 0x0ace, 0x0ace, 0x0ace, 0x0ace, 0x0ace, 0x0ace,
+  0x0008, 0x0018, 0x0029, 0x003a, 0x004a, 0x005b, 0x006b, 0x007c, 0x008d, 0x009d, 0x00ae, 0x00bf, 0x00cf, 0x00e0, 0x00f0, 0x0101,
+  0x0112, 0x0122, 0x0133, 0x0143, 0x0153, 0x0164, 0x0175, 0x0184, 0x0195, 0x01a5, 0x01b6, 0x01c6, 0x01d6, 0x01e7, 0x01f7, 0x0208,
+  0x0218, 0x0228, 0x0239, 0x0248, 0x0258, 0x0269, 0x027a, 0x028a, 0x029a, 0x02aa, 0x02b9, 0x02ca, 0x02da, 0x02ea, 0x02fa, 0x0309,
+  0x031a, 0x0329, 0x0338, 0x0348, 0x0358, 0x0369, 0x0379, 0x0388, 0x0397, 0x03a8, 0x03b8, 0x03c7, 0x03d4, 0x03e4, 0x03f5, 0x0403,
+  0x0414, 0x0422, 0x0433, 0x0442, 0x0451, 0x0460, 0x046f, 0x047e, 0x048e, 0x049b, 0x04ab, 0x04bb, 0x04c8, 0x04d6, 0x04e7, 0x04f4,
+  0x0502, 0x0514, 0x0522, 0x0530, 0x053e, 0x054d, 0x055c, 0x0567, 0x0576, 0x0585, 0x0595, 0x05a0, 0x05b0, 0x05bc, 0x05cc, 0x05d8,
+  0x05e8, 0x05f5, 0x0601, 0x0612, 0x061e, 0x062b, 0x0638, 0x0645, 0x0652, 0x065f, 0x066d, 0x067a, 0x0688, 0x0695, 0x06a3, 0x06b1,
+  0x06ba, 0x06c8, 0x06d6, 0x06e0, 0x06ee, 0x06fd, 0x0706, 0x0715, 0x071f, 0x072e, 0x0738, 0x0747, 0x0751, 0x075b, 0x076a, 0x0775,
+  0x077f, 0x078a, 0x0799, 0x07a4, 0x07ae, 0x07b9, 0x07c4, 0x07cf, 0x07da, 0x07e4, 0x07ef, 0x07fa, 0x0806, 0x0810, 0x081c, 0x0828,
+  0x0832, 0x083e, 0x0844, 0x0850, 0x085a, 0x0866, 0x0872, 0x0878, 0x0884, 0x0890, 0x0896, 0x08a2, 0x08a8, 0x08b4, 0x08c0, 0x08c6,
+  0x08d2, 0x08d8, 0x08e4, 0x08ea, 0x08f0, 0x08fc, 0x0904, 0x0910, 0x0916, 0x091c, 0x0928, 0x0930, 0x0936, 0x0942, 0x0948, 0x0950,
+  0x0956, 0x095c, 0x096a, 0x0970, 0x0976, 0x097c, 0x0984, 0x098a, 0x0990, 0x0998, 0x099e, 0x09a4, 0x09ac, 0x09b2, 0x09b8, 0x09c0,
+  0x09c6, 0x09ce, 0x09d4, 0x09da, 0x09e2, 0x09e8, 0x09f0, 0x09f0, 0x09f6, 0x09fe, 0x0a04, 0x0a04, 0x0a0c, 0x0a12, 0x0a18, 0x0a18,
+  0x0a20, 0x0a28, 0x0a28, 0x0a2e, 0x0a36, 0x0a36, 0x0a3c, 0x0a3c, 0x0a44, 0x0a4a, 0x0a4a, 0x0a52, 0x0a52, 0x0a58, 0x0a58, 0x0a60,
+  0x0a60, 0x0a60, 0x0a68, 0x0a68, 0x0a6e, 0x0a6e, 0x0a6e, 0x0a76, 0x0a76, 0x0a76, 0x0a7c, 0x0a7c, 0x0a7c, 0x0a84, 0x0a84, 0x0a84,
+  0x0a84, 0x0a8c, 0x0a8c, 0x0a8c, 0x0a8c, 0x0a8c, 0x0a8c, 0x0a8c, 0x0a92, 0x0a92, 0x0a92, 0x0a92, 0x0a92, 0x0a92, 0x0a92, 0x0a92,
+  0x0008, 0x0018, 0x0028, 0x0038, 0x0049, 0x0059, 0x0069, 0x0079, 0x008a, 0x009a, 0x00aa, 0x00bb, 0x00ca, 0x00db, 0x00eb, 0x00fb,
+  0x010c, 0x011b, 0x012c, 0x013c, 0x014c, 0x015c, 0x016d, 0x017c, 0x018d, 0x019c, 0x01ad, 0x01bc, 0x01cc, 0x01dd, 0x01ed, 0x01fd,
+  0x020c, 0x021c, 0x022d, 0x023c, 0x024c, 0x025c, 0x026c, 0x027c, 0x028b, 0x029b, 0x02aa, 0x02bb, 0x02ca, 0x02da, 0x02ea, 0x02f8,
+  0x0309, 0x0318, 0x0327, 0x0336, 0x0346, 0x0356, 0x0366, 0x0374, 0x0383, 0x0394, 0x03a3, 0x03b2, 0x03bf, 0x03cf, 0x03df, 0x03ed,
+  0x03fd, 0x040b, 0x041c, 0x042a, 0x0439, 0x0448, 0x0457, 0x0466, 0x0475, 0x0482, 0x0491, 0x04a1, 0x04ae, 0x04bb, 0x04cc, 0x04d9,
+  0x04e7, 0x04f8, 0x0506, 0x0514, 0x0522, 0x0530, 0x053e, 0x0549, 0x0558, 0x0567, 0x0576, 0x0581, 0x0591, 0x059c, 0x05ac, 0x05b8,
+  0x05c8, 0x05d4, 0x05e0, 0x05f0, 0x05fd, 0x0609, 0x0616, 0x0623, 0x0630, 0x063c, 0x0649, 0x0657, 0x0664, 0x0671, 0x067f, 0x068c,
+  0x0695, 0x06a3, 0x06b1, 0x06ba, 0x06c8, 0x06d6, 0x06e0, 0x06ee, 0x06f8, 0x0706, 0x0710, 0x071f, 0x0729, 0x0733, 0x0742, 0x074c,
+  0x0756, 0x0760, 0x0770, 0x077a, 0x0784, 0x078f, 0x0799, 0x07a4, 0x07ae, 0x07b9, 0x07c4, 0x07cf, 0x07da, 0x07e4, 0x07ef, 0x07fa,
+  0x0806, 0x0810, 0x0816, 0x0822, 0x082c, 0x0838, 0x0844, 0x084a, 0x0854, 0x0860, 0x0866, 0x0872, 0x0878, 0x0884, 0x0890, 0x0896,
+  0x08a2, 0x08a8, 0x08b4, 0x08ba, 0x08c0, 0x08cc, 0x08d2, 0x08de, 0x08e4, 0x08ea, 0x08f6, 0x08fc, 0x0904, 0x0910, 0x0916, 0x091c,
+  0x0922, 0x0928, 0x0936, 0x093c, 0x0942, 0x0948, 0x0950, 0x0956, 0x095c, 0x0962, 0x096a, 0x0970, 0x0976, 0x097c, 0x0984, 0x098a,
+  0x0990, 0x0998, 0x099e, 0x09a4, 0x09ac, 0x09b2, 0x09b8, 0x09b8, 0x09c0, 0x09c6, 0x09ce, 0x09ce, 0x09d4, 0x09da, 0x09e2, 0x09e2,
+  0x09e8, 0x09f0, 0x09f0, 0x09f6, 0x09fe, 0x09fe, 0x0a04, 0x0a04, 0x0a0c, 0x0a12, 0x0a12, 0x0a18, 0x0a18, 0x0a20, 0x0a20, 0x0a28,
+  0x0a28, 0x0a28, 0x0a2e, 0x0a2e, 0x0a36, 0x0a36, 0x0a36, 0x0a3c, 0x0a3c, 0x0a3c, 0x0a44, 0x0a44, 0x0a44, 0x0a4a, 0x0a4a, 0x0a4a,
+  0x0a4a, 0x0a52, 0x0a52, 0x0a52, 0x0a52, 0x0a52, 0x0a52, 0x0a52, 0x0a58, 0x0a58, 0x0a58, 0x0a58, 0x0a58, 0x0a58, 0x0a58, 0x0a58,
+  0x0007, 0x0017, 0x0027, 0x0037, 0x0047, 0x0057, 0x0067, 0x0077, 0x0087, 0x0097, 0x00a6, 0x00b7, 0x00c6, 0x00d6, 0x00e6, 0x00f6,
+  0x0106, 0x0115, 0x0126, 0x0135, 0x0145, 0x0155, 0x0165, 0x0174, 0x0184, 0x0193, 0x01a4, 0x01b3, 0x01c2, 0x01d3, 0x01e2, 0x01f2,
+  0x0201, 0x0211, 0x0221, 0x0230, 0x023f, 0x024f, 0x025f, 0x026e, 0x027d, 0x028d, 0x029b, 0x02ac, 0x02bb, 0x02ca, 0x02da, 0x02e8,
+  0x02f8, 0x0307, 0x0315, 0x0324, 0x0334, 0x0344, 0x0354, 0x0362, 0x0370, 0x0381, 0x038f, 0x039e, 0x03ab, 0x03ba, 0x03ca, 0x03d7,
+  0x03e7, 0x03f5, 0x0406, 0x0414, 0x0422, 0x0430, 0x043f, 0x044e, 0x045d, 0x0469, 0x0478, 0x0488, 0x0494, 0x04a1, 0x04b1, 0x04be,
+  0x04cc, 0x04dc, 0x04ea, 0x04f8, 0x0506, 0x0514, 0x0522, 0x052c, 0x053b, 0x0549, 0x0558, 0x0563, 0x0572, 0x057e, 0x058d, 0x0599,
+  0x05a8, 0x05b4, 0x05c0, 0x05d0, 0x05dc, 0x05e8, 0x05f5, 0x0601, 0x060e, 0x061a, 0x0627, 0x0634, 0x0641, 0x064e, 0x065b, 0x0668,
+  0x0671, 0x067f, 0x068c, 0x0695, 0x06a3, 0x06b1, 0x06ba, 0x06c8, 0x06d2, 0x06e0, 0x06e9, 0x06f8, 0x0702, 0x070b, 0x071a, 0x0724,
+  0x072e, 0x0738, 0x0747, 0x0751, 0x075b, 0x0765, 0x0770, 0x077a, 0x0784, 0x078f, 0x0799, 0x07a4, 0x07ae, 0x07b9, 0x07c4, 0x07cf,
+  0x07da, 0x07e4, 0x07ea, 0x07f5, 0x0800, 0x080c, 0x0816, 0x081c, 0x0828, 0x0832, 0x0838, 0x0844, 0x084a, 0x0854, 0x0860, 0x0866,
+  0x0872, 0x0878, 0x0884, 0x088a, 0x0890, 0x089c, 0x08a2, 0x08ae, 0x08b4, 0x08ba, 0x08c6, 0x08cc, 0x08d2, 0x08de, 0x08e4, 0x08ea,
+  0x08f0, 0x08f6, 0x0904, 0x090a, 0x0910, 0x0916, 0x091c, 0x0922, 0x0928, 0x0930, 0x0936, 0x093c, 0x0942, 0x0948, 0x0950, 0x0956,
+  0x095c, 0x0962, 0x096a, 0x0970, 0x0976, 0x097c, 0x0984, 0x0984, 0x098a, 0x0990, 0x0998, 0x0998, 0x099e, 0x09a4, 0x09ac, 0x09ac,
+  0x09b2, 0x09b8, 0x09b8, 0x09c0, 0x09c6, 0x09c6, 0x09ce, 0x09ce, 0x09d4, 0x09da, 0x09da, 0x09e2, 0x09e2, 0x09e8, 0x09e8, 0x09f0,
+  0x09f0, 0x09f0, 0x09f6, 0x09f6, 0x09fe, 0x09fe, 0x09fe, 0x0a04, 0x0a04, 0x0a04, 0x0a0c, 0x0a0c, 0x0a0c, 0x0a12, 0x0a12, 0x0a12,
+  0x0a12, 0x0a18, 0x0a18, 0x0a18, 0x0a18, 0x0a18, 0x0a18, 0x0a18, 0x0a20, 0x0a20, 0x0a20, 0x0a20, 0x0a20, 0x0a20, 0x0a20, 0x0a20,
+  0x0007, 0x0017, 0x0026, 0x0036, 0x0046, 0x0055, 0x0065, 0x0074, 0x0084, 0x0093, 0x00a3, 0x00b3, 0x00c2, 0x00d2, 0x00e1, 0x00f1,
+  0x0100, 0x010f, 0x011f, 0x012e, 0x013e, 0x014d, 0x015d, 0x016c, 0x017c, 0x018a, 0x019b, 0x01aa, 0x01b9, 0x01c9, 0x01d8, 0x01e7,
+  0x01f6, 0x0205, 0x0215, 0x0224, 0x0233, 0x0242, 0x0252, 0x0261, 0x0270, 0x027f, 0x028d, 0x029d, 0x02ac, 0x02bb, 0x02ca, 0x02d8,
+  0x02e8, 0x02f6, 0x0304, 0x0313, 0x0322, 0x0332, 0x0341, 0x034f, 0x035d, 0x036d, 0x037c, 0x038a, 0x0397, 0x03a6, 0x03b5, 0x03c2,
+  0x03d2, 0x03df, 0x03ef, 0x03fd, 0x040b, 0x0419, 0x0428, 0x0436, 0x0445, 0x0451, 0x0460, 0x046f, 0x047b, 0x0488, 0x0498, 0x04a4,
+  0x04b1, 0x04c2, 0x04cf, 0x04dc, 0x04ea, 0x04f8, 0x0506, 0x0510, 0x051e, 0x052c, 0x053b, 0x0546, 0x0554, 0x0560, 0x056f, 0x057a,
+  0x0589, 0x0595, 0x05a0, 0x05b0, 0x05bc, 0x05c8, 0x05d4, 0x05e0, 0x05ec, 0x05f9, 0x0605, 0x0612, 0x061e, 0x062b, 0x0638, 0x0645,
+  0x064e, 0x065b, 0x0668, 0x0671, 0x067f, 0x068c, 0x0695, 0x06a3, 0x06ac, 0x06ba, 0x06c4, 0x06d2, 0x06db, 0x06e5, 0x06f3, 0x06fd,
+  0x0706, 0x0710, 0x071f, 0x0729, 0x0733, 0x073d, 0x0747, 0x0751, 0x075b, 0x0765, 0x0770, 0x077a, 0x0784, 0x078f, 0x0799, 0x07a4,
+  0x07ae, 0x07b9, 0x07bf, 0x07c9, 0x07d4, 0x07df, 0x07ea, 0x07ef, 0x07fa, 0x0806, 0x080c, 0x0816, 0x081c, 0x0828, 0x0832, 0x0838,
+  0x0844, 0x084a, 0x0854, 0x085a, 0x0860, 0x086c, 0x0872, 0x087e, 0x0884, 0x088a, 0x0896, 0x089c, 0x08a2, 0x08ae, 0x08b4, 0x08ba,
+  0x08c0, 0x08c6, 0x08d2, 0x08d8, 0x08de, 0x08e4, 0x08ea, 0x08f0, 0x08f6, 0x08fc, 0x0904, 0x090a, 0x0910, 0x0916, 0x091c, 0x0922,
+  0x0928, 0x0930, 0x0936, 0x093c, 0x0942, 0x0948, 0x0950, 0x0950, 0x0956, 0x095c, 0x0962, 0x0962, 0x096a, 0x0970, 0x0976, 0x0976,
+  0x097c, 0x0984, 0x0984, 0x098a, 0x0990, 0x0990, 0x0998, 0x0998, 0x099e, 0x09a4, 0x09a4, 0x09ac, 0x09ac, 0x09b2, 0x09b2, 0x09b8,
+  0x09b8, 0x09b8, 0x09c0, 0x09c0, 0x09c6, 0x09c6, 0x09c6, 0x09ce, 0x09ce, 0x09ce, 0x09d4, 0x09d4, 0x09d4, 0x09da, 0x09da, 0x09da,
+  0x09da, 0x09e2, 0x09e2, 0x09e2, 0x09e2, 0x09e2, 0x09e2, 0x09e2, 0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x09e8, 0x09e8,
+  0x0007, 0x0016, 0x0026, 0x0035, 0x0044, 0x0053, 0x0063, 0x0072, 0x0081, 0x0090, 0x009f, 0x00af, 0x00be, 0x00cd, 0x00dc, 0x00ec,
+  0x00fb, 0x010a, 0x0119, 0x0128, 0x0137, 0x0146, 0x0156, 0x0164, 0x0174, 0x0182, 0x0192, 0x01a0, 0x01af, 0x01bf, 0x01ce, 0x01dd,
+  0x01eb, 0x01fa, 0x020a, 0x0218, 0x0227, 0x0236, 0x0245, 0x0254, 0x0262, 0x0271, 0x027f, 0x028f, 0x029d, 0x02ac, 0x02bb, 0x02c8,
+  0x02d8, 0x02e6, 0x02f4, 0x0302, 0x0311, 0x0320, 0x032f, 0x033d, 0x034a, 0x035a, 0x0369, 0x0377, 0x0383, 0x0392, 0x03a1, 0x03ad,
+  0x03bd, 0x03ca, 0x03da, 0x03e7, 0x03f5, 0x0403, 0x0411, 0x041f, 0x042d, 0x0439, 0x0448, 0x0457, 0x0463, 0x046f, 0x047e, 0x048b,
+  0x0498, 0x04a8, 0x04b5, 0x04c2, 0x04cf, 0x04dc, 0x04ea, 0x04f4, 0x0502, 0x0510, 0x051e, 0x0529, 0x0537, 0x0542, 0x0551, 0x055c,
+  0x056b, 0x0576, 0x0581, 0x0591, 0x059c, 0x05a8, 0x05b4, 0x05c0, 0x05cc, 0x05d8, 0x05e4, 0x05f0, 0x05fd, 0x0609, 0x0616, 0x0623,
+  0x062b, 0x0638, 0x0645, 0x064e, 0x065b, 0x0668, 0x0671, 0x067f, 0x0688, 0x0695, 0x069e, 0x06ac, 0x06b5, 0x06bf, 0x06cd, 0x06d6,
+  0x06e0, 0x06e9, 0x06f8, 0x0702, 0x070b, 0x0715, 0x071f, 0x0729, 0x0733, 0x073d, 0x0747, 0x0751, 0x075b, 0x0765, 0x0770, 0x077a,
+  0x0784, 0x078f, 0x0794, 0x079f, 0x07a9, 0x07b4, 0x07bf, 0x07c4, 0x07cf, 0x07da, 0x07df, 0x07ea, 0x07ef, 0x07fa, 0x0806, 0x080c,
+  0x0816, 0x081c, 0x0828, 0x082c, 0x0832, 0x083e, 0x0844, 0x0850, 0x0854, 0x085a, 0x0866, 0x086c, 0x0872, 0x087e, 0x0884, 0x088a,
+  0x0890, 0x0896, 0x08a2, 0x08a8, 0x08ae, 0x08b4, 0x08ba, 0x08c0, 0x08c6, 0x08cc, 0x08d2, 0x08d8, 0x08de, 0x08e4, 0x08ea, 0x08f0,
+  0x08f6, 0x08fc, 0x0904, 0x090a, 0x0910, 0x0916, 0x091c, 0x091c, 0x0922, 0x0928, 0x0930, 0x0930, 0x0936, 0x093c, 0x0942, 0x0942,
+  0x0948, 0x0950, 0x0950, 0x0956, 0x095c, 0x095c, 0x0962, 0x0962, 0x096a, 0x0970, 0x0970, 0x0976, 0x0976, 0x097c, 0x097c, 0x0984,
+  0x0984, 0x0984, 0x098a, 0x098a, 0x0990, 0x0990, 0x0990, 0x0998, 0x0998, 0x0998, 0x099e, 0x099e, 0x099e, 0x09a4, 0x09a4, 0x09a4,
+  0x09a4, 0x09ac, 0x09ac, 0x09ac, 0x09ac, 0x09ac, 0x09ac, 0x09ac, 0x09b2, 0x09b2, 0x09b2, 0x09b2, 0x09b2, 0x09b2, 0x09b2, 0x09b2,
+  0x0007, 0x0016, 0x0025, 0x0034, 0x0043, 0x0051, 0x0060, 0x006f, 0x007e, 0x008d, 0x009c, 0x00ab, 0x00ba, 0x00c9, 0x00d7, 0x00e7,
+  0x00f5, 0x0104, 0x0113, 0x0122, 0x0130, 0x013f, 0x014e, 0x015c, 0x016c, 0x017a, 0x0189, 0x0197, 0x01a6, 0x01b5, 0x01c4, 0x01d3,
+  0x01e1, 0x01ef, 0x01fe, 0x020c, 0x021b, 0x022a, 0x0239, 0x0247, 0x0255, 0x0264, 0x0271, 0x0281, 0x028f, 0x029d, 0x02ac, 0x02b9,
+  0x02c8, 0x02d6, 0x02e4, 0x02f2, 0x0300, 0x030f, 0x031e, 0x032b, 0x0338, 0x0348, 0x0356, 0x0364, 0x0370, 0x037e, 0x038d, 0x0399,
+  0x03a8, 0x03b5, 0x03c5, 0x03d2, 0x03df, 0x03ed, 0x03fa, 0x0408, 0x0416, 0x0422, 0x0430, 0x043f, 0x044b, 0x0457, 0x0466, 0x0472,
+  0x047e, 0x048e, 0x049b, 0x04a8, 0x04b5, 0x04c2, 0x04cf, 0x04d9, 0x04e7, 0x04f4, 0x0502, 0x050c, 0x051b, 0x0525, 0x0534, 0x053e,
+  0x054d, 0x0558, 0x0563, 0x0572, 0x057e, 0x0589, 0x0595, 0x05a0, 0x05ac, 0x05b8, 0x05c4, 0x05d0, 0x05dc, 0x05e8, 0x05f5, 0x0601,
+  0x0609, 0x0616, 0x0623, 0x062b, 0x0638, 0x0645, 0x064e, 0x065b, 0x0664, 0x0671, 0x067a, 0x0688, 0x0691, 0x069a, 0x06a8, 0x06b1,
+  0x06ba, 0x06c4, 0x06d2, 0x06db, 0x06e5, 0x06ee, 0x06f8, 0x0702, 0x070b, 0x0715, 0x071f, 0x0729, 0x0733, 0x073d, 0x0747, 0x0751,
+  0x075b, 0x0765, 0x076a, 0x0775, 0x077f, 0x078a, 0x0794, 0x0799, 0x07a4, 0x07ae, 0x07b4, 0x07bf, 0x07c4, 0x07cf, 0x07da, 0x07df,
+  0x07ea, 0x07ef, 0x07fa, 0x0800, 0x0806, 0x0810, 0x0816, 0x0822, 0x0828, 0x082c, 0x0838, 0x083e, 0x0844, 0x0850, 0x0854, 0x085a,
+  0x0860, 0x0866, 0x0872, 0x0878, 0x087e, 0x0884, 0x088a, 0x0890, 0x0896, 0x089c, 0x08a2, 0x08a8, 0x08ae, 0x08b4, 0x08ba, 0x08c0,
+  0x08c6, 0x08cc, 0x08d2, 0x08d8, 0x08de, 0x08e4, 0x08ea, 0x08ea, 0x08f0, 0x08f6, 0x08fc, 0x08fc, 0x0904, 0x090a, 0x0910, 0x0910,
+  0x0916, 0x091c, 0x091c, 0x0922, 0x0928, 0x0928, 0x0930, 0x0930, 0x0936, 0x093c, 0x093c, 0x0942, 0x0942, 0x0948, 0x0948, 0x0950,
+  0x0950, 0x0950, 0x0956, 0x0956, 0x095c, 0x095c, 0x095c, 0x0962, 0x0962, 0x0962, 0x096a, 0x096a, 0x096a, 0x0970, 0x0970, 0x0970,
+  0x0970, 0x0976, 0x0976, 0x0976, 0x0976, 0x0976, 0x0976, 0x0976, 0x097c, 0x097c, 0x097c, 0x097c, 0x097c, 0x097c, 0x097c, 0x097c,
+  0x0007, 0x0015, 0x0024, 0x0032, 0x0041, 0x0050, 0x005e, 0x006d, 0x007b, 0x008a, 0x0099, 0x00a7, 0x00b6, 0x00c4, 0x00d3, 0x00e2,
+  0x00f0, 0x00fe, 0x010d, 0x011b, 0x012a, 0x0138, 0x0147, 0x0155, 0x0164, 0x0172, 0x0181, 0x018f, 0x019d, 0x01ac, 0x01ba, 0x01c9,
+  0x01d6, 0x01e5, 0x01f3, 0x0201, 0x020f, 0x021e, 0x022d, 0x023a, 0x0248, 0x0257, 0x0264, 0x0273, 0x0281, 0x028f, 0x029d, 0x02aa,
+  0x02b9, 0x02c6, 0x02d4, 0x02e2, 0x02f0, 0x02fe, 0x030d, 0x031a, 0x0327, 0x0336, 0x0344, 0x0351, 0x035d, 0x036b, 0x0379, 0x0385,
+  0x0394, 0x03a1, 0x03b0, 0x03bd, 0x03ca, 0x03d7, 0x03e4, 0x03f2, 0x0400, 0x040b, 0x0419, 0x0428, 0x0433, 0x043f, 0x044e, 0x045a,
+  0x0466, 0x0475, 0x0482, 0x048e, 0x049b, 0x04a8, 0x04b5, 0x04be, 0x04cc, 0x04d9, 0x04e7, 0x04f1, 0x04ff, 0x0509, 0x0517, 0x0522,
+  0x0530, 0x053b, 0x0546, 0x0554, 0x0560, 0x056b, 0x0576, 0x0581, 0x058d, 0x0599, 0x05a4, 0x05b0, 0x05bc, 0x05c8, 0x05d4, 0x05e0,
+  0x05e8, 0x05f5, 0x0601, 0x0609, 0x0616, 0x0623, 0x062b, 0x0638, 0x0641, 0x064e, 0x0657, 0x0664, 0x066d, 0x0676, 0x0683, 0x068c,
+  0x0695, 0x069e, 0x06ac, 0x06b5, 0x06bf, 0x06c8, 0x06d2, 0x06db, 0x06e5, 0x06ee, 0x06f8, 0x0702, 0x070b, 0x0715, 0x071f, 0x0729,
+  0x0733, 0x073d, 0x0742, 0x074c, 0x0756, 0x0760, 0x076a, 0x0770, 0x077a, 0x0784, 0x078a, 0x0794, 0x0799, 0x07a4, 0x07ae, 0x07b4,
+  0x07bf, 0x07c4, 0x07cf, 0x07d4, 0x07da, 0x07e4, 0x07ea, 0x07f5, 0x07fa, 0x0800, 0x080c, 0x0810, 0x0816, 0x0822, 0x0828, 0x082c,
+  0x0832, 0x0838, 0x0844, 0x084a, 0x0850, 0x0854, 0x085a, 0x0860, 0x0866, 0x086c, 0x0872, 0x0878, 0x087e, 0x0884, 0x088a, 0x0890,
+  0x0896, 0x089c, 0x08a2, 0x08a8, 0x08ae, 0x08b4, 0x08ba, 0x08ba, 0x08c0, 0x08c6, 0x08cc, 0x08cc, 0x08d2, 0x08d8, 0x08de, 0x08de,
+  0x08e4, 0x08ea, 0x08ea, 0x08f0, 0x08f6, 0x08f6, 0x08fc, 0x08fc, 0x0904, 0x090a, 0x090a, 0x0910, 0x0910, 0x0916, 0x0916, 0x091c,
+  0x091c, 0x091c, 0x0922, 0x0922, 0x0928, 0x0928, 0x0928, 0x0930, 0x0930, 0x0930, 0x0936, 0x0936, 0x0936, 0x093c, 0x093c, 0x093c,
+  0x093c, 0x0942, 0x0942, 0x0942, 0x0942, 0x0942, 0x0942, 0x0942, 0x0948, 0x0948, 0x0948, 0x0948, 0x0948, 0x0948, 0x0948, 0x0948,
+  0x0007, 0x0015, 0x0023, 0x0031, 0x0040, 0x004e, 0x005c, 0x006b, 0x0079, 0x0087, 0x0095, 0x00a4, 0x00b2, 0x00c0, 0x00ce, 0x00dd,
+  0x00eb, 0x00f9, 0x0107, 0x0115, 0x0123, 0x0132, 0x0140, 0x014d, 0x015c, 0x016a, 0x0179, 0x0186, 0x0194, 0x01a3, 0x01b1, 0x01bf,
+  0x01cc, 0x01da, 0x01e9, 0x01f6, 0x0204, 0x0212, 0x0221, 0x022e, 0x023c, 0x024a, 0x0257, 0x0266, 0x0273, 0x0281, 0x028f, 0x029b,
+  0x02aa, 0x02b7, 0x02c4, 0x02d2, 0x02e0, 0x02ee, 0x02fc, 0x0309, 0x0315, 0x0324, 0x0332, 0x033f, 0x034a, 0x0358, 0x0366, 0x0372,
+  0x0381, 0x038d, 0x039c, 0x03a8, 0x03b5, 0x03c2, 0x03cf, 0x03dc, 0x03ea, 0x03f5, 0x0403, 0x0411, 0x041c, 0x0428, 0x0436, 0x0442,
+  0x044e, 0x045d, 0x0469, 0x0475, 0x0482, 0x048e, 0x049b, 0x04a4, 0x04b1, 0x04be, 0x04cc, 0x04d6, 0x04e3, 0x04ed, 0x04fb, 0x0506,
+  0x0514, 0x051e, 0x0529, 0x0537, 0x0542, 0x054d, 0x0558, 0x0563, 0x056f, 0x057a, 0x0585, 0x0591, 0x059c, 0x05a8, 0x05b4, 0x05c0,
+  0x05c8, 0x05d4, 0x05e0, 0x05e8, 0x05f5, 0x0601, 0x0609, 0x0616, 0x061e, 0x062b, 0x0634, 0x0641, 0x0649, 0x0652, 0x065f, 0x0668,
+  0x0671, 0x067a, 0x0688, 0x0691, 0x069a, 0x06a3, 0x06ac, 0x06b5, 0x06bf, 0x06c8, 0x06d2, 0x06db, 0x06e5, 0x06ee, 0x06f8, 0x0702,
+  0x070b, 0x0715, 0x071a, 0x0724, 0x072e, 0x0738, 0x0742, 0x0747, 0x0751, 0x075b, 0x0760, 0x076a, 0x0770, 0x077a, 0x0784, 0x078a,
+  0x0794, 0x0799, 0x07a4, 0x07a9, 0x07ae, 0x07b9, 0x07bf, 0x07c9, 0x07cf, 0x07d4, 0x07df, 0x07e4, 0x07ea, 0x07f5, 0x07fa, 0x0800,
+  0x0806, 0x080c, 0x0816, 0x081c, 0x0822, 0x0828, 0x082c, 0x0832, 0x0838, 0x083e, 0x0844, 0x084a, 0x0850, 0x0854, 0x085a, 0x0860,
+  0x0866, 0x086c, 0x0872, 0x0878, 0x087e, 0x0884, 0x088a, 0x088a, 0x0890, 0x0896, 0x089c, 0x089c, 0x08a2, 0x08a8, 0x08ae, 0x08ae,
+  0x08b4, 0x08ba, 0x08ba, 0x08c0, 0x08c6, 0x08c6, 0x08cc, 0x08cc, 0x08d2, 0x08d8, 0x08d8, 0x08de, 0x08de, 0x08e4, 0x08e4, 0x08ea,
+  0x08ea, 0x08ea, 0x08f0, 0x08f0, 0x08f6, 0x08f6, 0x08f6, 0x08fc, 0x08fc, 0x08fc, 0x0904, 0x0904, 0x0904, 0x090a, 0x090a, 0x090a,
+  0x090a, 0x0910, 0x0910, 0x0910, 0x0910, 0x0910, 0x0910, 0x0910, 0x0916, 0x0916, 0x0916, 0x0916, 0x0916, 0x0916, 0x0916, 0x0916,
+  0x0006, 0x0014, 0x0022, 0x0030, 0x003e, 0x004c, 0x005a, 0x0068, 0x0076, 0x0084, 0x0092, 0x00a0, 0x00ae, 0x00bc, 0x00ca, 0x00d8,
+  0x00e6, 0x00f3, 0x0102, 0x010f, 0x011d, 0x012b, 0x0139, 0x0146, 0x0155, 0x0162, 0x0171, 0x017e, 0x018c, 0x019a, 0x01a7, 0x01b5,
+  0x01c2, 0x01d0, 0x01de, 0x01eb, 0x01f9, 0x0207, 0x0215, 0x0222, 0x0230, 0x023d, 0x024a, 0x0258, 0x0266, 0x0273, 0x0281, 0x028d,
+  0x029b, 0x02a8, 0x02b5, 0x02c2, 0x02d0, 0x02de, 0x02ec, 0x02f8, 0x0304, 0x0313, 0x0320, 0x032d, 0x0338, 0x0346, 0x0354, 0x035f,
+  0x036d, 0x0379, 0x0388, 0x0394, 0x03a1, 0x03ad, 0x03ba, 0x03c7, 0x03d4, 0x03df, 0x03ed, 0x03fa, 0x0406, 0x0411, 0x041f, 0x042a,
+  0x0436, 0x0445, 0x0451, 0x045d, 0x0469, 0x0475, 0x0482, 0x048b, 0x0498, 0x04a4, 0x04b1, 0x04bb, 0x04c8, 0x04d2, 0x04e0, 0x04ea,
+  0x04f8, 0x0502, 0x050c, 0x051b, 0x0525, 0x0530, 0x053b, 0x0546, 0x0551, 0x055c, 0x0567, 0x0572, 0x057e, 0x0589, 0x0595, 0x05a0,
+  0x05a8, 0x05b4, 0x05c0, 0x05c8, 0x05d4, 0x05e0, 0x05e8, 0x05f5, 0x05fd, 0x0609, 0x0612, 0x061e, 0x0627, 0x0630, 0x063c, 0x0645,
+  0x064e, 0x0657, 0x0664, 0x066d, 0x0676, 0x067f, 0x0688, 0x0691, 0x069a, 0x06a3, 0x06ac, 0x06b5, 0x06bf, 0x06c8, 0x06d2, 0x06db,
+  0x06e5, 0x06ee, 0x06f3, 0x06fd, 0x0706, 0x0710, 0x071a, 0x071f, 0x0729, 0x0733, 0x0738, 0x0742, 0x0747, 0x0751, 0x075b, 0x0760,
+  0x076a, 0x0770, 0x077a, 0x077f, 0x0784, 0x078f, 0x0794, 0x079f, 0x07a4, 0x07a9, 0x07b4, 0x07b9, 0x07bf, 0x07c9, 0x07cf, 0x07d4,
+  0x07da, 0x07df, 0x07ea, 0x07ef, 0x07f5, 0x07fa, 0x0800, 0x0806, 0x080c, 0x0810, 0x0816, 0x081c, 0x0822, 0x0828, 0x082c, 0x0832,
+  0x0838, 0x083e, 0x0844, 0x084a, 0x0850, 0x0854, 0x085a, 0x085a, 0x0860, 0x0866, 0x086c, 0x086c, 0x0872, 0x0878, 0x087e, 0x087e,
+  0x0884, 0x088a, 0x088a, 0x0890, 0x0896, 0x0896, 0x089c, 0x089c, 0x08a2, 0x08a8, 0x08a8, 0x08ae, 0x08ae, 0x08b4, 0x08b4, 0x08ba,
+  0x08ba, 0x08ba, 0x08c0, 0x08c0, 0x08c6, 0x08c6, 0x08c6, 0x08cc, 0x08cc, 0x08cc, 0x08d2, 0x08d2, 0x08d2, 0x08d8, 0x08d8, 0x08d8,
+  0x08d8, 0x08de, 0x08de, 0x08de, 0x08de, 0x08de, 0x08de, 0x08de, 0x08e4, 0x08e4, 0x08e4, 0x08e4, 0x08e4, 0x08e4, 0x08e4, 0x08e4,
+  0x0006, 0x0014, 0x0022, 0x002f, 0x003d, 0x004b, 0x0058, 0x0066, 0x0074, 0x0081, 0x008f, 0x009d, 0x00aa, 0x00b8, 0x00c6, 0x00d3,
+  0x00e1, 0x00ee, 0x00fc, 0x010a, 0x0117, 0x0125, 0x0133, 0x013f, 0x014d, 0x015a, 0x0169, 0x0176, 0x0183, 0x0191, 0x019e, 0x01ac,
+  0x01b9, 0x01c6, 0x01d4, 0x01e1, 0x01ee, 0x01fb, 0x020a, 0x0216, 0x0224, 0x0231, 0x023d, 0x024c, 0x0258, 0x0266, 0x0273, 0x027f,
+  0x028d, 0x029a, 0x02a6, 0x02b3, 0x02c0, 0x02ce, 0x02dc, 0x02e8, 0x02f4, 0x0302, 0x030f, 0x031c, 0x0327, 0x0334, 0x0341, 0x034d,
+  0x035a, 0x0366, 0x0374, 0x0381, 0x038d, 0x0399, 0x03a6, 0x03b2, 0x03bf, 0x03ca, 0x03d7, 0x03e4, 0x03ef, 0x03fa, 0x0408, 0x0414,
+  0x041f, 0x042d, 0x0439, 0x0445, 0x0451, 0x045d, 0x0469, 0x0472, 0x047e, 0x048b, 0x0498, 0x04a1, 0x04ae, 0x04b8, 0x04c5, 0x04cf,
+  0x04dc, 0x04e7, 0x04f1, 0x04ff, 0x0509, 0x0514, 0x051e, 0x0529, 0x0534, 0x053e, 0x0549, 0x0554, 0x0560, 0x056b, 0x0576, 0x0581,
+  0x0589, 0x0595, 0x05a0, 0x05a8, 0x05b4, 0x05c0, 0x05c8, 0x05d4, 0x05dc, 0x05e8, 0x05f0, 0x05fd, 0x0605, 0x060e, 0x061a, 0x0623,
+  0x062b, 0x0634, 0x0641, 0x0649, 0x0652, 0x065b, 0x0664, 0x066d, 0x0676, 0x067f, 0x0688, 0x0691, 0x069a, 0x06a3, 0x06ac, 0x06b5,
+  0x06bf, 0x06c8, 0x06cd, 0x06d6, 0x06e0, 0x06e9, 0x06f3, 0x06f8, 0x0702, 0x070b, 0x0710, 0x071a, 0x071f, 0x0729, 0x0733, 0x0738,
+  0x0742, 0x0747, 0x0751, 0x0756, 0x075b, 0x0765, 0x076a, 0x0775, 0x077a, 0x077f, 0x078a, 0x078f, 0x0794, 0x079f, 0x07a4, 0x07a9,
+  0x07ae, 0x07b4, 0x07bf, 0x07c4, 0x07c9, 0x07cf, 0x07d4, 0x07da, 0x07df, 0x07e4, 0x07ea, 0x07ef, 0x07f5, 0x07fa, 0x0800, 0x0806,
+  0x080c, 0x0810, 0x0816, 0x081c, 0x0822, 0x0828, 0x082c, 0x082c, 0x0832, 0x0838, 0x083e, 0x083e, 0x0844, 0x084a, 0x0850, 0x0850,
+  0x0854, 0x085a, 0x085a, 0x0860, 0x0866, 0x0866, 0x086c, 0x086c, 0x0872, 0x0878, 0x0878, 0x087e, 0x087e, 0x0884, 0x0884, 0x088a,
+  0x088a, 0x088a, 0x0890, 0x0890, 0x0896, 0x0896, 0x0896, 0x089c, 0x089c, 0x089c, 0x08a2, 0x08a2, 0x08a2, 0x08a8, 0x08a8, 0x08a8,
+  0x08a8, 0x08ae, 0x08ae, 0x08ae, 0x08ae, 0x08ae, 0x08ae, 0x08ae, 0x08b4, 0x08b4, 0x08b4, 0x08b4, 0x08b4, 0x08b4, 0x08b4, 0x08b4,
+  0x0006, 0x0014, 0x0021, 0x002e, 0x003c, 0x0049, 0x0056, 0x0064, 0x0071, 0x007e, 0x008c, 0x0099, 0x00a6, 0x00b4, 0x00c1, 0x00cf,
+  0x00dc, 0x00e9, 0x00f7, 0x0104, 0x0111, 0x011e, 0x012c, 0x0138, 0x0146, 0x0153, 0x0161, 0x016e, 0x017b, 0x0188, 0x0195, 0x01a3,
+  0x01af, 0x01bc, 0x01ca, 0x01d6, 0x01e3, 0x01f1, 0x01fe, 0x020b, 0x0218, 0x0225, 0x0231, 0x023f, 0x024c, 0x0258, 0x0266, 0x0271,
+  0x027f, 0x028b, 0x0298, 0x02a4, 0x02b1, 0x02bf, 0x02cc, 0x02d8, 0x02e4, 0x02f2, 0x02fe, 0x030b, 0x0315, 0x0322, 0x032f, 0x033b,
+  0x0348, 0x0354, 0x0362, 0x036d, 0x0379, 0x0385, 0x0392, 0x039e, 0x03ab, 0x03b5, 0x03c2, 0x03cf, 0x03da, 0x03e4, 0x03f2, 0x03fd,
+  0x0408, 0x0416, 0x0422, 0x042d, 0x0439, 0x0445, 0x0451, 0x045a, 0x0466, 0x0472, 0x047e, 0x0488, 0x0494, 0x049e, 0x04ab, 0x04b5,
+  0x04c2, 0x04cc, 0x04d6, 0x04e3, 0x04ed, 0x04f8, 0x0502, 0x050c, 0x0517, 0x0522, 0x052c, 0x0537, 0x0542, 0x054d, 0x0558, 0x0563,
+  0x056b, 0x0576, 0x0581, 0x0589, 0x0595, 0x05a0, 0x05a8, 0x05b4, 0x05bc, 0x05c8, 0x05d0, 0x05dc, 0x05e4, 0x05ec, 0x05f9, 0x0601,
+  0x0609, 0x0612, 0x061e, 0x0627, 0x0630, 0x0638, 0x0641, 0x0649, 0x0652, 0x065b, 0x0664, 0x066d, 0x0676, 0x067f, 0x0688, 0x0691,
+  0x069a, 0x06a3, 0x06a8, 0x06b1, 0x06ba, 0x06c4, 0x06cd, 0x06d2, 0x06db, 0x06e5, 0x06e9, 0x06f3, 0x06f8, 0x0702, 0x070b, 0x0710,
+  0x071a, 0x071f, 0x0729, 0x072e, 0x0733, 0x073d, 0x0742, 0x074c, 0x0751, 0x0756, 0x0760, 0x0765, 0x076a, 0x0775, 0x077a, 0x077f,
+  0x0784, 0x078a, 0x0794, 0x0799, 0x079f, 0x07a4, 0x07a9, 0x07ae, 0x07b4, 0x07b9, 0x07bf, 0x07c4, 0x07c9, 0x07cf, 0x07d4, 0x07da,
+  0x07df, 0x07e4, 0x07ea, 0x07ef, 0x07f5, 0x07fa, 0x0800, 0x0800, 0x0806, 0x080c, 0x0810, 0x0810, 0x0816, 0x081c, 0x0822, 0x0822,
+  0x0828, 0x082c, 0x082c, 0x0832, 0x0838, 0x0838, 0x083e, 0x083e, 0x0844, 0x084a, 0x084a, 0x0850, 0x0850, 0x0854, 0x0854, 0x085a,
+  0x085a, 0x085a, 0x0860, 0x0860, 0x0866, 0x0866, 0x0866, 0x086c, 0x086c, 0x086c, 0x0872, 0x0872, 0x0872, 0x0878, 0x0878, 0x0878,
+  0x0878, 0x087e, 0x087e, 0x087e, 0x087e, 0x087e, 0x087e, 0x087e, 0x0884, 0x0884, 0x0884, 0x0884, 0x0884, 0x0884, 0x0884, 0x0884,
+  0x0006, 0x0013, 0x0020, 0x002d, 0x003a, 0x0047, 0x0055, 0x0062, 0x006f, 0x007c, 0x0089, 0x0096, 0x00a3, 0x00b0, 0x00bd, 0x00ca,
+  0x00d7, 0x00e4, 0x00f1, 0x00fe, 0x010b, 0x0118, 0x0126, 0x0132, 0x013f, 0x014c, 0x0159, 0x0166, 0x0173, 0x0180, 0x018d, 0x019a,
+  0x01a6, 0x01b3, 0x01c0, 0x01cc, 0x01d9, 0x01e6, 0x01f3, 0x0200, 0x020c, 0x0219, 0x0225, 0x0233, 0x023f, 0x024c, 0x0258, 0x0264,
+  0x0271, 0x027d, 0x028a, 0x0296, 0x02a3, 0x02b0, 0x02bd, 0x02c8, 0x02d4, 0x02e2, 0x02ee, 0x02fa, 0x0304, 0x0311, 0x031e, 0x0329,
+  0x0336, 0x0341, 0x034f, 0x035a, 0x0366, 0x0372, 0x037e, 0x038a, 0x0397, 0x03a1, 0x03ad, 0x03ba, 0x03c5, 0x03cf, 0x03dc, 0x03e7,
+  0x03f2, 0x0400, 0x040b, 0x0416, 0x0422, 0x042d, 0x0439, 0x0442, 0x044e, 0x045a, 0x0466, 0x046f, 0x047b, 0x0485, 0x0491, 0x049b,
+  0x04a8, 0x04b1, 0x04bb, 0x04c8, 0x04d2, 0x04dc, 0x04e7, 0x04f1, 0x04fb, 0x0506, 0x0510, 0x051b, 0x0525, 0x0530, 0x053b, 0x0546,
+  0x054d, 0x0558, 0x0563, 0x056b, 0x0576, 0x0581, 0x0589, 0x0595, 0x059c, 0x05a8, 0x05b0, 0x05bc, 0x05c4, 0x05cc, 0x05d8, 0x05e0,
+  0x05e8, 0x05f0, 0x05fd, 0x0605, 0x060e, 0x0616, 0x061e, 0x0627, 0x0630, 0x0638, 0x0641, 0x0649, 0x0652, 0x065b, 0x0664, 0x066d,
+  0x0676, 0x067f, 0x0683, 0x068c, 0x0695, 0x069e, 0x06a8, 0x06ac, 0x06b5, 0x06bf, 0x06c4, 0x06cd, 0x06d2, 0x06db, 0x06e5, 0x06e9,
+  0x06f3, 0x06f8, 0x0702, 0x0706, 0x070b, 0x0715, 0x071a, 0x0724, 0x0729, 0x072e, 0x0738, 0x073d, 0x0742, 0x074c, 0x0751, 0x0756,
+  0x075b, 0x0760, 0x076a, 0x0770, 0x0775, 0x077a, 0x077f, 0x0784, 0x078a, 0x078f, 0x0794, 0x0799, 0x079f, 0x07a4, 0x07a9, 0x07ae,
+  0x07b4, 0x07b9, 0x07bf, 0x07c4, 0x07c9, 0x07cf, 0x07d4, 0x07d4, 0x07da, 0x07df, 0x07e4, 0x07e4, 0x07ea, 0x07ef, 0x07f5, 0x07f5,
+  0x07fa, 0x0800, 0x0800, 0x0806, 0x080c, 0x080c, 0x0810, 0x0810, 0x0816, 0x081c, 0x081c, 0x0822, 0x0822, 0x0828, 0x0828, 0x082c,
+  0x082c, 0x082c, 0x0832, 0x0832, 0x0838, 0x0838, 0x0838, 0x083e, 0x083e, 0x083e, 0x0844, 0x0844, 0x0844, 0x084a, 0x084a, 0x084a,
+  0x084a, 0x0850, 0x0850, 0x0850, 0x0850, 0x0850, 0x0850, 0x0850, 0x0854, 0x0854, 0x0854, 0x0854, 0x0854, 0x0854, 0x0854, 0x0854,
+  0x0006, 0x0013, 0x0020, 0x002c, 0x0039, 0x0046, 0x0053, 0x0060, 0x006c, 0x0079, 0x0086, 0x0093, 0x009f, 0x00ac, 0x00b9, 0x00c6,
+  0x00d3, 0x00df, 0x00ec, 0x00f9, 0x0105, 0x0112, 0x011f, 0x012b, 0x0138, 0x0145, 0x0152, 0x015e, 0x016b, 0x0178, 0x0184, 0x0191,
+  0x019d, 0x01aa, 0x01b6, 0x01c2, 0x01cf, 0x01dc, 0x01e9, 0x01f5, 0x0201, 0x020e, 0x0219, 0x0227, 0x0233, 0x023f, 0x024c, 0x0257,
+  0x0264, 0x0270, 0x027c, 0x0288, 0x0294, 0x02a1, 0x02ae, 0x02b9, 0x02c4, 0x02d2, 0x02de, 0x02ea, 0x02f4, 0x0300, 0x030d, 0x0318,
+  0x0324, 0x032f, 0x033d, 0x0348, 0x0354, 0x035f, 0x036b, 0x0377, 0x0383, 0x038d, 0x0399, 0x03a6, 0x03b0, 0x03ba, 0x03c7, 0x03d2,
+  0x03dc, 0x03ea, 0x03f5, 0x0400, 0x040b, 0x0416, 0x0422, 0x042a, 0x0436, 0x0442, 0x044e, 0x0457, 0x0463, 0x046c, 0x0478, 0x0482,
+  0x048e, 0x0498, 0x04a1, 0x04ae, 0x04b8, 0x04c2, 0x04cc, 0x04d6, 0x04e0, 0x04ea, 0x04f4, 0x04ff, 0x0509, 0x0514, 0x051e, 0x0529,
+  0x0530, 0x053b, 0x0546, 0x054d, 0x0558, 0x0563, 0x056b, 0x0576, 0x057e, 0x0589, 0x0591, 0x059c, 0x05a4, 0x05ac, 0x05b8, 0x05c0,
+  0x05c8, 0x05d0, 0x05dc, 0x05e4, 0x05ec, 0x05f5, 0x05fd, 0x0605, 0x060e, 0x0616, 0x061e, 0x0627, 0x0630, 0x0638, 0x0641, 0x0649,
+  0x0652, 0x065b, 0x065f, 0x0668, 0x0671, 0x067a, 0x0683, 0x0688, 0x0691, 0x069a, 0x069e, 0x06a8, 0x06ac, 0x06b5, 0x06bf, 0x06c4,
+  0x06cd, 0x06d2, 0x06db, 0x06e0, 0x06e5, 0x06ee, 0x06f3, 0x06fd, 0x0702, 0x0706, 0x0710, 0x0715, 0x071a, 0x0724, 0x0729, 0x072e,
+  0x0733, 0x0738, 0x0742, 0x0747, 0x074c, 0x0751, 0x0756, 0x075b, 0x0760, 0x0765, 0x076a, 0x0770, 0x0775, 0x077a, 0x077f, 0x0784,
+  0x078a, 0x078f, 0x0794, 0x0799, 0x079f, 0x07a4, 0x07a9, 0x07a9, 0x07ae, 0x07b4, 0x07b9, 0x07b9, 0x07bf, 0x07c4, 0x07c9, 0x07c9,
+  0x07cf, 0x07d4, 0x07d4, 0x07da, 0x07df, 0x07df, 0x07e4, 0x07e4, 0x07ea, 0x07ef, 0x07ef, 0x07f5, 0x07f5, 0x07fa, 0x07fa, 0x0800,
+  0x0800, 0x0800, 0x0806, 0x0806, 0x080c, 0x080c, 0x080c, 0x0810, 0x0810, 0x0810, 0x0816, 0x0816, 0x0816, 0x081c, 0x081c, 0x081c,
+  0x081c, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0828, 0x0828, 0x0828, 0x0828, 0x0828, 0x0828, 0x0828, 0x0828,
+  0x0006, 0x0012, 0x001f, 0x002b, 0x0038, 0x0044, 0x0051, 0x005e, 0x006a, 0x0077, 0x0083, 0x0090, 0x009c, 0x00a9, 0x00b5, 0x00c2,
+  0x00ce, 0x00da, 0x00e7, 0x00f3, 0x0100, 0x010c, 0x0119, 0x0125, 0x0132, 0x013e, 0x014b, 0x0157, 0x0163, 0x0170, 0x017c, 0x0188,
+  0x0194, 0x01a0, 0x01ad, 0x01b9, 0x01c5, 0x01d1, 0x01de, 0x01ea, 0x01f6, 0x0203, 0x020e, 0x021b, 0x0227, 0x0233, 0x023f, 0x024a,
+  0x0257, 0x0262, 0x026e, 0x027a, 0x0286, 0x0292, 0x029f, 0x02aa, 0x02b5, 0x02c2, 0x02ce, 0x02da, 0x02e4, 0x02f0, 0x02fc, 0x0307,
+  0x0313, 0x031e, 0x032b, 0x0336, 0x0341, 0x034d, 0x0358, 0x0364, 0x0370, 0x0379, 0x0385, 0x0392, 0x039c, 0x03a6, 0x03b2, 0x03bd,
+  0x03c7, 0x03d4, 0x03df, 0x03ea, 0x03f5, 0x0400, 0x040b, 0x0414, 0x041f, 0x042a, 0x0436, 0x043f, 0x044b, 0x0454, 0x0460, 0x0469,
+  0x0475, 0x047e, 0x0488, 0x0494, 0x049e, 0x04a8, 0x04b1, 0x04bb, 0x04c5, 0x04cf, 0x04d9, 0x04e3, 0x04ed, 0x04f8, 0x0502, 0x050c,
+  0x0514, 0x051e, 0x0529, 0x0530, 0x053b, 0x0546, 0x054d, 0x0558, 0x0560, 0x056b, 0x0572, 0x057e, 0x0585, 0x058d, 0x0599, 0x05a0,
+  0x05a8, 0x05b0, 0x05bc, 0x05c4, 0x05cc, 0x05d4, 0x05dc, 0x05e4, 0x05ec, 0x05f5, 0x05fd, 0x0605, 0x060e, 0x0616, 0x061e, 0x0627,
+  0x0630, 0x0638, 0x063c, 0x0645, 0x064e, 0x0657, 0x065f, 0x0664, 0x066d, 0x0676, 0x067a, 0x0683, 0x0688, 0x0691, 0x069a, 0x069e,
+  0x06a8, 0x06ac, 0x06b5, 0x06ba, 0x06bf, 0x06c8, 0x06cd, 0x06d6, 0x06db, 0x06e0, 0x06e9, 0x06ee, 0x06f3, 0x06fd, 0x0702, 0x0706,
+  0x070b, 0x0710, 0x071a, 0x071f, 0x0724, 0x0729, 0x072e, 0x0733, 0x0738, 0x073d, 0x0742, 0x0747, 0x074c, 0x0751, 0x0756, 0x075b,
+  0x0760, 0x0765, 0x076a, 0x0770, 0x0775, 0x077a, 0x077f, 0x077f, 0x0784, 0x078a, 0x078f, 0x078f, 0x0794, 0x0799, 0x079f, 0x079f,
+  0x07a4, 0x07a9, 0x07a9, 0x07ae, 0x07b4, 0x07b4, 0x07b9, 0x07b9, 0x07bf, 0x07c4, 0x07c4, 0x07c9, 0x07c9, 0x07cf, 0x07cf, 0x07d4,
+  0x07d4, 0x07d4, 0x07da, 0x07da, 0x07df, 0x07df, 0x07df, 0x07e4, 0x07e4, 0x07e4, 0x07ea, 0x07ea, 0x07ea, 0x07ef, 0x07ef, 0x07ef,
+  0x07ef, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07f5, 0x07fa, 0x07fa, 0x07fa, 0x07fa, 0x07fa, 0x07fa, 0x07fa, 0x07fa,
+  0x0006, 0x0012, 0x001e, 0x002a, 0x0037, 0x0043, 0x004f, 0x005c, 0x0068, 0x0074, 0x0080, 0x008d, 0x0099, 0x00a5, 0x00b1, 0x00be,
+  0x00ca, 0x00d6, 0x00e2, 0x00ee, 0x00fa, 0x0107, 0x0113, 0x011e, 0x012b, 0x0137, 0x0144, 0x014f, 0x015b, 0x0168, 0x0174, 0x0180,
+  0x018c, 0x0197, 0x01a4, 0x01af, 0x01bb, 0x01c7, 0x01d4, 0x01df, 0x01eb, 0x01f7, 0x0203, 0x020f, 0x021b, 0x0227, 0x0233, 0x023d,
+  0x024a, 0x0255, 0x0261, 0x026c, 0x0278, 0x0284, 0x0291, 0x029b, 0x02a6, 0x02b3, 0x02bf, 0x02ca, 0x02d4, 0x02e0, 0x02ec, 0x02f6,
+  0x0302, 0x030d, 0x031a, 0x0324, 0x032f, 0x033b, 0x0346, 0x0351, 0x035d, 0x0366, 0x0372, 0x037e, 0x0388, 0x0392, 0x039e, 0x03a8,
+  0x03b2, 0x03bf, 0x03ca, 0x03d4, 0x03df, 0x03ea, 0x03f5, 0x03fd, 0x0408, 0x0414, 0x041f, 0x0428, 0x0433, 0x043c, 0x0448, 0x0451,
+  0x045d, 0x0466, 0x046f, 0x047b, 0x0485, 0x048e, 0x0498, 0x04a1, 0x04ab, 0x04b5, 0x04be, 0x04c8, 0x04d2, 0x04dc, 0x04e7, 0x04f1,
+  0x04f8, 0x0502, 0x050c, 0x0514, 0x051e, 0x0529, 0x0530, 0x053b, 0x0542, 0x054d, 0x0554, 0x0560, 0x0567, 0x056f, 0x057a, 0x0581,
+  0x0589, 0x0591, 0x059c, 0x05a4, 0x05ac, 0x05b4, 0x05bc, 0x05c4, 0x05cc, 0x05d4, 0x05dc, 0x05e4, 0x05ec, 0x05f5, 0x05fd, 0x0605,
+  0x060e, 0x0616, 0x061a, 0x0623, 0x062b, 0x0634, 0x063c, 0x0641, 0x0649, 0x0652, 0x0657, 0x065f, 0x0664, 0x066d, 0x0676, 0x067a,
+  0x0683, 0x0688, 0x0691, 0x0695, 0x069a, 0x06a3, 0x06a8, 0x06b1, 0x06b5, 0x06ba, 0x06c4, 0x06c8, 0x06cd, 0x06d6, 0x06db, 0x06e0,
+  0x06e5, 0x06e9, 0x06f3, 0x06f8, 0x06fd, 0x0702, 0x0706, 0x070b, 0x0710, 0x0715, 0x071a, 0x071f, 0x0724, 0x0729, 0x072e, 0x0733,
+  0x0738, 0x073d, 0x0742, 0x0747, 0x074c, 0x0751, 0x0756, 0x0756, 0x075b, 0x0760, 0x0765, 0x0765, 0x076a, 0x0770, 0x0775, 0x0775,
+  0x077a, 0x077f, 0x077f, 0x0784, 0x078a, 0x078a, 0x078f, 0x078f, 0x0794, 0x0799, 0x0799, 0x079f, 0x079f, 0x07a4, 0x07a4, 0x07a9,
+  0x07a9, 0x07a9, 0x07ae, 0x07ae, 0x07b4, 0x07b4, 0x07b4, 0x07b9, 0x07b9, 0x07b9, 0x07bf, 0x07bf, 0x07bf, 0x07c4, 0x07c4, 0x07c4,
+  0x07c4, 0x07c9, 0x07c9, 0x07c9, 0x07c9, 0x07c9, 0x07c9, 0x07c9, 0x07cf, 0x07cf, 0x07cf, 0x07cf, 0x07cf, 0x07cf, 0x07cf, 0x07cf,
+  0x0006, 0x0012, 0x001d, 0x0029, 0x0035, 0x0041, 0x004e, 0x005a, 0x0065, 0x0071, 0x007d, 0x008a, 0x0095, 0x00a2, 0x00ad, 0x00ba,
+  0x00c6, 0x00d1, 0x00dd, 0x00e9, 0x00f5, 0x0101, 0x010d, 0x0118, 0x0125, 0x0130, 0x013d, 0x0148, 0x0154, 0x0160, 0x016c, 0x0178,
+  0x0183, 0x018f, 0x019b, 0x01a6, 0x01b2, 0x01be, 0x01ca, 0x01d5, 0x01e1, 0x01ed, 0x01f7, 0x0204, 0x020f, 0x021b, 0x0227, 0x0231,
+  0x023d, 0x0248, 0x0254, 0x025f, 0x026b, 0x0276, 0x0283, 0x028d, 0x0298, 0x02a4, 0x02b0, 0x02bb, 0x02c4, 0x02d0, 0x02dc, 0x02e6,
+  0x02f2, 0x02fc, 0x0309, 0x0313, 0x031e, 0x0329, 0x0334, 0x033f, 0x034a, 0x0354, 0x035f, 0x036b, 0x0374, 0x037e, 0x038a, 0x0394,
+  0x039e, 0x03ab, 0x03b5, 0x03bf, 0x03ca, 0x03d4, 0x03df, 0x03e7, 0x03f2, 0x03fd, 0x0408, 0x0411, 0x041c, 0x0425, 0x0430, 0x0439,
+  0x0445, 0x044e, 0x0457, 0x0463, 0x046c, 0x0475, 0x047e, 0x0488, 0x0491, 0x049b, 0x04a4, 0x04ae, 0x04b8, 0x04c2, 0x04cc, 0x04d6,
+  0x04dc, 0x04e7, 0x04f1, 0x04f8, 0x0502, 0x050c, 0x0514, 0x051e, 0x0525, 0x0530, 0x0537, 0x0542, 0x0549, 0x0551, 0x055c, 0x0563,
+  0x056b, 0x0572, 0x057e, 0x0585, 0x058d, 0x0595, 0x059c, 0x05a4, 0x05ac, 0x05b4, 0x05bc, 0x05c4, 0x05cc, 0x05d4, 0x05dc, 0x05e4,
+  0x05ec, 0x05f5, 0x05f9, 0x0601, 0x0609, 0x0612, 0x061a, 0x061e, 0x0627, 0x0630, 0x0634, 0x063c, 0x0641, 0x0649, 0x0652, 0x0657,
+  0x065f, 0x0664, 0x066d, 0x0671, 0x0676, 0x067f, 0x0683, 0x068c, 0x0691, 0x0695, 0x069e, 0x06a3, 0x06a8, 0x06b1, 0x06b5, 0x06ba,
+  0x06bf, 0x06c4, 0x06cd, 0x06d2, 0x06d6, 0x06db, 0x06e0, 0x06e5, 0x06e9, 0x06ee, 0x06f3, 0x06f8, 0x06fd, 0x0702, 0x0706, 0x070b,
+  0x0710, 0x0715, 0x071a, 0x071f, 0x0724, 0x0729, 0x072e, 0x072e, 0x0733, 0x0738, 0x073d, 0x073d, 0x0742, 0x0747, 0x074c, 0x074c,
+  0x0751, 0x0756, 0x0756, 0x075b, 0x0760, 0x0760, 0x0765, 0x0765, 0x076a, 0x0770, 0x0770, 0x0775, 0x0775, 0x077a, 0x077a, 0x077f,
+  0x077f, 0x077f, 0x0784, 0x0784, 0x078a, 0x078a, 0x078a, 0x078f, 0x078f, 0x078f, 0x0794, 0x0794, 0x0794, 0x0799, 0x0799, 0x0799,
+  0x0799, 0x079f, 0x079f, 0x079f, 0x079f, 0x079f, 0x079f, 0x079f, 0x07a4, 0x07a4, 0x07a4, 0x07a4, 0x07a4, 0x07a4, 0x07a4, 0x07a4,
+  0x0005, 0x0011, 0x001d, 0x0029, 0x0034, 0x0040, 0x004c, 0x0058, 0x0063, 0x006f, 0x007b, 0x0087, 0x0092, 0x009e, 0x00aa, 0x00b6,
+  0x00c1, 0x00cd, 0x00d9, 0x00e4, 0x00ef, 0x00fb, 0x0107, 0x0112, 0x011e, 0x012a, 0x0136, 0x0141, 0x014d, 0x0158, 0x0164, 0x0170,
+  0x017b, 0x0186, 0x0192, 0x019d, 0x01a8, 0x01b4, 0x01c0, 0x01cb, 0x01d6, 0x01e2, 0x01ed, 0x01f9, 0x0204, 0x020f, 0x021b, 0x0225,
+  0x0231, 0x023c, 0x0247, 0x0252, 0x025d, 0x0269, 0x0275, 0x027f, 0x028a, 0x0296, 0x02a1, 0x02ac, 0x02b5, 0x02c0, 0x02cc, 0x02d6,
+  0x02e2, 0x02ec, 0x02f8, 0x0302, 0x030d, 0x0318, 0x0322, 0x032d, 0x0338, 0x0341, 0x034d, 0x0358, 0x0362, 0x036b, 0x0377, 0x0381,
+  0x038a, 0x0397, 0x03a1, 0x03ab, 0x03b5, 0x03bf, 0x03ca, 0x03d2, 0x03dc, 0x03e7, 0x03f2, 0x03fa, 0x0406, 0x040e, 0x0419, 0x0422,
+  0x042d, 0x0436, 0x043f, 0x044b, 0x0454, 0x045d, 0x0466, 0x046f, 0x0478, 0x0482, 0x048b, 0x0494, 0x049e, 0x04a8, 0x04b1, 0x04bb,
+  0x04c2, 0x04cc, 0x04d6, 0x04dc, 0x04e7, 0x04f1, 0x04f8, 0x0502, 0x0509, 0x0514, 0x051b, 0x0525, 0x052c, 0x0534, 0x053e, 0x0546,
+  0x054d, 0x0554, 0x0560, 0x0567, 0x056f, 0x0576, 0x057e, 0x0585, 0x058d, 0x0595, 0x059c, 0x05a4, 0x05ac, 0x05b4, 0x05bc, 0x05c4,
+  0x05cc, 0x05d4, 0x05d8, 0x05e0, 0x05e8, 0x05f0, 0x05f9, 0x05fd, 0x0605, 0x060e, 0x0612, 0x061a, 0x061e, 0x0627, 0x0630, 0x0634,
+  0x063c, 0x0641, 0x0649, 0x064e, 0x0652, 0x065b, 0x065f, 0x0668, 0x066d, 0x0671, 0x067a, 0x067f, 0x0683, 0x068c, 0x0691, 0x0695,
+  0x069a, 0x069e, 0x06a8, 0x06ac, 0x06b1, 0x06b5, 0x06ba, 0x06bf, 0x06c4, 0x06c8, 0x06cd, 0x06d2, 0x06d6, 0x06db, 0x06e0, 0x06e5,
+  0x06e9, 0x06ee, 0x06f3, 0x06f8, 0x06fd, 0x0702, 0x0706, 0x0706, 0x070b, 0x0710, 0x0715, 0x0715, 0x071a, 0x071f, 0x0724, 0x0724,
+  0x0729, 0x072e, 0x072e, 0x0733, 0x0738, 0x0738, 0x073d, 0x073d, 0x0742, 0x0747, 0x0747, 0x074c, 0x074c, 0x0751, 0x0751, 0x0756,
+  0x0756, 0x0756, 0x075b, 0x075b, 0x0760, 0x0760, 0x0760, 0x0765, 0x0765, 0x0765, 0x076a, 0x076a, 0x076a, 0x0770, 0x0770, 0x0770,
+  0x0770, 0x0775, 0x0775, 0x0775, 0x0775, 0x0775, 0x0775, 0x0775, 0x077a, 0x077a, 0x077a, 0x077a, 0x077a, 0x077a, 0x077a, 0x077a,
+  0x0005, 0x0011, 0x001c, 0x0028, 0x0033, 0x003f, 0x004a, 0x0056, 0x0061, 0x006d, 0x0078, 0x0084, 0x008f, 0x009b, 0x00a6, 0x00b2,
+  0x00bd, 0x00c8, 0x00d4, 0x00df, 0x00ea, 0x00f6, 0x0102, 0x010c, 0x0118, 0x0123, 0x012f, 0x013a, 0x0145, 0x0151, 0x015c, 0x0168,
+  0x0173, 0x017e, 0x0189, 0x0194, 0x019f, 0x01ab, 0x01b6, 0x01c1, 0x01cc, 0x01d8, 0x01e2, 0x01ee, 0x01f9, 0x0204, 0x020f, 0x0219,
+  0x0225, 0x0230, 0x023a, 0x0245, 0x0250, 0x025c, 0x0267, 0x0271, 0x027c, 0x0288, 0x0292, 0x029d, 0x02a6, 0x02b1, 0x02bd, 0x02c6,
+  0x02d2, 0x02dc, 0x02e8, 0x02f2, 0x02fc, 0x0307, 0x0311, 0x031c, 0x0327, 0x032f, 0x033b, 0x0346, 0x034f, 0x0358, 0x0364, 0x036d,
+  0x0377, 0x0383, 0x038d, 0x0397, 0x03a1, 0x03ab, 0x03b5, 0x03bd, 0x03c7, 0x03d2, 0x03dc, 0x03e4, 0x03ef, 0x03f7, 0x0403, 0x040b,
+  0x0416, 0x041f, 0x0428, 0x0433, 0x043c, 0x0445, 0x044e, 0x0457, 0x0460, 0x0469, 0x0472, 0x047b, 0x0485, 0x048e, 0x0498, 0x04a1,
+  0x04a8, 0x04b1, 0x04bb, 0x04c2, 0x04cc, 0x04d6, 0x04dc, 0x04e7, 0x04ed, 0x04f8, 0x04ff, 0x0509, 0x0510, 0x0517, 0x0522, 0x0529,
+  0x0530, 0x0537, 0x0542, 0x0549, 0x0551, 0x0558, 0x0560, 0x0567, 0x056f, 0x0576, 0x057e, 0x0585, 0x058d, 0x0595, 0x059c, 0x05a4,
+  0x05ac, 0x05b4, 0x05b8, 0x05c0, 0x05c8, 0x05d0, 0x05d8, 0x05dc, 0x05e4, 0x05ec, 0x05f0, 0x05f9, 0x05fd, 0x0605, 0x060e, 0x0612,
+  0x061a, 0x061e, 0x0627, 0x062b, 0x0630, 0x0638, 0x063c, 0x0645, 0x0649, 0x064e, 0x0657, 0x065b, 0x065f, 0x0668, 0x066d, 0x0671,
+  0x0676, 0x067a, 0x0683, 0x0688, 0x068c, 0x0691, 0x0695, 0x069a, 0x069e, 0x06a3, 0x06a8, 0x06ac, 0x06b1, 0x06b5, 0x06ba, 0x06bf,
+  0x06c4, 0x06c8, 0x06cd, 0x06d2, 0x06d6, 0x06db, 0x06e0, 0x06e0, 0x06e5, 0x06e9, 0x06ee, 0x06ee, 0x06f3, 0x06f8, 0x06fd, 0x06fd,
+  0x0702, 0x0706, 0x0706, 0x070b, 0x0710, 0x0710, 0x0715, 0x0715, 0x071a, 0x071f, 0x071f, 0x0724, 0x0724, 0x0729, 0x0729, 0x072e,
+  0x072e, 0x072e, 0x0733, 0x0733, 0x0738, 0x0738, 0x0738, 0x073d, 0x073d, 0x073d, 0x0742, 0x0742, 0x0742, 0x0747, 0x0747, 0x0747,
+  0x0747, 0x074c, 0x074c, 0x074c, 0x074c, 0x074c, 0x074c, 0x074c, 0x0751, 0x0751, 0x0751, 0x0751, 0x0751, 0x0751, 0x0751, 0x0751,
+  0x0005, 0x0010, 0x001c, 0x0027, 0x0032, 0x003d, 0x0049, 0x0054, 0x005f, 0x006a, 0x0076, 0x0081, 0x008c, 0x0097, 0x00a2, 0x00ae,
+  0x00b9, 0x00c4, 0x00cf, 0x00da, 0x00e5, 0x00f1, 0x00fc, 0x0107, 0x0112, 0x011d, 0x0129, 0x0133, 0x013e, 0x014a, 0x0155, 0x0160,
+  0x016b, 0x0176, 0x0181, 0x018c, 0x0196, 0x01a2, 0x01ad, 0x01b8, 0x01c2, 0x01ce, 0x01d8, 0x01e3, 0x01ee, 0x01f9, 0x0204, 0x020e,
+  0x0219, 0x0224, 0x022e, 0x0239, 0x0244, 0x024f, 0x025a, 0x0264, 0x026e, 0x027a, 0x0284, 0x028f, 0x0298, 0x02a3, 0x02ae, 0x02b7,
+  0x02c2, 0x02cc, 0x02d8, 0x02e2, 0x02ec, 0x02f6, 0x0300, 0x030b, 0x0315, 0x031e, 0x0329, 0x0334, 0x033d, 0x0346, 0x0351, 0x035a,
+  0x0364, 0x0370, 0x0379, 0x0383, 0x038d, 0x0397, 0x03a1, 0x03a8, 0x03b2, 0x03bd, 0x03c7, 0x03cf, 0x03da, 0x03e2, 0x03ed, 0x03f5,
+  0x0400, 0x0408, 0x0411, 0x041c, 0x0425, 0x042d, 0x0436, 0x043f, 0x0448, 0x0451, 0x045a, 0x0463, 0x046c, 0x0475, 0x047e, 0x0488,
+  0x048e, 0x0498, 0x04a1, 0x04a8, 0x04b1, 0x04bb, 0x04c2, 0x04cc, 0x04d2, 0x04dc, 0x04e3, 0x04ed, 0x04f4, 0x04fb, 0x0506, 0x050c,
+  0x0514, 0x051b, 0x0525, 0x052c, 0x0534, 0x053b, 0x0542, 0x0549, 0x0551, 0x0558, 0x0560, 0x0567, 0x056f, 0x0576, 0x057e, 0x0585,
+  0x058d, 0x0595, 0x0599, 0x05a0, 0x05a8, 0x05b0, 0x05b8, 0x05bc, 0x05c4, 0x05cc, 0x05d0, 0x05d8, 0x05dc, 0x05e4, 0x05ec, 0x05f0,
+  0x05f9, 0x05fd, 0x0605, 0x0609, 0x060e, 0x0616, 0x061a, 0x0623, 0x0627, 0x062b, 0x0634, 0x0638, 0x063c, 0x0645, 0x0649, 0x064e,
+  0x0652, 0x0657, 0x065f, 0x0664, 0x0668, 0x066d, 0x0671, 0x0676, 0x067a, 0x067f, 0x0683, 0x0688, 0x068c, 0x0691, 0x0695, 0x069a,
+  0x069e, 0x06a3, 0x06a8, 0x06ac, 0x06b1, 0x06b5, 0x06ba, 0x06ba, 0x06bf, 0x06c4, 0x06c8, 0x06c8, 0x06cd, 0x06d2, 0x06d6, 0x06d6,
+  0x06db, 0x06e0, 0x06e0, 0x06e5, 0x06e9, 0x06e9, 0x06ee, 0x06ee, 0x06f3, 0x06f8, 0x06f8, 0x06fd, 0x06fd, 0x0702, 0x0702, 0x0706,
+  0x0706, 0x0706, 0x070b, 0x070b, 0x0710, 0x0710, 0x0710, 0x0715, 0x0715, 0x0715, 0x071a, 0x071a, 0x071a, 0x071f, 0x071f, 0x071f,
+  0x071f, 0x0724, 0x0724, 0x0724, 0x0724, 0x0724, 0x0724, 0x0724, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729, 0x0729,
+  0x0005, 0x0010, 0x001b, 0x0026, 0x0031, 0x003c, 0x0047, 0x0052, 0x005d, 0x0068, 0x0073, 0x007e, 0x0089, 0x0094, 0x009f, 0x00aa,
+  0x00b5, 0x00c0, 0x00cb, 0x00d6, 0x00e0, 0x00ec, 0x00f7, 0x0101, 0x010c, 0x0117, 0x0122, 0x012d, 0x0138, 0x0143, 0x014d, 0x0158,
+  0x0163, 0x016e, 0x0179, 0x0183, 0x018e, 0x0199, 0x01a4, 0x01ae, 0x01b9, 0x01c4, 0x01ce, 0x01d9, 0x01e3, 0x01ee, 0x01f9, 0x0203,
+  0x020e, 0x0218, 0x0222, 0x022d, 0x0237, 0x0242, 0x024d, 0x0257, 0x0261, 0x026c, 0x0276, 0x0281, 0x028a, 0x0294, 0x029f, 0x02a8,
+  0x02b3, 0x02bd, 0x02c8, 0x02d2, 0x02dc, 0x02e6, 0x02f0, 0x02fa, 0x0304, 0x030d, 0x0318, 0x0322, 0x032b, 0x0334, 0x033f, 0x0348,
+  0x0351, 0x035d, 0x0366, 0x0370, 0x0379, 0x0383, 0x038d, 0x0394, 0x039e, 0x03a8, 0x03b2, 0x03ba, 0x03c5, 0x03cc, 0x03d7, 0x03df,
+  0x03ea, 0x03f2, 0x03fa, 0x0406, 0x040e, 0x0416, 0x041f, 0x0428, 0x0430, 0x0439, 0x0442, 0x044b, 0x0454, 0x045d, 0x0466, 0x046f,
+  0x0475, 0x047e, 0x0488, 0x048e, 0x0498, 0x04a1, 0x04a8, 0x04b1, 0x04b8, 0x04c2, 0x04c8, 0x04d2, 0x04d9, 0x04e0, 0x04ea, 0x04f1,
+  0x04f8, 0x04ff, 0x0509, 0x0510, 0x0517, 0x051e, 0x0525, 0x052c, 0x0534, 0x053b, 0x0542, 0x0549, 0x0551, 0x0558, 0x0560, 0x0567,
+  0x056f, 0x0576, 0x057a, 0x0581, 0x0589, 0x0591, 0x0599, 0x059c, 0x05a4, 0x05ac, 0x05b0, 0x05b8, 0x05bc, 0x05c4, 0x05cc, 0x05d0,
+  0x05d8, 0x05dc, 0x05e4, 0x05e8, 0x05ec, 0x05f5, 0x05f9, 0x0601, 0x0605, 0x0609, 0x0612, 0x0616, 0x061a, 0x0623, 0x0627, 0x062b,
+  0x0630, 0x0634, 0x063c, 0x0641, 0x0645, 0x0649, 0x064e, 0x0652, 0x0657, 0x065b, 0x065f, 0x0664, 0x0668, 0x066d, 0x0671, 0x0676,
+  0x067a, 0x067f, 0x0683, 0x0688, 0x068c, 0x0691, 0x0695, 0x0695, 0x069a, 0x069e, 0x06a3, 0x06a3, 0x06a8, 0x06ac, 0x06b1, 0x06b1,
+  0x06b5, 0x06ba, 0x06ba, 0x06bf, 0x06c4, 0x06c4, 0x06c8, 0x06c8, 0x06cd, 0x06d2, 0x06d2, 0x06d6, 0x06d6, 0x06db, 0x06db, 0x06e0,
+  0x06e0, 0x06e0, 0x06e5, 0x06e5, 0x06e9, 0x06e9, 0x06e9, 0x06ee, 0x06ee, 0x06ee, 0x06f3, 0x06f3, 0x06f3, 0x06f8, 0x06f8, 0x06f8,
+  0x06f8, 0x06fd, 0x06fd, 0x06fd, 0x06fd, 0x06fd, 0x06fd, 0x06fd, 0x0702, 0x0702, 0x0702, 0x0702, 0x0702, 0x0702, 0x0702, 0x0702,
+  0x0005, 0x0010, 0x001a, 0x0025, 0x0030, 0x003b, 0x0046, 0x0050, 0x005b, 0x0066, 0x0071, 0x007b, 0x0086, 0x0091, 0x009c, 0x00a6,
+  0x00b1, 0x00bc, 0x00c7, 0x00d1, 0x00dc, 0x00e7, 0x00f1, 0x00fb, 0x0107, 0x0111, 0x011c, 0x0126, 0x0131, 0x013c, 0x0146, 0x0151,
+  0x015b, 0x0166, 0x0171, 0x017b, 0x0185, 0x0190, 0x019b, 0x01a5, 0x01af, 0x01ba, 0x01c4, 0x01cf, 0x01d9, 0x01e3, 0x01ee, 0x01f7,
+  0x0203, 0x020c, 0x0216, 0x0221, 0x022b, 0x0236, 0x0241, 0x024a, 0x0254, 0x025f, 0x0269, 0x0273, 0x027c, 0x0286, 0x0291, 0x029a,
+  0x02a4, 0x02ae, 0x02b9, 0x02c2, 0x02cc, 0x02d6, 0x02e0, 0x02ea, 0x02f4, 0x02fc, 0x0307, 0x0311, 0x031a, 0x0322, 0x032d, 0x0336,
+  0x033f, 0x034a, 0x0354, 0x035d, 0x0366, 0x0370, 0x0379, 0x0381, 0x038a, 0x0394, 0x039e, 0x03a6, 0x03b0, 0x03b8, 0x03c2, 0x03ca,
+  0x03d4, 0x03dc, 0x03e4, 0x03ef, 0x03f7, 0x0400, 0x0408, 0x0411, 0x0419, 0x0422, 0x042a, 0x0433, 0x043c, 0x0445, 0x044e, 0x0457,
+  0x045d, 0x0466, 0x046f, 0x0475, 0x047e, 0x0488, 0x048e, 0x0498, 0x049e, 0x04a8, 0x04ae, 0x04b8, 0x04be, 0x04c5, 0x04cf, 0x04d6,
+  0x04dc, 0x04e3, 0x04ed, 0x04f4, 0x04fb, 0x0502, 0x0509, 0x0510, 0x0517, 0x051e, 0x0525, 0x052c, 0x0534, 0x053b, 0x0542, 0x0549,
+  0x0551, 0x0558, 0x055c, 0x0563, 0x056b, 0x0572, 0x057a, 0x057e, 0x0585, 0x058d, 0x0591, 0x0599, 0x059c, 0x05a4, 0x05ac, 0x05b0,
+  0x05b8, 0x05bc, 0x05c4, 0x05c8, 0x05cc, 0x05d4, 0x05d8, 0x05e0, 0x05e4, 0x05e8, 0x05f0, 0x05f5, 0x05f9, 0x0601, 0x0605, 0x0609,
+  0x060e, 0x0612, 0x061a, 0x061e, 0x0623, 0x0627, 0x062b, 0x0630, 0x0634, 0x0638, 0x063c, 0x0641, 0x0645, 0x0649, 0x064e, 0x0652,
+  0x0657, 0x065b, 0x065f, 0x0664, 0x0668, 0x066d, 0x0671, 0x0671, 0x0676, 0x067a, 0x067f, 0x067f, 0x0683, 0x0688, 0x068c, 0x068c,
+  0x0691, 0x0695, 0x0695, 0x069a, 0x069e, 0x069e, 0x06a3, 0x06a3, 0x06a8, 0x06ac, 0x06ac, 0x06b1, 0x06b1, 0x06b5, 0x06b5, 0x06ba,
+  0x06ba, 0x06ba, 0x06bf, 0x06bf, 0x06c4, 0x06c4, 0x06c4, 0x06c8, 0x06c8, 0x06c8, 0x06cd, 0x06cd, 0x06cd, 0x06d2, 0x06d2, 0x06d2,
+  0x06d2, 0x06d6, 0x06d6, 0x06d6, 0x06d6, 0x06d6, 0x06d6, 0x06d6, 0x06db, 0x06db, 0x06db, 0x06db, 0x06db, 0x06db, 0x06db, 0x06db,
+  0x0005, 0x000f, 0x001a, 0x0024, 0x002f, 0x0039, 0x0044, 0x004f, 0x0059, 0x0064, 0x006e, 0x0079, 0x0083, 0x008e, 0x0098, 0x00a3,
+  0x00ad, 0x00b8, 0x00c2, 0x00cd, 0x00d7, 0x00e2, 0x00ec, 0x00f6, 0x0101, 0x010b, 0x0116, 0x0120, 0x012a, 0x0135, 0x013f, 0x014a,
+  0x0154, 0x015e, 0x0169, 0x0173, 0x017d, 0x0187, 0x0192, 0x019c, 0x01a6, 0x01b1, 0x01ba, 0x01c5, 0x01cf, 0x01d9, 0x01e3, 0x01ed,
+  0x01f7, 0x0201, 0x020b, 0x0215, 0x021f, 0x022a, 0x0234, 0x023d, 0x0247, 0x0252, 0x025c, 0x0266, 0x026e, 0x0278, 0x0283, 0x028b,
+  0x0296, 0x029f, 0x02aa, 0x02b3, 0x02bd, 0x02c6, 0x02d0, 0x02da, 0x02e4, 0x02ec, 0x02f6, 0x0300, 0x0309, 0x0311, 0x031c, 0x0324,
+  0x032d, 0x0338, 0x0341, 0x034a, 0x0354, 0x035d, 0x0366, 0x036d, 0x0377, 0x0381, 0x038a, 0x0392, 0x039c, 0x03a3, 0x03ad, 0x03b5,
+  0x03bf, 0x03c7, 0x03cf, 0x03da, 0x03e2, 0x03ea, 0x03f2, 0x03fa, 0x0403, 0x040b, 0x0414, 0x041c, 0x0425, 0x042d, 0x0436, 0x043f,
+  0x0445, 0x044e, 0x0457, 0x045d, 0x0466, 0x046f, 0x0475, 0x047e, 0x0485, 0x048e, 0x0494, 0x049e, 0x04a4, 0x04ab, 0x04b5, 0x04bb,
+  0x04c2, 0x04c8, 0x04d2, 0x04d9, 0x04e0, 0x04e7, 0x04ed, 0x04f4, 0x04fb, 0x0502, 0x0509, 0x0510, 0x0517, 0x051e, 0x0525, 0x052c,
+  0x0534, 0x053b, 0x053e, 0x0546, 0x054d, 0x0554, 0x055c, 0x0560, 0x0567, 0x056f, 0x0572, 0x057a, 0x057e, 0x0585, 0x058d, 0x0591,
+  0x0599, 0x059c, 0x05a4, 0x05a8, 0x05ac, 0x05b4, 0x05b8, 0x05c0, 0x05c4, 0x05c8, 0x05d0, 0x05d4, 0x05d8, 0x05e0, 0x05e4, 0x05e8,
+  0x05ec, 0x05f0, 0x05f9, 0x05fd, 0x0601, 0x0605, 0x0609, 0x060e, 0x0612, 0x0616, 0x061a, 0x061e, 0x0623, 0x0627, 0x062b, 0x0630,
+  0x0634, 0x0638, 0x063c, 0x0641, 0x0645, 0x0649, 0x064e, 0x064e, 0x0652, 0x0657, 0x065b, 0x065b, 0x065f, 0x0664, 0x0668, 0x0668,
+  0x066d, 0x0671, 0x0671, 0x0676, 0x067a, 0x067a, 0x067f, 0x067f, 0x0683, 0x0688, 0x0688, 0x068c, 0x068c, 0x0691, 0x0691, 0x0695,
+  0x0695, 0x0695, 0x069a, 0x069a, 0x069e, 0x069e, 0x069e, 0x06a3, 0x06a3, 0x06a3, 0x06a8, 0x06a8, 0x06a8, 0x06ac, 0x06ac, 0x06ac,
+  0x06ac, 0x06b1, 0x06b1, 0x06b1, 0x06b1, 0x06b1, 0x06b1, 0x06b1, 0x06b5, 0x06b5, 0x06b5, 0x06b5, 0x06b5, 0x06b5, 0x06b5, 0x06b5,
+  0x0005, 0x000f, 0x0019, 0x0024, 0x002e, 0x0038, 0x0043, 0x004d, 0x0057, 0x0061, 0x006c, 0x0076, 0x0080, 0x008b, 0x0095, 0x009f,
+  0x00aa, 0x00b4, 0x00be, 0x00c8, 0x00d2, 0x00dd, 0x00e7, 0x00f1, 0x00fb, 0x0105, 0x0110, 0x011a, 0x0124, 0x012e, 0x0138, 0x0143,
+  0x014d, 0x0157, 0x0161, 0x016b, 0x0175, 0x017f, 0x0189, 0x0193, 0x019d, 0x01a7, 0x01b1, 0x01bb, 0x01c5, 0x01cf, 0x01d9, 0x01e2,
+  0x01ed, 0x01f6, 0x0200, 0x020a, 0x0214, 0x021e, 0x0228, 0x0231, 0x023a, 0x0245, 0x024f, 0x0258, 0x0261, 0x026b, 0x0275, 0x027d,
+  0x0288, 0x0291, 0x029b, 0x02a4, 0x02ae, 0x02b7, 0x02c0, 0x02ca, 0x02d4, 0x02dc, 0x02e6, 0x02f0, 0x02f8, 0x0300, 0x030b, 0x0313,
+  0x031c, 0x0327, 0x032f, 0x0338, 0x0341, 0x034a, 0x0354, 0x035a, 0x0364, 0x036d, 0x0377, 0x037e, 0x0388, 0x038f, 0x0399, 0x03a1,
+  0x03ab, 0x03b2, 0x03ba, 0x03c5, 0x03cc, 0x03d4, 0x03dc, 0x03e4, 0x03ed, 0x03f5, 0x03fd, 0x0406, 0x040e, 0x0416, 0x041f, 0x0428,
+  0x042d, 0x0436, 0x043f, 0x0445, 0x044e, 0x0457, 0x045d, 0x0466, 0x046c, 0x0475, 0x047b, 0x0485, 0x048b, 0x0491, 0x049b, 0x04a1,
+  0x04a8, 0x04ae, 0x04b8, 0x04be, 0x04c5, 0x04cc, 0x04d2, 0x04d9, 0x04e0, 0x04e7, 0x04ed, 0x04f4, 0x04fb, 0x0502, 0x0509, 0x0510,
+  0x0517, 0x051e, 0x0522, 0x0529, 0x0530, 0x0537, 0x053e, 0x0542, 0x0549, 0x0551, 0x0554, 0x055c, 0x0560, 0x0567, 0x056f, 0x0572,
+  0x057a, 0x057e, 0x0585, 0x0589, 0x058d, 0x0595, 0x0599, 0x05a0, 0x05a4, 0x05a8, 0x05b0, 0x05b4, 0x05b8, 0x05c0, 0x05c4, 0x05c8,
+  0x05cc, 0x05d0, 0x05d8, 0x05dc, 0x05e0, 0x05e4, 0x05e8, 0x05ec, 0x05f0, 0x05f5, 0x05f9, 0x05fd, 0x0601, 0x0605, 0x0609, 0x060e,
+  0x0612, 0x0616, 0x061a, 0x061e, 0x0623, 0x0627, 0x062b, 0x062b, 0x0630, 0x0634, 0x0638, 0x0638, 0x063c, 0x0641, 0x0645, 0x0645,
+  0x0649, 0x064e, 0x064e, 0x0652, 0x0657, 0x0657, 0x065b, 0x065b, 0x065f, 0x0664, 0x0664, 0x0668, 0x0668, 0x066d, 0x066d, 0x0671,
+  0x0671, 0x0671, 0x0676, 0x0676, 0x067a, 0x067a, 0x067a, 0x067f, 0x067f, 0x067f, 0x0683, 0x0683, 0x0683, 0x0688, 0x0688, 0x0688,
+  0x0688, 0x068c, 0x068c, 0x068c, 0x068c, 0x068c, 0x068c, 0x068c, 0x0691, 0x0691, 0x0691, 0x0691, 0x0691, 0x0691, 0x0691, 0x0691,
+  0x0005, 0x000f, 0x0019, 0x0023, 0x002d, 0x0037, 0x0041, 0x004b, 0x0055, 0x005f, 0x0069, 0x0074, 0x007d, 0x0088, 0x0092, 0x009c,
+  0x00a6, 0x00b0, 0x00ba, 0x00c4, 0x00ce, 0x00d8, 0x00e2, 0x00ec, 0x00f6, 0x0100, 0x010a, 0x0114, 0x011e, 0x0128, 0x0132, 0x013c,
+  0x0145, 0x014f, 0x0159, 0x0163, 0x016d, 0x0177, 0x0181, 0x018a, 0x0194, 0x019e, 0x01a7, 0x01b2, 0x01bb, 0x01c5, 0x01cf, 0x01d8,
+  0x01e2, 0x01eb, 0x01f5, 0x01fe, 0x0208, 0x0212, 0x021c, 0x0225, 0x022e, 0x0239, 0x0242, 0x024c, 0x0254, 0x025d, 0x0267, 0x0270,
+  0x027a, 0x0283, 0x028d, 0x0296, 0x029f, 0x02a8, 0x02b1, 0x02bb, 0x02c4, 0x02cc, 0x02d6, 0x02e0, 0x02e8, 0x02f0, 0x02fa, 0x0302,
+  0x030b, 0x0315, 0x031e, 0x0327, 0x032f, 0x0338, 0x0341, 0x0348, 0x0351, 0x035a, 0x0364, 0x036b, 0x0374, 0x037c, 0x0385, 0x038d,
+  0x0397, 0x039e, 0x03a6, 0x03b0, 0x03b8, 0x03bf, 0x03c7, 0x03cf, 0x03d7, 0x03df, 0x03e7, 0x03ef, 0x03f7, 0x0400, 0x0408, 0x0411,
+  0x0416, 0x041f, 0x0428, 0x042d, 0x0436, 0x043f, 0x0445, 0x044e, 0x0454, 0x045d, 0x0463, 0x046c, 0x0472, 0x0478, 0x0482, 0x0488,
+  0x048e, 0x0494, 0x049e, 0x04a4, 0x04ab, 0x04b1, 0x04b8, 0x04be, 0x04c5, 0x04cc, 0x04d2, 0x04d9, 0x04e0, 0x04e7, 0x04ed, 0x04f4,
+  0x04fb, 0x0502, 0x0506, 0x050c, 0x0514, 0x051b, 0x0522, 0x0525, 0x052c, 0x0534, 0x0537, 0x053e, 0x0542, 0x0549, 0x0551, 0x0554,
+  0x055c, 0x0560, 0x0567, 0x056b, 0x056f, 0x0576, 0x057a, 0x0581, 0x0585, 0x0589, 0x0591, 0x0595, 0x0599, 0x05a0, 0x05a4, 0x05a8,
+  0x05ac, 0x05b0, 0x05b8, 0x05bc, 0x05c0, 0x05c4, 0x05c8, 0x05cc, 0x05d0, 0x05d4, 0x05d8, 0x05dc, 0x05e0, 0x05e4, 0x05e8, 0x05ec,
+  0x05f0, 0x05f5, 0x05f9, 0x05fd, 0x0601, 0x0605, 0x0609, 0x0609, 0x060e, 0x0612, 0x0616, 0x0616, 0x061a, 0x061e, 0x0623, 0x0623,
+  0x0627, 0x062b, 0x062b, 0x0630, 0x0634, 0x0634, 0x0638, 0x0638, 0x063c, 0x0641, 0x0641, 0x0645, 0x0645, 0x0649, 0x0649, 0x064e,
+  0x064e, 0x064e, 0x0652, 0x0652, 0x0657, 0x0657, 0x0657, 0x065b, 0x065b, 0x065b, 0x065f, 0x065f, 0x065f, 0x0664, 0x0664, 0x0664,
+  0x0664, 0x0668, 0x0668, 0x0668, 0x0668, 0x0668, 0x0668, 0x0668, 0x066d, 0x066d, 0x066d, 0x066d, 0x066d, 0x066d, 0x066d, 0x066d,
+  0x0004, 0x000e, 0x0018, 0x0022, 0x002c, 0x0036, 0x0040, 0x004a, 0x0053, 0x005d, 0x0067, 0x0071, 0x007b, 0x0085, 0x008f, 0x0099,
+  0x00a2, 0x00ac, 0x00b6, 0x00c0, 0x00c9, 0x00d3, 0x00dd, 0x00e7, 0x00f1, 0x00fa, 0x0105, 0x010e, 0x0118, 0x0122, 0x012b, 0x0135,
+  0x013e, 0x0148, 0x0152, 0x015b, 0x0165, 0x016f, 0x0179, 0x0182, 0x018c, 0x0195, 0x019e, 0x01a8, 0x01b2, 0x01bb, 0x01c5, 0x01ce,
+  0x01d8, 0x01e1, 0x01ea, 0x01f3, 0x01fd, 0x0207, 0x0211, 0x0219, 0x0222, 0x022d, 0x0236, 0x023f, 0x0247, 0x0250, 0x025a, 0x0262,
+  0x026c, 0x0275, 0x027f, 0x0288, 0x0291, 0x029a, 0x02a3, 0x02ac, 0x02b5, 0x02bd, 0x02c6, 0x02d0, 0x02d8, 0x02e0, 0x02ea, 0x02f2,
+  0x02fa, 0x0304, 0x030d, 0x0315, 0x031e, 0x0327, 0x032f, 0x0336, 0x033f, 0x0348, 0x0351, 0x0358, 0x0362, 0x0369, 0x0372, 0x0379,
+  0x0383, 0x038a, 0x0392, 0x039c, 0x03a3, 0x03ab, 0x03b2, 0x03ba, 0x03c2, 0x03ca, 0x03d2, 0x03da, 0x03e2, 0x03ea, 0x03f2, 0x03fa,
+  0x0400, 0x0408, 0x0411, 0x0416, 0x041f, 0x0428, 0x042d, 0x0436, 0x043c, 0x0445, 0x044b, 0x0454, 0x045a, 0x0460, 0x0469, 0x046f,
+  0x0475, 0x047b, 0x0485, 0x048b, 0x0491, 0x0498, 0x049e, 0x04a4, 0x04ab, 0x04b1, 0x04b8, 0x04be, 0x04c5, 0x04cc, 0x04d2, 0x04d9,
+  0x04e0, 0x04e7, 0x04ea, 0x04f1, 0x04f8, 0x04ff, 0x0506, 0x0509, 0x0510, 0x0517, 0x051b, 0x0522, 0x0525, 0x052c, 0x0534, 0x0537,
+  0x053e, 0x0542, 0x0549, 0x054d, 0x0551, 0x0558, 0x055c, 0x0563, 0x0567, 0x056b, 0x0572, 0x0576, 0x057a, 0x0581, 0x0585, 0x0589,
+  0x058d, 0x0591, 0x0599, 0x059c, 0x05a0, 0x05a4, 0x05a8, 0x05ac, 0x05b0, 0x05b4, 0x05b8, 0x05bc, 0x05c0, 0x05c4, 0x05c8, 0x05cc,
+  0x05d0, 0x05d4, 0x05d8, 0x05dc, 0x05e0, 0x05e4, 0x05e8, 0x05e8, 0x05ec, 0x05f0, 0x05f5, 0x05f5, 0x05f9, 0x05fd, 0x0601, 0x0601,
+  0x0605, 0x0609, 0x0609, 0x060e, 0x0612, 0x0612, 0x0616, 0x0616, 0x061a, 0x061e, 0x061e, 0x0623, 0x0623, 0x0627, 0x0627, 0x062b,
+  0x062b, 0x062b, 0x0630, 0x0630, 0x0634, 0x0634, 0x0634, 0x0638, 0x0638, 0x0638, 0x063c, 0x063c, 0x063c, 0x0641, 0x0641, 0x0641,
+  0x0641, 0x0645, 0x0645, 0x0645, 0x0645, 0x0645, 0x0645, 0x0645, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649, 0x0649,
+  0x0004, 0x000e, 0x0018, 0x0021, 0x002b, 0x0035, 0x003e, 0x0048, 0x0052, 0x005b, 0x0065, 0x006f, 0x0078, 0x0082, 0x008c, 0x0095,
+  0x009f, 0x00a8, 0x00b2, 0x00bc, 0x00c5, 0x00cf, 0x00d9, 0x00e2, 0x00ec, 0x00f5, 0x00ff, 0x0108, 0x0112, 0x011b, 0x0125, 0x012e,
+  0x0138, 0x0141, 0x014b, 0x0154, 0x015d, 0x0167, 0x0171, 0x017a, 0x0183, 0x018d, 0x0195, 0x019f, 0x01a8, 0x01b2, 0x01bb, 0x01c4,
+  0x01ce, 0x01d6, 0x01df, 0x01e9, 0x01f2, 0x01fb, 0x0205, 0x020e, 0x0216, 0x0221, 0x022a, 0x0233, 0x023a, 0x0244, 0x024d, 0x0255,
+  0x025f, 0x0267, 0x0271, 0x027a, 0x0283, 0x028b, 0x0294, 0x029d, 0x02a6, 0x02ae, 0x02b7, 0x02c0, 0x02c8, 0x02d0, 0x02da, 0x02e2,
+  0x02ea, 0x02f4, 0x02fc, 0x0304, 0x030d, 0x0315, 0x031e, 0x0324, 0x032d, 0x0336, 0x033f, 0x0346, 0x034f, 0x0356, 0x035f, 0x0366,
+  0x0370, 0x0377, 0x037e, 0x0388, 0x038f, 0x0397, 0x039e, 0x03a6, 0x03ad, 0x03b5, 0x03bd, 0x03c5, 0x03cc, 0x03d4, 0x03dc, 0x03e4,
+  0x03ea, 0x03f2, 0x03fa, 0x0400, 0x0408, 0x0411, 0x0416, 0x041f, 0x0425, 0x042d, 0x0433, 0x043c, 0x0442, 0x0448, 0x0451, 0x0457,
+  0x045d, 0x0463, 0x046c, 0x0472, 0x0478, 0x047e, 0x0485, 0x048b, 0x0491, 0x0498, 0x049e, 0x04a4, 0x04ab, 0x04b1, 0x04b8, 0x04be,
+  0x04c5, 0x04cc, 0x04cf, 0x04d6, 0x04dc, 0x04e3, 0x04ea, 0x04ed, 0x04f4, 0x04fb, 0x04ff, 0x0506, 0x0509, 0x0510, 0x0517, 0x051b,
+  0x0522, 0x0525, 0x052c, 0x0530, 0x0534, 0x053b, 0x053e, 0x0546, 0x0549, 0x054d, 0x0554, 0x0558, 0x055c, 0x0563, 0x0567, 0x056b,
+  0x056f, 0x0572, 0x057a, 0x057e, 0x0581, 0x0585, 0x0589, 0x058d, 0x0591, 0x0595, 0x0599, 0x059c, 0x05a0, 0x05a4, 0x05a8, 0x05ac,
+  0x05b0, 0x05b4, 0x05b8, 0x05bc, 0x05c0, 0x05c4, 0x05c8, 0x05c8, 0x05cc, 0x05d0, 0x05d4, 0x05d4, 0x05d8, 0x05dc, 0x05e0, 0x05e0,
+  0x05e4, 0x05e8, 0x05e8, 0x05ec, 0x05f0, 0x05f0, 0x05f5, 0x05f5, 0x05f9, 0x05fd, 0x05fd, 0x0601, 0x0601, 0x0605, 0x0605, 0x0609,
+  0x0609, 0x0609, 0x060e, 0x060e, 0x0612, 0x0612, 0x0612, 0x0616, 0x0616, 0x0616, 0x061a, 0x061a, 0x061a, 0x061e, 0x061e, 0x061e,
+  0x061e, 0x0623, 0x0623, 0x0623, 0x0623, 0x0623, 0x0623, 0x0623, 0x0627, 0x0627, 0x0627, 0x0627, 0x0627, 0x0627, 0x0627, 0x0627,
+  0x0004, 0x000e, 0x0017, 0x0021, 0x002a, 0x0033, 0x003d, 0x0046, 0x0050, 0x0059, 0x0063, 0x006c, 0x0076, 0x007f, 0x0089, 0x0092,
+  0x009c, 0x00a5, 0x00ae, 0x00b8, 0x00c1, 0x00ca, 0x00d4, 0x00dd, 0x00e7, 0x00ef, 0x00f9, 0x0102, 0x010c, 0x0115, 0x011e, 0x0128,
+  0x0131, 0x013a, 0x0144, 0x014d, 0x0156, 0x015f, 0x0169, 0x0172, 0x017b, 0x0184, 0x018d, 0x0196, 0x019f, 0x01a8, 0x01b2, 0x01ba,
+  0x01c4, 0x01cc, 0x01d5, 0x01de, 0x01e7, 0x01f1, 0x01fa, 0x0203, 0x020b, 0x0215, 0x021e, 0x0227, 0x022e, 0x0237, 0x0241, 0x0248,
+  0x0252, 0x025a, 0x0264, 0x026c, 0x0275, 0x027d, 0x0286, 0x028f, 0x0298, 0x029f, 0x02a8, 0x02b1, 0x02b9, 0x02c0, 0x02ca, 0x02d2,
+  0x02da, 0x02e4, 0x02ec, 0x02f4, 0x02fc, 0x0304, 0x030d, 0x0313, 0x031c, 0x0324, 0x032d, 0x0334, 0x033d, 0x0344, 0x034d, 0x0354,
+  0x035d, 0x0364, 0x036b, 0x0374, 0x037c, 0x0383, 0x038a, 0x0392, 0x0399, 0x03a1, 0x03a8, 0x03b0, 0x03b8, 0x03bf, 0x03c7, 0x03cf,
+  0x03d4, 0x03dc, 0x03e4, 0x03ea, 0x03f2, 0x03fa, 0x0400, 0x0408, 0x040e, 0x0416, 0x041c, 0x0425, 0x042a, 0x0430, 0x0439, 0x043f,
+  0x0445, 0x044b, 0x0454, 0x045a, 0x0460, 0x0466, 0x046c, 0x0472, 0x0478, 0x047e, 0x0485, 0x048b, 0x0491, 0x0498, 0x049e, 0x04a4,
+  0x04ab, 0x04b1, 0x04b5, 0x04bb, 0x04c2, 0x04c8, 0x04cf, 0x04d2, 0x04d9, 0x04e0, 0x04e3, 0x04ea, 0x04ed, 0x04f4, 0x04fb, 0x04ff,
+  0x0506, 0x0509, 0x0510, 0x0514, 0x0517, 0x051e, 0x0522, 0x0529, 0x052c, 0x0530, 0x0537, 0x053b, 0x053e, 0x0546, 0x0549, 0x054d,
+  0x0551, 0x0554, 0x055c, 0x0560, 0x0563, 0x0567, 0x056b, 0x056f, 0x0572, 0x0576, 0x057a, 0x057e, 0x0581, 0x0585, 0x0589, 0x058d,
+  0x0591, 0x0595, 0x0599, 0x059c, 0x05a0, 0x05a4, 0x05a8, 0x05a8, 0x05ac, 0x05b0, 0x05b4, 0x05b4, 0x05b8, 0x05bc, 0x05c0, 0x05c0,
+  0x05c4, 0x05c8, 0x05c8, 0x05cc, 0x05d0, 0x05d0, 0x05d4, 0x05d4, 0x05d8, 0x05dc, 0x05dc, 0x05e0, 0x05e0, 0x05e4, 0x05e4, 0x05e8,
+  0x05e8, 0x05e8, 0x05ec, 0x05ec, 0x05f0, 0x05f0, 0x05f0, 0x05f5, 0x05f5, 0x05f5, 0x05f9, 0x05f9, 0x05f9, 0x05fd, 0x05fd, 0x05fd,
+  0x05fd, 0x0601, 0x0601, 0x0601, 0x0601, 0x0601, 0x0601, 0x0601, 0x0605, 0x0605, 0x0605, 0x0605, 0x0605, 0x0605, 0x0605, 0x0605,
+  0x0004, 0x000d, 0x0017, 0x0020, 0x0029, 0x0032, 0x003c, 0x0045, 0x004e, 0x0057, 0x0061, 0x006a, 0x0073, 0x007c, 0x0086, 0x008f,
+  0x0098, 0x00a1, 0x00ab, 0x00b4, 0x00bd, 0x00c6, 0x00cf, 0x00d8, 0x00e2, 0x00ea, 0x00f4, 0x00fd, 0x0106, 0x010f, 0x0118, 0x0122,
+  0x012a, 0x0133, 0x013d, 0x0145, 0x014e, 0x0158, 0x0161, 0x016a, 0x0173, 0x017c, 0x0184, 0x018e, 0x0196, 0x019f, 0x01a8, 0x01b1,
+  0x01ba, 0x01c2, 0x01cb, 0x01d4, 0x01dd, 0x01e6, 0x01ef, 0x01f7, 0x0200, 0x020a, 0x0212, 0x021b, 0x0222, 0x022b, 0x0234, 0x023c,
+  0x0245, 0x024d, 0x0257, 0x025f, 0x0267, 0x0270, 0x0278, 0x0281, 0x028a, 0x0291, 0x029a, 0x02a3, 0x02aa, 0x02b1, 0x02bb, 0x02c2,
+  0x02ca, 0x02d4, 0x02dc, 0x02e4, 0x02ec, 0x02f4, 0x02fc, 0x0302, 0x030b, 0x0313, 0x031c, 0x0322, 0x032b, 0x0332, 0x033b, 0x0341,
+  0x034a, 0x0351, 0x0358, 0x0362, 0x0369, 0x0370, 0x0377, 0x037e, 0x0385, 0x038d, 0x0394, 0x039c, 0x03a3, 0x03ab, 0x03b2, 0x03ba,
+  0x03bf, 0x03c7, 0x03cf, 0x03d4, 0x03dc, 0x03e4, 0x03ea, 0x03f2, 0x03f7, 0x0400, 0x0406, 0x040e, 0x0414, 0x0419, 0x0422, 0x0428,
+  0x042d, 0x0433, 0x043c, 0x0442, 0x0448, 0x044e, 0x0454, 0x045a, 0x0460, 0x0466, 0x046c, 0x0472, 0x0478, 0x047e, 0x0485, 0x048b,
+  0x0491, 0x0498, 0x049b, 0x04a1, 0x04a8, 0x04ae, 0x04b5, 0x04b8, 0x04be, 0x04c5, 0x04c8, 0x04cf, 0x04d2, 0x04d9, 0x04e0, 0x04e3,
+  0x04ea, 0x04ed, 0x04f4, 0x04f8, 0x04fb, 0x0502, 0x0506, 0x050c, 0x0510, 0x0514, 0x051b, 0x051e, 0x0522, 0x0529, 0x052c, 0x0530,
+  0x0534, 0x0537, 0x053e, 0x0542, 0x0546, 0x0549, 0x054d, 0x0551, 0x0554, 0x0558, 0x055c, 0x0560, 0x0563, 0x0567, 0x056b, 0x056f,
+  0x0572, 0x0576, 0x057a, 0x057e, 0x0581, 0x0585, 0x0589, 0x0589, 0x058d, 0x0591, 0x0595, 0x0595, 0x0599, 0x059c, 0x05a0, 0x05a0,
+  0x05a4, 0x05a8, 0x05a8, 0x05ac, 0x05b0, 0x05b0, 0x05b4, 0x05b4, 0x05b8, 0x05bc, 0x05bc, 0x05c0, 0x05c0, 0x05c4, 0x05c4, 0x05c8,
+  0x05c8, 0x05c8, 0x05cc, 0x05cc, 0x05d0, 0x05d0, 0x05d0, 0x05d4, 0x05d4, 0x05d4, 0x05d8, 0x05d8, 0x05d8, 0x05dc, 0x05dc, 0x05dc,
+  0x05dc, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e0, 0x05e4, 0x05e4, 0x05e4, 0x05e4, 0x05e4, 0x05e4, 0x05e4, 0x05e4,
+  0x0004, 0x000d, 0x0016, 0x001f, 0x0028, 0x0031, 0x003a, 0x0043, 0x004c, 0x0056, 0x005f, 0x0068, 0x0071, 0x007a, 0x0083, 0x008c,
+  0x0095, 0x009e, 0x00a7, 0x00b0, 0x00b9, 0x00c2, 0x00cb, 0x00d3, 0x00dd, 0x00e5, 0x00ef, 0x00f7, 0x0100, 0x010a, 0x0112, 0x011b,
+  0x0124, 0x012d, 0x0136, 0x013e, 0x0147, 0x0150, 0x0159, 0x0162, 0x016b, 0x0174, 0x017c, 0x0185, 0x018e, 0x0196, 0x019f, 0x01a7,
+  0x01b1, 0x01b9, 0x01c1, 0x01ca, 0x01d3, 0x01dc, 0x01e5, 0x01ed, 0x01f5, 0x01fe, 0x0207, 0x020f, 0x0216, 0x021f, 0x0228, 0x0230,
+  0x0239, 0x0241, 0x024a, 0x0252, 0x025a, 0x0262, 0x026b, 0x0273, 0x027c, 0x0283, 0x028b, 0x0294, 0x029b, 0x02a3, 0x02ac, 0x02b3,
+  0x02bb, 0x02c4, 0x02cc, 0x02d4, 0x02dc, 0x02e4, 0x02ec, 0x02f2, 0x02fa, 0x0302, 0x030b, 0x0311, 0x031a, 0x0320, 0x0329, 0x032f,
+  0x0338, 0x033f, 0x0346, 0x034f, 0x0356, 0x035d, 0x0364, 0x036b, 0x0372, 0x0379, 0x0381, 0x0388, 0x038f, 0x0397, 0x039e, 0x03a6,
+  0x03ab, 0x03b2, 0x03ba, 0x03bf, 0x03c7, 0x03cf, 0x03d4, 0x03dc, 0x03e2, 0x03ea, 0x03ef, 0x03f7, 0x03fd, 0x0403, 0x040b, 0x0411,
+  0x0416, 0x041c, 0x0425, 0x042a, 0x0430, 0x0436, 0x043c, 0x0442, 0x0448, 0x044e, 0x0454, 0x045a, 0x0460, 0x0466, 0x046c, 0x0472,
+  0x0478, 0x047e, 0x0482, 0x0488, 0x048e, 0x0494, 0x049b, 0x049e, 0x04a4, 0x04ab, 0x04ae, 0x04b5, 0x04b8, 0x04be, 0x04c5, 0x04c8,
+  0x04cf, 0x04d2, 0x04d9, 0x04dc, 0x04e0, 0x04e7, 0x04ea, 0x04f1, 0x04f4, 0x04f8, 0x04ff, 0x0502, 0x0506, 0x050c, 0x0510, 0x0514,
+  0x0517, 0x051b, 0x0522, 0x0525, 0x0529, 0x052c, 0x0530, 0x0534, 0x0537, 0x053b, 0x053e, 0x0542, 0x0546, 0x0549, 0x054d, 0x0551,
+  0x0554, 0x0558, 0x055c, 0x0560, 0x0563, 0x0567, 0x056b, 0x056b, 0x056f, 0x0572, 0x0576, 0x0576, 0x057a, 0x057e, 0x0581, 0x0581,
+  0x0585, 0x0589, 0x0589, 0x058d, 0x0591, 0x0591, 0x0595, 0x0595, 0x0599, 0x059c, 0x059c, 0x05a0, 0x05a0, 0x05a4, 0x05a4, 0x05a8,
+  0x05a8, 0x05a8, 0x05ac, 0x05ac, 0x05b0, 0x05b0, 0x05b0, 0x05b4, 0x05b4, 0x05b4, 0x05b8, 0x05b8, 0x05b8, 0x05bc, 0x05bc, 0x05bc,
+  0x05bc, 0x05c0, 0x05c0, 0x05c0, 0x05c0, 0x05c0, 0x05c0, 0x05c0, 0x05c4, 0x05c4, 0x05c4, 0x05c4, 0x05c4, 0x05c4, 0x05c4, 0x05c4,
+  0x0004, 0x000d, 0x0016, 0x001e, 0x0027, 0x0030, 0x0039, 0x0042, 0x004b, 0x0054, 0x005d, 0x0065, 0x006e, 0x0077, 0x0080, 0x0089,
+  0x0092, 0x009a, 0x00a3, 0x00ac, 0x00b5, 0x00be, 0x00c7, 0x00cf, 0x00d8, 0x00e0, 0x00ea, 0x00f2, 0x00fb, 0x0104, 0x010c, 0x0115,
+  0x011e, 0x0126, 0x012f, 0x0138, 0x0140, 0x0149, 0x0152, 0x015a, 0x0163, 0x016c, 0x0174, 0x017d, 0x0185, 0x018e, 0x0196, 0x019e,
+  0x01a7, 0x01af, 0x01b8, 0x01c0, 0x01c9, 0x01d1, 0x01da, 0x01e2, 0x01ea, 0x01f3, 0x01fb, 0x0204, 0x020b, 0x0214, 0x021c, 0x0224,
+  0x022d, 0x0234, 0x023d, 0x0245, 0x024d, 0x0255, 0x025d, 0x0266, 0x026e, 0x0275, 0x027d, 0x0286, 0x028d, 0x0294, 0x029d, 0x02a4,
+  0x02ac, 0x02b5, 0x02bd, 0x02c4, 0x02cc, 0x02d4, 0x02dc, 0x02e2, 0x02ea, 0x02f2, 0x02fa, 0x0300, 0x0309, 0x030f, 0x0318, 0x031e,
+  0x0327, 0x032d, 0x0334, 0x033d, 0x0344, 0x034a, 0x0351, 0x0358, 0x035f, 0x0366, 0x036d, 0x0374, 0x037c, 0x0383, 0x038a, 0x0392,
+  0x0397, 0x039e, 0x03a6, 0x03ab, 0x03b2, 0x03ba, 0x03bf, 0x03c7, 0x03cc, 0x03d4, 0x03da, 0x03e2, 0x03e7, 0x03ed, 0x03f5, 0x03fa,
+  0x0400, 0x0406, 0x040e, 0x0414, 0x0419, 0x041f, 0x0425, 0x042a, 0x0430, 0x0436, 0x043c, 0x0442, 0x0448, 0x044e, 0x0454, 0x045a,
+  0x0460, 0x0466, 0x0469, 0x046f, 0x0475, 0x047b, 0x0482, 0x0485, 0x048b, 0x0491, 0x0494, 0x049b, 0x049e, 0x04a4, 0x04ab, 0x04ae,
+  0x04b5, 0x04b8, 0x04be, 0x04c2, 0x04c5, 0x04cc, 0x04cf, 0x04d6, 0x04d9, 0x04dc, 0x04e3, 0x04e7, 0x04ea, 0x04f1, 0x04f4, 0x04f8,
+  0x04fb, 0x04ff, 0x0506, 0x0509, 0x050c, 0x0510, 0x0514, 0x0517, 0x051b, 0x051e, 0x0522, 0x0525, 0x0529, 0x052c, 0x0530, 0x0534,
+  0x0537, 0x053b, 0x053e, 0x0542, 0x0546, 0x0549, 0x054d, 0x054d, 0x0551, 0x0554, 0x0558, 0x0558, 0x055c, 0x0560, 0x0563, 0x0563,
+  0x0567, 0x056b, 0x056b, 0x056f, 0x0572, 0x0572, 0x0576, 0x0576, 0x057a, 0x057e, 0x057e, 0x0581, 0x0581, 0x0585, 0x0585, 0x0589,
+  0x0589, 0x0589, 0x058d, 0x058d, 0x0591, 0x0591, 0x0591, 0x0595, 0x0595, 0x0595, 0x0599, 0x0599, 0x0599, 0x059c, 0x059c, 0x059c,
+  0x059c, 0x05a0, 0x05a0, 0x05a0, 0x05a0, 0x05a0, 0x05a0, 0x05a0, 0x05a4, 0x05a4, 0x05a4, 0x05a4, 0x05a4, 0x05a4, 0x05a4, 0x05a4,
+  0x0004, 0x000d, 0x0015, 0x001e, 0x0027, 0x002f, 0x0038, 0x0041, 0x0049, 0x0052, 0x005b, 0x0063, 0x006c, 0x0075, 0x007d, 0x0086,
+  0x008f, 0x0097, 0x00a0, 0x00a8, 0x00b1, 0x00ba, 0x00c2, 0x00ca, 0x00d3, 0x00dc, 0x00e5, 0x00ed, 0x00f5, 0x00fe, 0x0107, 0x010f,
+  0x0118, 0x0120, 0x0129, 0x0131, 0x0139, 0x0142, 0x014b, 0x0153, 0x015b, 0x0164, 0x016c, 0x0175, 0x017d, 0x0185, 0x018e, 0x0195,
+  0x019e, 0x01a6, 0x01ae, 0x01b6, 0x01bf, 0x01c7, 0x01d0, 0x01d8, 0x01df, 0x01e9, 0x01f1, 0x01f9, 0x0200, 0x0208, 0x0211, 0x0218,
+  0x0221, 0x0228, 0x0231, 0x0239, 0x0241, 0x0248, 0x0250, 0x0258, 0x0261, 0x0267, 0x0270, 0x0278, 0x027f, 0x0286, 0x028f, 0x0296,
+  0x029d, 0x02a6, 0x02ae, 0x02b5, 0x02bd, 0x02c4, 0x02cc, 0x02d2, 0x02da, 0x02e2, 0x02ea, 0x02f0, 0x02f8, 0x02fe, 0x0307, 0x030d,
+  0x0315, 0x031c, 0x0322, 0x032b, 0x0332, 0x0338, 0x033f, 0x0346, 0x034d, 0x0354, 0x035a, 0x0362, 0x0369, 0x0370, 0x0377, 0x037e,
+  0x0383, 0x038a, 0x0392, 0x0397, 0x039e, 0x03a6, 0x03ab, 0x03b2, 0x03b8, 0x03bf, 0x03c5, 0x03cc, 0x03d2, 0x03d7, 0x03df, 0x03e4,
+  0x03ea, 0x03ef, 0x03f7, 0x03fd, 0x0403, 0x0408, 0x040e, 0x0414, 0x0419, 0x041f, 0x0425, 0x042a, 0x0430, 0x0436, 0x043c, 0x0442,
+  0x0448, 0x044e, 0x0451, 0x0457, 0x045d, 0x0463, 0x0469, 0x046c, 0x0472, 0x0478, 0x047b, 0x0482, 0x0485, 0x048b, 0x0491, 0x0494,
+  0x049b, 0x049e, 0x04a4, 0x04a8, 0x04ab, 0x04b1, 0x04b5, 0x04bb, 0x04be, 0x04c2, 0x04c8, 0x04cc, 0x04cf, 0x04d6, 0x04d9, 0x04dc,
+  0x04e0, 0x04e3, 0x04ea, 0x04ed, 0x04f1, 0x04f4, 0x04f8, 0x04fb, 0x04ff, 0x0502, 0x0506, 0x0509, 0x050c, 0x0510, 0x0514, 0x0517,
+  0x051b, 0x051e, 0x0522, 0x0525, 0x0529, 0x052c, 0x0530, 0x0530, 0x0534, 0x0537, 0x053b, 0x053b, 0x053e, 0x0542, 0x0546, 0x0546,
+  0x0549, 0x054d, 0x054d, 0x0551, 0x0554, 0x0554, 0x0558, 0x0558, 0x055c, 0x0560, 0x0560, 0x0563, 0x0563, 0x0567, 0x0567, 0x056b,
+  0x056b, 0x056b, 0x056f, 0x056f, 0x0572, 0x0572, 0x0572, 0x0576, 0x0576, 0x0576, 0x057a, 0x057a, 0x057a, 0x057e, 0x057e, 0x057e,
+  0x057e, 0x0581, 0x0581, 0x0581, 0x0581, 0x0581, 0x0581, 0x0581, 0x0585, 0x0585, 0x0585, 0x0585, 0x0585, 0x0585, 0x0585, 0x0585,
+  0x0004, 0x000c, 0x0015, 0x001d, 0x0026, 0x002e, 0x0037, 0x003f, 0x0048, 0x0050, 0x0059, 0x0061, 0x0069, 0x0072, 0x007a, 0x0083,
+  0x008c, 0x0094, 0x009c, 0x00a5, 0x00ad, 0x00b6, 0x00be, 0x00c6, 0x00cf, 0x00d7, 0x00e0, 0x00e8, 0x00f0, 0x00f9, 0x0101, 0x010a,
+  0x0112, 0x011a, 0x0122, 0x012a, 0x0133, 0x013b, 0x0144, 0x014c, 0x0154, 0x015c, 0x0164, 0x016d, 0x0175, 0x017d, 0x0185, 0x018d,
+  0x0195, 0x019d, 0x01a5, 0x01ad, 0x01b5, 0x01be, 0x01c6, 0x01ce, 0x01d5, 0x01de, 0x01e6, 0x01ee, 0x01f5, 0x01fd, 0x0205, 0x020c,
+  0x0215, 0x021c, 0x0225, 0x022d, 0x0234, 0x023c, 0x0244, 0x024c, 0x0254, 0x025a, 0x0262, 0x026b, 0x0271, 0x0278, 0x0281, 0x0288,
+  0x028f, 0x0298, 0x029f, 0x02a6, 0x02ae, 0x02b5, 0x02bd, 0x02c2, 0x02ca, 0x02d2, 0x02da, 0x02e0, 0x02e8, 0x02ee, 0x02f6, 0x02fc,
+  0x0304, 0x030b, 0x0311, 0x031a, 0x0320, 0x0327, 0x032d, 0x0334, 0x033b, 0x0341, 0x0348, 0x034f, 0x0356, 0x035d, 0x0364, 0x036b,
+  0x0370, 0x0377, 0x037e, 0x0383, 0x038a, 0x0392, 0x0397, 0x039e, 0x03a3, 0x03ab, 0x03b0, 0x03b8, 0x03bd, 0x03c2, 0x03ca, 0x03cf,
+  0x03d4, 0x03da, 0x03e2, 0x03e7, 0x03ed, 0x03f2, 0x03f7, 0x03fd, 0x0403, 0x0408, 0x040e, 0x0414, 0x0419, 0x041f, 0x0425, 0x042a,
+  0x0430, 0x0436, 0x0439, 0x043f, 0x0445, 0x044b, 0x0451, 0x0454, 0x045a, 0x0460, 0x0463, 0x0469, 0x046c, 0x0472, 0x0478, 0x047b,
+  0x0482, 0x0485, 0x048b, 0x048e, 0x0491, 0x0498, 0x049b, 0x04a1, 0x04a4, 0x04a8, 0x04ae, 0x04b1, 0x04b5, 0x04bb, 0x04be, 0x04c2,
+  0x04c5, 0x04c8, 0x04cf, 0x04d2, 0x04d6, 0x04d9, 0x04dc, 0x04e0, 0x04e3, 0x04e7, 0x04ea, 0x04ed, 0x04f1, 0x04f4, 0x04f8, 0x04fb,
+  0x04ff, 0x0502, 0x0506, 0x0509, 0x050c, 0x0510, 0x0514, 0x0514, 0x0517, 0x051b, 0x051e, 0x051e, 0x0522, 0x0525, 0x0529, 0x0529,
+  0x052c, 0x0530, 0x0530, 0x0534, 0x0537, 0x0537, 0x053b, 0x053b, 0x053e, 0x0542, 0x0542, 0x0546, 0x0546, 0x0549, 0x0549, 0x054d,
+  0x054d, 0x054d, 0x0551, 0x0551, 0x0554, 0x0554, 0x0554, 0x0558, 0x0558, 0x0558, 0x055c, 0x055c, 0x055c, 0x0560, 0x0560, 0x0560,
+  0x0560, 0x0563, 0x0563, 0x0563, 0x0563, 0x0563, 0x0563, 0x0563, 0x0567, 0x0567, 0x0567, 0x0567, 0x0567, 0x0567, 0x0567, 0x0567,
+  0x0004, 0x000c, 0x0014, 0x001d, 0x0025, 0x002d, 0x0035, 0x003e, 0x0046, 0x004e, 0x0057, 0x005f, 0x0067, 0x0070, 0x0078, 0x0080,
+  0x0089, 0x0091, 0x0099, 0x00a1, 0x00a9, 0x00b2, 0x00ba, 0x00c2, 0x00ca, 0x00d2, 0x00db, 0x00e3, 0x00eb, 0x00f3, 0x00fb, 0x0104,
+  0x010c, 0x0114, 0x011c, 0x0124, 0x012c, 0x0134, 0x013d, 0x0145, 0x014d, 0x0155, 0x015c, 0x0165, 0x016d, 0x0175, 0x017d, 0x0184,
+  0x018d, 0x0194, 0x019c, 0x01a4, 0x01ac, 0x01b4, 0x01bc, 0x01c4, 0x01cb, 0x01d4, 0x01dc, 0x01e3, 0x01ea, 0x01f2, 0x01fa, 0x0201,
+  0x020a, 0x0211, 0x0219, 0x0221, 0x0228, 0x0230, 0x0237, 0x023f, 0x0247, 0x024d, 0x0255, 0x025d, 0x0264, 0x026b, 0x0273, 0x027a,
+  0x0281, 0x028a, 0x0291, 0x0298, 0x029f, 0x02a6, 0x02ae, 0x02b3, 0x02bb, 0x02c2, 0x02ca, 0x02d0, 0x02d8, 0x02de, 0x02e6, 0x02ec,
+  0x02f4, 0x02fa, 0x0300, 0x0309, 0x030f, 0x0315, 0x031c, 0x0322, 0x0329, 0x032f, 0x0336, 0x033d, 0x0344, 0x034a, 0x0351, 0x0358,
+  0x035d, 0x0364, 0x036b, 0x0370, 0x0377, 0x037e, 0x0383, 0x038a, 0x038f, 0x0397, 0x039c, 0x03a3, 0x03a8, 0x03ad, 0x03b5, 0x03ba,
+  0x03bf, 0x03c5, 0x03cc, 0x03d2, 0x03d7, 0x03dc, 0x03e2, 0x03e7, 0x03ed, 0x03f2, 0x03f7, 0x03fd, 0x0403, 0x0408, 0x040e, 0x0414,
+  0x0419, 0x041f, 0x0422, 0x0428, 0x042d, 0x0433, 0x0439, 0x043c, 0x0442, 0x0448, 0x044b, 0x0451, 0x0454, 0x045a, 0x0460, 0x0463,
+  0x0469, 0x046c, 0x0472, 0x0475, 0x0478, 0x047e, 0x0482, 0x0488, 0x048b, 0x048e, 0x0494, 0x0498, 0x049b, 0x04a1, 0x04a4, 0x04a8,
+  0x04ab, 0x04ae, 0x04b5, 0x04b8, 0x04bb, 0x04be, 0x04c2, 0x04c5, 0x04c8, 0x04cc, 0x04cf, 0x04d2, 0x04d6, 0x04d9, 0x04dc, 0x04e0,
+  0x04e3, 0x04e7, 0x04ea, 0x04ed, 0x04f1, 0x04f4, 0x04f8, 0x04f8, 0x04fb, 0x04ff, 0x0502, 0x0502, 0x0506, 0x0509, 0x050c, 0x050c,
+  0x0510, 0x0514, 0x0514, 0x0517, 0x051b, 0x051b, 0x051e, 0x051e, 0x0522, 0x0525, 0x0525, 0x0529, 0x0529, 0x052c, 0x052c, 0x0530,
+  0x0530, 0x0530, 0x0534, 0x0534, 0x0537, 0x0537, 0x0537, 0x053b, 0x053b, 0x053b, 0x053e, 0x053e, 0x053e, 0x0542, 0x0542, 0x0542,
+  0x0542, 0x0546, 0x0546, 0x0546, 0x0546, 0x0546, 0x0546, 0x0546, 0x0549, 0x0549, 0x0549, 0x0549, 0x0549, 0x0549, 0x0549, 0x0549,
+  0x0004, 0x000c, 0x0014, 0x001c, 0x0024, 0x002c, 0x0034, 0x003c, 0x0045, 0x004d, 0x0055, 0x005d, 0x0065, 0x006d, 0x0075, 0x007d,
+  0x0086, 0x008d, 0x0096, 0x009e, 0x00a6, 0x00ae, 0x00b6, 0x00be, 0x00c6, 0x00ce, 0x00d6, 0x00de, 0x00e6, 0x00ee, 0x00f6, 0x00fe,
+  0x0106, 0x010e, 0x0116, 0x011e, 0x0126, 0x012e, 0x0136, 0x013e, 0x0145, 0x014d, 0x0155, 0x015d, 0x0165, 0x016d, 0x0175, 0x017c,
+  0x0184, 0x018c, 0x0193, 0x019b, 0x01a3, 0x01ab, 0x01b3, 0x01ba, 0x01c1, 0x01ca, 0x01d1, 0x01d9, 0x01df, 0x01e7, 0x01ef, 0x01f6,
+  0x01fe, 0x0205, 0x020e, 0x0215, 0x021c, 0x0224, 0x022b, 0x0233, 0x023a, 0x0241, 0x0248, 0x0250, 0x0257, 0x025d, 0x0266, 0x026c,
+  0x0273, 0x027c, 0x0283, 0x028a, 0x0291, 0x0298, 0x029f, 0x02a4, 0x02ac, 0x02b3, 0x02bb, 0x02c0, 0x02c8, 0x02ce, 0x02d6, 0x02dc,
+  0x02e4, 0x02ea, 0x02f0, 0x02f8, 0x02fe, 0x0304, 0x030b, 0x0311, 0x0318, 0x031e, 0x0324, 0x032b, 0x0332, 0x0338, 0x033f, 0x0346,
+  0x034a, 0x0351, 0x0358, 0x035d, 0x0364, 0x036b, 0x0370, 0x0377, 0x037c, 0x0383, 0x0388, 0x038f, 0x0394, 0x0399, 0x03a1, 0x03a6,
+  0x03ab, 0x03b0, 0x03b8, 0x03bd, 0x03c2, 0x03c7, 0x03cc, 0x03d2, 0x03d7, 0x03dc, 0x03e2, 0x03e7, 0x03ed, 0x03f2, 0x03f7, 0x03fd,
+  0x0403, 0x0408, 0x040b, 0x0411, 0x0416, 0x041c, 0x0422, 0x0425, 0x042a, 0x0430, 0x0433, 0x0439, 0x043c, 0x0442, 0x0448, 0x044b,
+  0x0451, 0x0454, 0x045a, 0x045d, 0x0460, 0x0466, 0x0469, 0x046f, 0x0472, 0x0475, 0x047b, 0x047e, 0x0482, 0x0488, 0x048b, 0x048e,
+  0x0491, 0x0494, 0x049b, 0x049e, 0x04a1, 0x04a4, 0x04a8, 0x04ab, 0x04ae, 0x04b1, 0x04b5, 0x04b8, 0x04bb, 0x04be, 0x04c2, 0x04c5,
+  0x04c8, 0x04cc, 0x04cf, 0x04d2, 0x04d6, 0x04d9, 0x04dc, 0x04dc, 0x04e0, 0x04e3, 0x04e7, 0x04e7, 0x04ea, 0x04ed, 0x04f1, 0x04f1,
+  0x04f4, 0x04f8, 0x04f8, 0x04fb, 0x04ff, 0x04ff, 0x0502, 0x0502, 0x0506, 0x0509, 0x0509, 0x050c, 0x050c, 0x0510, 0x0510, 0x0514,
+  0x0514, 0x0514, 0x0517, 0x0517, 0x051b, 0x051b, 0x051b, 0x051e, 0x051e, 0x051e, 0x0522, 0x0522, 0x0522, 0x0525, 0x0525, 0x0525,
+  0x0525, 0x0529, 0x0529, 0x0529, 0x0529, 0x0529, 0x0529, 0x0529, 0x052c, 0x052c, 0x052c, 0x052c, 0x052c, 0x052c, 0x052c, 0x052c,
+  0x0003, 0x000b, 0x0013, 0x001b, 0x0023, 0x002b, 0x0033, 0x003b, 0x0043, 0x004b, 0x0053, 0x005b, 0x0063, 0x006b, 0x0073, 0x007b,
+  0x0083, 0x008a, 0x0093, 0x009a, 0x00a2, 0x00aa, 0x00b2, 0x00ba, 0x00c2, 0x00c9, 0x00d2, 0x00d9, 0x00e1, 0x00e9, 0x00f1, 0x00f9,
+  0x0100, 0x0108, 0x0110, 0x0118, 0x011f, 0x0127, 0x012f, 0x0137, 0x013e, 0x0146, 0x014d, 0x0156, 0x015d, 0x0165, 0x016d, 0x0174,
+  0x017c, 0x0183, 0x018a, 0x0192, 0x019a, 0x01a2, 0x01aa, 0x01b1, 0x01b8, 0x01c0, 0x01c7, 0x01cf, 0x01d5, 0x01dd, 0x01e5, 0x01eb,
+  0x01f3, 0x01fa, 0x0203, 0x020a, 0x0211, 0x0218, 0x021f, 0x0227, 0x022e, 0x0234, 0x023c, 0x0244, 0x024a, 0x0250, 0x0258, 0x025f,
+  0x0266, 0x026e, 0x0275, 0x027c, 0x0283, 0x028a, 0x0291, 0x0296, 0x029d, 0x02a4, 0x02ac, 0x02b1, 0x02b9, 0x02bf, 0x02c6, 0x02cc,
+  0x02d4, 0x02da, 0x02e0, 0x02e8, 0x02ee, 0x02f4, 0x02fa, 0x0300, 0x0307, 0x030d, 0x0313, 0x031a, 0x0320, 0x0327, 0x032d, 0x0334,
+  0x0338, 0x033f, 0x0346, 0x034a, 0x0351, 0x0358, 0x035d, 0x0364, 0x0369, 0x0370, 0x0374, 0x037c, 0x0381, 0x0385, 0x038d, 0x0392,
+  0x0397, 0x039c, 0x03a3, 0x03a8, 0x03ad, 0x03b2, 0x03b8, 0x03bd, 0x03c2, 0x03c7, 0x03cc, 0x03d2, 0x03d7, 0x03dc, 0x03e2, 0x03e7,
+  0x03ed, 0x03f2, 0x03f5, 0x03fa, 0x0400, 0x0406, 0x040b, 0x040e, 0x0414, 0x0419, 0x041c, 0x0422, 0x0425, 0x042a, 0x0430, 0x0433,
+  0x0439, 0x043c, 0x0442, 0x0445, 0x0448, 0x044e, 0x0451, 0x0457, 0x045a, 0x045d, 0x0463, 0x0466, 0x0469, 0x046f, 0x0472, 0x0475,
+  0x0478, 0x047b, 0x0482, 0x0485, 0x0488, 0x048b, 0x048e, 0x0491, 0x0494, 0x0498, 0x049b, 0x049e, 0x04a1, 0x04a4, 0x04a8, 0x04ab,
+  0x04ae, 0x04b1, 0x04b5, 0x04b8, 0x04bb, 0x04be, 0x04c2, 0x04c2, 0x04c5, 0x04c8, 0x04cc, 0x04cc, 0x04cf, 0x04d2, 0x04d6, 0x04d6,
+  0x04d9, 0x04dc, 0x04dc, 0x04e0, 0x04e3, 0x04e3, 0x04e7, 0x04e7, 0x04ea, 0x04ed, 0x04ed, 0x04f1, 0x04f1, 0x04f4, 0x04f4, 0x04f8,
+  0x04f8, 0x04f8, 0x04fb, 0x04fb, 0x04ff, 0x04ff, 0x04ff, 0x0502, 0x0502, 0x0502, 0x0506, 0x0506, 0x0506, 0x0509, 0x0509, 0x0509,
+  0x0509, 0x050c, 0x050c, 0x050c, 0x050c, 0x050c, 0x050c, 0x050c, 0x0510, 0x0510, 0x0510, 0x0510, 0x0510, 0x0510, 0x0510, 0x0510,
+  0x0003, 0x000b, 0x0013, 0x001b, 0x0023, 0x002a, 0x0032, 0x003a, 0x0042, 0x0049, 0x0051, 0x0059, 0x0061, 0x0069, 0x0070, 0x0078,
+  0x0080, 0x0087, 0x008f, 0x0097, 0x009f, 0x00a6, 0x00ae, 0x00b6, 0x00be, 0x00c5, 0x00cd, 0x00d5, 0x00dc, 0x00e4, 0x00ec, 0x00f3,
+  0x00fb, 0x0102, 0x010a, 0x0112, 0x0119, 0x0121, 0x0129, 0x0130, 0x0138, 0x013f, 0x0146, 0x014e, 0x0156, 0x015d, 0x0165, 0x016c,
+  0x0174, 0x017b, 0x0182, 0x0189, 0x0191, 0x0199, 0x01a0, 0x01a7, 0x01ae, 0x01b6, 0x01be, 0x01c5, 0x01cb, 0x01d3, 0x01da, 0x01e1,
+  0x01e9, 0x01ef, 0x01f7, 0x01fe, 0x0205, 0x020c, 0x0214, 0x021b, 0x0222, 0x0228, 0x0230, 0x0237, 0x023d, 0x0244, 0x024c, 0x0252,
+  0x0258, 0x0261, 0x0267, 0x026e, 0x0275, 0x027c, 0x0283, 0x0288, 0x028f, 0x0296, 0x029d, 0x02a3, 0x02aa, 0x02b0, 0x02b7, 0x02bd,
+  0x02c4, 0x02ca, 0x02d0, 0x02d8, 0x02de, 0x02e4, 0x02ea, 0x02f0, 0x02f6, 0x02fc, 0x0302, 0x0309, 0x030f, 0x0315, 0x031c, 0x0322,
+  0x0327, 0x032d, 0x0334, 0x0338, 0x033f, 0x0346, 0x034a, 0x0351, 0x0356, 0x035d, 0x0362, 0x0369, 0x036d, 0x0372, 0x0379, 0x037e,
+  0x0383, 0x0388, 0x038f, 0x0394, 0x0399, 0x039e, 0x03a3, 0x03a8, 0x03ad, 0x03b2, 0x03b8, 0x03bd, 0x03c2, 0x03c7, 0x03cc, 0x03d2,
+  0x03d7, 0x03dc, 0x03df, 0x03e4, 0x03ea, 0x03ef, 0x03f5, 0x03f7, 0x03fd, 0x0403, 0x0406, 0x040b, 0x040e, 0x0414, 0x0419, 0x041c,
+  0x0422, 0x0425, 0x042a, 0x042d, 0x0430, 0x0436, 0x0439, 0x043f, 0x0442, 0x0445, 0x044b, 0x044e, 0x0451, 0x0457, 0x045a, 0x045d,
+  0x0460, 0x0463, 0x0469, 0x046c, 0x046f, 0x0472, 0x0475, 0x0478, 0x047b, 0x047e, 0x0482, 0x0485, 0x0488, 0x048b, 0x048e, 0x0491,
+  0x0494, 0x0498, 0x049b, 0x049e, 0x04a1, 0x04a4, 0x04a8, 0x04a8, 0x04ab, 0x04ae, 0x04b1, 0x04b1, 0x04b5, 0x04b8, 0x04bb, 0x04bb,
+  0x04be, 0x04c2, 0x04c2, 0x04c5, 0x04c8, 0x04c8, 0x04cc, 0x04cc, 0x04cf, 0x04d2, 0x04d2, 0x04d6, 0x04d6, 0x04d9, 0x04d9, 0x04dc,
+  0x04dc, 0x04dc, 0x04e0, 0x04e0, 0x04e3, 0x04e3, 0x04e3, 0x04e7, 0x04e7, 0x04e7, 0x04ea, 0x04ea, 0x04ea, 0x04ed, 0x04ed, 0x04ed,
+  0x04ed, 0x04f1, 0x04f1, 0x04f1, 0x04f1, 0x04f1, 0x04f1, 0x04f1, 0x04f4, 0x04f4, 0x04f4, 0x04f4, 0x04f4, 0x04f4, 0x04f4, 0x04f4,
+  0x0003, 0x000b, 0x0013, 0x001a, 0x0022, 0x0029, 0x0031, 0x0039, 0x0040, 0x0048, 0x004f, 0x0057, 0x005f, 0x0066, 0x006e, 0x0076,
+  0x007d, 0x0085, 0x008c, 0x0094, 0x009b, 0x00a3, 0x00ab, 0x00b2, 0x00ba, 0x00c1, 0x00c9, 0x00d0, 0x00d7, 0x00df, 0x00e7, 0x00ee,
+  0x00f5, 0x00fd, 0x0105, 0x010c, 0x0113, 0x011b, 0x0122, 0x012a, 0x0131, 0x0138, 0x013f, 0x0147, 0x014e, 0x0156, 0x015d, 0x0164,
+  0x016c, 0x0173, 0x017a, 0x0181, 0x0188, 0x0190, 0x0197, 0x019e, 0x01a5, 0x01ad, 0x01b4, 0x01bb, 0x01c1, 0x01c9, 0x01d0, 0x01d6,
+  0x01de, 0x01e5, 0x01ed, 0x01f3, 0x01fa, 0x0201, 0x0208, 0x020f, 0x0216, 0x021c, 0x0224, 0x022b, 0x0231, 0x0237, 0x023f, 0x0245,
+  0x024c, 0x0254, 0x025a, 0x0261, 0x0267, 0x026e, 0x0275, 0x027a, 0x0281, 0x0288, 0x028f, 0x0294, 0x029b, 0x02a1, 0x02a8, 0x02ae,
+  0x02b5, 0x02bb, 0x02c0, 0x02c8, 0x02ce, 0x02d4, 0x02da, 0x02e0, 0x02e6, 0x02ec, 0x02f2, 0x02f8, 0x02fe, 0x0304, 0x030b, 0x0311,
+  0x0315, 0x031c, 0x0322, 0x0327, 0x032d, 0x0334, 0x0338, 0x033f, 0x0344, 0x034a, 0x034f, 0x0356, 0x035a, 0x035f, 0x0366, 0x036b,
+  0x0370, 0x0374, 0x037c, 0x0381, 0x0385, 0x038a, 0x038f, 0x0394, 0x0399, 0x039e, 0x03a3, 0x03a8, 0x03ad, 0x03b2, 0x03b8, 0x03bd,
+  0x03c2, 0x03c7, 0x03ca, 0x03cf, 0x03d4, 0x03da, 0x03df, 0x03e2, 0x03e7, 0x03ed, 0x03ef, 0x03f5, 0x03f7, 0x03fd, 0x0403, 0x0406,
+  0x040b, 0x040e, 0x0414, 0x0416, 0x0419, 0x041f, 0x0422, 0x0428, 0x042a, 0x042d, 0x0433, 0x0436, 0x0439, 0x043f, 0x0442, 0x0445,
+  0x0448, 0x044b, 0x0451, 0x0454, 0x0457, 0x045a, 0x045d, 0x0460, 0x0463, 0x0466, 0x0469, 0x046c, 0x046f, 0x0472, 0x0475, 0x0478,
+  0x047b, 0x047e, 0x0482, 0x0485, 0x0488, 0x048b, 0x048e, 0x048e, 0x0491, 0x0494, 0x0498, 0x0498, 0x049b, 0x049e, 0x04a1, 0x04a1,
+  0x04a4, 0x04a8, 0x04a8, 0x04ab, 0x04ae, 0x04ae, 0x04b1, 0x04b1, 0x04b5, 0x04b8, 0x04b8, 0x04bb, 0x04bb, 0x04be, 0x04be, 0x04c2,
+  0x04c2, 0x04c2, 0x04c5, 0x04c5, 0x04c8, 0x04c8, 0x04c8, 0x04cc, 0x04cc, 0x04cc, 0x04cf, 0x04cf, 0x04cf, 0x04d2, 0x04d2, 0x04d2,
+  0x04d2, 0x04d6, 0x04d6, 0x04d6, 0x04d6, 0x04d6, 0x04d6, 0x04d6, 0x04d9, 0x04d9, 0x04d9, 0x04d9, 0x04d9, 0x04d9, 0x04d9, 0x04d9,
+  0x0003, 0x000b, 0x0012, 0x001a, 0x0021, 0x0028, 0x0030, 0x0037, 0x003f, 0x0046, 0x004e, 0x0055, 0x005d, 0x0064, 0x006b, 0x0073,
+  0x007a, 0x0082, 0x0089, 0x0091, 0x0098, 0x009f, 0x00a7, 0x00ae, 0x00b6, 0x00bd, 0x00c4, 0x00cb, 0x00d3, 0x00da, 0x00e2, 0x00e9,
+  0x00f0, 0x00f7, 0x00ff, 0x0106, 0x010d, 0x0115, 0x011c, 0x0123, 0x012a, 0x0132, 0x0138, 0x0140, 0x0147, 0x014e, 0x0156, 0x015c,
+  0x0164, 0x016b, 0x0172, 0x0179, 0x0180, 0x0187, 0x018f, 0x0195, 0x019c, 0x01a4, 0x01ab, 0x01b2, 0x01b8, 0x01bf, 0x01c6, 0x01cc,
+  0x01d4, 0x01da, 0x01e2, 0x01e9, 0x01ef, 0x01f6, 0x01fd, 0x0204, 0x020b, 0x0211, 0x0218, 0x021f, 0x0225, 0x022b, 0x0233, 0x0239,
+  0x023f, 0x0247, 0x024d, 0x0254, 0x025a, 0x0261, 0x0267, 0x026c, 0x0273, 0x027a, 0x0281, 0x0286, 0x028d, 0x0292, 0x029a, 0x029f,
+  0x02a6, 0x02ac, 0x02b1, 0x02b9, 0x02bf, 0x02c4, 0x02ca, 0x02d0, 0x02d6, 0x02dc, 0x02e2, 0x02e8, 0x02ee, 0x02f4, 0x02fa, 0x0300,
+  0x0304, 0x030b, 0x0311, 0x0315, 0x031c, 0x0322, 0x0327, 0x032d, 0x0332, 0x0338, 0x033d, 0x0344, 0x0348, 0x034d, 0x0354, 0x0358,
+  0x035d, 0x0362, 0x0369, 0x036d, 0x0372, 0x0377, 0x037c, 0x0381, 0x0385, 0x038a, 0x038f, 0x0394, 0x0399, 0x039e, 0x03a3, 0x03a8,
+  0x03ad, 0x03b2, 0x03b5, 0x03ba, 0x03bf, 0x03c5, 0x03ca, 0x03cc, 0x03d2, 0x03d7, 0x03da, 0x03df, 0x03e2, 0x03e7, 0x03ed, 0x03ef,
+  0x03f5, 0x03f7, 0x03fd, 0x0400, 0x0403, 0x0408, 0x040b, 0x0411, 0x0414, 0x0416, 0x041c, 0x041f, 0x0422, 0x0428, 0x042a, 0x042d,
+  0x0430, 0x0433, 0x0439, 0x043c, 0x043f, 0x0442, 0x0445, 0x0448, 0x044b, 0x044e, 0x0451, 0x0454, 0x0457, 0x045a, 0x045d, 0x0460,
+  0x0463, 0x0466, 0x0469, 0x046c, 0x046f, 0x0472, 0x0475, 0x0475, 0x0478, 0x047b, 0x047e, 0x047e, 0x0482, 0x0485, 0x0488, 0x0488,
+  0x048b, 0x048e, 0x048e, 0x0491, 0x0494, 0x0494, 0x0498, 0x0498, 0x049b, 0x049e, 0x049e, 0x04a1, 0x04a1, 0x04a4, 0x04a4, 0x04a8,
+  0x04a8, 0x04a8, 0x04ab, 0x04ab, 0x04ae, 0x04ae, 0x04ae, 0x04b1, 0x04b1, 0x04b1, 0x04b5, 0x04b5, 0x04b5, 0x04b8, 0x04b8, 0x04b8,
+  0x04b8, 0x04bb, 0x04bb, 0x04bb, 0x04bb, 0x04bb, 0x04bb, 0x04bb, 0x04be, 0x04be, 0x04be, 0x04be, 0x04be, 0x04be, 0x04be, 0x04be,
+  0x0003, 0x000a, 0x0012, 0x0019, 0x0020, 0x0028, 0x002f, 0x0036, 0x003d, 0x0045, 0x004c, 0x0053, 0x005b, 0x0062, 0x0069, 0x0071,
+  0x0078, 0x007f, 0x0086, 0x008d, 0x0095, 0x009c, 0x00a3, 0x00aa, 0x00b2, 0x00b9, 0x00c0, 0x00c7, 0x00ce, 0x00d6, 0x00dd, 0x00e4,
+  0x00eb, 0x00f2, 0x00f9, 0x0100, 0x0107, 0x010f, 0x0116, 0x011d, 0x0124, 0x012b, 0x0132, 0x0139, 0x0140, 0x0147, 0x014e, 0x0155,
+  0x015c, 0x0163, 0x016a, 0x0171, 0x0178, 0x017f, 0x0186, 0x018d, 0x0193, 0x019b, 0x01a2, 0x01a8, 0x01ae, 0x01b5, 0x01bc, 0x01c2,
+  0x01ca, 0x01d0, 0x01d8, 0x01de, 0x01e5, 0x01eb, 0x01f2, 0x01f9, 0x0200, 0x0205, 0x020c, 0x0214, 0x0219, 0x021f, 0x0227, 0x022d,
+  0x0233, 0x023a, 0x0241, 0x0247, 0x024d, 0x0254, 0x025a, 0x025f, 0x0266, 0x026c, 0x0273, 0x0278, 0x027f, 0x0284, 0x028b, 0x0291,
+  0x0298, 0x029d, 0x02a3, 0x02aa, 0x02b0, 0x02b5, 0x02bb, 0x02c0, 0x02c6, 0x02cc, 0x02d2, 0x02d8, 0x02de, 0x02e4, 0x02ea, 0x02f0,
+  0x02f4, 0x02fa, 0x0300, 0x0304, 0x030b, 0x0311, 0x0315, 0x031c, 0x0320, 0x0327, 0x032b, 0x0332, 0x0336, 0x033b, 0x0341, 0x0346,
+  0x034a, 0x034f, 0x0356, 0x035a, 0x035f, 0x0364, 0x0369, 0x036d, 0x0372, 0x0377, 0x037c, 0x0381, 0x0385, 0x038a, 0x038f, 0x0394,
+  0x0399, 0x039e, 0x03a1, 0x03a6, 0x03ab, 0x03b0, 0x03b5, 0x03b8, 0x03bd, 0x03c2, 0x03c5, 0x03ca, 0x03cc, 0x03d2, 0x03d7, 0x03da,
+  0x03df, 0x03e2, 0x03e7, 0x03ea, 0x03ed, 0x03f2, 0x03f5, 0x03fa, 0x03fd, 0x0400, 0x0406, 0x0408, 0x040b, 0x0411, 0x0414, 0x0416,
+  0x0419, 0x041c, 0x0422, 0x0425, 0x0428, 0x042a, 0x042d, 0x0430, 0x0433, 0x0436, 0x0439, 0x043c, 0x043f, 0x0442, 0x0445, 0x0448,
+  0x044b, 0x044e, 0x0451, 0x0454, 0x0457, 0x045a, 0x045d, 0x045d, 0x0460, 0x0463, 0x0466, 0x0466, 0x0469, 0x046c, 0x046f, 0x046f,
+  0x0472, 0x0475, 0x0475, 0x0478, 0x047b, 0x047b, 0x047e, 0x047e, 0x0482, 0x0485, 0x0485, 0x0488, 0x0488, 0x048b, 0x048b, 0x048e,
+  0x048e, 0x048e, 0x0491, 0x0491, 0x0494, 0x0494, 0x0494, 0x0498, 0x0498, 0x0498, 0x049b, 0x049b, 0x049b, 0x049e, 0x049e, 0x049e,
+  0x049e, 0x04a1, 0x04a1, 0x04a1, 0x04a1, 0x04a1, 0x04a1, 0x04a1, 0x04a4, 0x04a4, 0x04a4, 0x04a4, 0x04a4, 0x04a4, 0x04a4, 0x04a4,
+  0x0003, 0x000a, 0x0011, 0x0018, 0x0020, 0x0027, 0x002e, 0x0035, 0x003c, 0x0043, 0x004a, 0x0052, 0x0059, 0x0060, 0x0067, 0x006e,
+  0x0075, 0x007c, 0x0083, 0x008a, 0x0091, 0x0099, 0x00a0, 0x00a6, 0x00ae, 0x00b5, 0x00bc, 0x00c3, 0x00ca, 0x00d1, 0x00d8, 0x00df,
+  0x00e6, 0x00ed, 0x00f4, 0x00fb, 0x0102, 0x0109, 0x0110, 0x0117, 0x011e, 0x0125, 0x012b, 0x0133, 0x0139, 0x0140, 0x0147, 0x014d,
+  0x0155, 0x015b, 0x0162, 0x0169, 0x0170, 0x0177, 0x017e, 0x0184, 0x018a, 0x0192, 0x0199, 0x019f, 0x01a5, 0x01ac, 0x01b3, 0x01b9,
+  0x01c0, 0x01c6, 0x01ce, 0x01d4, 0x01da, 0x01e1, 0x01e7, 0x01ee, 0x01f5, 0x01fa, 0x0201, 0x0208, 0x020e, 0x0214, 0x021b, 0x0221,
+  0x0227, 0x022e, 0x0234, 0x023a, 0x0241, 0x0247, 0x024d, 0x0252, 0x0258, 0x025f, 0x0266, 0x026b, 0x0271, 0x0276, 0x027d, 0x0283,
+  0x028a, 0x028f, 0x0294, 0x029b, 0x02a1, 0x02a6, 0x02ac, 0x02b1, 0x02b7, 0x02bd, 0x02c2, 0x02c8, 0x02ce, 0x02d4, 0x02da, 0x02e0,
+  0x02e4, 0x02ea, 0x02f0, 0x02f4, 0x02fa, 0x0300, 0x0304, 0x030b, 0x030f, 0x0315, 0x031a, 0x0320, 0x0324, 0x0329, 0x032f, 0x0334,
+  0x0338, 0x033d, 0x0344, 0x0348, 0x034d, 0x0351, 0x0356, 0x035a, 0x035f, 0x0364, 0x0369, 0x036d, 0x0372, 0x0377, 0x037c, 0x0381,
+  0x0385, 0x038a, 0x038d, 0x0392, 0x0397, 0x039c, 0x03a1, 0x03a3, 0x03a8, 0x03ad, 0x03b0, 0x03b5, 0x03b8, 0x03bd, 0x03c2, 0x03c5,
+  0x03ca, 0x03cc, 0x03d2, 0x03d4, 0x03d7, 0x03dc, 0x03df, 0x03e4, 0x03e7, 0x03ea, 0x03ef, 0x03f2, 0x03f5, 0x03fa, 0x03fd, 0x0400,
+  0x0403, 0x0406, 0x040b, 0x040e, 0x0411, 0x0414, 0x0416, 0x0419, 0x041c, 0x041f, 0x0422, 0x0425, 0x0428, 0x042a, 0x042d, 0x0430,
+  0x0433, 0x0436, 0x0439, 0x043c, 0x043f, 0x0442, 0x0445, 0x0445, 0x0448, 0x044b, 0x044e, 0x044e, 0x0451, 0x0454, 0x0457, 0x0457,
+  0x045a, 0x045d, 0x045d, 0x0460, 0x0463, 0x0463, 0x0466, 0x0466, 0x0469, 0x046c, 0x046c, 0x046f, 0x046f, 0x0472, 0x0472, 0x0475,
+  0x0475, 0x0475, 0x0478, 0x0478, 0x047b, 0x047b, 0x047b, 0x047e, 0x047e, 0x047e, 0x0482, 0x0482, 0x0482, 0x0485, 0x0485, 0x0485,
+  0x0485, 0x0488, 0x0488, 0x0488, 0x0488, 0x0488, 0x0488, 0x0488, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b, 0x048b,
+  0x0003, 0x000a, 0x0011, 0x0018, 0x001f, 0x0026, 0x002d, 0x0034, 0x003b, 0x0042, 0x0049, 0x0050, 0x0057, 0x005e, 0x0065, 0x006c,
+  0x0073, 0x0079, 0x0081, 0x0087, 0x008e, 0x0095, 0x009c, 0x00a3, 0x00aa, 0x00b1, 0x00b8, 0x00bf, 0x00c6, 0x00cd, 0x00d3, 0x00da,
+  0x00e1, 0x00e8, 0x00ef, 0x00f5, 0x00fc, 0x0103, 0x010a, 0x0111, 0x0118, 0x011e, 0x0125, 0x012c, 0x0133, 0x0139, 0x0140, 0x0146,
+  0x014d, 0x0154, 0x015a, 0x0161, 0x0168, 0x016f, 0x0176, 0x017c, 0x0182, 0x0189, 0x0190, 0x0196, 0x019c, 0x01a3, 0x01aa, 0x01af,
+  0x01b6, 0x01bc, 0x01c4, 0x01ca, 0x01d0, 0x01d6, 0x01dd, 0x01e3, 0x01ea, 0x01ef, 0x01f6, 0x01fd, 0x0203, 0x0208, 0x020f, 0x0215,
+  0x021b, 0x0222, 0x0228, 0x022e, 0x0234, 0x023a, 0x0241, 0x0245, 0x024c, 0x0252, 0x0258, 0x025d, 0x0264, 0x0269, 0x0270, 0x0275,
+  0x027c, 0x0281, 0x0286, 0x028d, 0x0292, 0x0298, 0x029d, 0x02a3, 0x02a8, 0x02ae, 0x02b3, 0x02b9, 0x02bf, 0x02c4, 0x02ca, 0x02d0,
+  0x02d4, 0x02da, 0x02e0, 0x02e4, 0x02ea, 0x02f0, 0x02f4, 0x02fa, 0x02fe, 0x0304, 0x0309, 0x030f, 0x0313, 0x0318, 0x031e, 0x0322,
+  0x0327, 0x032b, 0x0332, 0x0336, 0x033b, 0x033f, 0x0344, 0x0348, 0x034d, 0x0351, 0x0356, 0x035a, 0x035f, 0x0364, 0x0369, 0x036d,
+  0x0372, 0x0377, 0x0379, 0x037e, 0x0383, 0x0388, 0x038d, 0x038f, 0x0394, 0x0399, 0x039c, 0x03a1, 0x03a3, 0x03a8, 0x03ad, 0x03b0,
+  0x03b5, 0x03b8, 0x03bd, 0x03bf, 0x03c2, 0x03c7, 0x03ca, 0x03cf, 0x03d2, 0x03d4, 0x03da, 0x03dc, 0x03df, 0x03e4, 0x03e7, 0x03ea,
+  0x03ed, 0x03ef, 0x03f5, 0x03f7, 0x03fa, 0x03fd, 0x0400, 0x0403, 0x0406, 0x0408, 0x040b, 0x040e, 0x0411, 0x0414, 0x0416, 0x0419,
+  0x041c, 0x041f, 0x0422, 0x0425, 0x0428, 0x042a, 0x042d, 0x042d, 0x0430, 0x0433, 0x0436, 0x0436, 0x0439, 0x043c, 0x043f, 0x043f,
+  0x0442, 0x0445, 0x0445, 0x0448, 0x044b, 0x044b, 0x044e, 0x044e, 0x0451, 0x0454, 0x0454, 0x0457, 0x0457, 0x045a, 0x045a, 0x045d,
+  0x045d, 0x045d, 0x0460, 0x0460, 0x0463, 0x0463, 0x0463, 0x0466, 0x0466, 0x0466, 0x0469, 0x0469, 0x0469, 0x046c, 0x046c, 0x046c,
+  0x046c, 0x046f, 0x046f, 0x046f, 0x046f, 0x046f, 0x046f, 0x046f, 0x0472, 0x0472, 0x0472, 0x0472, 0x0472, 0x0472, 0x0472, 0x0472,
+  0x0003, 0x000a, 0x0011, 0x0017, 0x001e, 0x0025, 0x002c, 0x0033, 0x003a, 0x0040, 0x0047, 0x004e, 0x0055, 0x005c, 0x0063, 0x0069,
+  0x0070, 0x0077, 0x007e, 0x0085, 0x008b, 0x0092, 0x0099, 0x009f, 0x00a6, 0x00ad, 0x00b4, 0x00bb, 0x00c1, 0x00c8, 0x00cf, 0x00d6,
+  0x00dc, 0x00e3, 0x00ea, 0x00f0, 0x00f7, 0x00fd, 0x0105, 0x010b, 0x0112, 0x0118, 0x011e, 0x0126, 0x012c, 0x0133, 0x0139, 0x013f,
+  0x0146, 0x014d, 0x0153, 0x0159, 0x0160, 0x0167, 0x016e, 0x0174, 0x017a, 0x0181, 0x0187, 0x018e, 0x0193, 0x019a, 0x01a0, 0x01a6,
+  0x01ad, 0x01b3, 0x01ba, 0x01c0, 0x01c6, 0x01cc, 0x01d3, 0x01d9, 0x01df, 0x01e5, 0x01eb, 0x01f2, 0x01f7, 0x01fd, 0x0204, 0x020a,
+  0x020f, 0x0216, 0x021c, 0x0222, 0x0228, 0x022e, 0x0234, 0x0239, 0x023f, 0x0245, 0x024c, 0x0250, 0x0257, 0x025c, 0x0262, 0x0267,
+  0x026e, 0x0273, 0x0278, 0x027f, 0x0284, 0x028a, 0x028f, 0x0294, 0x029a, 0x029f, 0x02a4, 0x02aa, 0x02b0, 0x02b5, 0x02bb, 0x02c0,
+  0x02c4, 0x02ca, 0x02d0, 0x02d4, 0x02da, 0x02e0, 0x02e4, 0x02ea, 0x02ee, 0x02f4, 0x02f8, 0x02fe, 0x0302, 0x0307, 0x030d, 0x0311,
+  0x0315, 0x031a, 0x0320, 0x0324, 0x0329, 0x032d, 0x0332, 0x0336, 0x033b, 0x033f, 0x0344, 0x0348, 0x034d, 0x0351, 0x0356, 0x035a,
+  0x035f, 0x0364, 0x0366, 0x036b, 0x0370, 0x0374, 0x0379, 0x037c, 0x0381, 0x0385, 0x0388, 0x038d, 0x038f, 0x0394, 0x0399, 0x039c,
+  0x03a1, 0x03a3, 0x03a8, 0x03ab, 0x03ad, 0x03b2, 0x03b5, 0x03ba, 0x03bd, 0x03bf, 0x03c5, 0x03c7, 0x03ca, 0x03cf, 0x03d2, 0x03d4,
+  0x03d7, 0x03da, 0x03df, 0x03e2, 0x03e4, 0x03e7, 0x03ea, 0x03ed, 0x03ef, 0x03f2, 0x03f5, 0x03f7, 0x03fa, 0x03fd, 0x0400, 0x0403,
+  0x0406, 0x0408, 0x040b, 0x040e, 0x0411, 0x0414, 0x0416, 0x0416, 0x0419, 0x041c, 0x041f, 0x041f, 0x0422, 0x0425, 0x0428, 0x0428,
+  0x042a, 0x042d, 0x042d, 0x0430, 0x0433, 0x0433, 0x0436, 0x0436, 0x0439, 0x043c, 0x043c, 0x043f, 0x043f, 0x0442, 0x0442, 0x0445,
+  0x0445, 0x0445, 0x0448, 0x0448, 0x044b, 0x044b, 0x044b, 0x044e, 0x044e, 0x044e, 0x0451, 0x0451, 0x0451, 0x0454, 0x0454, 0x0454,
+  0x0454, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x045a, 0x045a, 0x045a, 0x045a, 0x045a, 0x045a, 0x045a, 0x045a,
+  0x0003, 0x000a, 0x0010, 0x0017, 0x001e, 0x0024, 0x002b, 0x0032, 0x0038, 0x003f, 0x0046, 0x004c, 0x0053, 0x005a, 0x0060, 0x0067,
+  0x006e, 0x0074, 0x007b, 0x0082, 0x0088, 0x008f, 0x0096, 0x009c, 0x00a3, 0x00a9, 0x00b0, 0x00b7, 0x00bd, 0x00c4, 0x00ca, 0x00d1,
+  0x00d7, 0x00de, 0x00e5, 0x00eb, 0x00f1, 0x00f8, 0x00ff, 0x0105, 0x010c, 0x0112, 0x0118, 0x011f, 0x0126, 0x012c, 0x0133, 0x0138,
+  0x013f, 0x0145, 0x014c, 0x0152, 0x0158, 0x015f, 0x0166, 0x016c, 0x0172, 0x0179, 0x017f, 0x0185, 0x018a, 0x0191, 0x0197, 0x019d,
+  0x01a4, 0x01aa, 0x01b1, 0x01b6, 0x01bc, 0x01c2, 0x01c9, 0x01cf, 0x01d5, 0x01da, 0x01e1, 0x01e7, 0x01ed, 0x01f2, 0x01f9, 0x01fe,
+  0x0204, 0x020b, 0x0211, 0x0216, 0x021c, 0x0222, 0x0228, 0x022d, 0x0233, 0x0239, 0x023f, 0x0244, 0x024a, 0x024f, 0x0255, 0x025a,
+  0x0261, 0x0266, 0x026b, 0x0271, 0x0276, 0x027c, 0x0281, 0x0286, 0x028b, 0x0291, 0x0296, 0x029b, 0x02a1, 0x02a6, 0x02ac, 0x02b1,
+  0x02b5, 0x02bb, 0x02c0, 0x02c4, 0x02ca, 0x02d0, 0x02d4, 0x02da, 0x02de, 0x02e4, 0x02e8, 0x02ee, 0x02f2, 0x02f6, 0x02fc, 0x0300,
+  0x0304, 0x0309, 0x030f, 0x0313, 0x0318, 0x031c, 0x0320, 0x0324, 0x0329, 0x032d, 0x0332, 0x0336, 0x033b, 0x033f, 0x0344, 0x0348,
+  0x034d, 0x0351, 0x0354, 0x0358, 0x035d, 0x0362, 0x0366, 0x0369, 0x036d, 0x0372, 0x0374, 0x0379, 0x037c, 0x0381, 0x0385, 0x0388,
+  0x038d, 0x038f, 0x0394, 0x0397, 0x0399, 0x039e, 0x03a1, 0x03a6, 0x03a8, 0x03ab, 0x03b0, 0x03b2, 0x03b5, 0x03ba, 0x03bd, 0x03bf,
+  0x03c2, 0x03c5, 0x03ca, 0x03cc, 0x03cf, 0x03d2, 0x03d4, 0x03d7, 0x03da, 0x03dc, 0x03df, 0x03e2, 0x03e4, 0x03e7, 0x03ea, 0x03ed,
+  0x03ef, 0x03f2, 0x03f5, 0x03f7, 0x03fa, 0x03fd, 0x0400, 0x0400, 0x0403, 0x0406, 0x0408, 0x0408, 0x040b, 0x040e, 0x0411, 0x0411,
+  0x0414, 0x0416, 0x0416, 0x0419, 0x041c, 0x041c, 0x041f, 0x041f, 0x0422, 0x0425, 0x0425, 0x0428, 0x0428, 0x042a, 0x042a, 0x042d,
+  0x042d, 0x042d, 0x0430, 0x0430, 0x0433, 0x0433, 0x0433, 0x0436, 0x0436, 0x0436, 0x0439, 0x0439, 0x0439, 0x043c, 0x043c, 0x043c,
+  0x043c, 0x043f, 0x043f, 0x043f, 0x043f, 0x043f, 0x043f, 0x043f, 0x0442, 0x0442, 0x0442, 0x0442, 0x0442, 0x0442, 0x0442, 0x0442,
+  0x0003, 0x0009, 0x0010, 0x0016, 0x001d, 0x0023, 0x002a, 0x0031, 0x0037, 0x003e, 0x0044, 0x004b, 0x0051, 0x0058, 0x005e, 0x0065,
+  0x006b, 0x0072, 0x0078, 0x007f, 0x0085, 0x008c, 0x0093, 0x0099, 0x009f, 0x00a6, 0x00ac, 0x00b3, 0x00b9, 0x00c0, 0x00c6, 0x00cd,
+  0x00d3, 0x00d9, 0x00e0, 0x00e6, 0x00ec, 0x00f3, 0x00f9, 0x0100, 0x0106, 0x010c, 0x0112, 0x0119, 0x011f, 0x0126, 0x012c, 0x0132,
+  0x0138, 0x013e, 0x0145, 0x014b, 0x0151, 0x0158, 0x015e, 0x0164, 0x016a, 0x0171, 0x0177, 0x017d, 0x0182, 0x0188, 0x018f, 0x0194,
+  0x019b, 0x01a0, 0x01a7, 0x01ad, 0x01b3, 0x01b9, 0x01bf, 0x01c5, 0x01cb, 0x01d0, 0x01d6, 0x01dd, 0x01e2, 0x01e7, 0x01ee, 0x01f3,
+  0x01f9, 0x0200, 0x0205, 0x020b, 0x0211, 0x0216, 0x021c, 0x0221, 0x0227, 0x022d, 0x0233, 0x0237, 0x023d, 0x0242, 0x0248, 0x024d,
+  0x0254, 0x0258, 0x025d, 0x0264, 0x0269, 0x026e, 0x0273, 0x0278, 0x027d, 0x0283, 0x0288, 0x028d, 0x0292, 0x0298, 0x029d, 0x02a3,
+  0x02a6, 0x02ac, 0x02b1, 0x02b5, 0x02bb, 0x02c0, 0x02c4, 0x02ca, 0x02ce, 0x02d4, 0x02d8, 0x02de, 0x02e2, 0x02e6, 0x02ec, 0x02f0,
+  0x02f4, 0x02f8, 0x02fe, 0x0302, 0x0307, 0x030b, 0x030f, 0x0313, 0x0318, 0x031c, 0x0320, 0x0324, 0x0329, 0x032d, 0x0332, 0x0336,
+  0x033b, 0x033f, 0x0341, 0x0346, 0x034a, 0x034f, 0x0354, 0x0356, 0x035a, 0x035f, 0x0362, 0x0366, 0x0369, 0x036d, 0x0372, 0x0374,
+  0x0379, 0x037c, 0x0381, 0x0383, 0x0385, 0x038a, 0x038d, 0x0392, 0x0394, 0x0397, 0x039c, 0x039e, 0x03a1, 0x03a6, 0x03a8, 0x03ab,
+  0x03ad, 0x03b0, 0x03b5, 0x03b8, 0x03ba, 0x03bd, 0x03bf, 0x03c2, 0x03c5, 0x03c7, 0x03ca, 0x03cc, 0x03cf, 0x03d2, 0x03d4, 0x03d7,
+  0x03da, 0x03dc, 0x03df, 0x03e2, 0x03e4, 0x03e7, 0x03ea, 0x03ea, 0x03ed, 0x03ef, 0x03f2, 0x03f2, 0x03f5, 0x03f7, 0x03fa, 0x03fa,
+  0x03fd, 0x0400, 0x0400, 0x0403, 0x0406, 0x0406, 0x0408, 0x0408, 0x040b, 0x040e, 0x040e, 0x0411, 0x0411, 0x0414, 0x0414, 0x0416,
+  0x0416, 0x0416, 0x0419, 0x0419, 0x041c, 0x041c, 0x041c, 0x041f, 0x041f, 0x041f, 0x0422, 0x0422, 0x0422, 0x0425, 0x0425, 0x0425,
+  0x0425, 0x0428, 0x0428, 0x0428, 0x0428, 0x0428, 0x0428, 0x0428, 0x042a, 0x042a, 0x042a, 0x042a, 0x042a, 0x042a, 0x042a, 0x042a,
+  0x0003, 0x0009, 0x0010, 0x0016, 0x001c, 0x0023, 0x0029, 0x0030, 0x0036, 0x003c, 0x0043, 0x0049, 0x004f, 0x0056, 0x005c, 0x0063,
+  0x0069, 0x006f, 0x0076, 0x007c, 0x0082, 0x0089, 0x008f, 0x0095, 0x009c, 0x00a2, 0x00a9, 0x00af, 0x00b5, 0x00bc, 0x00c2, 0x00c8,
+  0x00ce, 0x00d5, 0x00db, 0x00e1, 0x00e7, 0x00ee, 0x00f4, 0x00fa, 0x0100, 0x0107, 0x010c, 0x0113, 0x0119, 0x011f, 0x0126, 0x012b,
+  0x0132, 0x0138, 0x013e, 0x0144, 0x014a, 0x0150, 0x0157, 0x015c, 0x0162, 0x0169, 0x016f, 0x0175, 0x017a, 0x0180, 0x0186, 0x018c,
+  0x0192, 0x0197, 0x019e, 0x01a4, 0x01aa, 0x01af, 0x01b5, 0x01bb, 0x01c1, 0x01c6, 0x01cc, 0x01d3, 0x01d8, 0x01dd, 0x01e3, 0x01e9,
+  0x01ee, 0x01f5, 0x01fa, 0x0200, 0x0205, 0x020b, 0x0211, 0x0215, 0x021b, 0x0221, 0x0227, 0x022b, 0x0231, 0x0236, 0x023c, 0x0241,
+  0x0247, 0x024c, 0x0250, 0x0257, 0x025c, 0x0261, 0x0266, 0x026b, 0x0270, 0x0275, 0x027a, 0x027f, 0x0284, 0x028a, 0x028f, 0x0294,
+  0x0298, 0x029d, 0x02a3, 0x02a6, 0x02ac, 0x02b1, 0x02b5, 0x02bb, 0x02bf, 0x02c4, 0x02c8, 0x02ce, 0x02d2, 0x02d6, 0x02dc, 0x02e0,
+  0x02e4, 0x02e8, 0x02ee, 0x02f2, 0x02f6, 0x02fa, 0x02fe, 0x0302, 0x0307, 0x030b, 0x030f, 0x0313, 0x0318, 0x031c, 0x0320, 0x0324,
+  0x0329, 0x032d, 0x032f, 0x0334, 0x0338, 0x033d, 0x0341, 0x0344, 0x0348, 0x034d, 0x034f, 0x0354, 0x0356, 0x035a, 0x035f, 0x0362,
+  0x0366, 0x0369, 0x036d, 0x0370, 0x0372, 0x0377, 0x0379, 0x037e, 0x0381, 0x0383, 0x0388, 0x038a, 0x038d, 0x0392, 0x0394, 0x0397,
+  0x0399, 0x039c, 0x03a1, 0x03a3, 0x03a6, 0x03a8, 0x03ab, 0x03ad, 0x03b0, 0x03b2, 0x03b5, 0x03b8, 0x03ba, 0x03bd, 0x03bf, 0x03c2,
+  0x03c5, 0x03c7, 0x03ca, 0x03cc, 0x03cf, 0x03d2, 0x03d4, 0x03d4, 0x03d7, 0x03da, 0x03dc, 0x03dc, 0x03df, 0x03e2, 0x03e4, 0x03e4,
+  0x03e7, 0x03ea, 0x03ea, 0x03ed, 0x03ef, 0x03ef, 0x03f2, 0x03f2, 0x03f5, 0x03f7, 0x03f7, 0x03fa, 0x03fa, 0x03fd, 0x03fd, 0x0400,
+  0x0400, 0x0400, 0x0403, 0x0403, 0x0406, 0x0406, 0x0406, 0x0408, 0x0408, 0x0408, 0x040b, 0x040b, 0x040b, 0x040e, 0x040e, 0x040e,
+  0x040e, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414,
+  0x0003, 0x0009, 0x000f, 0x0015, 0x001c, 0x0022, 0x0028, 0x002f, 0x0035, 0x003b, 0x0041, 0x0048, 0x004e, 0x0054, 0x005a, 0x0061,
+  0x0067, 0x006d, 0x0073, 0x0079, 0x0080, 0x0086, 0x008c, 0x0092, 0x0099, 0x009f, 0x00a5, 0x00ab, 0x00b1, 0x00b8, 0x00be, 0x00c4,
+  0x00ca, 0x00d0, 0x00d6, 0x00dc, 0x00e2, 0x00e8, 0x00ef, 0x00f5, 0x00fb, 0x0101, 0x0107, 0x010d, 0x0113, 0x0119, 0x011f, 0x0125,
+  0x012b, 0x0131, 0x0137, 0x013d, 0x0143, 0x0149, 0x014f, 0x0155, 0x015a, 0x0161, 0x0167, 0x016d, 0x0172, 0x0178, 0x017e, 0x0183,
+  0x0189, 0x018f, 0x0195, 0x019b, 0x01a0, 0x01a6, 0x01ac, 0x01b2, 0x01b8, 0x01bc, 0x01c2, 0x01c9, 0x01ce, 0x01d3, 0x01d9, 0x01de,
+  0x01e3, 0x01ea, 0x01ef, 0x01f5, 0x01fa, 0x0200, 0x0205, 0x020a, 0x020f, 0x0215, 0x021b, 0x021f, 0x0225, 0x022a, 0x0230, 0x0234,
+  0x023a, 0x023f, 0x0244, 0x024a, 0x024f, 0x0254, 0x0258, 0x025d, 0x0262, 0x0267, 0x026c, 0x0271, 0x0276, 0x027c, 0x0281, 0x0286,
+  0x028a, 0x028f, 0x0294, 0x0298, 0x029d, 0x02a3, 0x02a6, 0x02ac, 0x02b0, 0x02b5, 0x02b9, 0x02bf, 0x02c2, 0x02c6, 0x02cc, 0x02d0,
+  0x02d4, 0x02d8, 0x02de, 0x02e2, 0x02e6, 0x02ea, 0x02ee, 0x02f2, 0x02f6, 0x02fa, 0x02fe, 0x0302, 0x0307, 0x030b, 0x030f, 0x0313,
+  0x0318, 0x031c, 0x031e, 0x0322, 0x0327, 0x032b, 0x032f, 0x0332, 0x0336, 0x033b, 0x033d, 0x0341, 0x0344, 0x0348, 0x034d, 0x034f,
+  0x0354, 0x0356, 0x035a, 0x035d, 0x035f, 0x0364, 0x0366, 0x036b, 0x036d, 0x0370, 0x0374, 0x0377, 0x0379, 0x037e, 0x0381, 0x0383,
+  0x0385, 0x0388, 0x038d, 0x038f, 0x0392, 0x0394, 0x0397, 0x0399, 0x039c, 0x039e, 0x03a1, 0x03a3, 0x03a6, 0x03a8, 0x03ab, 0x03ad,
+  0x03b0, 0x03b2, 0x03b5, 0x03b8, 0x03ba, 0x03bd, 0x03bf, 0x03bf, 0x03c2, 0x03c5, 0x03c7, 0x03c7, 0x03ca, 0x03cc, 0x03cf, 0x03cf,
+  0x03d2, 0x03d4, 0x03d4, 0x03d7, 0x03da, 0x03da, 0x03dc, 0x03dc, 0x03df, 0x03e2, 0x03e2, 0x03e4, 0x03e4, 0x03e7, 0x03e7, 0x03ea,
+  0x03ea, 0x03ea, 0x03ed, 0x03ed, 0x03ef, 0x03ef, 0x03ef, 0x03f2, 0x03f2, 0x03f2, 0x03f5, 0x03f5, 0x03f5, 0x03f7, 0x03f7, 0x03f7,
+  0x03f7, 0x03fa, 0x03fa, 0x03fa, 0x03fa, 0x03fa, 0x03fa, 0x03fa, 0x03fd, 0x03fd, 0x03fd, 0x03fd, 0x03fd, 0x03fd, 0x03fd, 0x03fd,
+  0x0003, 0x0009, 0x000f, 0x0015, 0x001b, 0x0021, 0x0027, 0x002e, 0x0034, 0x003a, 0x0040, 0x0046, 0x004c, 0x0052, 0x0058, 0x005f,
+  0x0065, 0x006b, 0x0071, 0x0077, 0x007d, 0x0083, 0x0089, 0x008f, 0x0095, 0x009b, 0x00a2, 0x00a7, 0x00ad, 0x00b4, 0x00ba, 0x00c0,
+  0x00c6, 0x00cb, 0x00d2, 0x00d7, 0x00dd, 0x00e3, 0x00ea, 0x00ef, 0x00f5, 0x00fb, 0x0101, 0x0107, 0x010d, 0x0113, 0x0119, 0x011e,
+  0x0125, 0x012a, 0x0130, 0x0136, 0x013c, 0x0142, 0x0148, 0x014d, 0x0153, 0x0159, 0x015f, 0x0165, 0x016a, 0x0170, 0x0176, 0x017b,
+  0x0181, 0x0186, 0x018d, 0x0192, 0x0197, 0x019d, 0x01a3, 0x01a8, 0x01ae, 0x01b3, 0x01b9, 0x01bf, 0x01c4, 0x01c9, 0x01cf, 0x01d4,
+  0x01d9, 0x01df, 0x01e5, 0x01ea, 0x01ef, 0x01f5, 0x01fa, 0x01fe, 0x0204, 0x020a, 0x020f, 0x0214, 0x0219, 0x021e, 0x0224, 0x0228,
+  0x022e, 0x0233, 0x0237, 0x023d, 0x0242, 0x0247, 0x024c, 0x0250, 0x0255, 0x025a, 0x025f, 0x0264, 0x0269, 0x026e, 0x0273, 0x0278,
+  0x027c, 0x0281, 0x0286, 0x028a, 0x028f, 0x0294, 0x0298, 0x029d, 0x02a1, 0x02a6, 0x02aa, 0x02b0, 0x02b3, 0x02b7, 0x02bd, 0x02c0,
+  0x02c4, 0x02c8, 0x02ce, 0x02d2, 0x02d6, 0x02da, 0x02de, 0x02e2, 0x02e6, 0x02ea, 0x02ee, 0x02f2, 0x02f6, 0x02fa, 0x02fe, 0x0302,
+  0x0307, 0x030b, 0x030d, 0x0311, 0x0315, 0x031a, 0x031e, 0x0320, 0x0324, 0x0329, 0x032b, 0x032f, 0x0332, 0x0336, 0x033b, 0x033d,
+  0x0341, 0x0344, 0x0348, 0x034a, 0x034d, 0x0351, 0x0354, 0x0358, 0x035a, 0x035d, 0x0362, 0x0364, 0x0366, 0x036b, 0x036d, 0x0370,
+  0x0372, 0x0374, 0x0379, 0x037c, 0x037e, 0x0381, 0x0383, 0x0385, 0x0388, 0x038a, 0x038d, 0x038f, 0x0392, 0x0394, 0x0397, 0x0399,
+  0x039c, 0x039e, 0x03a1, 0x03a3, 0x03a6, 0x03a8, 0x03ab, 0x03ab, 0x03ad, 0x03b0, 0x03b2, 0x03b2, 0x03b5, 0x03b8, 0x03ba, 0x03ba,
+  0x03bd, 0x03bf, 0x03bf, 0x03c2, 0x03c5, 0x03c5, 0x03c7, 0x03c7, 0x03ca, 0x03cc, 0x03cc, 0x03cf, 0x03cf, 0x03d2, 0x03d2, 0x03d4,
+  0x03d4, 0x03d4, 0x03d7, 0x03d7, 0x03da, 0x03da, 0x03da, 0x03dc, 0x03dc, 0x03dc, 0x03df, 0x03df, 0x03df, 0x03e2, 0x03e2, 0x03e2,
+  0x03e2, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e4, 0x03e7, 0x03e7, 0x03e7, 0x03e7, 0x03e7, 0x03e7, 0x03e7, 0x03e7,
+  0x0003, 0x0009, 0x000e, 0x0014, 0x001a, 0x0020, 0x0027, 0x002d, 0x0032, 0x0038, 0x003e, 0x0045, 0x004a, 0x0051, 0x0056, 0x005d,
+  0x0063, 0x0068, 0x006e, 0x0074, 0x007a, 0x0080, 0x0086, 0x008c, 0x0092, 0x0098, 0x009e, 0x00a4, 0x00aa, 0x00b0, 0x00b6, 0x00bc,
+  0x00c1, 0x00c7, 0x00cd, 0x00d3, 0x00d9, 0x00df, 0x00e5, 0x00ea, 0x00f0, 0x00f6, 0x00fb, 0x0102, 0x0107, 0x010d, 0x0113, 0x0118,
+  0x011e, 0x0124, 0x012a, 0x012f, 0x0135, 0x013b, 0x0141, 0x0146, 0x014c, 0x0152, 0x0158, 0x015d, 0x0162, 0x0168, 0x016e, 0x0173,
+  0x0179, 0x017e, 0x0184, 0x0189, 0x018f, 0x0194, 0x019a, 0x019f, 0x01a5, 0x01aa, 0x01af, 0x01b5, 0x01ba, 0x01bf, 0x01c5, 0x01ca,
+  0x01cf, 0x01d5, 0x01da, 0x01df, 0x01e5, 0x01ea, 0x01ef, 0x01f3, 0x01f9, 0x01fe, 0x0204, 0x0208, 0x020e, 0x0212, 0x0218, 0x021c,
+  0x0222, 0x0227, 0x022b, 0x0231, 0x0236, 0x023a, 0x023f, 0x0244, 0x0248, 0x024d, 0x0252, 0x0257, 0x025c, 0x0261, 0x0266, 0x026b,
+  0x026e, 0x0273, 0x0278, 0x027c, 0x0281, 0x0286, 0x028a, 0x028f, 0x0292, 0x0298, 0x029b, 0x02a1, 0x02a4, 0x02a8, 0x02ae, 0x02b1,
+  0x02b5, 0x02b9, 0x02bf, 0x02c2, 0x02c6, 0x02ca, 0x02ce, 0x02d2, 0x02d6, 0x02da, 0x02de, 0x02e2, 0x02e6, 0x02ea, 0x02ee, 0x02f2,
+  0x02f6, 0x02fa, 0x02fc, 0x0300, 0x0304, 0x0309, 0x030d, 0x030f, 0x0313, 0x0318, 0x031a, 0x031e, 0x0320, 0x0324, 0x0329, 0x032b,
+  0x032f, 0x0332, 0x0336, 0x0338, 0x033b, 0x033f, 0x0341, 0x0346, 0x0348, 0x034a, 0x034f, 0x0351, 0x0354, 0x0358, 0x035a, 0x035d,
+  0x035f, 0x0362, 0x0366, 0x0369, 0x036b, 0x036d, 0x0370, 0x0372, 0x0374, 0x0377, 0x0379, 0x037c, 0x037e, 0x0381, 0x0383, 0x0385,
+  0x0388, 0x038a, 0x038d, 0x038f, 0x0392, 0x0394, 0x0397, 0x0397, 0x0399, 0x039c, 0x039e, 0x039e, 0x03a1, 0x03a3, 0x03a6, 0x03a6,
+  0x03a8, 0x03ab, 0x03ab, 0x03ad, 0x03b0, 0x03b0, 0x03b2, 0x03b2, 0x03b5, 0x03b8, 0x03b8, 0x03ba, 0x03ba, 0x03bd, 0x03bd, 0x03bf,
+  0x03bf, 0x03bf, 0x03c2, 0x03c2, 0x03c5, 0x03c5, 0x03c5, 0x03c7, 0x03c7, 0x03c7, 0x03ca, 0x03ca, 0x03ca, 0x03cc, 0x03cc, 0x03cc,
+  0x03cc, 0x03cf, 0x03cf, 0x03cf, 0x03cf, 0x03cf, 0x03cf, 0x03cf, 0x03d2, 0x03d2, 0x03d2, 0x03d2, 0x03d2, 0x03d2, 0x03d2, 0x03d2,
+  0x0002, 0x0008, 0x000e, 0x0014, 0x001a, 0x0020, 0x0026, 0x002c, 0x0031, 0x0037, 0x003d, 0x0043, 0x0049, 0x004f, 0x0055, 0x005b,
+  0x0060, 0x0066, 0x006c, 0x0072, 0x0077, 0x007d, 0x0083, 0x0089, 0x008f, 0x0095, 0x009b, 0x00a0, 0x00a6, 0x00ac, 0x00b2, 0x00b8,
+  0x00bd, 0x00c3, 0x00c9, 0x00ce, 0x00d4, 0x00da, 0x00e0, 0x00e5, 0x00eb, 0x00f1, 0x00f6, 0x00fc, 0x0102, 0x0107, 0x010d, 0x0112,
+  0x0118, 0x011e, 0x0123, 0x0129, 0x012e, 0x0134, 0x013a, 0x013f, 0x0145, 0x014b, 0x0150, 0x0156, 0x015a, 0x0160, 0x0166, 0x016b,
+  0x0171, 0x0176, 0x017c, 0x0181, 0x0186, 0x018c, 0x0191, 0x0196, 0x019c, 0x01a0, 0x01a6, 0x01ac, 0x01b1, 0x01b5, 0x01bb, 0x01c0,
+  0x01c5, 0x01cb, 0x01d0, 0x01d5, 0x01da, 0x01df, 0x01e5, 0x01e9, 0x01ee, 0x01f3, 0x01f9, 0x01fd, 0x0203, 0x0207, 0x020c, 0x0211,
+  0x0216, 0x021b, 0x021f, 0x0225, 0x022a, 0x022e, 0x0233, 0x0237, 0x023c, 0x0241, 0x0245, 0x024a, 0x024f, 0x0254, 0x0258, 0x025d,
+  0x0261, 0x0266, 0x026b, 0x026e, 0x0273, 0x0278, 0x027c, 0x0281, 0x0284, 0x028a, 0x028d, 0x0292, 0x0296, 0x029a, 0x029f, 0x02a3,
+  0x02a6, 0x02aa, 0x02b0, 0x02b3, 0x02b7, 0x02bb, 0x02bf, 0x02c2, 0x02c6, 0x02ca, 0x02ce, 0x02d2, 0x02d6, 0x02da, 0x02de, 0x02e2,
+  0x02e6, 0x02ea, 0x02ec, 0x02f0, 0x02f4, 0x02f8, 0x02fc, 0x02fe, 0x0302, 0x0307, 0x0309, 0x030d, 0x030f, 0x0313, 0x0318, 0x031a,
+  0x031e, 0x0320, 0x0324, 0x0327, 0x0329, 0x032d, 0x032f, 0x0334, 0x0336, 0x0338, 0x033d, 0x033f, 0x0341, 0x0346, 0x0348, 0x034a,
+  0x034d, 0x034f, 0x0354, 0x0356, 0x0358, 0x035a, 0x035d, 0x035f, 0x0362, 0x0364, 0x0366, 0x0369, 0x036b, 0x036d, 0x0370, 0x0372,
+  0x0374, 0x0377, 0x0379, 0x037c, 0x037e, 0x0381, 0x0383, 0x0383, 0x0385, 0x0388, 0x038a, 0x038a, 0x038d, 0x038f, 0x0392, 0x0392,
+  0x0394, 0x0397, 0x0397, 0x0399, 0x039c, 0x039c, 0x039e, 0x039e, 0x03a1, 0x03a3, 0x03a3, 0x03a6, 0x03a6, 0x03a8, 0x03a8, 0x03ab,
+  0x03ab, 0x03ab, 0x03ad, 0x03ad, 0x03b0, 0x03b0, 0x03b0, 0x03b2, 0x03b2, 0x03b2, 0x03b5, 0x03b5, 0x03b5, 0x03b8, 0x03b8, 0x03b8,
+  0x03b8, 0x03ba, 0x03ba, 0x03ba, 0x03ba, 0x03ba, 0x03ba, 0x03ba, 0x03bd, 0x03bd, 0x03bd, 0x03bd, 0x03bd, 0x03bd, 0x03bd, 0x03bd,
+  0x0002, 0x0008, 0x000e, 0x0014, 0x0019, 0x001f, 0x0025, 0x002b, 0x0030, 0x0036, 0x003c, 0x0042, 0x0047, 0x004d, 0x0053, 0x0059,
+  0x005e, 0x0064, 0x006a, 0x006f, 0x0075, 0x007b, 0x0081, 0x0086, 0x008c, 0x0091, 0x0097, 0x009d, 0x00a2, 0x00a8, 0x00ae, 0x00b4,
+  0x00b9, 0x00bf, 0x00c4, 0x00ca, 0x00cf, 0x00d5, 0x00db, 0x00e0, 0x00e6, 0x00ec, 0x00f1, 0x00f7, 0x00fc, 0x0102, 0x0107, 0x010c,
+  0x0112, 0x0118, 0x011d, 0x0122, 0x0128, 0x012e, 0x0133, 0x0138, 0x013e, 0x0144, 0x0149, 0x014e, 0x0153, 0x0158, 0x015e, 0x0163,
+  0x0169, 0x016e, 0x0174, 0x0179, 0x017e, 0x0183, 0x0188, 0x018e, 0x0193, 0x0197, 0x019d, 0x01a3, 0x01a7, 0x01ac, 0x01b2, 0x01b6,
+  0x01bb, 0x01c1, 0x01c6, 0x01cb, 0x01d0, 0x01d5, 0x01da, 0x01de, 0x01e3, 0x01e9, 0x01ee, 0x01f2, 0x01f7, 0x01fb, 0x0201, 0x0205,
+  0x020b, 0x020f, 0x0214, 0x0219, 0x021e, 0x0222, 0x0227, 0x022b, 0x0230, 0x0234, 0x0239, 0x023d, 0x0242, 0x0247, 0x024c, 0x0250,
+  0x0254, 0x0258, 0x025d, 0x0261, 0x0266, 0x026b, 0x026e, 0x0273, 0x0276, 0x027c, 0x027f, 0x0284, 0x0288, 0x028b, 0x0291, 0x0294,
+  0x0298, 0x029b, 0x02a1, 0x02a4, 0x02a8, 0x02ac, 0x02b0, 0x02b3, 0x02b7, 0x02bb, 0x02bf, 0x02c2, 0x02c6, 0x02ca, 0x02ce, 0x02d2,
+  0x02d6, 0x02da, 0x02dc, 0x02e0, 0x02e4, 0x02e8, 0x02ec, 0x02ee, 0x02f2, 0x02f6, 0x02f8, 0x02fc, 0x02fe, 0x0302, 0x0307, 0x0309,
+  0x030d, 0x030f, 0x0313, 0x0315, 0x0318, 0x031c, 0x031e, 0x0322, 0x0324, 0x0327, 0x032b, 0x032d, 0x032f, 0x0334, 0x0336, 0x0338,
+  0x033b, 0x033d, 0x0341, 0x0344, 0x0346, 0x0348, 0x034a, 0x034d, 0x034f, 0x0351, 0x0354, 0x0356, 0x0358, 0x035a, 0x035d, 0x035f,
+  0x0362, 0x0364, 0x0366, 0x0369, 0x036b, 0x036d, 0x0370, 0x0370, 0x0372, 0x0374, 0x0377, 0x0377, 0x0379, 0x037c, 0x037e, 0x037e,
+  0x0381, 0x0383, 0x0383, 0x0385, 0x0388, 0x0388, 0x038a, 0x038a, 0x038d, 0x038f, 0x038f, 0x0392, 0x0392, 0x0394, 0x0394, 0x0397,
+  0x0397, 0x0397, 0x0399, 0x0399, 0x039c, 0x039c, 0x039c, 0x039e, 0x039e, 0x039e, 0x03a1, 0x03a1, 0x03a1, 0x03a3, 0x03a3, 0x03a3,
+  0x03a3, 0x03a6, 0x03a6, 0x03a6, 0x03a6, 0x03a6, 0x03a6, 0x03a6, 0x03a8, 0x03a8, 0x03a8, 0x03a8, 0x03a8, 0x03a8, 0x03a8, 0x03a8,
+  0x0002, 0x0008, 0x000e, 0x0013, 0x0019, 0x001e, 0x0024, 0x002a, 0x002f, 0x0035, 0x003b, 0x0040, 0x0046, 0x004b, 0x0051, 0x0057,
+  0x005c, 0x0062, 0x0067, 0x006d, 0x0072, 0x0078, 0x007e, 0x0083, 0x0089, 0x008e, 0x0094, 0x0099, 0x009f, 0x00a5, 0x00aa, 0x00b0,
+  0x00b5, 0x00bb, 0x00c0, 0x00c6, 0x00cb, 0x00d1, 0x00d6, 0x00dc, 0x00e1, 0x00e7, 0x00ec, 0x00f1, 0x00f7, 0x00fc, 0x0102, 0x0107,
+  0x010c, 0x0112, 0x0117, 0x011c, 0x0122, 0x0127, 0x012d, 0x0132, 0x0137, 0x013d, 0x0142, 0x0147, 0x014c, 0x0151, 0x0157, 0x015b,
+  0x0161, 0x0166, 0x016c, 0x0171, 0x0176, 0x017b, 0x0180, 0x0185, 0x018a, 0x018f, 0x0194, 0x019a, 0x019e, 0x01a3, 0x01a8, 0x01ad,
+  0x01b2, 0x01b8, 0x01bc, 0x01c1, 0x01c6, 0x01cb, 0x01d0, 0x01d4, 0x01d9, 0x01de, 0x01e3, 0x01e7, 0x01ed, 0x01f1, 0x01f6, 0x01fa,
+  0x0200, 0x0204, 0x0208, 0x020e, 0x0212, 0x0216, 0x021b, 0x021f, 0x0224, 0x0228, 0x022d, 0x0231, 0x0236, 0x023a, 0x023f, 0x0244,
+  0x0247, 0x024c, 0x0250, 0x0254, 0x0258, 0x025d, 0x0261, 0x0266, 0x0269, 0x026e, 0x0271, 0x0276, 0x027a, 0x027d, 0x0283, 0x0286,
+  0x028a, 0x028d, 0x0292, 0x0296, 0x029a, 0x029d, 0x02a1, 0x02a4, 0x02a8, 0x02ac, 0x02b0, 0x02b3, 0x02b7, 0x02bb, 0x02bf, 0x02c2,
+  0x02c6, 0x02ca, 0x02cc, 0x02d0, 0x02d4, 0x02d8, 0x02dc, 0x02de, 0x02e2, 0x02e6, 0x02e8, 0x02ec, 0x02ee, 0x02f2, 0x02f6, 0x02f8,
+  0x02fc, 0x02fe, 0x0302, 0x0304, 0x0307, 0x030b, 0x030d, 0x0311, 0x0313, 0x0315, 0x031a, 0x031c, 0x031e, 0x0322, 0x0324, 0x0327,
+  0x0329, 0x032b, 0x032f, 0x0332, 0x0334, 0x0336, 0x0338, 0x033b, 0x033d, 0x033f, 0x0341, 0x0344, 0x0346, 0x0348, 0x034a, 0x034d,
+  0x034f, 0x0351, 0x0354, 0x0356, 0x0358, 0x035a, 0x035d, 0x035d, 0x035f, 0x0362, 0x0364, 0x0364, 0x0366, 0x0369, 0x036b, 0x036b,
+  0x036d, 0x0370, 0x0370, 0x0372, 0x0374, 0x0374, 0x0377, 0x0377, 0x0379, 0x037c, 0x037c, 0x037e, 0x037e, 0x0381, 0x0381, 0x0383,
+  0x0383, 0x0383, 0x0385, 0x0385, 0x0388, 0x0388, 0x0388, 0x038a, 0x038a, 0x038a, 0x038d, 0x038d, 0x038d, 0x038f, 0x038f, 0x038f,
+  0x038f, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0394, 0x0394, 0x0394, 0x0394, 0x0394, 0x0394, 0x0394, 0x0394,
+  0x0002, 0x0008, 0x000d, 0x0013, 0x0018, 0x001e, 0x0023, 0x0029, 0x002e, 0x0034, 0x0039, 0x003f, 0x0044, 0x004a, 0x004f, 0x0055,
+  0x005a, 0x0060, 0x0065, 0x006b, 0x0070, 0x0076, 0x007b, 0x0080, 0x0086, 0x008b, 0x0091, 0x0096, 0x009c, 0x00a1, 0x00a6, 0x00ac,
+  0x00b1, 0x00b7, 0x00bc, 0x00c1, 0x00c7, 0x00cc, 0x00d2, 0x00d7, 0x00dc, 0x00e2, 0x00e7, 0x00ec, 0x00f1, 0x00f7, 0x00fc, 0x0101,
+  0x0107, 0x010c, 0x0111, 0x0116, 0x011b, 0x0121, 0x0126, 0x012b, 0x0130, 0x0136, 0x013b, 0x0140, 0x0145, 0x014a, 0x014f, 0x0154,
+  0x0159, 0x015e, 0x0164, 0x0169, 0x016e, 0x0173, 0x0178, 0x017d, 0x0182, 0x0186, 0x018c, 0x0191, 0x0195, 0x019a, 0x019f, 0x01a4,
+  0x01a8, 0x01ae, 0x01b3, 0x01b8, 0x01bc, 0x01c1, 0x01c6, 0x01ca, 0x01cf, 0x01d4, 0x01d9, 0x01dd, 0x01e2, 0x01e6, 0x01eb, 0x01ef,
+  0x01f5, 0x01f9, 0x01fd, 0x0203, 0x0207, 0x020b, 0x020f, 0x0214, 0x0218, 0x021c, 0x0221, 0x0225, 0x022a, 0x022e, 0x0233, 0x0237,
+  0x023a, 0x023f, 0x0244, 0x0247, 0x024c, 0x0250, 0x0254, 0x0258, 0x025c, 0x0261, 0x0264, 0x0269, 0x026c, 0x0270, 0x0275, 0x0278,
+  0x027c, 0x027f, 0x0284, 0x0288, 0x028b, 0x028f, 0x0292, 0x0296, 0x029a, 0x029d, 0x02a1, 0x02a4, 0x02a8, 0x02ac, 0x02b0, 0x02b3,
+  0x02b7, 0x02bb, 0x02bd, 0x02c0, 0x02c4, 0x02c8, 0x02cc, 0x02ce, 0x02d2, 0x02d6, 0x02d8, 0x02dc, 0x02de, 0x02e2, 0x02e6, 0x02e8,
+  0x02ec, 0x02ee, 0x02f2, 0x02f4, 0x02f6, 0x02fa, 0x02fc, 0x0300, 0x0302, 0x0304, 0x0309, 0x030b, 0x030d, 0x0311, 0x0313, 0x0315,
+  0x0318, 0x031a, 0x031e, 0x0320, 0x0322, 0x0324, 0x0327, 0x0329, 0x032b, 0x032d, 0x032f, 0x0332, 0x0334, 0x0336, 0x0338, 0x033b,
+  0x033d, 0x033f, 0x0341, 0x0344, 0x0346, 0x0348, 0x034a, 0x034a, 0x034d, 0x034f, 0x0351, 0x0351, 0x0354, 0x0356, 0x0358, 0x0358,
+  0x035a, 0x035d, 0x035d, 0x035f, 0x0362, 0x0362, 0x0364, 0x0364, 0x0366, 0x0369, 0x0369, 0x036b, 0x036b, 0x036d, 0x036d, 0x0370,
+  0x0370, 0x0370, 0x0372, 0x0372, 0x0374, 0x0374, 0x0374, 0x0377, 0x0377, 0x0377, 0x0379, 0x0379, 0x0379, 0x037c, 0x037c, 0x037c,
+  0x037c, 0x037e, 0x037e, 0x037e, 0x037e, 0x037e, 0x037e, 0x037e, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381,
+  0x0002, 0x0008, 0x000d, 0x0012, 0x0018, 0x001d, 0x0023, 0x0028, 0x002d, 0x0033, 0x0038, 0x003d, 0x0043, 0x0048, 0x004e, 0x0053,
+  0x0058, 0x005e, 0x0063, 0x0068, 0x006e, 0x0073, 0x0078, 0x007d, 0x0083, 0x0088, 0x008e, 0x0093, 0x0098, 0x009e, 0x00a3, 0x00a8,
+  0x00ad, 0x00b3, 0x00b8, 0x00bd, 0x00c2, 0x00c8, 0x00cd, 0x00d2, 0x00d7, 0x00dd, 0x00e2, 0x00e7, 0x00ec, 0x00f1, 0x00f7, 0x00fb,
+  0x0101, 0x0106, 0x010b, 0x0110, 0x0115, 0x011b, 0x0120, 0x0125, 0x012a, 0x012f, 0x0134, 0x0139, 0x013e, 0x0143, 0x0148, 0x014d,
+  0x0152, 0x0157, 0x015c, 0x0161, 0x0166, 0x016b, 0x0170, 0x0175, 0x017a, 0x017e, 0x0183, 0x0188, 0x018d, 0x0191, 0x0196, 0x019b,
+  0x019f, 0x01a5, 0x01aa, 0x01ae, 0x01b3, 0x01b8, 0x01bc, 0x01c0, 0x01c5, 0x01ca, 0x01cf, 0x01d3, 0x01d8, 0x01dc, 0x01e1, 0x01e5,
+  0x01ea, 0x01ee, 0x01f2, 0x01f7, 0x01fb, 0x0200, 0x0204, 0x0208, 0x020c, 0x0211, 0x0215, 0x0219, 0x021e, 0x0222, 0x0227, 0x022b,
+  0x022e, 0x0233, 0x0237, 0x023a, 0x023f, 0x0244, 0x0247, 0x024c, 0x024f, 0x0254, 0x0257, 0x025c, 0x025f, 0x0262, 0x0267, 0x026b,
+  0x026e, 0x0271, 0x0276, 0x027a, 0x027d, 0x0281, 0x0284, 0x0288, 0x028b, 0x028f, 0x0292, 0x0296, 0x029a, 0x029d, 0x02a1, 0x02a4,
+  0x02a8, 0x02ac, 0x02ae, 0x02b1, 0x02b5, 0x02b9, 0x02bd, 0x02bf, 0x02c2, 0x02c6, 0x02c8, 0x02cc, 0x02ce, 0x02d2, 0x02d6, 0x02d8,
+  0x02dc, 0x02de, 0x02e2, 0x02e4, 0x02e6, 0x02ea, 0x02ec, 0x02f0, 0x02f2, 0x02f4, 0x02f8, 0x02fa, 0x02fc, 0x0300, 0x0302, 0x0304,
+  0x0307, 0x0309, 0x030d, 0x030f, 0x0311, 0x0313, 0x0315, 0x0318, 0x031a, 0x031c, 0x031e, 0x0320, 0x0322, 0x0324, 0x0327, 0x0329,
+  0x032b, 0x032d, 0x032f, 0x0332, 0x0334, 0x0336, 0x0338, 0x0338, 0x033b, 0x033d, 0x033f, 0x033f, 0x0341, 0x0344, 0x0346, 0x0346,
+  0x0348, 0x034a, 0x034a, 0x034d, 0x034f, 0x034f, 0x0351, 0x0351, 0x0354, 0x0356, 0x0356, 0x0358, 0x0358, 0x035a, 0x035a, 0x035d,
+  0x035d, 0x035d, 0x035f, 0x035f, 0x0362, 0x0362, 0x0362, 0x0364, 0x0364, 0x0364, 0x0366, 0x0366, 0x0366, 0x0369, 0x0369, 0x0369,
+  0x0369, 0x036b, 0x036b, 0x036b, 0x036b, 0x036b, 0x036b, 0x036b, 0x036d, 0x036d, 0x036d, 0x036d, 0x036d, 0x036d, 0x036d, 0x036d,
+  0x0002, 0x0007, 0x000d, 0x0012, 0x0017, 0x001c, 0x0022, 0x0027, 0x002c, 0x0032, 0x0037, 0x003c, 0x0041, 0x0047, 0x004c, 0x0051,
+  0x0056, 0x005c, 0x0061, 0x0066, 0x006b, 0x0071, 0x0076, 0x007b, 0x0080, 0x0085, 0x008b, 0x0090, 0x0095, 0x009a, 0x009f, 0x00a5,
+  0x00aa, 0x00af, 0x00b4, 0x00b9, 0x00be, 0x00c3, 0x00c9, 0x00ce, 0x00d3, 0x00d8, 0x00dd, 0x00e2, 0x00e7, 0x00ec, 0x00f1, 0x00f6,
+  0x00fb, 0x0100, 0x0105, 0x010a, 0x010f, 0x0115, 0x011a, 0x011e, 0x0123, 0x0129, 0x012e, 0x0133, 0x0137, 0x013c, 0x0141, 0x0145,
+  0x014b, 0x014f, 0x0155, 0x0159, 0x015e, 0x0163, 0x0168, 0x016d, 0x0172, 0x0176, 0x017b, 0x0180, 0x0184, 0x0188, 0x018e, 0x0192,
+  0x0196, 0x019c, 0x01a0, 0x01a5, 0x01aa, 0x01ae, 0x01b3, 0x01b6, 0x01bb, 0x01c0, 0x01c5, 0x01c9, 0x01ce, 0x01d1, 0x01d6, 0x01da,
+  0x01df, 0x01e3, 0x01e7, 0x01ed, 0x01f1, 0x01f5, 0x01f9, 0x01fd, 0x0201, 0x0205, 0x020a, 0x020e, 0x0212, 0x0216, 0x021b, 0x021f,
+  0x0222, 0x0227, 0x022b, 0x022e, 0x0233, 0x0237, 0x023a, 0x023f, 0x0242, 0x0247, 0x024a, 0x024f, 0x0252, 0x0255, 0x025a, 0x025d,
+  0x0261, 0x0264, 0x0269, 0x026c, 0x0270, 0x0273, 0x0276, 0x027a, 0x027d, 0x0281, 0x0284, 0x0288, 0x028b, 0x028f, 0x0292, 0x0296,
+  0x029a, 0x029d, 0x029f, 0x02a3, 0x02a6, 0x02aa, 0x02ae, 0x02b0, 0x02b3, 0x02b7, 0x02b9, 0x02bd, 0x02bf, 0x02c2, 0x02c6, 0x02c8,
+  0x02cc, 0x02ce, 0x02d2, 0x02d4, 0x02d6, 0x02da, 0x02dc, 0x02e0, 0x02e2, 0x02e4, 0x02e8, 0x02ea, 0x02ec, 0x02f0, 0x02f2, 0x02f4,
+  0x02f6, 0x02f8, 0x02fc, 0x02fe, 0x0300, 0x0302, 0x0304, 0x0307, 0x0309, 0x030b, 0x030d, 0x030f, 0x0311, 0x0313, 0x0315, 0x0318,
+  0x031a, 0x031c, 0x031e, 0x0320, 0x0322, 0x0324, 0x0327, 0x0327, 0x0329, 0x032b, 0x032d, 0x032d, 0x032f, 0x0332, 0x0334, 0x0334,
+  0x0336, 0x0338, 0x0338, 0x033b, 0x033d, 0x033d, 0x033f, 0x033f, 0x0341, 0x0344, 0x0344, 0x0346, 0x0346, 0x0348, 0x0348, 0x034a,
+  0x034a, 0x034a, 0x034d, 0x034d, 0x034f, 0x034f, 0x034f, 0x0351, 0x0351, 0x0351, 0x0354, 0x0354, 0x0354, 0x0356, 0x0356, 0x0356,
+  0x0356, 0x0358, 0x0358, 0x0358, 0x0358, 0x0358, 0x0358, 0x0358, 0x035a, 0x035a, 0x035a, 0x035a, 0x035a, 0x035a, 0x035a, 0x035a,
+  0x0002, 0x0007, 0x000c, 0x0012, 0x0017, 0x001c, 0x0021, 0x0026, 0x002b, 0x0030, 0x0036, 0x003b, 0x0040, 0x0045, 0x004a, 0x004f,
+  0x0055, 0x005a, 0x005f, 0x0064, 0x0069, 0x006e, 0x0073, 0x0078, 0x007d, 0x0082, 0x0088, 0x008d, 0x0092, 0x0097, 0x009c, 0x00a1,
+  0x00a6, 0x00ab, 0x00b0, 0x00b5, 0x00ba, 0x00bf, 0x00c4, 0x00c9, 0x00ce, 0x00d3, 0x00d8, 0x00dd, 0x00e2, 0x00e7, 0x00ec, 0x00f1,
+  0x00f6, 0x00fb, 0x0100, 0x0105, 0x010a, 0x010f, 0x0114, 0x0118, 0x011d, 0x0122, 0x0127, 0x012c, 0x0130, 0x0135, 0x013a, 0x013e,
+  0x0144, 0x0148, 0x014d, 0x0152, 0x0157, 0x015b, 0x0160, 0x0165, 0x016a, 0x016e, 0x0173, 0x0178, 0x017c, 0x0180, 0x0185, 0x0189,
+  0x018e, 0x0193, 0x0197, 0x019c, 0x01a0, 0x01a5, 0x01aa, 0x01ad, 0x01b2, 0x01b6, 0x01bb, 0x01bf, 0x01c4, 0x01c7, 0x01cc, 0x01d0,
+  0x01d5, 0x01d9, 0x01dd, 0x01e2, 0x01e6, 0x01ea, 0x01ee, 0x01f2, 0x01f6, 0x01fa, 0x01fe, 0x0203, 0x0207, 0x020b, 0x020f, 0x0214,
+  0x0216, 0x021b, 0x021f, 0x0222, 0x0227, 0x022b, 0x022e, 0x0233, 0x0236, 0x023a, 0x023d, 0x0242, 0x0245, 0x0248, 0x024d, 0x0250,
+  0x0254, 0x0257, 0x025c, 0x025f, 0x0262, 0x0266, 0x0269, 0x026c, 0x0270, 0x0273, 0x0276, 0x027a, 0x027d, 0x0281, 0x0284, 0x0288,
+  0x028b, 0x028f, 0x0291, 0x0294, 0x0298, 0x029b, 0x029f, 0x02a1, 0x02a4, 0x02a8, 0x02aa, 0x02ae, 0x02b0, 0x02b3, 0x02b7, 0x02b9,
+  0x02bd, 0x02bf, 0x02c2, 0x02c4, 0x02c6, 0x02ca, 0x02cc, 0x02d0, 0x02d2, 0x02d4, 0x02d8, 0x02da, 0x02dc, 0x02e0, 0x02e2, 0x02e4,
+  0x02e6, 0x02e8, 0x02ec, 0x02ee, 0x02f0, 0x02f2, 0x02f4, 0x02f6, 0x02f8, 0x02fa, 0x02fc, 0x02fe, 0x0300, 0x0302, 0x0304, 0x0307,
+  0x0309, 0x030b, 0x030d, 0x030f, 0x0311, 0x0313, 0x0315, 0x0315, 0x0318, 0x031a, 0x031c, 0x031c, 0x031e, 0x0320, 0x0322, 0x0322,
+  0x0324, 0x0327, 0x0327, 0x0329, 0x032b, 0x032b, 0x032d, 0x032d, 0x032f, 0x0332, 0x0332, 0x0334, 0x0334, 0x0336, 0x0336, 0x0338,
+  0x0338, 0x0338, 0x033b, 0x033b, 0x033d, 0x033d, 0x033d, 0x033f, 0x033f, 0x033f, 0x0341, 0x0341, 0x0341, 0x0344, 0x0344, 0x0344,
+  0x0344, 0x0346, 0x0346, 0x0346, 0x0346, 0x0346, 0x0346, 0x0346, 0x0348, 0x0348, 0x0348, 0x0348, 0x0348, 0x0348, 0x0348, 0x0348,
+  0x0002, 0x0007, 0x000c, 0x0011, 0x0016, 0x001b, 0x0020, 0x0025, 0x002a, 0x002f, 0x0034, 0x003a, 0x003e, 0x0044, 0x0049, 0x004e,
+  0x0053, 0x0058, 0x005d, 0x0062, 0x0067, 0x006c, 0x0071, 0x0076, 0x007b, 0x0080, 0x0085, 0x008a, 0x008f, 0x0094, 0x0099, 0x009e,
+  0x00a2, 0x00a7, 0x00ac, 0x00b1, 0x00b6, 0x00bb, 0x00c0, 0x00c5, 0x00ca, 0x00cf, 0x00d3, 0x00d9, 0x00dd, 0x00e2, 0x00e7, 0x00ec,
+  0x00f1, 0x00f5, 0x00fa, 0x00ff, 0x0104, 0x0109, 0x010e, 0x0112, 0x0117, 0x011c, 0x0121, 0x0126, 0x012a, 0x012e, 0x0133, 0x0138,
+  0x013d, 0x0141, 0x0146, 0x014b, 0x014f, 0x0154, 0x0158, 0x015d, 0x0162, 0x0166, 0x016b, 0x0170, 0x0174, 0x0178, 0x017d, 0x0181,
+  0x0185, 0x018a, 0x018f, 0x0193, 0x0197, 0x019c, 0x01a0, 0x01a4, 0x01a8, 0x01ad, 0x01b2, 0x01b5, 0x01ba, 0x01be, 0x01c2, 0x01c6,
+  0x01cb, 0x01cf, 0x01d3, 0x01d8, 0x01dc, 0x01df, 0x01e3, 0x01e7, 0x01eb, 0x01ef, 0x01f3, 0x01f7, 0x01fb, 0x0200, 0x0204, 0x0208,
+  0x020b, 0x020f, 0x0214, 0x0216, 0x021b, 0x021f, 0x0222, 0x0227, 0x022a, 0x022e, 0x0231, 0x0236, 0x0239, 0x023c, 0x0241, 0x0244,
+  0x0247, 0x024a, 0x024f, 0x0252, 0x0255, 0x0258, 0x025c, 0x025f, 0x0262, 0x0266, 0x0269, 0x026c, 0x0270, 0x0273, 0x0276, 0x027a,
+  0x027d, 0x0281, 0x0283, 0x0286, 0x028a, 0x028d, 0x0291, 0x0292, 0x0296, 0x029a, 0x029b, 0x029f, 0x02a1, 0x02a4, 0x02a8, 0x02aa,
+  0x02ae, 0x02b0, 0x02b3, 0x02b5, 0x02b7, 0x02bb, 0x02bd, 0x02c0, 0x02c2, 0x02c4, 0x02c8, 0x02ca, 0x02cc, 0x02d0, 0x02d2, 0x02d4,
+  0x02d6, 0x02d8, 0x02dc, 0x02de, 0x02e0, 0x02e2, 0x02e4, 0x02e6, 0x02e8, 0x02ea, 0x02ec, 0x02ee, 0x02f0, 0x02f2, 0x02f4, 0x02f6,
+  0x02f8, 0x02fa, 0x02fc, 0x02fe, 0x0300, 0x0302, 0x0304, 0x0304, 0x0307, 0x0309, 0x030b, 0x030b, 0x030d, 0x030f, 0x0311, 0x0311,
+  0x0313, 0x0315, 0x0315, 0x0318, 0x031a, 0x031a, 0x031c, 0x031c, 0x031e, 0x0320, 0x0320, 0x0322, 0x0322, 0x0324, 0x0324, 0x0327,
+  0x0327, 0x0327, 0x0329, 0x0329, 0x032b, 0x032b, 0x032b, 0x032d, 0x032d, 0x032d, 0x032f, 0x032f, 0x032f, 0x0332, 0x0332, 0x0332,
+  0x0332, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336,
+  0x0002, 0x0007, 0x000c, 0x0011, 0x0016, 0x001b, 0x0020, 0x0025, 0x0029, 0x002e, 0x0033, 0x0038, 0x003d, 0x0042, 0x0047, 0x004c,
+  0x0051, 0x0056, 0x005b, 0x0060, 0x0064, 0x0069, 0x006e, 0x0073, 0x0078, 0x007d, 0x0082, 0x0087, 0x008c, 0x0091, 0x0095, 0x009a,
+  0x009f, 0x00a4, 0x00a9, 0x00ad, 0x00b2, 0x00b7, 0x00bc, 0x00c1, 0x00c6, 0x00ca, 0x00cf, 0x00d4, 0x00d9, 0x00dd, 0x00e2, 0x00e7,
+  0x00ec, 0x00f0, 0x00f5, 0x00f9, 0x00fe, 0x0103, 0x0108, 0x010c, 0x0111, 0x0116, 0x011b, 0x011f, 0x0123, 0x0128, 0x012d, 0x0131,
+  0x0136, 0x013a, 0x013f, 0x0144, 0x0148, 0x014d, 0x0151, 0x0156, 0x015a, 0x015e, 0x0163, 0x0168, 0x016c, 0x0170, 0x0175, 0x0179,
+  0x017d, 0x0182, 0x0186, 0x018a, 0x018f, 0x0193, 0x0197, 0x019b, 0x019f, 0x01a4, 0x01a8, 0x01ac, 0x01b1, 0x01b4, 0x01b9, 0x01bc,
+  0x01c1, 0x01c5, 0x01c9, 0x01ce, 0x01d1, 0x01d5, 0x01d9, 0x01dd, 0x01e1, 0x01e5, 0x01e9, 0x01ed, 0x01f1, 0x01f5, 0x01f9, 0x01fd,
+  0x0200, 0x0204, 0x0208, 0x020b, 0x020f, 0x0214, 0x0216, 0x021b, 0x021e, 0x0222, 0x0225, 0x022a, 0x022d, 0x0230, 0x0234, 0x0237,
+  0x023a, 0x023d, 0x0242, 0x0245, 0x0248, 0x024c, 0x024f, 0x0252, 0x0255, 0x0258, 0x025c, 0x025f, 0x0262, 0x0266, 0x0269, 0x026c,
+  0x0270, 0x0273, 0x0275, 0x0278, 0x027c, 0x027f, 0x0283, 0x0284, 0x0288, 0x028b, 0x028d, 0x0291, 0x0292, 0x0296, 0x029a, 0x029b,
+  0x029f, 0x02a1, 0x02a4, 0x02a6, 0x02a8, 0x02ac, 0x02ae, 0x02b1, 0x02b3, 0x02b5, 0x02b9, 0x02bb, 0x02bd, 0x02c0, 0x02c2, 0x02c4,
+  0x02c6, 0x02c8, 0x02cc, 0x02ce, 0x02d0, 0x02d2, 0x02d4, 0x02d6, 0x02d8, 0x02da, 0x02dc, 0x02de, 0x02e0, 0x02e2, 0x02e4, 0x02e6,
+  0x02e8, 0x02ea, 0x02ec, 0x02ee, 0x02f0, 0x02f2, 0x02f4, 0x02f4, 0x02f6, 0x02f8, 0x02fa, 0x02fa, 0x02fc, 0x02fe, 0x0300, 0x0300,
+  0x0302, 0x0304, 0x0304, 0x0307, 0x0309, 0x0309, 0x030b, 0x030b, 0x030d, 0x030f, 0x030f, 0x0311, 0x0311, 0x0313, 0x0313, 0x0315,
+  0x0315, 0x0315, 0x0318, 0x0318, 0x031a, 0x031a, 0x031a, 0x031c, 0x031c, 0x031c, 0x031e, 0x031e, 0x031e, 0x0320, 0x0320, 0x0320,
+  0x0320, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0324, 0x0324, 0x0324, 0x0324, 0x0324, 0x0324, 0x0324, 0x0324,
+  0x0002, 0x0007, 0x000c, 0x0010, 0x0015, 0x001a, 0x001f, 0x0024, 0x0029, 0x002d, 0x0032, 0x0037, 0x003c, 0x0041, 0x0046, 0x004a,
+  0x004f, 0x0054, 0x0059, 0x005e, 0x0062, 0x0067, 0x006c, 0x0071, 0x0076, 0x007a, 0x007f, 0x0084, 0x0089, 0x008d, 0x0092, 0x0097,
+  0x009c, 0x00a0, 0x00a5, 0x00aa, 0x00ae, 0x00b3, 0x00b8, 0x00bd, 0x00c1, 0x00c6, 0x00ca, 0x00cf, 0x00d4, 0x00d9, 0x00dd, 0x00e2,
+  0x00e7, 0x00eb, 0x00ef, 0x00f4, 0x00f9, 0x00fd, 0x0102, 0x0107, 0x010b, 0x0110, 0x0115, 0x0119, 0x011d, 0x0122, 0x0126, 0x012a,
+  0x012f, 0x0133, 0x0138, 0x013d, 0x0141, 0x0145, 0x014a, 0x014e, 0x0153, 0x0157, 0x015b, 0x0160, 0x0164, 0x0168, 0x016d, 0x0171,
+  0x0175, 0x017a, 0x017e, 0x0182, 0x0186, 0x018a, 0x018f, 0x0192, 0x0196, 0x019b, 0x019f, 0x01a3, 0x01a7, 0x01ab, 0x01af, 0x01b3,
+  0x01b8, 0x01bb, 0x01bf, 0x01c4, 0x01c7, 0x01cb, 0x01cf, 0x01d3, 0x01d6, 0x01da, 0x01de, 0x01e2, 0x01e6, 0x01ea, 0x01ee, 0x01f2,
+  0x01f5, 0x01f9, 0x01fd, 0x0200, 0x0204, 0x0208, 0x020b, 0x020f, 0x0212, 0x0216, 0x0219, 0x021e, 0x0221, 0x0224, 0x0228, 0x022b,
+  0x022e, 0x0231, 0x0236, 0x0239, 0x023c, 0x023f, 0x0242, 0x0245, 0x0248, 0x024c, 0x024f, 0x0252, 0x0255, 0x0258, 0x025c, 0x025f,
+  0x0262, 0x0266, 0x0267, 0x026b, 0x026e, 0x0271, 0x0275, 0x0276, 0x027a, 0x027d, 0x027f, 0x0283, 0x0284, 0x0288, 0x028b, 0x028d,
+  0x0291, 0x0292, 0x0296, 0x0298, 0x029a, 0x029d, 0x029f, 0x02a3, 0x02a4, 0x02a6, 0x02aa, 0x02ac, 0x02ae, 0x02b1, 0x02b3, 0x02b5,
+  0x02b7, 0x02b9, 0x02bd, 0x02bf, 0x02c0, 0x02c2, 0x02c4, 0x02c6, 0x02c8, 0x02ca, 0x02cc, 0x02ce, 0x02d0, 0x02d2, 0x02d4, 0x02d6,
+  0x02d8, 0x02da, 0x02dc, 0x02de, 0x02e0, 0x02e2, 0x02e4, 0x02e4, 0x02e6, 0x02e8, 0x02ea, 0x02ea, 0x02ec, 0x02ee, 0x02f0, 0x02f0,
+  0x02f2, 0x02f4, 0x02f4, 0x02f6, 0x02f8, 0x02f8, 0x02fa, 0x02fa, 0x02fc, 0x02fe, 0x02fe, 0x0300, 0x0300, 0x0302, 0x0302, 0x0304,
+  0x0304, 0x0304, 0x0307, 0x0307, 0x0309, 0x0309, 0x0309, 0x030b, 0x030b, 0x030b, 0x030d, 0x030d, 0x030d, 0x030f, 0x030f, 0x030f,
+  0x030f, 0x0311, 0x0311, 0x0311, 0x0311, 0x0311, 0x0311, 0x0311, 0x0313, 0x0313, 0x0313, 0x0313, 0x0313, 0x0313, 0x0313, 0x0313,
+  0x0002, 0x0007, 0x000b, 0x0010, 0x0015, 0x0019, 0x001e, 0x0023, 0x0028, 0x002c, 0x0031, 0x0036, 0x003b, 0x003f, 0x0044, 0x0049,
+  0x004e, 0x0052, 0x0057, 0x005c, 0x0060, 0x0065, 0x006a, 0x006e, 0x0073, 0x0077, 0x007c, 0x0081, 0x0086, 0x008a, 0x008f, 0x0094,
+  0x0098, 0x009d, 0x00a2, 0x00a6, 0x00ab, 0x00af, 0x00b4, 0x00b9, 0x00bd, 0x00c2, 0x00c6, 0x00cb, 0x00cf, 0x00d4, 0x00d9, 0x00dd,
+  0x00e2, 0x00e6, 0x00ea, 0x00ef, 0x00f3, 0x00f8, 0x00fd, 0x0101, 0x0105, 0x010a, 0x010f, 0x0113, 0x0117, 0x011b, 0x0120, 0x0124,
+  0x0129, 0x012d, 0x0132, 0x0136, 0x013a, 0x013e, 0x0143, 0x0147, 0x014c, 0x014f, 0x0154, 0x0158, 0x015c, 0x0160, 0x0165, 0x0169,
+  0x016d, 0x0172, 0x0176, 0x017a, 0x017e, 0x0182, 0x0186, 0x0189, 0x018e, 0x0192, 0x0196, 0x019a, 0x019e, 0x01a2, 0x01a6, 0x01aa,
+  0x01ae, 0x01b2, 0x01b5, 0x01ba, 0x01be, 0x01c1, 0x01c5, 0x01c9, 0x01cc, 0x01d0, 0x01d4, 0x01d8, 0x01dc, 0x01df, 0x01e3, 0x01e7,
+  0x01ea, 0x01ee, 0x01f2, 0x01f5, 0x01f9, 0x01fd, 0x0200, 0x0204, 0x0207, 0x020b, 0x020e, 0x0212, 0x0215, 0x0218, 0x021c, 0x021f,
+  0x0222, 0x0225, 0x022a, 0x022d, 0x0230, 0x0233, 0x0236, 0x0239, 0x023c, 0x023f, 0x0242, 0x0245, 0x0248, 0x024c, 0x024f, 0x0252,
+  0x0255, 0x0258, 0x025a, 0x025d, 0x0261, 0x0264, 0x0267, 0x0269, 0x026c, 0x0270, 0x0271, 0x0275, 0x0276, 0x027a, 0x027d, 0x027f,
+  0x0283, 0x0284, 0x0288, 0x028a, 0x028b, 0x028f, 0x0291, 0x0294, 0x0296, 0x0298, 0x029b, 0x029d, 0x029f, 0x02a3, 0x02a4, 0x02a6,
+  0x02a8, 0x02aa, 0x02ae, 0x02b0, 0x02b1, 0x02b3, 0x02b5, 0x02b7, 0x02b9, 0x02bb, 0x02bd, 0x02bf, 0x02c0, 0x02c2, 0x02c4, 0x02c6,
+  0x02c8, 0x02ca, 0x02cc, 0x02ce, 0x02d0, 0x02d2, 0x02d4, 0x02d4, 0x02d6, 0x02d8, 0x02da, 0x02da, 0x02dc, 0x02de, 0x02e0, 0x02e0,
+  0x02e2, 0x02e4, 0x02e4, 0x02e6, 0x02e8, 0x02e8, 0x02ea, 0x02ea, 0x02ec, 0x02ee, 0x02ee, 0x02f0, 0x02f0, 0x02f2, 0x02f2, 0x02f4,
+  0x02f4, 0x02f4, 0x02f6, 0x02f6, 0x02f8, 0x02f8, 0x02f8, 0x02fa, 0x02fa, 0x02fa, 0x02fc, 0x02fc, 0x02fc, 0x02fe, 0x02fe, 0x02fe,
+  0x02fe, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302,
+  0x0002, 0x0006, 0x000b, 0x0010, 0x0014, 0x0019, 0x001e, 0x0022, 0x0027, 0x002b, 0x0030, 0x0035, 0x0039, 0x003e, 0x0043, 0x0047,
+  0x004c, 0x0050, 0x0055, 0x005a, 0x005e, 0x0063, 0x0067, 0x006c, 0x0071, 0x0075, 0x007a, 0x007e, 0x0083, 0x0087, 0x008c, 0x0091,
+  0x0095, 0x0099, 0x009e, 0x00a2, 0x00a7, 0x00ac, 0x00b0, 0x00b5, 0x00b9, 0x00be, 0x00c2, 0x00c7, 0x00cb, 0x00cf, 0x00d4, 0x00d8,
+  0x00dd, 0x00e1, 0x00e5, 0x00ea, 0x00ee, 0x00f3, 0x00f7, 0x00fb, 0x0100, 0x0105, 0x0109, 0x010d, 0x0111, 0x0115, 0x011a, 0x011e,
+  0x0122, 0x0126, 0x012b, 0x012f, 0x0133, 0x0138, 0x013c, 0x0140, 0x0145, 0x0148, 0x014d, 0x0151, 0x0155, 0x0158, 0x015d, 0x0161,
+  0x0165, 0x016a, 0x016e, 0x0172, 0x0176, 0x017a, 0x017e, 0x0181, 0x0185, 0x0189, 0x018e, 0x0191, 0x0195, 0x0199, 0x019d, 0x01a0,
+  0x01a5, 0x01a8, 0x01ac, 0x01b1, 0x01b4, 0x01b8, 0x01bb, 0x01bf, 0x01c2, 0x01c6, 0x01ca, 0x01ce, 0x01d1, 0x01d5, 0x01d9, 0x01dd,
+  0x01df, 0x01e3, 0x01e7, 0x01ea, 0x01ee, 0x01f2, 0x01f5, 0x01f9, 0x01fb, 0x0200, 0x0203, 0x0207, 0x020a, 0x020c, 0x0211, 0x0214,
+  0x0216, 0x0219, 0x021e, 0x0221, 0x0224, 0x0227, 0x022a, 0x022d, 0x0230, 0x0233, 0x0236, 0x0239, 0x023c, 0x023f, 0x0242, 0x0245,
+  0x0248, 0x024c, 0x024d, 0x0250, 0x0254, 0x0257, 0x025a, 0x025c, 0x025f, 0x0262, 0x0264, 0x0267, 0x0269, 0x026c, 0x0270, 0x0271,
+  0x0275, 0x0276, 0x027a, 0x027c, 0x027d, 0x0281, 0x0283, 0x0286, 0x0288, 0x028a, 0x028d, 0x028f, 0x0291, 0x0294, 0x0296, 0x0298,
+  0x029a, 0x029b, 0x029f, 0x02a1, 0x02a3, 0x02a4, 0x02a6, 0x02a8, 0x02aa, 0x02ac, 0x02ae, 0x02b0, 0x02b1, 0x02b3, 0x02b5, 0x02b7,
+  0x02b9, 0x02bb, 0x02bd, 0x02bf, 0x02c0, 0x02c2, 0x02c4, 0x02c4, 0x02c6, 0x02c8, 0x02ca, 0x02ca, 0x02cc, 0x02ce, 0x02d0, 0x02d0,
+  0x02d2, 0x02d4, 0x02d4, 0x02d6, 0x02d8, 0x02d8, 0x02da, 0x02da, 0x02dc, 0x02de, 0x02de, 0x02e0, 0x02e0, 0x02e2, 0x02e2, 0x02e4,
+  0x02e4, 0x02e4, 0x02e6, 0x02e6, 0x02e8, 0x02e8, 0x02e8, 0x02ea, 0x02ea, 0x02ea, 0x02ec, 0x02ec, 0x02ec, 0x02ee, 0x02ee, 0x02ee,
+  0x02ee, 0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x02f0, 0x02f2, 0x02f2, 0x02f2, 0x02f2, 0x02f2, 0x02f2, 0x02f2, 0x02f2,
+  0x0002, 0x0006, 0x000b, 0x000f, 0x0014, 0x0018, 0x001d, 0x0021, 0x0026, 0x002b, 0x002f, 0x0034, 0x0038, 0x003d, 0x0041, 0x0046,
+  0x004a, 0x004f, 0x0053, 0x0058, 0x005c, 0x0061, 0x0065, 0x0069, 0x006e, 0x0072, 0x0077, 0x007b, 0x0080, 0x0085, 0x0089, 0x008d,
+  0x0092, 0x0096, 0x009b, 0x009f, 0x00a3, 0x00a8, 0x00ac, 0x00b1, 0x00b5, 0x00ba, 0x00be, 0x00c2, 0x00c7, 0x00cb, 0x00cf, 0x00d3,
+  0x00d8, 0x00dc, 0x00e0, 0x00e5, 0x00e9, 0x00ee, 0x00f2, 0x00f6, 0x00fa, 0x00ff, 0x0103, 0x0107, 0x010b, 0x010f, 0x0114, 0x0118,
+  0x011c, 0x0120, 0x0125, 0x0129, 0x012d, 0x0131, 0x0135, 0x0139, 0x013e, 0x0141, 0x0145, 0x014a, 0x014d, 0x0151, 0x0156, 0x0159,
+  0x015d, 0x0162, 0x0166, 0x016a, 0x016e, 0x0172, 0x0176, 0x0179, 0x017d, 0x0181, 0x0185, 0x0188, 0x018d, 0x0190, 0x0194, 0x0197,
+  0x019c, 0x019f, 0x01a3, 0x01a7, 0x01ab, 0x01ae, 0x01b2, 0x01b5, 0x01b9, 0x01bc, 0x01c0, 0x01c4, 0x01c7, 0x01cb, 0x01cf, 0x01d3,
+  0x01d5, 0x01d9, 0x01dd, 0x01df, 0x01e3, 0x01e7, 0x01ea, 0x01ee, 0x01f1, 0x01f5, 0x01f7, 0x01fb, 0x01fe, 0x0201, 0x0205, 0x0208,
+  0x020b, 0x020e, 0x0212, 0x0215, 0x0218, 0x021b, 0x021e, 0x0221, 0x0224, 0x0227, 0x022a, 0x022d, 0x0230, 0x0233, 0x0236, 0x0239,
+  0x023c, 0x023f, 0x0241, 0x0244, 0x0247, 0x024a, 0x024d, 0x024f, 0x0252, 0x0255, 0x0257, 0x025a, 0x025c, 0x025f, 0x0262, 0x0264,
+  0x0267, 0x0269, 0x026c, 0x026e, 0x0270, 0x0273, 0x0275, 0x0278, 0x027a, 0x027c, 0x027f, 0x0281, 0x0283, 0x0286, 0x0288, 0x028a,
+  0x028b, 0x028d, 0x0291, 0x0292, 0x0294, 0x0296, 0x0298, 0x029a, 0x029b, 0x029d, 0x029f, 0x02a1, 0x02a3, 0x02a4, 0x02a6, 0x02a8,
+  0x02aa, 0x02ac, 0x02ae, 0x02b0, 0x02b1, 0x02b3, 0x02b5, 0x02b5, 0x02b7, 0x02b9, 0x02bb, 0x02bb, 0x02bd, 0x02bf, 0x02c0, 0x02c0,
+  0x02c2, 0x02c4, 0x02c4, 0x02c6, 0x02c8, 0x02c8, 0x02ca, 0x02ca, 0x02cc, 0x02ce, 0x02ce, 0x02d0, 0x02d0, 0x02d2, 0x02d2, 0x02d4,
+  0x02d4, 0x02d4, 0x02d6, 0x02d6, 0x02d8, 0x02d8, 0x02d8, 0x02da, 0x02da, 0x02da, 0x02dc, 0x02dc, 0x02dc, 0x02de, 0x02de, 0x02de,
+  0x02de, 0x02e0, 0x02e0, 0x02e0, 0x02e0, 0x02e0, 0x02e0, 0x02e0, 0x02e2, 0x02e2, 0x02e2, 0x02e2, 0x02e2, 0x02e2, 0x02e2, 0x02e2,
+  0x0002, 0x0006, 0x000b, 0x000f, 0x0013, 0x0018, 0x001c, 0x0021, 0x0025, 0x002a, 0x002e, 0x0032, 0x0037, 0x003b, 0x0040, 0x0044,
+  0x0049, 0x004d, 0x0051, 0x0056, 0x005a, 0x005f, 0x0063, 0x0067, 0x006c, 0x0070, 0x0075, 0x0079, 0x007d, 0x0082, 0x0086, 0x008a,
+  0x008f, 0x0093, 0x0097, 0x009c, 0x00a0, 0x00a4, 0x00a9, 0x00ad, 0x00b1, 0x00b6, 0x00ba, 0x00be, 0x00c2, 0x00c7, 0x00cb, 0x00cf,
+  0x00d3, 0x00d7, 0x00dc, 0x00e0, 0x00e4, 0x00e8, 0x00ed, 0x00f1, 0x00f5, 0x00f9, 0x00fd, 0x0102, 0x0105, 0x010a, 0x010e, 0x0112,
+  0x0116, 0x011a, 0x011e, 0x0122, 0x0126, 0x012a, 0x012e, 0x0133, 0x0137, 0x013a, 0x013e, 0x0143, 0x0146, 0x014a, 0x014e, 0x0152,
+  0x0156, 0x015a, 0x015e, 0x0162, 0x0166, 0x016a, 0x016e, 0x0171, 0x0175, 0x0179, 0x017d, 0x0180, 0x0184, 0x0187, 0x018c, 0x018f,
+  0x0193, 0x0196, 0x019a, 0x019e, 0x01a2, 0x01a5, 0x01a8, 0x01ac, 0x01af, 0x01b3, 0x01b6, 0x01ba, 0x01be, 0x01c1, 0x01c5, 0x01c9,
+  0x01cb, 0x01cf, 0x01d3, 0x01d5, 0x01d9, 0x01dd, 0x01df, 0x01e3, 0x01e6, 0x01ea, 0x01ed, 0x01f1, 0x01f3, 0x01f6, 0x01fa, 0x01fd,
+  0x0200, 0x0203, 0x0207, 0x020a, 0x020c, 0x020f, 0x0212, 0x0215, 0x0218, 0x021b, 0x021e, 0x0221, 0x0224, 0x0227, 0x022a, 0x022d,
+  0x0230, 0x0233, 0x0234, 0x0237, 0x023a, 0x023d, 0x0241, 0x0242, 0x0245, 0x0248, 0x024a, 0x024d, 0x024f, 0x0252, 0x0255, 0x0257,
+  0x025a, 0x025c, 0x025f, 0x0261, 0x0262, 0x0266, 0x0267, 0x026b, 0x026c, 0x026e, 0x0271, 0x0273, 0x0275, 0x0278, 0x027a, 0x027c,
+  0x027d, 0x027f, 0x0283, 0x0284, 0x0286, 0x0288, 0x028a, 0x028b, 0x028d, 0x028f, 0x0291, 0x0292, 0x0294, 0x0296, 0x0298, 0x029a,
+  0x029b, 0x029d, 0x029f, 0x02a1, 0x02a3, 0x02a4, 0x02a6, 0x02a6, 0x02a8, 0x02aa, 0x02ac, 0x02ac, 0x02ae, 0x02b0, 0x02b1, 0x02b1,
+  0x02b3, 0x02b5, 0x02b5, 0x02b7, 0x02b9, 0x02b9, 0x02bb, 0x02bb, 0x02bd, 0x02bf, 0x02bf, 0x02c0, 0x02c0, 0x02c2, 0x02c2, 0x02c4,
+  0x02c4, 0x02c4, 0x02c6, 0x02c6, 0x02c8, 0x02c8, 0x02c8, 0x02ca, 0x02ca, 0x02ca, 0x02cc, 0x02cc, 0x02cc, 0x02ce, 0x02ce, 0x02ce,
+  0x02ce, 0x02d0, 0x02d0, 0x02d0, 0x02d0, 0x02d0, 0x02d0, 0x02d0, 0x02d2, 0x02d2, 0x02d2, 0x02d2, 0x02d2, 0x02d2, 0x02d2, 0x02d2,
+  0x0002, 0x0006, 0x000a, 0x000f, 0x0013, 0x0017, 0x001c, 0x0020, 0x0024, 0x0029, 0x002d, 0x0031, 0x0036, 0x003a, 0x003e, 0x0043,
+  0x0047, 0x004b, 0x0050, 0x0054, 0x0058, 0x005d, 0x0061, 0x0065, 0x0069, 0x006e, 0x0072, 0x0076, 0x007a, 0x007f, 0x0083, 0x0087,
+  0x008c, 0x0090, 0x0094, 0x0098, 0x009c, 0x00a1, 0x00a5, 0x00a9, 0x00ad, 0x00b2, 0x00b6, 0x00ba, 0x00be, 0x00c2, 0x00c7, 0x00ca,
+  0x00cf, 0x00d3, 0x00d7, 0x00db, 0x00df, 0x00e3, 0x00e8, 0x00ec, 0x00ef, 0x00f4, 0x00f8, 0x00fc, 0x0100, 0x0104, 0x0108, 0x010c,
+  0x0110, 0x0114, 0x0118, 0x011c, 0x0120, 0x0124, 0x0128, 0x012c, 0x0130, 0x0133, 0x0138, 0x013c, 0x013f, 0x0143, 0x0147, 0x014b,
+  0x014e, 0x0153, 0x0157, 0x015a, 0x015e, 0x0162, 0x0166, 0x0169, 0x016d, 0x0171, 0x0175, 0x0178, 0x017c, 0x017f, 0x0183, 0x0186,
+  0x018a, 0x018e, 0x0191, 0x0195, 0x0199, 0x019c, 0x019f, 0x01a3, 0x01a6, 0x01aa, 0x01ad, 0x01b1, 0x01b4, 0x01b8, 0x01bb, 0x01bf,
+  0x01c1, 0x01c5, 0x01c9, 0x01cb, 0x01cf, 0x01d3, 0x01d5, 0x01d9, 0x01dc, 0x01df, 0x01e2, 0x01e6, 0x01e9, 0x01eb, 0x01ef, 0x01f2,
+  0x01f5, 0x01f7, 0x01fb, 0x01fe, 0x0201, 0x0204, 0x0207, 0x020a, 0x020c, 0x020f, 0x0212, 0x0215, 0x0218, 0x021b, 0x021e, 0x0221,
+  0x0224, 0x0227, 0x0228, 0x022b, 0x022e, 0x0231, 0x0234, 0x0236, 0x0239, 0x023c, 0x023d, 0x0241, 0x0242, 0x0245, 0x0248, 0x024a,
+  0x024d, 0x024f, 0x0252, 0x0254, 0x0255, 0x0258, 0x025a, 0x025d, 0x025f, 0x0261, 0x0264, 0x0266, 0x0267, 0x026b, 0x026c, 0x026e,
+  0x0270, 0x0271, 0x0275, 0x0276, 0x0278, 0x027a, 0x027c, 0x027d, 0x027f, 0x0281, 0x0283, 0x0284, 0x0286, 0x0288, 0x028a, 0x028b,
+  0x028d, 0x028f, 0x0291, 0x0292, 0x0294, 0x0296, 0x0298, 0x0298, 0x029a, 0x029b, 0x029d, 0x029d, 0x029f, 0x02a1, 0x02a3, 0x02a3,
+  0x02a4, 0x02a6, 0x02a6, 0x02a8, 0x02aa, 0x02aa, 0x02ac, 0x02ac, 0x02ae, 0x02b0, 0x02b0, 0x02b1, 0x02b1, 0x02b3, 0x02b3, 0x02b5,
+  0x02b5, 0x02b5, 0x02b7, 0x02b7, 0x02b9, 0x02b9, 0x02b9, 0x02bb, 0x02bb, 0x02bb, 0x02bd, 0x02bd, 0x02bd, 0x02bf, 0x02bf, 0x02bf,
+  0x02bf, 0x02c0, 0x02c0, 0x02c0, 0x02c0, 0x02c0, 0x02c0, 0x02c0, 0x02c2, 0x02c2, 0x02c2, 0x02c2, 0x02c2, 0x02c2, 0x02c2, 0x02c2,
+  0x0002, 0x0006, 0x000a, 0x000e, 0x0013, 0x0017, 0x001b, 0x001f, 0x0024, 0x0028, 0x002c, 0x0030, 0x0034, 0x0039, 0x003d, 0x0041,
+  0x0046, 0x004a, 0x004e, 0x0052, 0x0056, 0x005b, 0x005f, 0x0063, 0x0067, 0x006b, 0x0070, 0x0074, 0x0078, 0x007c, 0x0080, 0x0085,
+  0x0089, 0x008d, 0x0091, 0x0095, 0x0099, 0x009d, 0x00a2, 0x00a6, 0x00aa, 0x00ae, 0x00b2, 0x00b6, 0x00ba, 0x00be, 0x00c2, 0x00c6,
+  0x00ca, 0x00ce, 0x00d2, 0x00d6, 0x00da, 0x00df, 0x00e3, 0x00e7, 0x00ea, 0x00ef, 0x00f3, 0x00f7, 0x00fa, 0x00fe, 0x0102, 0x0106,
+  0x010a, 0x010e, 0x0112, 0x0116, 0x011a, 0x011e, 0x0122, 0x0126, 0x012a, 0x012d, 0x0131, 0x0135, 0x0138, 0x013c, 0x0140, 0x0144,
+  0x0147, 0x014c, 0x014f, 0x0153, 0x0157, 0x015a, 0x015e, 0x0161, 0x0165, 0x0169, 0x016d, 0x0170, 0x0174, 0x0177, 0x017b, 0x017e,
+  0x0182, 0x0185, 0x0188, 0x018d, 0x0190, 0x0193, 0x0196, 0x019a, 0x019d, 0x01a0, 0x01a4, 0x01a7, 0x01ab, 0x01ae, 0x01b2, 0x01b5,
+  0x01b8, 0x01bb, 0x01bf, 0x01c1, 0x01c5, 0x01c9, 0x01cb, 0x01cf, 0x01d1, 0x01d5, 0x01d8, 0x01dc, 0x01de, 0x01e1, 0x01e5, 0x01e7,
+  0x01ea, 0x01ed, 0x01f1, 0x01f3, 0x01f6, 0x01f9, 0x01fb, 0x01fe, 0x0201, 0x0204, 0x0207, 0x020a, 0x020c, 0x020f, 0x0212, 0x0215,
+  0x0218, 0x021b, 0x021c, 0x021f, 0x0222, 0x0225, 0x0228, 0x022a, 0x022d, 0x0230, 0x0231, 0x0234, 0x0236, 0x0239, 0x023c, 0x023d,
+  0x0241, 0x0242, 0x0245, 0x0247, 0x0248, 0x024c, 0x024d, 0x0250, 0x0252, 0x0254, 0x0257, 0x0258, 0x025a, 0x025d, 0x025f, 0x0261,
+  0x0262, 0x0264, 0x0267, 0x0269, 0x026b, 0x026c, 0x026e, 0x0270, 0x0271, 0x0273, 0x0275, 0x0276, 0x0278, 0x027a, 0x027c, 0x027d,
+  0x027f, 0x0281, 0x0283, 0x0284, 0x0286, 0x0288, 0x028a, 0x028a, 0x028b, 0x028d, 0x028f, 0x028f, 0x0291, 0x0292, 0x0294, 0x0294,
+  0x0296, 0x0298, 0x0298, 0x029a, 0x029b, 0x029b, 0x029d, 0x029d, 0x029f, 0x02a1, 0x02a1, 0x02a3, 0x02a3, 0x02a4, 0x02a4, 0x02a6,
+  0x02a6, 0x02a6, 0x02a8, 0x02a8, 0x02aa, 0x02aa, 0x02aa, 0x02ac, 0x02ac, 0x02ac, 0x02ae, 0x02ae, 0x02ae, 0x02b0, 0x02b0, 0x02b0,
+  0x02b0, 0x02b1, 0x02b1, 0x02b1, 0x02b1, 0x02b1, 0x02b1, 0x02b1, 0x02b3, 0x02b3, 0x02b3, 0x02b3, 0x02b3, 0x02b3, 0x02b3, 0x02b3,
+  0x0002, 0x0006, 0x000a, 0x000e, 0x0012, 0x0016, 0x001a, 0x001f, 0x0023, 0x0027, 0x002b, 0x002f, 0x0033, 0x0038, 0x003c, 0x0040,
+  0x0044, 0x0048, 0x004c, 0x0050, 0x0054, 0x0059, 0x005d, 0x0061, 0x0065, 0x0069, 0x006d, 0x0071, 0x0075, 0x0079, 0x007d, 0x0082,
+  0x0086, 0x008a, 0x008e, 0x0092, 0x0096, 0x009a, 0x009e, 0x00a2, 0x00a6, 0x00aa, 0x00ae, 0x00b2, 0x00b6, 0x00ba, 0x00be, 0x00c2,
+  0x00c6, 0x00ca, 0x00ce, 0x00d2, 0x00d6, 0x00da, 0x00de, 0x00e2, 0x00e5, 0x00ea, 0x00ee, 0x00f1, 0x00f5, 0x00f9, 0x00fd, 0x0100,
+  0x0105, 0x0108, 0x010c, 0x0110, 0x0114, 0x0118, 0x011b, 0x011f, 0x0123, 0x0126, 0x012a, 0x012e, 0x0132, 0x0135, 0x0139, 0x013d,
+  0x0140, 0x0145, 0x0148, 0x014c, 0x014f, 0x0153, 0x0157, 0x0159, 0x015d, 0x0161, 0x0165, 0x0168, 0x016c, 0x016f, 0x0173, 0x0176,
+  0x017a, 0x017d, 0x0180, 0x0184, 0x0187, 0x018a, 0x018e, 0x0191, 0x0194, 0x0197, 0x019b, 0x019e, 0x01a2, 0x01a5, 0x01a8, 0x01ac,
+  0x01ae, 0x01b2, 0x01b5, 0x01b8, 0x01bb, 0x01bf, 0x01c1, 0x01c5, 0x01c7, 0x01cb, 0x01ce, 0x01d1, 0x01d4, 0x01d6, 0x01da, 0x01dd,
+  0x01df, 0x01e2, 0x01e6, 0x01e9, 0x01eb, 0x01ee, 0x01f1, 0x01f3, 0x01f6, 0x01f9, 0x01fb, 0x01fe, 0x0201, 0x0204, 0x0207, 0x020a,
+  0x020c, 0x020f, 0x0211, 0x0214, 0x0216, 0x0219, 0x021c, 0x021e, 0x0221, 0x0224, 0x0225, 0x0228, 0x022a, 0x022d, 0x0230, 0x0231,
+  0x0234, 0x0236, 0x0239, 0x023a, 0x023c, 0x023f, 0x0241, 0x0244, 0x0245, 0x0247, 0x024a, 0x024c, 0x024d, 0x0250, 0x0252, 0x0254,
+  0x0255, 0x0257, 0x025a, 0x025c, 0x025d, 0x025f, 0x0261, 0x0262, 0x0264, 0x0266, 0x0267, 0x0269, 0x026b, 0x026c, 0x026e, 0x0270,
+  0x0271, 0x0273, 0x0275, 0x0276, 0x0278, 0x027a, 0x027c, 0x027c, 0x027d, 0x027f, 0x0281, 0x0281, 0x0283, 0x0284, 0x0286, 0x0286,
+  0x0288, 0x028a, 0x028a, 0x028b, 0x028d, 0x028d, 0x028f, 0x028f, 0x0291, 0x0292, 0x0292, 0x0294, 0x0294, 0x0296, 0x0296, 0x0298,
+  0x0298, 0x0298, 0x029a, 0x029a, 0x029b, 0x029b, 0x029b, 0x029d, 0x029d, 0x029d, 0x029f, 0x029f, 0x029f, 0x02a1, 0x02a1, 0x02a1,
+  0x02a1, 0x02a3, 0x02a3, 0x02a3, 0x02a3, 0x02a3, 0x02a3, 0x02a3, 0x02a4, 0x02a4, 0x02a4, 0x02a4, 0x02a4, 0x02a4, 0x02a4, 0x02a4,
+  0x0002, 0x0006, 0x000a, 0x000e, 0x0012, 0x0016, 0x001a, 0x001e, 0x0022, 0x0026, 0x002a, 0x002e, 0x0032, 0x0036, 0x003a, 0x003e,
+  0x0043, 0x0046, 0x004b, 0x004f, 0x0053, 0x0057, 0x005b, 0x005f, 0x0063, 0x0067, 0x006b, 0x006f, 0x0073, 0x0077, 0x007b, 0x007f,
+  0x0083, 0x0087, 0x008b, 0x008f, 0x0093, 0x0097, 0x009b, 0x009f, 0x00a2, 0x00a6, 0x00aa, 0x00ae, 0x00b2, 0x00b6, 0x00ba, 0x00be,
+  0x00c2, 0x00c6, 0x00c9, 0x00cd, 0x00d1, 0x00d5, 0x00d9, 0x00dd, 0x00e0, 0x00e5, 0x00e8, 0x00ec, 0x00ef, 0x00f3, 0x00f7, 0x00fb,
+  0x00ff, 0x0102, 0x0107, 0x010a, 0x010e, 0x0112, 0x0115, 0x0119, 0x011d, 0x0120, 0x0124, 0x0128, 0x012b, 0x012e, 0x0133, 0x0136,
+  0x0139, 0x013e, 0x0141, 0x0145, 0x0148, 0x014c, 0x014f, 0x0152, 0x0156, 0x0159, 0x015d, 0x0160, 0x0164, 0x0167, 0x016b, 0x016e,
+  0x0172, 0x0175, 0x0178, 0x017c, 0x017f, 0x0182, 0x0185, 0x0188, 0x018c, 0x018f, 0x0192, 0x0195, 0x0199, 0x019c, 0x019f, 0x01a3,
+  0x01a5, 0x01a8, 0x01ac, 0x01ae, 0x01b2, 0x01b5, 0x01b8, 0x01bb, 0x01be, 0x01c1, 0x01c4, 0x01c7, 0x01ca, 0x01cc, 0x01d0, 0x01d3,
+  0x01d5, 0x01d8, 0x01dc, 0x01de, 0x01e1, 0x01e3, 0x01e6, 0x01e9, 0x01eb, 0x01ee, 0x01f1, 0x01f3, 0x01f6, 0x01f9, 0x01fb, 0x01fe,
+  0x0201, 0x0204, 0x0205, 0x0208, 0x020b, 0x020e, 0x0211, 0x0212, 0x0215, 0x0218, 0x0219, 0x021c, 0x021e, 0x0221, 0x0224, 0x0225,
+  0x0228, 0x022a, 0x022d, 0x022e, 0x0230, 0x0233, 0x0234, 0x0237, 0x0239, 0x023a, 0x023d, 0x023f, 0x0241, 0x0244, 0x0245, 0x0247,
+  0x0248, 0x024a, 0x024d, 0x024f, 0x0250, 0x0252, 0x0254, 0x0255, 0x0257, 0x0258, 0x025a, 0x025c, 0x025d, 0x025f, 0x0261, 0x0262,
+  0x0264, 0x0266, 0x0267, 0x0269, 0x026b, 0x026c, 0x026e, 0x026e, 0x0270, 0x0271, 0x0273, 0x0273, 0x0275, 0x0276, 0x0278, 0x0278,
+  0x027a, 0x027c, 0x027c, 0x027d, 0x027f, 0x027f, 0x0281, 0x0281, 0x0283, 0x0284, 0x0284, 0x0286, 0x0286, 0x0288, 0x0288, 0x028a,
+  0x028a, 0x028a, 0x028b, 0x028b, 0x028d, 0x028d, 0x028d, 0x028f, 0x028f, 0x028f, 0x0291, 0x0291, 0x0291, 0x0292, 0x0292, 0x0292,
+  0x0292, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0294, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296,
+  0x0001, 0x0005, 0x0009, 0x000d, 0x0011, 0x0015, 0x0019, 0x001d, 0x0021, 0x0025, 0x0029, 0x002d, 0x0031, 0x0035, 0x0039, 0x003d,
+  0x0041, 0x0045, 0x0049, 0x004d, 0x0051, 0x0055, 0x0059, 0x005d, 0x0061, 0x0064, 0x0069, 0x006c, 0x0070, 0x0074, 0x0078, 0x007c,
+  0x0080, 0x0084, 0x0088, 0x008c, 0x008f, 0x0093, 0x0097, 0x009b, 0x009f, 0x00a3, 0x00a6, 0x00ab, 0x00ae, 0x00b2, 0x00b6, 0x00ba,
+  0x00be, 0x00c1, 0x00c5, 0x00c9, 0x00cd, 0x00d1, 0x00d5, 0x00d8, 0x00dc, 0x00e0, 0x00e3, 0x00e7, 0x00ea, 0x00ee, 0x00f2, 0x00f5,
+  0x00f9, 0x00fd, 0x0101, 0x0105, 0x0108, 0x010c, 0x010f, 0x0113, 0x0117, 0x011a, 0x011e, 0x0122, 0x0125, 0x0128, 0x012c, 0x012f,
+  0x0133, 0x0137, 0x013a, 0x013e, 0x0141, 0x0145, 0x0148, 0x014b, 0x014e, 0x0152, 0x0156, 0x0158, 0x015c, 0x015f, 0x0163, 0x0166,
+  0x016a, 0x016d, 0x0170, 0x0174, 0x0177, 0x017a, 0x017d, 0x0180, 0x0183, 0x0186, 0x0189, 0x018d, 0x0190, 0x0193, 0x0196, 0x019a,
+  0x019c, 0x019f, 0x01a3, 0x01a5, 0x01a8, 0x01ac, 0x01ae, 0x01b2, 0x01b4, 0x01b8, 0x01ba, 0x01be, 0x01c0, 0x01c2, 0x01c6, 0x01c9,
+  0x01cb, 0x01ce, 0x01d1, 0x01d4, 0x01d6, 0x01d9, 0x01dc, 0x01de, 0x01e1, 0x01e3, 0x01e6, 0x01e9, 0x01eb, 0x01ee, 0x01f1, 0x01f3,
+  0x01f6, 0x01f9, 0x01fa, 0x01fd, 0x0200, 0x0203, 0x0205, 0x0207, 0x020a, 0x020c, 0x020e, 0x0211, 0x0212, 0x0215, 0x0218, 0x0219,
+  0x021c, 0x021e, 0x0221, 0x0222, 0x0224, 0x0227, 0x0228, 0x022b, 0x022d, 0x022e, 0x0231, 0x0233, 0x0234, 0x0237, 0x0239, 0x023a,
+  0x023c, 0x023d, 0x0241, 0x0242, 0x0244, 0x0245, 0x0247, 0x0248, 0x024a, 0x024c, 0x024d, 0x024f, 0x0250, 0x0252, 0x0254, 0x0255,
+  0x0257, 0x0258, 0x025a, 0x025c, 0x025d, 0x025f, 0x0261, 0x0261, 0x0262, 0x0264, 0x0266, 0x0266, 0x0267, 0x0269, 0x026b, 0x026b,
+  0x026c, 0x026e, 0x026e, 0x0270, 0x0271, 0x0271, 0x0273, 0x0273, 0x0275, 0x0276, 0x0276, 0x0278, 0x0278, 0x027a, 0x027a, 0x027c,
+  0x027c, 0x027c, 0x027d, 0x027d, 0x027f, 0x027f, 0x027f, 0x0281, 0x0281, 0x0281, 0x0283, 0x0283, 0x0283, 0x0284, 0x0284, 0x0284,
+  0x0284, 0x0286, 0x0286, 0x0286, 0x0286, 0x0286, 0x0286, 0x0286, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288, 0x0288,
+  0x0001, 0x0005, 0x0009, 0x000d, 0x0011, 0x0015, 0x0019, 0x001d, 0x0021, 0x0024, 0x0028, 0x002c, 0x0030, 0x0034, 0x0038, 0x003c,
+  0x0040, 0x0043, 0x0047, 0x004b, 0x004f, 0x0053, 0x0057, 0x005b, 0x005f, 0x0062, 0x0066, 0x006a, 0x006e, 0x0072, 0x0076, 0x0079,
+  0x007d, 0x0081, 0x0085, 0x0089, 0x008c, 0x0090, 0x0094, 0x0098, 0x009c, 0x009f, 0x00a3, 0x00a7, 0x00ab, 0x00ae, 0x00b2, 0x00b6,
+  0x00ba, 0x00bd, 0x00c1, 0x00c4, 0x00c8, 0x00cc, 0x00d0, 0x00d3, 0x00d7, 0x00db, 0x00df, 0x00e2, 0x00e5, 0x00e9, 0x00ed, 0x00f0,
+  0x00f4, 0x00f7, 0x00fb, 0x00ff, 0x0102, 0x0106, 0x010a, 0x010d, 0x0111, 0x0114, 0x0118, 0x011b, 0x011e, 0x0122, 0x0126, 0x0129,
+  0x012c, 0x0130, 0x0133, 0x0137, 0x013a, 0x013e, 0x0141, 0x0144, 0x0147, 0x014b, 0x014e, 0x0151, 0x0155, 0x0158, 0x015b, 0x015e,
+  0x0162, 0x0165, 0x0168, 0x016c, 0x016f, 0x0172, 0x0175, 0x0178, 0x017b, 0x017e, 0x0181, 0x0184, 0x0187, 0x018a, 0x018e, 0x0191,
+  0x0193, 0x0196, 0x019a, 0x019c, 0x019f, 0x01a3, 0x01a5, 0x01a8, 0x01ab, 0x01ae, 0x01b1, 0x01b4, 0x01b6, 0x01b9, 0x01bc, 0x01bf,
+  0x01c1, 0x01c4, 0x01c7, 0x01ca, 0x01cc, 0x01cf, 0x01d1, 0x01d4, 0x01d6, 0x01d9, 0x01dc, 0x01de, 0x01e1, 0x01e3, 0x01e6, 0x01e9,
+  0x01eb, 0x01ee, 0x01ef, 0x01f2, 0x01f5, 0x01f7, 0x01fa, 0x01fb, 0x01fe, 0x0201, 0x0203, 0x0205, 0x0207, 0x020a, 0x020c, 0x020e,
+  0x0211, 0x0212, 0x0215, 0x0216, 0x0218, 0x021b, 0x021c, 0x021f, 0x0221, 0x0222, 0x0225, 0x0227, 0x0228, 0x022b, 0x022d, 0x022e,
+  0x0230, 0x0231, 0x0234, 0x0236, 0x0237, 0x0239, 0x023a, 0x023c, 0x023d, 0x023f, 0x0241, 0x0242, 0x0244, 0x0245, 0x0247, 0x0248,
+  0x024a, 0x024c, 0x024d, 0x024f, 0x0250, 0x0252, 0x0254, 0x0254, 0x0255, 0x0257, 0x0258, 0x0258, 0x025a, 0x025c, 0x025d, 0x025d,
+  0x025f, 0x0261, 0x0261, 0x0262, 0x0264, 0x0264, 0x0266, 0x0266, 0x0267, 0x0269, 0x0269, 0x026b, 0x026b, 0x026c, 0x026c, 0x026e,
+  0x026e, 0x026e, 0x0270, 0x0270, 0x0271, 0x0271, 0x0271, 0x0273, 0x0273, 0x0273, 0x0275, 0x0275, 0x0275, 0x0276, 0x0276, 0x0276,
+  0x0276, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x0278, 0x027a, 0x027a, 0x027a, 0x027a, 0x027a, 0x027a, 0x027a, 0x027a,
+  0x0001, 0x0005, 0x0009, 0x000d, 0x0011, 0x0014, 0x0018, 0x001c, 0x0020, 0x0024, 0x0027, 0x002b, 0x002f, 0x0033, 0x0037, 0x003b,
+  0x003e, 0x0042, 0x0046, 0x004a, 0x004d, 0x0051, 0x0055, 0x0059, 0x005d, 0x0060, 0x0064, 0x0068, 0x006b, 0x006f, 0x0073, 0x0077,
+  0x007a, 0x007e, 0x0082, 0x0086, 0x0089, 0x008d, 0x0091, 0x0095, 0x0098, 0x009c, 0x009f, 0x00a3, 0x00a7, 0x00ab, 0x00ae, 0x00b2,
+  0x00b6, 0x00b9, 0x00bd, 0x00c0, 0x00c4, 0x00c8, 0x00cb, 0x00cf, 0x00d2, 0x00d6, 0x00da, 0x00dd, 0x00e0, 0x00e4, 0x00e8, 0x00eb,
+  0x00ef, 0x00f2, 0x00f6, 0x00f9, 0x00fd, 0x0100, 0x0104, 0x0107, 0x010b, 0x010e, 0x0112, 0x0115, 0x0118, 0x011b, 0x011f, 0x0122,
+  0x0126, 0x012a, 0x012d, 0x0130, 0x0133, 0x0137, 0x013a, 0x013d, 0x0140, 0x0144, 0x0147, 0x014a, 0x014d, 0x0150, 0x0154, 0x0157,
+  0x015a, 0x015d, 0x0160, 0x0164, 0x0167, 0x016a, 0x016d, 0x0170, 0x0173, 0x0176, 0x0179, 0x017c, 0x017f, 0x0182, 0x0185, 0x0188,
+  0x018a, 0x018e, 0x0191, 0x0193, 0x0196, 0x019a, 0x019c, 0x019f, 0x01a2, 0x01a5, 0x01a7, 0x01ab, 0x01ad, 0x01af, 0x01b3, 0x01b5,
+  0x01b8, 0x01ba, 0x01be, 0x01c0, 0x01c2, 0x01c5, 0x01c7, 0x01ca, 0x01cc, 0x01cf, 0x01d1, 0x01d4, 0x01d6, 0x01d9, 0x01dc, 0x01de,
+  0x01e1, 0x01e3, 0x01e5, 0x01e7, 0x01ea, 0x01ed, 0x01ef, 0x01f1, 0x01f3, 0x01f6, 0x01f7, 0x01fa, 0x01fb, 0x01fe, 0x0201, 0x0203,
+  0x0205, 0x0207, 0x020a, 0x020b, 0x020c, 0x020f, 0x0211, 0x0214, 0x0215, 0x0216, 0x0219, 0x021b, 0x021c, 0x021f, 0x0221, 0x0222,
+  0x0224, 0x0225, 0x0228, 0x022a, 0x022b, 0x022d, 0x022e, 0x0230, 0x0231, 0x0233, 0x0234, 0x0236, 0x0237, 0x0239, 0x023a, 0x023c,
+  0x023d, 0x023f, 0x0241, 0x0242, 0x0244, 0x0245, 0x0247, 0x0247, 0x0248, 0x024a, 0x024c, 0x024c, 0x024d, 0x024f, 0x0250, 0x0250,
+  0x0252, 0x0254, 0x0254, 0x0255, 0x0257, 0x0257, 0x0258, 0x0258, 0x025a, 0x025c, 0x025c, 0x025d, 0x025d, 0x025f, 0x025f, 0x0261,
+  0x0261, 0x0261, 0x0262, 0x0262, 0x0264, 0x0264, 0x0264, 0x0266, 0x0266, 0x0266, 0x0267, 0x0267, 0x0267, 0x0269, 0x0269, 0x0269,
+  0x0269, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026c, 0x026c, 0x026c, 0x026c, 0x026c, 0x026c, 0x026c, 0x026c,
+  0x0001, 0x0005, 0x0009, 0x000d, 0x0010, 0x0014, 0x0018, 0x001b, 0x001f, 0x0023, 0x0027, 0x002a, 0x002e, 0x0032, 0x0035, 0x0039,
+  0x003d, 0x0041, 0x0044, 0x0048, 0x004c, 0x004f, 0x0053, 0x0057, 0x005b, 0x005e, 0x0062, 0x0065, 0x0069, 0x006d, 0x0071, 0x0074,
+  0x0078, 0x007b, 0x007f, 0x0083, 0x0086, 0x008a, 0x008e, 0x0091, 0x0095, 0x0099, 0x009c, 0x00a0, 0x00a3, 0x00a7, 0x00ab, 0x00ae,
+  0x00b2, 0x00b5, 0x00b9, 0x00bc, 0x00c0, 0x00c3, 0x00c7, 0x00ca, 0x00ce, 0x00d2, 0x00d5, 0x00d9, 0x00dc, 0x00df, 0x00e3, 0x00e6,
+  0x00ea, 0x00ed, 0x00f1, 0x00f4, 0x00f7, 0x00fb, 0x00fe, 0x0102, 0x0105, 0x0108, 0x010c, 0x010f, 0x0112, 0x0115, 0x0119, 0x011c,
+  0x011f, 0x0123, 0x0126, 0x012a, 0x012d, 0x0130, 0x0133, 0x0136, 0x0139, 0x013d, 0x0140, 0x0143, 0x0146, 0x0149, 0x014d, 0x014f,
+  0x0153, 0x0156, 0x0158, 0x015c, 0x015f, 0x0162, 0x0165, 0x0168, 0x016b, 0x016e, 0x0171, 0x0174, 0x0177, 0x017a, 0x017d, 0x0180,
+  0x0182, 0x0185, 0x0188, 0x018a, 0x018e, 0x0191, 0x0193, 0x0196, 0x0199, 0x019c, 0x019e, 0x01a2, 0x01a4, 0x01a6, 0x01aa, 0x01ac,
+  0x01ae, 0x01b1, 0x01b4, 0x01b6, 0x01b9, 0x01bb, 0x01be, 0x01c0, 0x01c2, 0x01c5, 0x01c7, 0x01ca, 0x01cc, 0x01cf, 0x01d1, 0x01d4,
+  0x01d6, 0x01d9, 0x01da, 0x01dd, 0x01df, 0x01e2, 0x01e5, 0x01e6, 0x01e9, 0x01eb, 0x01ed, 0x01ef, 0x01f1, 0x01f3, 0x01f6, 0x01f7,
+  0x01fa, 0x01fb, 0x01fe, 0x0200, 0x0201, 0x0204, 0x0205, 0x0208, 0x020a, 0x020b, 0x020e, 0x020f, 0x0211, 0x0214, 0x0215, 0x0216,
+  0x0218, 0x0219, 0x021c, 0x021e, 0x021f, 0x0221, 0x0222, 0x0224, 0x0225, 0x0227, 0x0228, 0x022a, 0x022b, 0x022d, 0x022e, 0x0230,
+  0x0231, 0x0233, 0x0234, 0x0236, 0x0237, 0x0239, 0x023a, 0x023a, 0x023c, 0x023d, 0x023f, 0x023f, 0x0241, 0x0242, 0x0244, 0x0244,
+  0x0245, 0x0247, 0x0247, 0x0248, 0x024a, 0x024a, 0x024c, 0x024c, 0x024d, 0x024f, 0x024f, 0x0250, 0x0250, 0x0252, 0x0252, 0x0254,
+  0x0254, 0x0254, 0x0255, 0x0255, 0x0257, 0x0257, 0x0257, 0x0258, 0x0258, 0x0258, 0x025a, 0x025a, 0x025a, 0x025c, 0x025c, 0x025c,
+  0x025c, 0x025d, 0x025d, 0x025d, 0x025d, 0x025d, 0x025d, 0x025d, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f, 0x025f,
+  0x0001, 0x0005, 0x0009, 0x000c, 0x0010, 0x0014, 0x0017, 0x001b, 0x001e, 0x0022, 0x0026, 0x0029, 0x002d, 0x0031, 0x0034, 0x0038,
+  0x003c, 0x003f, 0x0043, 0x0046, 0x004a, 0x004e, 0x0051, 0x0055, 0x0059, 0x005c, 0x0060, 0x0063, 0x0067, 0x006b, 0x006e, 0x0072,
+  0x0075, 0x0079, 0x007c, 0x0080, 0x0083, 0x0087, 0x008b, 0x008e, 0x0092, 0x0095, 0x0099, 0x009c, 0x00a0, 0x00a3, 0x00a7, 0x00aa,
+  0x00ae, 0x00b1, 0x00b5, 0x00b8, 0x00bc, 0x00bf, 0x00c3, 0x00c6, 0x00c9, 0x00cd, 0x00d1, 0x00d4, 0x00d7, 0x00da, 0x00de, 0x00e1,
+  0x00e5, 0x00e8, 0x00ec, 0x00ef, 0x00f2, 0x00f5, 0x00f9, 0x00fc, 0x0100, 0x0102, 0x0106, 0x010a, 0x010c, 0x010f, 0x0113, 0x0116,
+  0x0119, 0x011d, 0x0120, 0x0123, 0x0126, 0x012a, 0x012d, 0x012f, 0x0133, 0x0136, 0x0139, 0x013c, 0x013f, 0x0142, 0x0145, 0x0148,
+  0x014c, 0x014e, 0x0151, 0x0155, 0x0158, 0x015a, 0x015d, 0x0160, 0x0163, 0x0166, 0x0169, 0x016c, 0x016f, 0x0172, 0x0175, 0x0178,
+  0x017a, 0x017d, 0x0180, 0x0182, 0x0185, 0x0188, 0x018a, 0x018e, 0x0190, 0x0193, 0x0195, 0x0199, 0x019b, 0x019d, 0x01a0, 0x01a3,
+  0x01a5, 0x01a7, 0x01ab, 0x01ad, 0x01af, 0x01b2, 0x01b4, 0x01b6, 0x01b9, 0x01bb, 0x01be, 0x01c0, 0x01c2, 0x01c5, 0x01c7, 0x01ca,
+  0x01cc, 0x01cf, 0x01d0, 0x01d3, 0x01d5, 0x01d8, 0x01da, 0x01dc, 0x01de, 0x01e1, 0x01e2, 0x01e5, 0x01e6, 0x01e9, 0x01eb, 0x01ed,
+  0x01ef, 0x01f1, 0x01f3, 0x01f5, 0x01f6, 0x01f9, 0x01fa, 0x01fd, 0x01fe, 0x0200, 0x0203, 0x0204, 0x0205, 0x0208, 0x020a, 0x020b,
+  0x020c, 0x020e, 0x0211, 0x0212, 0x0214, 0x0215, 0x0216, 0x0218, 0x0219, 0x021b, 0x021c, 0x021e, 0x021f, 0x0221, 0x0222, 0x0224,
+  0x0225, 0x0227, 0x0228, 0x022a, 0x022b, 0x022d, 0x022e, 0x022e, 0x0230, 0x0231, 0x0233, 0x0233, 0x0234, 0x0236, 0x0237, 0x0237,
+  0x0239, 0x023a, 0x023a, 0x023c, 0x023d, 0x023d, 0x023f, 0x023f, 0x0241, 0x0242, 0x0242, 0x0244, 0x0244, 0x0245, 0x0245, 0x0247,
+  0x0247, 0x0247, 0x0248, 0x0248, 0x024a, 0x024a, 0x024a, 0x024c, 0x024c, 0x024c, 0x024d, 0x024d, 0x024d, 0x024f, 0x024f, 0x024f,
+  0x024f, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0250, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252,
+  0x0001, 0x0005, 0x0008, 0x000c, 0x0010, 0x0013, 0x0017, 0x001a, 0x001e, 0x0021, 0x0025, 0x0029, 0x002c, 0x0030, 0x0033, 0x0037,
+  0x003a, 0x003e, 0x0041, 0x0045, 0x0048, 0x004c, 0x0050, 0x0053, 0x0057, 0x005a, 0x005e, 0x0061, 0x0065, 0x0068, 0x006c, 0x006f,
+  0x0073, 0x0076, 0x007a, 0x007d, 0x0081, 0x0084, 0x0088, 0x008b, 0x008f, 0x0092, 0x0095, 0x0099, 0x009c, 0x00a0, 0x00a3, 0x00a6,
+  0x00aa, 0x00ad, 0x00b1, 0x00b4, 0x00b8, 0x00bb, 0x00bf, 0x00c2, 0x00c5, 0x00c9, 0x00cc, 0x00cf, 0x00d2, 0x00d6, 0x00d9, 0x00dc,
+  0x00e0, 0x00e3, 0x00e7, 0x00ea, 0x00ed, 0x00f0, 0x00f3, 0x00f7, 0x00fa, 0x00fd, 0x0100, 0x0104, 0x0107, 0x010a, 0x010d, 0x0110,
+  0x0113, 0x0117, 0x011a, 0x011d, 0x0120, 0x0123, 0x0126, 0x0129, 0x012c, 0x012f, 0x0133, 0x0135, 0x0138, 0x013b, 0x013e, 0x0141,
+  0x0145, 0x0147, 0x014a, 0x014d, 0x0150, 0x0153, 0x0156, 0x0158, 0x015b, 0x015e, 0x0161, 0x0164, 0x0167, 0x016a, 0x016d, 0x0170,
+  0x0172, 0x0175, 0x0178, 0x017a, 0x017d, 0x0180, 0x0182, 0x0185, 0x0187, 0x018a, 0x018d, 0x0190, 0x0192, 0x0194, 0x0197, 0x019a,
+  0x019c, 0x019e, 0x01a2, 0x01a4, 0x01a6, 0x01a8, 0x01ab, 0x01ad, 0x01af, 0x01b2, 0x01b4, 0x01b6, 0x01b9, 0x01bb, 0x01be, 0x01c0,
+  0x01c2, 0x01c5, 0x01c6, 0x01c9, 0x01cb, 0x01ce, 0x01d0, 0x01d1, 0x01d4, 0x01d6, 0x01d8, 0x01da, 0x01dc, 0x01de, 0x01e1, 0x01e2,
+  0x01e5, 0x01e6, 0x01e9, 0x01ea, 0x01eb, 0x01ee, 0x01ef, 0x01f2, 0x01f3, 0x01f5, 0x01f7, 0x01f9, 0x01fa, 0x01fd, 0x01fe, 0x0200,
+  0x0201, 0x0203, 0x0205, 0x0207, 0x0208, 0x020a, 0x020b, 0x020c, 0x020e, 0x020f, 0x0211, 0x0212, 0x0214, 0x0215, 0x0216, 0x0218,
+  0x0219, 0x021b, 0x021c, 0x021e, 0x021f, 0x0221, 0x0222, 0x0222, 0x0224, 0x0225, 0x0227, 0x0227, 0x0228, 0x022a, 0x022b, 0x022b,
+  0x022d, 0x022e, 0x022e, 0x0230, 0x0231, 0x0231, 0x0233, 0x0233, 0x0234, 0x0236, 0x0236, 0x0237, 0x0237, 0x0239, 0x0239, 0x023a,
+  0x023a, 0x023a, 0x023c, 0x023c, 0x023d, 0x023d, 0x023d, 0x023f, 0x023f, 0x023f, 0x0241, 0x0241, 0x0241, 0x0242, 0x0242, 0x0242,
+  0x0242, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0245, 0x0245, 0x0245, 0x0245, 0x0245, 0x0245, 0x0245, 0x0245,
+  0x0001, 0x0005, 0x0008, 0x000c, 0x000f, 0x0013, 0x0016, 0x001a, 0x001d, 0x0021, 0x0024, 0x0028, 0x002b, 0x002f, 0x0032, 0x0036,
+  0x0039, 0x003c, 0x0040, 0x0043, 0x0047, 0x004a, 0x004e, 0x0051, 0x0055, 0x0058, 0x005c, 0x005f, 0x0063, 0x0066, 0x0069, 0x006d,
+  0x0070, 0x0074, 0x0077, 0x007a, 0x007e, 0x0081, 0x0085, 0x0088, 0x008c, 0x008f, 0x0092, 0x0096, 0x0099, 0x009c, 0x00a0, 0x00a3,
+  0x00a6, 0x00aa, 0x00ad, 0x00b0, 0x00b4, 0x00b7, 0x00bb, 0x00be, 0x00c1, 0x00c4, 0x00c8, 0x00cb, 0x00ce, 0x00d1, 0x00d5, 0x00d7,
+  0x00db, 0x00de, 0x00e2, 0x00e5, 0x00e8, 0x00eb, 0x00ee, 0x00f1, 0x00f5, 0x00f7, 0x00fb, 0x00fe, 0x0101, 0x0104, 0x0107, 0x010a,
+  0x010d, 0x0111, 0x0114, 0x0117, 0x011a, 0x011d, 0x0120, 0x0122, 0x0126, 0x0129, 0x012c, 0x012e, 0x0132, 0x0134, 0x0138, 0x013a,
+  0x013e, 0x0140, 0x0143, 0x0146, 0x0149, 0x014c, 0x014e, 0x0151, 0x0154, 0x0157, 0x0159, 0x015c, 0x015f, 0x0162, 0x0165, 0x0168,
+  0x016a, 0x016d, 0x0170, 0x0172, 0x0175, 0x0178, 0x017a, 0x017d, 0x017f, 0x0182, 0x0184, 0x0187, 0x0189, 0x018c, 0x018f, 0x0191,
+  0x0193, 0x0195, 0x0199, 0x019b, 0x019d, 0x019f, 0x01a2, 0x01a4, 0x01a6, 0x01a8, 0x01ab, 0x01ad, 0x01af, 0x01b2, 0x01b4, 0x01b6,
+  0x01b9, 0x01bb, 0x01bc, 0x01bf, 0x01c1, 0x01c4, 0x01c6, 0x01c7, 0x01ca, 0x01cc, 0x01ce, 0x01d0, 0x01d1, 0x01d4, 0x01d6, 0x01d8,
+  0x01da, 0x01dc, 0x01de, 0x01df, 0x01e1, 0x01e3, 0x01e5, 0x01e7, 0x01e9, 0x01ea, 0x01ed, 0x01ee, 0x01ef, 0x01f2, 0x01f3, 0x01f5,
+  0x01f6, 0x01f7, 0x01fa, 0x01fb, 0x01fd, 0x01fe, 0x0200, 0x0201, 0x0203, 0x0204, 0x0205, 0x0207, 0x0208, 0x020a, 0x020b, 0x020c,
+  0x020e, 0x020f, 0x0211, 0x0212, 0x0214, 0x0215, 0x0216, 0x0216, 0x0218, 0x0219, 0x021b, 0x021b, 0x021c, 0x021e, 0x021f, 0x021f,
+  0x0221, 0x0222, 0x0222, 0x0224, 0x0225, 0x0225, 0x0227, 0x0227, 0x0228, 0x022a, 0x022a, 0x022b, 0x022b, 0x022d, 0x022d, 0x022e,
+  0x022e, 0x022e, 0x0230, 0x0230, 0x0231, 0x0231, 0x0231, 0x0233, 0x0233, 0x0233, 0x0234, 0x0234, 0x0234, 0x0236, 0x0236, 0x0236,
+  0x0236, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0237, 0x0239, 0x0239, 0x0239, 0x0239, 0x0239, 0x0239, 0x0239, 0x0239,
+  0x0001, 0x0005, 0x0008, 0x000b, 0x000f, 0x0012, 0x0016, 0x0019, 0x001d, 0x0020, 0x0023, 0x0027, 0x002a, 0x002e, 0x0031, 0x0034,
+  0x0038, 0x003b, 0x003f, 0x0042, 0x0045, 0x0049, 0x004c, 0x004f, 0x0053, 0x0056, 0x005a, 0x005d, 0x0060, 0x0064, 0x0067, 0x006b,
+  0x006e, 0x0071, 0x0075, 0x0078, 0x007b, 0x007e, 0x0082, 0x0085, 0x0089, 0x008c, 0x008f, 0x0093, 0x0096, 0x0099, 0x009c, 0x009f,
+  0x00a3, 0x00a6, 0x00a9, 0x00ac, 0x00b0, 0x00b3, 0x00b7, 0x00ba, 0x00bd, 0x00c0, 0x00c3, 0x00c7, 0x00c9, 0x00cd, 0x00d0, 0x00d3,
+  0x00d6, 0x00d9, 0x00dd, 0x00e0, 0x00e3, 0x00e6, 0x00e9, 0x00ec, 0x00ef, 0x00f2, 0x00f5, 0x00f9, 0x00fb, 0x00fe, 0x0102, 0x0105,
+  0x0107, 0x010b, 0x010e, 0x0111, 0x0114, 0x0117, 0x011a, 0x011c, 0x011f, 0x0122, 0x0126, 0x0128, 0x012b, 0x012e, 0x0131, 0x0133,
+  0x0137, 0x0139, 0x013c, 0x013f, 0x0142, 0x0145, 0x0147, 0x014a, 0x014d, 0x014f, 0x0152, 0x0155, 0x0158, 0x015a, 0x015d, 0x0160,
+  0x0162, 0x0165, 0x0168, 0x016a, 0x016d, 0x0170, 0x0172, 0x0175, 0x0177, 0x017a, 0x017c, 0x017f, 0x0181, 0x0183, 0x0186, 0x0188,
+  0x018a, 0x018d, 0x0190, 0x0192, 0x0194, 0x0196, 0x0199, 0x019b, 0x019d, 0x019f, 0x01a2, 0x01a4, 0x01a6, 0x01a8, 0x01ab, 0x01ad,
+  0x01af, 0x01b2, 0x01b3, 0x01b5, 0x01b8, 0x01ba, 0x01bc, 0x01be, 0x01c0, 0x01c2, 0x01c4, 0x01c6, 0x01c7, 0x01ca, 0x01cc, 0x01ce,
+  0x01d0, 0x01d1, 0x01d4, 0x01d5, 0x01d6, 0x01d9, 0x01da, 0x01dd, 0x01de, 0x01df, 0x01e2, 0x01e3, 0x01e5, 0x01e7, 0x01e9, 0x01ea,
+  0x01eb, 0x01ed, 0x01ef, 0x01f1, 0x01f2, 0x01f3, 0x01f5, 0x01f6, 0x01f7, 0x01f9, 0x01fa, 0x01fb, 0x01fd, 0x01fe, 0x0200, 0x0201,
+  0x0203, 0x0204, 0x0205, 0x0207, 0x0208, 0x020a, 0x020b, 0x020b, 0x020c, 0x020e, 0x020f, 0x020f, 0x0211, 0x0212, 0x0214, 0x0214,
+  0x0215, 0x0216, 0x0216, 0x0218, 0x0219, 0x0219, 0x021b, 0x021b, 0x021c, 0x021e, 0x021e, 0x021f, 0x021f, 0x0221, 0x0221, 0x0222,
+  0x0222, 0x0222, 0x0224, 0x0224, 0x0225, 0x0225, 0x0225, 0x0227, 0x0227, 0x0227, 0x0228, 0x0228, 0x0228, 0x022a, 0x022a, 0x022a,
+  0x022a, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022b, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d, 0x022d,
+  0x0001, 0x0005, 0x0008, 0x000b, 0x000f, 0x0012, 0x0015, 0x0019, 0x001c, 0x001f, 0x0023, 0x0026, 0x0029, 0x002d, 0x0030, 0x0033,
+  0x0037, 0x003a, 0x003d, 0x0041, 0x0044, 0x0047, 0x004b, 0x004e, 0x0051, 0x0054, 0x0058, 0x005b, 0x005e, 0x0062, 0x0065, 0x0068,
+  0x006b, 0x006f, 0x0072, 0x0075, 0x0078, 0x007c, 0x007f, 0x0082, 0x0086, 0x0089, 0x008c, 0x008f, 0x0093, 0x0096, 0x0099, 0x009c,
+  0x009f, 0x00a2, 0x00a6, 0x00a9, 0x00ac, 0x00af, 0x00b3, 0x00b6, 0x00b9, 0x00bc, 0x00bf, 0x00c2, 0x00c5, 0x00c8, 0x00cb, 0x00ce,
+  0x00d2, 0x00d5, 0x00d8, 0x00db, 0x00de, 0x00e1, 0x00e4, 0x00e7, 0x00ea, 0x00ed, 0x00f0, 0x00f3, 0x00f6, 0x00f9, 0x00fc, 0x00ff,
+  0x0102, 0x0105, 0x0108, 0x010b, 0x010e, 0x0111, 0x0114, 0x0116, 0x0119, 0x011c, 0x011f, 0x0122, 0x0125, 0x0127, 0x012a, 0x012d,
+  0x0130, 0x0133, 0x0135, 0x0138, 0x013b, 0x013e, 0x0140, 0x0143, 0x0145, 0x0148, 0x014b, 0x014d, 0x0150, 0x0153, 0x0156, 0x0158,
+  0x015a, 0x015d, 0x0160, 0x0162, 0x0165, 0x0168, 0x016a, 0x016d, 0x016f, 0x0172, 0x0174, 0x0177, 0x0179, 0x017b, 0x017e, 0x0180,
+  0x0182, 0x0184, 0x0187, 0x0189, 0x018c, 0x018e, 0x0190, 0x0192, 0x0194, 0x0196, 0x0199, 0x019b, 0x019d, 0x019f, 0x01a2, 0x01a4,
+  0x01a6, 0x01a8, 0x01aa, 0x01ac, 0x01ae, 0x01b1, 0x01b3, 0x01b4, 0x01b6, 0x01b9, 0x01ba, 0x01bc, 0x01be, 0x01c0, 0x01c2, 0x01c4,
+  0x01c6, 0x01c7, 0x01ca, 0x01cb, 0x01cc, 0x01cf, 0x01d0, 0x01d3, 0x01d4, 0x01d5, 0x01d8, 0x01d9, 0x01da, 0x01dd, 0x01de, 0x01df,
+  0x01e1, 0x01e2, 0x01e5, 0x01e6, 0x01e7, 0x01e9, 0x01ea, 0x01eb, 0x01ed, 0x01ee, 0x01ef, 0x01f1, 0x01f2, 0x01f3, 0x01f5, 0x01f6,
+  0x01f7, 0x01f9, 0x01fa, 0x01fb, 0x01fd, 0x01fe, 0x0200, 0x0200, 0x0201, 0x0203, 0x0204, 0x0204, 0x0205, 0x0207, 0x0208, 0x0208,
+  0x020a, 0x020b, 0x020b, 0x020c, 0x020e, 0x020e, 0x020f, 0x020f, 0x0211, 0x0212, 0x0212, 0x0214, 0x0214, 0x0215, 0x0215, 0x0216,
+  0x0216, 0x0216, 0x0218, 0x0218, 0x0219, 0x0219, 0x0219, 0x021b, 0x021b, 0x021b, 0x021c, 0x021c, 0x021c, 0x021e, 0x021e, 0x021e,
+  0x021e, 0x021f, 0x021f, 0x021f, 0x021f, 0x021f, 0x021f, 0x021f, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221,
+  0x0001, 0x0004, 0x0008, 0x000b, 0x000e, 0x0011, 0x0015, 0x0018, 0x001b, 0x001f, 0x0022, 0x0025, 0x0028, 0x002c, 0x002f, 0x0032,
+  0x0035, 0x0039, 0x003c, 0x003f, 0x0042, 0x0046, 0x0049, 0x004c, 0x004f, 0x0053, 0x0056, 0x0059, 0x005c, 0x0060, 0x0063, 0x0066,
+  0x0069, 0x006c, 0x0070, 0x0073, 0x0076, 0x0079, 0x007c, 0x0080, 0x0083, 0x0086, 0x0089, 0x008c, 0x008f, 0x0093, 0x0096, 0x0099,
+  0x009c, 0x009f, 0x00a2, 0x00a5, 0x00a8, 0x00ac, 0x00af, 0x00b2, 0x00b5, 0x00b8, 0x00bb, 0x00be, 0x00c1, 0x00c4, 0x00c7, 0x00ca,
+  0x00cd, 0x00d0, 0x00d3, 0x00d6, 0x00d9, 0x00dc, 0x00df, 0x00e2, 0x00e5, 0x00e8, 0x00eb, 0x00ee, 0x00f1, 0x00f3, 0x00f7, 0x00f9,
+  0x00fc, 0x0100, 0x0102, 0x0105, 0x0108, 0x010b, 0x010e, 0x0110, 0x0113, 0x0116, 0x0119, 0x011b, 0x011e, 0x0121, 0x0124, 0x0126,
+  0x012a, 0x012c, 0x012e, 0x0132, 0x0134, 0x0137, 0x0139, 0x013c, 0x013e, 0x0141, 0x0144, 0x0146, 0x0149, 0x014c, 0x014e, 0x0151,
+  0x0153, 0x0156, 0x0158, 0x015a, 0x015d, 0x0160, 0x0162, 0x0165, 0x0167, 0x016a, 0x016c, 0x016f, 0x0171, 0x0173, 0x0176, 0x0178,
+  0x017a, 0x017c, 0x017f, 0x0181, 0x0183, 0x0185, 0x0187, 0x0189, 0x018c, 0x018e, 0x0190, 0x0192, 0x0194, 0x0196, 0x0199, 0x019b,
+  0x019d, 0x019f, 0x01a0, 0x01a3, 0x01a5, 0x01a7, 0x01aa, 0x01ab, 0x01ad, 0x01af, 0x01b1, 0x01b3, 0x01b4, 0x01b6, 0x01b9, 0x01ba,
+  0x01bc, 0x01be, 0x01c0, 0x01c1, 0x01c2, 0x01c5, 0x01c6, 0x01c9, 0x01ca, 0x01cb, 0x01ce, 0x01cf, 0x01d0, 0x01d3, 0x01d4, 0x01d5,
+  0x01d6, 0x01d8, 0x01da, 0x01dc, 0x01dd, 0x01de, 0x01df, 0x01e1, 0x01e2, 0x01e3, 0x01e5, 0x01e6, 0x01e7, 0x01e9, 0x01ea, 0x01eb,
+  0x01ed, 0x01ee, 0x01ef, 0x01f1, 0x01f2, 0x01f3, 0x01f5, 0x01f5, 0x01f6, 0x01f7, 0x01f9, 0x01f9, 0x01fa, 0x01fb, 0x01fd, 0x01fd,
+  0x01fe, 0x0200, 0x0200, 0x0201, 0x0203, 0x0203, 0x0204, 0x0204, 0x0205, 0x0207, 0x0207, 0x0208, 0x0208, 0x020a, 0x020a, 0x020b,
+  0x020b, 0x020b, 0x020c, 0x020c, 0x020e, 0x020e, 0x020e, 0x020f, 0x020f, 0x020f, 0x0211, 0x0211, 0x0211, 0x0212, 0x0212, 0x0212,
+  0x0212, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215, 0x0215,
+  0x0001, 0x0004, 0x0008, 0x000b, 0x000e, 0x0011, 0x0014, 0x0018, 0x001b, 0x001e, 0x0021, 0x0024, 0x0027, 0x002b, 0x002e, 0x0031,
+  0x0034, 0x0037, 0x003b, 0x003e, 0x0041, 0x0044, 0x0047, 0x004a, 0x004e, 0x0051, 0x0054, 0x0057, 0x005a, 0x005e, 0x0061, 0x0064,
+  0x0067, 0x006a, 0x006d, 0x0070, 0x0073, 0x0077, 0x007a, 0x007d, 0x0080, 0x0083, 0x0086, 0x0089, 0x008c, 0x008f, 0x0093, 0x0095,
+  0x0099, 0x009c, 0x009f, 0x00a2, 0x00a5, 0x00a8, 0x00ab, 0x00ae, 0x00b1, 0x00b4, 0x00b7, 0x00ba, 0x00bd, 0x00c0, 0x00c3, 0x00c6,
+  0x00c9, 0x00cb, 0x00cf, 0x00d2, 0x00d5, 0x00d7, 0x00da, 0x00dd, 0x00e0, 0x00e3, 0x00e6, 0x00e9, 0x00ec, 0x00ee, 0x00f1, 0x00f4,
+  0x00f7, 0x00fa, 0x00fd, 0x0100, 0x0102, 0x0105, 0x0108, 0x010a, 0x010d, 0x0110, 0x0113, 0x0115, 0x0118, 0x011b, 0x011e, 0x0120,
+  0x0123, 0x0126, 0x0128, 0x012b, 0x012e, 0x0130, 0x0133, 0x0135, 0x0138, 0x013a, 0x013d, 0x013f, 0x0142, 0x0145, 0x0147, 0x014a,
+  0x014c, 0x014e, 0x0151, 0x0153, 0x0156, 0x0158, 0x015a, 0x015d, 0x015f, 0x0162, 0x0164, 0x0167, 0x0169, 0x016b, 0x016e, 0x0170,
+  0x0172, 0x0174, 0x0177, 0x0179, 0x017b, 0x017d, 0x017f, 0x0181, 0x0183, 0x0185, 0x0187, 0x0189, 0x018c, 0x018e, 0x0190, 0x0192,
+  0x0194, 0x0196, 0x0197, 0x019a, 0x019c, 0x019e, 0x01a0, 0x01a2, 0x01a4, 0x01a6, 0x01a7, 0x01aa, 0x01ab, 0x01ad, 0x01af, 0x01b1,
+  0x01b3, 0x01b4, 0x01b6, 0x01b8, 0x01b9, 0x01bb, 0x01bc, 0x01bf, 0x01c0, 0x01c1, 0x01c4, 0x01c5, 0x01c6, 0x01c9, 0x01ca, 0x01cb,
+  0x01cc, 0x01ce, 0x01d0, 0x01d1, 0x01d3, 0x01d4, 0x01d5, 0x01d6, 0x01d8, 0x01d9, 0x01da, 0x01dc, 0x01dd, 0x01de, 0x01df, 0x01e1,
+  0x01e2, 0x01e3, 0x01e5, 0x01e6, 0x01e7, 0x01e9, 0x01ea, 0x01ea, 0x01eb, 0x01ed, 0x01ee, 0x01ee, 0x01ef, 0x01f1, 0x01f2, 0x01f2,
+  0x01f3, 0x01f5, 0x01f5, 0x01f6, 0x01f7, 0x01f7, 0x01f9, 0x01f9, 0x01fa, 0x01fb, 0x01fb, 0x01fd, 0x01fd, 0x01fe, 0x01fe, 0x0200,
+  0x0200, 0x0200, 0x0201, 0x0201, 0x0203, 0x0203, 0x0203, 0x0204, 0x0204, 0x0204, 0x0205, 0x0205, 0x0205, 0x0207, 0x0207, 0x0207,
+  0x0207, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
+  0x0001, 0x0004, 0x0007, 0x000a, 0x000e, 0x0011, 0x0014, 0x0017, 0x001a, 0x001d, 0x0020, 0x0024, 0x0027, 0x002a, 0x002d, 0x0030,
+  0x0033, 0x0036, 0x0039, 0x003c, 0x0040, 0x0043, 0x0046, 0x0049, 0x004c, 0x004f, 0x0052, 0x0055, 0x0058, 0x005c, 0x005f, 0x0062,
+  0x0065, 0x0068, 0x006b, 0x006e, 0x0071, 0x0074, 0x0077, 0x007a, 0x007d, 0x0080, 0x0083, 0x0086, 0x0089, 0x008c, 0x008f, 0x0092,
+  0x0095, 0x0098, 0x009b, 0x009e, 0x00a1, 0x00a4, 0x00a7, 0x00aa, 0x00ad, 0x00b0, 0x00b3, 0x00b6, 0x00b9, 0x00bc, 0x00bf, 0x00c1,
+  0x00c4, 0x00c7, 0x00ca, 0x00cd, 0x00d0, 0x00d3, 0x00d6, 0x00d9, 0x00dc, 0x00de, 0x00e1, 0x00e4, 0x00e7, 0x00e9, 0x00ec, 0x00ef,
+  0x00f1, 0x00f5, 0x00f7, 0x00fa, 0x00fd, 0x0100, 0x0102, 0x0105, 0x0107, 0x010a, 0x010d, 0x010f, 0x0112, 0x0115, 0x0118, 0x011a,
+  0x011d, 0x011f, 0x0122, 0x0125, 0x0127, 0x012a, 0x012c, 0x012e, 0x0131, 0x0133, 0x0136, 0x0138, 0x013b, 0x013e, 0x0140, 0x0143,
+  0x0145, 0x0147, 0x014a, 0x014c, 0x014e, 0x0151, 0x0153, 0x0156, 0x0158, 0x015a, 0x015c, 0x015f, 0x0161, 0x0163, 0x0166, 0x0168,
+  0x016a, 0x016c, 0x016f, 0x0171, 0x0173, 0x0175, 0x0177, 0x0179, 0x017b, 0x017d, 0x017f, 0x0181, 0x0183, 0x0185, 0x0187, 0x0189,
+  0x018c, 0x018e, 0x018f, 0x0191, 0x0193, 0x0195, 0x0197, 0x0199, 0x019b, 0x019d, 0x019e, 0x01a0, 0x01a2, 0x01a4, 0x01a6, 0x01a7,
+  0x01aa, 0x01ab, 0x01ad, 0x01ae, 0x01af, 0x01b2, 0x01b3, 0x01b5, 0x01b6, 0x01b8, 0x01ba, 0x01bb, 0x01bc, 0x01bf, 0x01c0, 0x01c1,
+  0x01c2, 0x01c4, 0x01c6, 0x01c7, 0x01c9, 0x01ca, 0x01cb, 0x01cc, 0x01ce, 0x01cf, 0x01d0, 0x01d1, 0x01d3, 0x01d4, 0x01d5, 0x01d6,
+  0x01d8, 0x01d9, 0x01da, 0x01dc, 0x01dd, 0x01de, 0x01df, 0x01df, 0x01e1, 0x01e2, 0x01e3, 0x01e3, 0x01e5, 0x01e6, 0x01e7, 0x01e7,
+  0x01e9, 0x01ea, 0x01ea, 0x01eb, 0x01ed, 0x01ed, 0x01ee, 0x01ee, 0x01ef, 0x01f1, 0x01f1, 0x01f2, 0x01f2, 0x01f3, 0x01f3, 0x01f5,
+  0x01f5, 0x01f5, 0x01f6, 0x01f6, 0x01f7, 0x01f7, 0x01f7, 0x01f9, 0x01f9, 0x01f9, 0x01fa, 0x01fa, 0x01fa, 0x01fb, 0x01fb, 0x01fb,
+  0x01fb, 0x01fd, 0x01fd, 0x01fd, 0x01fd, 0x01fd, 0x01fd, 0x01fd, 0x01fe, 0x01fe, 0x01fe, 0x01fe, 0x01fe, 0x01fe, 0x01fe, 0x01fe,
+  0x0001, 0x0004, 0x0007, 0x000a, 0x000d, 0x0010, 0x0013, 0x0017, 0x001a, 0x001d, 0x0020, 0x0023, 0x0026, 0x0029, 0x002c, 0x002f,
+  0x0032, 0x0035, 0x0038, 0x003b, 0x003e, 0x0041, 0x0044, 0x0047, 0x004a, 0x004d, 0x0051, 0x0053, 0x0056, 0x005a, 0x005d, 0x0060,
+  0x0063, 0x0065, 0x0069, 0x006b, 0x006e, 0x0071, 0x0075, 0x0077, 0x007a, 0x007d, 0x0080, 0x0083, 0x0086, 0x0089, 0x008c, 0x008f,
+  0x0092, 0x0095, 0x0098, 0x009b, 0x009e, 0x00a1, 0x00a4, 0x00a6, 0x00a9, 0x00ac, 0x00af, 0x00b2, 0x00b5, 0x00b8, 0x00bb, 0x00bd,
+  0x00c0, 0x00c3, 0x00c6, 0x00c9, 0x00cb, 0x00ce, 0x00d1, 0x00d4, 0x00d7, 0x00d9, 0x00dc, 0x00df, 0x00e2, 0x00e4, 0x00e7, 0x00ea,
+  0x00ec, 0x00ef, 0x00f2, 0x00f5, 0x00f7, 0x00fa, 0x00fd, 0x00ff, 0x0102, 0x0105, 0x0107, 0x010a, 0x010c, 0x010f, 0x0112, 0x0114,
+  0x0117, 0x0119, 0x011b, 0x011e, 0x0121, 0x0123, 0x0126, 0x0128, 0x012a, 0x012d, 0x012f, 0x0132, 0x0134, 0x0137, 0x0139, 0x013c,
+  0x013e, 0x0140, 0x0143, 0x0145, 0x0147, 0x014a, 0x014c, 0x014e, 0x0150, 0x0153, 0x0155, 0x0158, 0x0159, 0x015b, 0x015e, 0x0160,
+  0x0162, 0x0164, 0x0167, 0x0169, 0x016b, 0x016d, 0x016f, 0x0171, 0x0173, 0x0175, 0x0177, 0x0179, 0x017b, 0x017d, 0x017f, 0x0181,
+  0x0183, 0x0185, 0x0186, 0x0188, 0x018a, 0x018d, 0x018f, 0x0190, 0x0192, 0x0194, 0x0195, 0x0197, 0x0199, 0x019b, 0x019d, 0x019e,
+  0x01a0, 0x01a2, 0x01a4, 0x01a5, 0x01a6, 0x01a8, 0x01aa, 0x01ac, 0x01ad, 0x01ae, 0x01b1, 0x01b2, 0x01b3, 0x01b5, 0x01b6, 0x01b8,
+  0x01b9, 0x01ba, 0x01bc, 0x01be, 0x01bf, 0x01c0, 0x01c1, 0x01c2, 0x01c4, 0x01c5, 0x01c6, 0x01c7, 0x01c9, 0x01ca, 0x01cb, 0x01cc,
+  0x01ce, 0x01cf, 0x01d0, 0x01d1, 0x01d3, 0x01d4, 0x01d5, 0x01d5, 0x01d6, 0x01d8, 0x01d9, 0x01d9, 0x01da, 0x01dc, 0x01dd, 0x01dd,
+  0x01de, 0x01df, 0x01df, 0x01e1, 0x01e2, 0x01e2, 0x01e3, 0x01e3, 0x01e5, 0x01e6, 0x01e6, 0x01e7, 0x01e7, 0x01e9, 0x01e9, 0x01ea,
+  0x01ea, 0x01ea, 0x01eb, 0x01eb, 0x01ed, 0x01ed, 0x01ed, 0x01ee, 0x01ee, 0x01ee, 0x01ef, 0x01ef, 0x01ef, 0x01f1, 0x01f1, 0x01f1,
+  0x01f1, 0x01f2, 0x01f2, 0x01f2, 0x01f2, 0x01f2, 0x01f2, 0x01f2, 0x01f3, 0x01f3, 0x01f3, 0x01f3, 0x01f3, 0x01f3, 0x01f3, 0x01f3,
+  0x0001, 0x0004, 0x0007, 0x000a, 0x000d, 0x0010, 0x0013, 0x0016, 0x0019, 0x001c, 0x001f, 0x0022, 0x0025, 0x0028, 0x002b, 0x002e,
+  0x0031, 0x0034, 0x0037, 0x003a, 0x003d, 0x0040, 0x0043, 0x0046, 0x0049, 0x004c, 0x004f, 0x0052, 0x0055, 0x0058, 0x005b, 0x005e,
+  0x0060, 0x0063, 0x0066, 0x0069, 0x006c, 0x006f, 0x0072, 0x0075, 0x0078, 0x007b, 0x007d, 0x0081, 0x0083, 0x0086, 0x0089, 0x008c,
+  0x008f, 0x0092, 0x0095, 0x0097, 0x009a, 0x009d, 0x00a0, 0x00a3, 0x00a6, 0x00a9, 0x00ac, 0x00ae, 0x00b1, 0x00b4, 0x00b7, 0x00b9,
+  0x00bc, 0x00bf, 0x00c2, 0x00c4, 0x00c7, 0x00ca, 0x00cd, 0x00cf, 0x00d2, 0x00d5, 0x00d7, 0x00da, 0x00dd, 0x00df, 0x00e2, 0x00e5,
+  0x00e7, 0x00ea, 0x00ed, 0x00ef, 0x00f2, 0x00f5, 0x00f7, 0x00f9, 0x00fc, 0x00ff, 0x0102, 0x0104, 0x0107, 0x0109, 0x010c, 0x010e,
+  0x0111, 0x0113, 0x0115, 0x0118, 0x011b, 0x011d, 0x011f, 0x0122, 0x0124, 0x0126, 0x0129, 0x012b, 0x012e, 0x0130, 0x0133, 0x0135,
+  0x0137, 0x0139, 0x013c, 0x013e, 0x0140, 0x0143, 0x0145, 0x0147, 0x0149, 0x014c, 0x014d, 0x0150, 0x0152, 0x0154, 0x0157, 0x0158,
+  0x015a, 0x015c, 0x015f, 0x0161, 0x0163, 0x0165, 0x0167, 0x0169, 0x016b, 0x016d, 0x016f, 0x0171, 0x0173, 0x0175, 0x0177, 0x0179,
+  0x017b, 0x017d, 0x017e, 0x0180, 0x0182, 0x0184, 0x0186, 0x0187, 0x0189, 0x018c, 0x018d, 0x018f, 0x0190, 0x0192, 0x0194, 0x0195,
+  0x0197, 0x0199, 0x019b, 0x019c, 0x019d, 0x019f, 0x01a0, 0x01a3, 0x01a4, 0x01a5, 0x01a7, 0x01a8, 0x01aa, 0x01ac, 0x01ad, 0x01ae,
+  0x01af, 0x01b1, 0x01b3, 0x01b4, 0x01b5, 0x01b6, 0x01b8, 0x01b9, 0x01ba, 0x01bb, 0x01bc, 0x01be, 0x01bf, 0x01c0, 0x01c1, 0x01c2,
+  0x01c4, 0x01c5, 0x01c6, 0x01c7, 0x01c9, 0x01ca, 0x01cb, 0x01cb, 0x01cc, 0x01ce, 0x01cf, 0x01cf, 0x01d0, 0x01d1, 0x01d3, 0x01d3,
+  0x01d4, 0x01d5, 0x01d5, 0x01d6, 0x01d8, 0x01d8, 0x01d9, 0x01d9, 0x01da, 0x01dc, 0x01dc, 0x01dd, 0x01dd, 0x01de, 0x01de, 0x01df,
+  0x01df, 0x01df, 0x01e1, 0x01e1, 0x01e2, 0x01e2, 0x01e2, 0x01e3, 0x01e3, 0x01e3, 0x01e5, 0x01e5, 0x01e5, 0x01e6, 0x01e6, 0x01e6,
+  0x01e6, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e7, 0x01e9, 0x01e9, 0x01e9, 0x01e9, 0x01e9, 0x01e9, 0x01e9, 0x01e9,
+  0x0001, 0x0004, 0x0007, 0x000a, 0x000d, 0x0010, 0x0013, 0x0016, 0x0018, 0x001b, 0x001e, 0x0021, 0x0024, 0x0027, 0x002a, 0x002d,
+  0x0030, 0x0033, 0x0036, 0x0039, 0x003b, 0x003e, 0x0041, 0x0044, 0x0047, 0x004a, 0x004d, 0x0050, 0x0053, 0x0056, 0x0059, 0x005c,
+  0x005e, 0x0061, 0x0064, 0x0067, 0x006a, 0x006d, 0x0070, 0x0072, 0x0075, 0x0078, 0x007b, 0x007e, 0x0081, 0x0083, 0x0086, 0x0089,
+  0x008c, 0x008f, 0x0091, 0x0094, 0x0097, 0x009a, 0x009d, 0x009f, 0x00a2, 0x00a5, 0x00a8, 0x00ab, 0x00ad, 0x00b0, 0x00b3, 0x00b5,
+  0x00b8, 0x00bb, 0x00be, 0x00c0, 0x00c3, 0x00c6, 0x00c8, 0x00cb, 0x00ce, 0x00d0, 0x00d3, 0x00d6, 0x00d8, 0x00da, 0x00dd, 0x00e0,
+  0x00e2, 0x00e5, 0x00e8, 0x00ea, 0x00ed, 0x00ef, 0x00f2, 0x00f4, 0x00f7, 0x00f9, 0x00fc, 0x00fe, 0x0101, 0x0103, 0x0106, 0x0108,
+  0x010b, 0x010d, 0x010f, 0x0112, 0x0115, 0x0117, 0x0119, 0x011b, 0x011e, 0x0120, 0x0122, 0x0125, 0x0127, 0x012a, 0x012c, 0x012e,
+  0x0130, 0x0133, 0x0135, 0x0137, 0x0139, 0x013c, 0x013e, 0x0140, 0x0142, 0x0145, 0x0146, 0x0149, 0x014b, 0x014d, 0x014f, 0x0151,
+  0x0153, 0x0155, 0x0158, 0x0159, 0x015b, 0x015d, 0x015f, 0x0161, 0x0163, 0x0165, 0x0167, 0x0169, 0x016b, 0x016d, 0x016f, 0x0171,
+  0x0173, 0x0175, 0x0176, 0x0178, 0x017a, 0x017c, 0x017e, 0x017f, 0x0181, 0x0183, 0x0184, 0x0186, 0x0187, 0x0189, 0x018c, 0x018d,
+  0x018f, 0x0190, 0x0192, 0x0193, 0x0194, 0x0196, 0x0197, 0x019a, 0x019b, 0x019c, 0x019e, 0x019f, 0x01a0, 0x01a3, 0x01a4, 0x01a5,
+  0x01a6, 0x01a7, 0x01aa, 0x01ab, 0x01ac, 0x01ad, 0x01ae, 0x01af, 0x01b1, 0x01b2, 0x01b3, 0x01b4, 0x01b5, 0x01b6, 0x01b8, 0x01b9,
+  0x01ba, 0x01bb, 0x01bc, 0x01be, 0x01bf, 0x01c0, 0x01c1, 0x01c1, 0x01c2, 0x01c4, 0x01c5, 0x01c5, 0x01c6, 0x01c7, 0x01c9, 0x01c9,
+  0x01ca, 0x01cb, 0x01cb, 0x01cc, 0x01ce, 0x01ce, 0x01cf, 0x01cf, 0x01d0, 0x01d1, 0x01d1, 0x01d3, 0x01d3, 0x01d4, 0x01d4, 0x01d5,
+  0x01d5, 0x01d5, 0x01d6, 0x01d6, 0x01d8, 0x01d8, 0x01d8, 0x01d9, 0x01d9, 0x01d9, 0x01da, 0x01da, 0x01da, 0x01dc, 0x01dc, 0x01dc,
+  0x01dc, 0x01dd, 0x01dd, 0x01dd, 0x01dd, 0x01dd, 0x01dd, 0x01dd, 0x01de, 0x01de, 0x01de, 0x01de, 0x01de, 0x01de, 0x01de, 0x01de,
+  0x0001, 0x0004, 0x0007, 0x000a, 0x000c, 0x000f, 0x0012, 0x0015, 0x0018, 0x001b, 0x001e, 0x0021, 0x0023, 0x0026, 0x0029, 0x002c,
+  0x002f, 0x0032, 0x0035, 0x0037, 0x003a, 0x003d, 0x0040, 0x0043, 0x0046, 0x0048, 0x004b, 0x004e, 0x0051, 0x0054, 0x0057, 0x005a,
+  0x005c, 0x005f, 0x0062, 0x0065, 0x0067, 0x006a, 0x006d, 0x0070, 0x0073, 0x0076, 0x0078, 0x007b, 0x007e, 0x0081, 0x0083, 0x0086,
+  0x0089, 0x008c, 0x008e, 0x0091, 0x0094, 0x0097, 0x0099, 0x009c, 0x009f, 0x00a2, 0x00a4, 0x00a7, 0x00a9, 0x00ac, 0x00af, 0x00b1,
+  0x00b4, 0x00b7, 0x00ba, 0x00bc, 0x00bf, 0x00c1, 0x00c4, 0x00c7, 0x00c9, 0x00cb, 0x00ce, 0x00d1, 0x00d3, 0x00d6, 0x00d9, 0x00db,
+  0x00dd, 0x00e0, 0x00e3, 0x00e5, 0x00e8, 0x00ea, 0x00ed, 0x00ef, 0x00f1, 0x00f4, 0x00f7, 0x00f9, 0x00fb, 0x00fd, 0x0100, 0x0102,
+  0x0105, 0x0107, 0x010a, 0x010c, 0x010f, 0x0111, 0x0113, 0x0115, 0x0118, 0x011a, 0x011c, 0x011e, 0x0121, 0x0123, 0x0126, 0x0128,
+  0x012a, 0x012c, 0x012e, 0x0130, 0x0133, 0x0135, 0x0137, 0x0139, 0x013b, 0x013e, 0x013f, 0x0142, 0x0144, 0x0145, 0x0148, 0x014a,
+  0x014c, 0x014d, 0x0150, 0x0152, 0x0154, 0x0156, 0x0158, 0x0159, 0x015b, 0x015d, 0x015f, 0x0161, 0x0163, 0x0165, 0x0167, 0x0169,
+  0x016b, 0x016d, 0x016e, 0x0170, 0x0172, 0x0174, 0x0176, 0x0177, 0x0179, 0x017b, 0x017c, 0x017e, 0x017f, 0x0181, 0x0183, 0x0184,
+  0x0186, 0x0187, 0x0189, 0x018a, 0x018c, 0x018e, 0x018f, 0x0191, 0x0192, 0x0193, 0x0195, 0x0196, 0x0197, 0x019a, 0x019b, 0x019c,
+  0x019d, 0x019e, 0x01a0, 0x01a2, 0x01a3, 0x01a4, 0x01a5, 0x01a6, 0x01a7, 0x01a8, 0x01aa, 0x01ab, 0x01ac, 0x01ad, 0x01ae, 0x01af,
+  0x01b1, 0x01b2, 0x01b3, 0x01b4, 0x01b5, 0x01b6, 0x01b8, 0x01b8, 0x01b9, 0x01ba, 0x01bb, 0x01bb, 0x01bc, 0x01be, 0x01bf, 0x01bf,
+  0x01c0, 0x01c1, 0x01c1, 0x01c2, 0x01c4, 0x01c4, 0x01c5, 0x01c5, 0x01c6, 0x01c7, 0x01c7, 0x01c9, 0x01c9, 0x01ca, 0x01ca, 0x01cb,
+  0x01cb, 0x01cb, 0x01cc, 0x01cc, 0x01ce, 0x01ce, 0x01ce, 0x01cf, 0x01cf, 0x01cf, 0x01d0, 0x01d0, 0x01d0, 0x01d1, 0x01d1, 0x01d1,
+  0x01d1, 0x01d3, 0x01d3, 0x01d3, 0x01d3, 0x01d3, 0x01d3, 0x01d3, 0x01d4, 0x01d4, 0x01d4, 0x01d4, 0x01d4, 0x01d4, 0x01d4, 0x01d4,
+  0x0001, 0x0004, 0x0007, 0x0009, 0x000c, 0x000f, 0x0012, 0x0015, 0x0017, 0x001a, 0x001d, 0x0020, 0x0023, 0x0025, 0x0028, 0x002b,
+  0x002e, 0x0031, 0x0033, 0x0036, 0x0039, 0x003c, 0x003f, 0x0041, 0x0044, 0x0047, 0x004a, 0x004c, 0x004f, 0x0052, 0x0055, 0x0058,
+  0x005a, 0x005d, 0x0060, 0x0063, 0x0065, 0x0068, 0x006b, 0x006e, 0x0070, 0x0073, 0x0076, 0x0078, 0x007b, 0x007e, 0x0081, 0x0083,
+  0x0086, 0x0089, 0x008b, 0x008e, 0x0091, 0x0093, 0x0096, 0x0099, 0x009b, 0x009e, 0x00a1, 0x00a3, 0x00a6, 0x00a8, 0x00ab, 0x00ad,
+  0x00b0, 0x00b3, 0x00b6, 0x00b8, 0x00bb, 0x00bd, 0x00c0, 0x00c2, 0x00c5, 0x00c7, 0x00ca, 0x00cd, 0x00cf, 0x00d1, 0x00d4, 0x00d6,
+  0x00d9, 0x00dc, 0x00de, 0x00e0, 0x00e3, 0x00e5, 0x00e8, 0x00ea, 0x00ec, 0x00ef, 0x00f1, 0x00f3, 0x00f6, 0x00f8, 0x00fb, 0x00fd,
+  0x0100, 0x0102, 0x0104, 0x0107, 0x0109, 0x010b, 0x010d, 0x010f, 0x0112, 0x0114, 0x0116, 0x0118, 0x011b, 0x011d, 0x011f, 0x0122,
+  0x0123, 0x0126, 0x0128, 0x012a, 0x012c, 0x012e, 0x0130, 0x0133, 0x0134, 0x0137, 0x0138, 0x013b, 0x013d, 0x013e, 0x0141, 0x0143,
+  0x0145, 0x0146, 0x0149, 0x014b, 0x014d, 0x014e, 0x0150, 0x0152, 0x0154, 0x0156, 0x0158, 0x0159, 0x015b, 0x015d, 0x015f, 0x0161,
+  0x0163, 0x0165, 0x0166, 0x0168, 0x016a, 0x016c, 0x016e, 0x016f, 0x0171, 0x0173, 0x0174, 0x0176, 0x0177, 0x0179, 0x017b, 0x017c,
+  0x017e, 0x017f, 0x0181, 0x0182, 0x0183, 0x0185, 0x0186, 0x0188, 0x0189, 0x018a, 0x018d, 0x018e, 0x018f, 0x0191, 0x0192, 0x0193,
+  0x0194, 0x0195, 0x0197, 0x0199, 0x019a, 0x019b, 0x019c, 0x019d, 0x019e, 0x019f, 0x01a0, 0x01a2, 0x01a3, 0x01a4, 0x01a5, 0x01a6,
+  0x01a7, 0x01a8, 0x01aa, 0x01ab, 0x01ac, 0x01ad, 0x01ae, 0x01ae, 0x01af, 0x01b1, 0x01b2, 0x01b2, 0x01b3, 0x01b4, 0x01b5, 0x01b5,
+  0x01b6, 0x01b8, 0x01b8, 0x01b9, 0x01ba, 0x01ba, 0x01bb, 0x01bb, 0x01bc, 0x01be, 0x01be, 0x01bf, 0x01bf, 0x01c0, 0x01c0, 0x01c1,
+  0x01c1, 0x01c1, 0x01c2, 0x01c2, 0x01c4, 0x01c4, 0x01c4, 0x01c5, 0x01c5, 0x01c5, 0x01c6, 0x01c6, 0x01c6, 0x01c7, 0x01c7, 0x01c7,
+  0x01c7, 0x01c9, 0x01c9, 0x01c9, 0x01c9, 0x01c9, 0x01c9, 0x01c9, 0x01ca, 0x01ca, 0x01ca, 0x01ca, 0x01ca, 0x01ca, 0x01ca, 0x01ca,
+  0x0001, 0x0004, 0x0006, 0x0009, 0x000c, 0x000f, 0x0011, 0x0014, 0x0017, 0x001a, 0x001c, 0x001f, 0x0022, 0x0025, 0x0027, 0x002a,
+  0x002d, 0x0030, 0x0032, 0x0035, 0x0038, 0x003b, 0x003d, 0x0040, 0x0043, 0x0045, 0x0048, 0x004b, 0x004e, 0x0050, 0x0053, 0x0056,
+  0x0058, 0x005b, 0x005e, 0x0060, 0x0063, 0x0066, 0x0069, 0x006b, 0x006e, 0x0071, 0x0073, 0x0076, 0x0078, 0x007b, 0x007e, 0x0080,
+  0x0083, 0x0086, 0x0088, 0x008b, 0x008d, 0x0090, 0x0093, 0x0095, 0x0098, 0x009b, 0x009d, 0x00a0, 0x00a2, 0x00a5, 0x00a7, 0x00aa,
+  0x00ac, 0x00af, 0x00b2, 0x00b4, 0x00b7, 0x00b9, 0x00bc, 0x00be, 0x00c1, 0x00c3, 0x00c6, 0x00c8, 0x00ca, 0x00cd, 0x00cf, 0x00d2,
+  0x00d4, 0x00d7, 0x00d9, 0x00dc, 0x00de, 0x00e0, 0x00e3, 0x00e5, 0x00e7, 0x00ea, 0x00ec, 0x00ee, 0x00f1, 0x00f3, 0x00f5, 0x00f7,
+  0x00fa, 0x00fc, 0x00fe, 0x0101, 0x0103, 0x0105, 0x0107, 0x010a, 0x010c, 0x010e, 0x0110, 0x0112, 0x0115, 0x0117, 0x0119, 0x011b,
+  0x011d, 0x011f, 0x0122, 0x0123, 0x0126, 0x0128, 0x012a, 0x012c, 0x012e, 0x0130, 0x0132, 0x0134, 0x0136, 0x0138, 0x013a, 0x013c,
+  0x013e, 0x013f, 0x0142, 0x0144, 0x0145, 0x0147, 0x0149, 0x014b, 0x014d, 0x014e, 0x0150, 0x0152, 0x0154, 0x0156, 0x0158, 0x0159,
+  0x015b, 0x015d, 0x015e, 0x0160, 0x0162, 0x0164, 0x0166, 0x0167, 0x0169, 0x016b, 0x016c, 0x016e, 0x016f, 0x0171, 0x0173, 0x0174,
+  0x0176, 0x0177, 0x0179, 0x017a, 0x017b, 0x017d, 0x017e, 0x0180, 0x0181, 0x0182, 0x0184, 0x0185, 0x0186, 0x0188, 0x0189, 0x018a,
+  0x018c, 0x018d, 0x018f, 0x0190, 0x0191, 0x0192, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197, 0x0199, 0x019a, 0x019b, 0x019c, 0x019d,
+  0x019e, 0x019f, 0x01a0, 0x01a2, 0x01a3, 0x01a4, 0x01a5, 0x01a5, 0x01a6, 0x01a7, 0x01a8, 0x01a8, 0x01aa, 0x01ab, 0x01ac, 0x01ac,
+  0x01ad, 0x01ae, 0x01ae, 0x01af, 0x01b1, 0x01b1, 0x01b2, 0x01b2, 0x01b3, 0x01b4, 0x01b4, 0x01b5, 0x01b5, 0x01b6, 0x01b6, 0x01b8,
+  0x01b8, 0x01b8, 0x01b9, 0x01b9, 0x01ba, 0x01ba, 0x01ba, 0x01bb, 0x01bb, 0x01bb, 0x01bc, 0x01bc, 0x01bc, 0x01be, 0x01be, 0x01be,
+  0x01be, 0x01bf, 0x01bf, 0x01bf, 0x01bf, 0x01bf, 0x01bf, 0x01bf, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0, 0x01c0,
+  0x0001, 0x0004, 0x0006, 0x0009, 0x000c, 0x000e, 0x0011, 0x0014, 0x0016, 0x0019, 0x001c, 0x001e, 0x0021, 0x0024, 0x0027, 0x0029,
+  0x002c, 0x002f, 0x0031, 0x0034, 0x0037, 0x0039, 0x003c, 0x003e, 0x0041, 0x0044, 0x0047, 0x0049, 0x004c, 0x004f, 0x0051, 0x0054,
+  0x0056, 0x0059, 0x005c, 0x005e, 0x0061, 0x0064, 0x0066, 0x0069, 0x006b, 0x006e, 0x0071, 0x0073, 0x0076, 0x0078, 0x007b, 0x007d,
+  0x0080, 0x0083, 0x0085, 0x0088, 0x008a, 0x008d, 0x0090, 0x0092, 0x0095, 0x0097, 0x009a, 0x009c, 0x009f, 0x00a1, 0x00a4, 0x00a6,
+  0x00a9, 0x00ab, 0x00ae, 0x00b0, 0x00b3, 0x00b5, 0x00b8, 0x00ba, 0x00bd, 0x00bf, 0x00c1, 0x00c4, 0x00c6, 0x00c8, 0x00cb, 0x00cd,
+  0x00cf, 0x00d2, 0x00d5, 0x00d7, 0x00d9, 0x00dc, 0x00de, 0x00e0, 0x00e2, 0x00e5, 0x00e7, 0x00e9, 0x00ec, 0x00ee, 0x00f0, 0x00f2,
+  0x00f5, 0x00f7, 0x00f9, 0x00fb, 0x00fd, 0x0100, 0x0102, 0x0104, 0x0106, 0x0108, 0x010a, 0x010c, 0x010f, 0x0111, 0x0113, 0x0115,
+  0x0117, 0x0119, 0x011b, 0x011d, 0x011f, 0x0122, 0x0123, 0x0126, 0x0127, 0x012a, 0x012b, 0x012e, 0x012f, 0x0131, 0x0133, 0x0135,
+  0x0137, 0x0138, 0x013b, 0x013d, 0x013e, 0x0140, 0x0142, 0x0144, 0x0145, 0x0147, 0x0149, 0x014b, 0x014d, 0x014e, 0x0150, 0x0152,
+  0x0154, 0x0156, 0x0157, 0x0158, 0x015a, 0x015c, 0x015e, 0x015f, 0x0161, 0x0163, 0x0164, 0x0166, 0x0167, 0x0169, 0x016b, 0x016c,
+  0x016e, 0x016f, 0x0171, 0x0172, 0x0173, 0x0175, 0x0176, 0x0178, 0x0179, 0x017a, 0x017c, 0x017d, 0x017e, 0x0180, 0x0181, 0x0182,
+  0x0183, 0x0184, 0x0186, 0x0187, 0x0188, 0x0189, 0x018a, 0x018c, 0x018d, 0x018e, 0x018f, 0x0190, 0x0191, 0x0192, 0x0193, 0x0194,
+  0x0195, 0x0196, 0x0197, 0x0199, 0x019a, 0x019b, 0x019c, 0x019c, 0x019d, 0x019e, 0x019f, 0x019f, 0x01a0, 0x01a2, 0x01a3, 0x01a3,
+  0x01a4, 0x01a5, 0x01a5, 0x01a6, 0x01a7, 0x01a7, 0x01a8, 0x01a8, 0x01aa, 0x01ab, 0x01ab, 0x01ac, 0x01ac, 0x01ad, 0x01ad, 0x01ae,
+  0x01ae, 0x01ae, 0x01af, 0x01af, 0x01b1, 0x01b1, 0x01b1, 0x01b2, 0x01b2, 0x01b2, 0x01b3, 0x01b3, 0x01b3, 0x01b4, 0x01b4, 0x01b4,
+  0x01b4, 0x01b5, 0x01b5, 0x01b5, 0x01b5, 0x01b5, 0x01b5, 0x01b5, 0x01b6, 0x01b6, 0x01b6, 0x01b6, 0x01b6, 0x01b6, 0x01b6, 0x01b6,
+  0x0001, 0x0003, 0x0006, 0x0009, 0x000b, 0x000e, 0x0011, 0x0013, 0x0016, 0x0019, 0x001b, 0x001e, 0x0020, 0x0023, 0x0026, 0x0028,
+  0x002b, 0x002e, 0x0030, 0x0033, 0x0035, 0x0038, 0x003b, 0x003d, 0x0040, 0x0042, 0x0045, 0x0048, 0x004a, 0x004d, 0x004f, 0x0052,
+  0x0055, 0x0057, 0x005a, 0x005c, 0x005f, 0x0061, 0x0064, 0x0067, 0x0069, 0x006c, 0x006e, 0x0071, 0x0073, 0x0076, 0x0078, 0x007b,
+  0x007d, 0x0080, 0x0082, 0x0085, 0x0087, 0x008a, 0x008d, 0x008f, 0x0091, 0x0094, 0x0097, 0x0099, 0x009b, 0x009e, 0x00a0, 0x00a2,
+  0x00a5, 0x00a7, 0x00aa, 0x00ac, 0x00af, 0x00b1, 0x00b4, 0x00b6, 0x00b9, 0x00bb, 0x00bd, 0x00c0, 0x00c2, 0x00c4, 0x00c7, 0x00c9,
+  0x00cb, 0x00ce, 0x00d0, 0x00d2, 0x00d5, 0x00d7, 0x00d9, 0x00db, 0x00dd, 0x00e0, 0x00e2, 0x00e4, 0x00e7, 0x00e8, 0x00eb, 0x00ed,
+  0x00ef, 0x00f1, 0x00f3, 0x00f6, 0x00f8, 0x00fa, 0x00fc, 0x00fe, 0x0100, 0x0102, 0x0105, 0x0107, 0x0109, 0x010b, 0x010d, 0x010f,
+  0x0111, 0x0113, 0x0115, 0x0117, 0x0119, 0x011b, 0x011d, 0x011f, 0x0121, 0x0123, 0x0125, 0x0127, 0x0129, 0x012a, 0x012d, 0x012e,
+  0x0130, 0x0132, 0x0134, 0x0136, 0x0138, 0x0139, 0x013b, 0x013d, 0x013e, 0x0140, 0x0142, 0x0144, 0x0145, 0x0147, 0x0149, 0x014b,
+  0x014d, 0x014e, 0x014f, 0x0151, 0x0153, 0x0155, 0x0157, 0x0158, 0x0159, 0x015b, 0x015c, 0x015e, 0x015f, 0x0161, 0x0163, 0x0164,
+  0x0166, 0x0167, 0x0169, 0x016a, 0x016b, 0x016d, 0x016e, 0x0170, 0x0171, 0x0172, 0x0174, 0x0175, 0x0176, 0x0178, 0x0179, 0x017a,
+  0x017b, 0x017c, 0x017e, 0x017f, 0x0180, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x0189, 0x018a, 0x018c,
+  0x018d, 0x018e, 0x018f, 0x0190, 0x0191, 0x0192, 0x0193, 0x0193, 0x0194, 0x0195, 0x0196, 0x0196, 0x0197, 0x0199, 0x019a, 0x019a,
+  0x019b, 0x019c, 0x019c, 0x019d, 0x019e, 0x019e, 0x019f, 0x019f, 0x01a0, 0x01a2, 0x01a2, 0x01a3, 0x01a3, 0x01a4, 0x01a4, 0x01a5,
+  0x01a5, 0x01a5, 0x01a6, 0x01a6, 0x01a7, 0x01a7, 0x01a7, 0x01a8, 0x01a8, 0x01a8, 0x01aa, 0x01aa, 0x01aa, 0x01ab, 0x01ab, 0x01ab,
+  0x01ab, 0x01ac, 0x01ac, 0x01ac, 0x01ac, 0x01ac, 0x01ac, 0x01ac, 0x01ad, 0x01ad, 0x01ad, 0x01ad, 0x01ad, 0x01ad, 0x01ad, 0x01ad,
+  0x0001, 0x0003, 0x0006, 0x0009, 0x000b, 0x000e, 0x0010, 0x0013, 0x0015, 0x0018, 0x001b, 0x001d, 0x0020, 0x0022, 0x0025, 0x0027,
+  0x002a, 0x002d, 0x002f, 0x0032, 0x0034, 0x0037, 0x0039, 0x003c, 0x003e, 0x0041, 0x0044, 0x0046, 0x0049, 0x004b, 0x004e, 0x0050,
+  0x0053, 0x0055, 0x0058, 0x005a, 0x005d, 0x005f, 0x0062, 0x0064, 0x0067, 0x0069, 0x006c, 0x006e, 0x0071, 0x0073, 0x0076, 0x0078,
+  0x007b, 0x007d, 0x0080, 0x0082, 0x0085, 0x0087, 0x008a, 0x008c, 0x008e, 0x0091, 0x0093, 0x0096, 0x0098, 0x009a, 0x009d, 0x009f,
+  0x00a2, 0x00a4, 0x00a6, 0x00a9, 0x00ab, 0x00ad, 0x00b0, 0x00b2, 0x00b5, 0x00b7, 0x00b9, 0x00bc, 0x00be, 0x00c0, 0x00c2, 0x00c4,
+  0x00c7, 0x00c9, 0x00cb, 0x00ce, 0x00d0, 0x00d2, 0x00d5, 0x00d6, 0x00d9, 0x00db, 0x00dd, 0x00df, 0x00e2, 0x00e3, 0x00e6, 0x00e8,
+  0x00ea, 0x00ec, 0x00ee, 0x00f1, 0x00f3, 0x00f5, 0x00f7, 0x00f9, 0x00fb, 0x00fd, 0x00ff, 0x0101, 0x0103, 0x0105, 0x0107, 0x010a,
+  0x010b, 0x010d, 0x010f, 0x0111, 0x0113, 0x0115, 0x0117, 0x0119, 0x011b, 0x011d, 0x011e, 0x0121, 0x0122, 0x0124, 0x0126, 0x0128,
+  0x012a, 0x012b, 0x012e, 0x012f, 0x0131, 0x0133, 0x0134, 0x0136, 0x0138, 0x0139, 0x013b, 0x013d, 0x013e, 0x0140, 0x0142, 0x0144,
+  0x0145, 0x0147, 0x0148, 0x014a, 0x014c, 0x014d, 0x014f, 0x0150, 0x0152, 0x0154, 0x0155, 0x0157, 0x0158, 0x0159, 0x015b, 0x015c,
+  0x015e, 0x015f, 0x0161, 0x0162, 0x0163, 0x0165, 0x0166, 0x0168, 0x0169, 0x016a, 0x016c, 0x016d, 0x016e, 0x0170, 0x0171, 0x0172,
+  0x0173, 0x0174, 0x0176, 0x0177, 0x0178, 0x0179, 0x017a, 0x017b, 0x017c, 0x017d, 0x017e, 0x017f, 0x0180, 0x0181, 0x0182, 0x0183,
+  0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x0189, 0x018a, 0x018a, 0x018c, 0x018d, 0x018e, 0x018e, 0x018f, 0x0190, 0x0191, 0x0191,
+  0x0192, 0x0193, 0x0193, 0x0194, 0x0195, 0x0195, 0x0196, 0x0196, 0x0197, 0x0199, 0x0199, 0x019a, 0x019a, 0x019b, 0x019b, 0x019c,
+  0x019c, 0x019c, 0x019d, 0x019d, 0x019e, 0x019e, 0x019e, 0x019f, 0x019f, 0x019f, 0x01a0, 0x01a0, 0x01a0, 0x01a2, 0x01a2, 0x01a2,
+  0x01a2, 0x01a3, 0x01a3, 0x01a3, 0x01a3, 0x01a3, 0x01a3, 0x01a3, 0x01a4, 0x01a4, 0x01a4, 0x01a4, 0x01a4, 0x01a4, 0x01a4, 0x01a4,
+  0x0001, 0x0003, 0x0006, 0x0008, 0x000b, 0x000d, 0x0010, 0x0012, 0x0015, 0x0017, 0x001a, 0x001d, 0x001f, 0x0022, 0x0024, 0x0027,
+  0x0029, 0x002c, 0x002e, 0x0031, 0x0033, 0x0036, 0x0038, 0x003b, 0x003d, 0x0040, 0x0042, 0x0045, 0x0047, 0x004a, 0x004c, 0x004f,
+  0x0051, 0x0053, 0x0056, 0x0058, 0x005b, 0x005d, 0x0060, 0x0062, 0x0065, 0x0067, 0x0069, 0x006c, 0x006e, 0x0071, 0x0073, 0x0076,
+  0x0078, 0x007a, 0x007d, 0x007f, 0x0082, 0x0084, 0x0087, 0x0089, 0x008b, 0x008e, 0x0090, 0x0093, 0x0095, 0x0097, 0x0099, 0x009c,
+  0x009e, 0x00a0, 0x00a3, 0x00a5, 0x00a7, 0x00aa, 0x00ac, 0x00ae, 0x00b1, 0x00b3, 0x00b5, 0x00b8, 0x00ba, 0x00bc, 0x00be, 0x00c0,
+  0x00c2, 0x00c5, 0x00c7, 0x00c9, 0x00cb, 0x00ce, 0x00d0, 0x00d2, 0x00d4, 0x00d6, 0x00d9, 0x00da, 0x00dd, 0x00df, 0x00e1, 0x00e3,
+  0x00e5, 0x00e7, 0x00e9, 0x00ec, 0x00ee, 0x00ef, 0x00f1, 0x00f3, 0x00f5, 0x00f7, 0x00f9, 0x00fb, 0x00fd, 0x0100, 0x0102, 0x0104,
+  0x0105, 0x0107, 0x010a, 0x010b, 0x010d, 0x010f, 0x0111, 0x0113, 0x0115, 0x0117, 0x0118, 0x011b, 0x011c, 0x011e, 0x0120, 0x0122,
+  0x0123, 0x0125, 0x0127, 0x0129, 0x012a, 0x012c, 0x012e, 0x012f, 0x0131, 0x0133, 0x0134, 0x0136, 0x0138, 0x0139, 0x013b, 0x013d,
+  0x013e, 0x0140, 0x0141, 0x0143, 0x0145, 0x0146, 0x0148, 0x0149, 0x014b, 0x014d, 0x014d, 0x014f, 0x0150, 0x0152, 0x0154, 0x0155,
+  0x0157, 0x0158, 0x0159, 0x015a, 0x015b, 0x015d, 0x015e, 0x0160, 0x0161, 0x0162, 0x0164, 0x0165, 0x0166, 0x0168, 0x0169, 0x016a,
+  0x016b, 0x016c, 0x016e, 0x016f, 0x0170, 0x0171, 0x0172, 0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x0178, 0x0179, 0x017a, 0x017b,
+  0x017c, 0x017d, 0x017e, 0x017f, 0x0180, 0x0181, 0x0182, 0x0182, 0x0183, 0x0184, 0x0185, 0x0185, 0x0186, 0x0187, 0x0188, 0x0188,
+  0x0189, 0x018a, 0x018a, 0x018c, 0x018d, 0x018d, 0x018e, 0x018e, 0x018f, 0x0190, 0x0190, 0x0191, 0x0191, 0x0192, 0x0192, 0x0193,
+  0x0193, 0x0193, 0x0194, 0x0194, 0x0195, 0x0195, 0x0195, 0x0196, 0x0196, 0x0196, 0x0197, 0x0197, 0x0197, 0x0199, 0x0199, 0x0199,
+  0x0199, 0x019a, 0x019a, 0x019a, 0x019a, 0x019a, 0x019a, 0x019a, 0x019b, 0x019b, 0x019b, 0x019b, 0x019b, 0x019b, 0x019b, 0x019b,
+  0x0001, 0x0003, 0x0006, 0x0008, 0x000b, 0x000d, 0x0010, 0x0012, 0x0014, 0x0017, 0x0019, 0x001c, 0x001e, 0x0021, 0x0023, 0x0026,
+  0x0028, 0x002b, 0x002d, 0x0030, 0x0032, 0x0034, 0x0037, 0x0039, 0x003c, 0x003e, 0x0041, 0x0043, 0x0046, 0x0048, 0x004a, 0x004d,
+  0x004f, 0x0052, 0x0054, 0x0056, 0x0059, 0x005b, 0x005e, 0x0060, 0x0063, 0x0065, 0x0067, 0x006a, 0x006c, 0x006e, 0x0071, 0x0073,
+  0x0076, 0x0078, 0x007a, 0x007c, 0x007f, 0x0081, 0x0084, 0x0086, 0x0088, 0x008b, 0x008d, 0x008f, 0x0091, 0x0094, 0x0096, 0x0098,
+  0x009b, 0x009d, 0x009f, 0x00a2, 0x00a4, 0x00a6, 0x00a8, 0x00ab, 0x00ad, 0x00af, 0x00b1, 0x00b4, 0x00b6, 0x00b8, 0x00ba, 0x00bc,
+  0x00be, 0x00c1, 0x00c3, 0x00c5, 0x00c7, 0x00c9, 0x00cb, 0x00cd, 0x00cf, 0x00d2, 0x00d4, 0x00d6, 0x00d8, 0x00da, 0x00dc, 0x00de,
+  0x00e0, 0x00e2, 0x00e4, 0x00e7, 0x00e8, 0x00ea, 0x00ec, 0x00ee, 0x00f0, 0x00f2, 0x00f4, 0x00f6, 0x00f8, 0x00fa, 0x00fc, 0x00fe,
+  0x0100, 0x0102, 0x0104, 0x0105, 0x0107, 0x010a, 0x010b, 0x010d, 0x010f, 0x0111, 0x0112, 0x0115, 0x0116, 0x0118, 0x011a, 0x011b,
+  0x011d, 0x011e, 0x0121, 0x0122, 0x0124, 0x0126, 0x0127, 0x0129, 0x012a, 0x012c, 0x012e, 0x012f, 0x0131, 0x0133, 0x0134, 0x0136,
+  0x0138, 0x0139, 0x013a, 0x013c, 0x013e, 0x013f, 0x0141, 0x0142, 0x0144, 0x0145, 0x0146, 0x0148, 0x0149, 0x014b, 0x014d, 0x014d,
+  0x014f, 0x0150, 0x0152, 0x0153, 0x0154, 0x0156, 0x0157, 0x0158, 0x0159, 0x015a, 0x015c, 0x015d, 0x015e, 0x0160, 0x0161, 0x0162,
+  0x0163, 0x0164, 0x0166, 0x0167, 0x0168, 0x0169, 0x016a, 0x016b, 0x016c, 0x016d, 0x016e, 0x016f, 0x0170, 0x0171, 0x0172, 0x0173,
+  0x0174, 0x0175, 0x0176, 0x0177, 0x0178, 0x0179, 0x017a, 0x017a, 0x017b, 0x017c, 0x017d, 0x017d, 0x017e, 0x017f, 0x0180, 0x0180,
+  0x0181, 0x0182, 0x0182, 0x0183, 0x0184, 0x0184, 0x0185, 0x0185, 0x0186, 0x0187, 0x0187, 0x0188, 0x0188, 0x0189, 0x0189, 0x018a,
+  0x018a, 0x018a, 0x018c, 0x018c, 0x018d, 0x018d, 0x018d, 0x018e, 0x018e, 0x018e, 0x018f, 0x018f, 0x018f, 0x0190, 0x0190, 0x0190,
+  0x0190, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192,
+  0x0001, 0x0003, 0x0006, 0x0008, 0x000a, 0x000d, 0x000f, 0x0012, 0x0014, 0x0016, 0x0019, 0x001b, 0x001e, 0x0020, 0x0023, 0x0025,
+  0x0027, 0x002a, 0x002c, 0x002f, 0x0031, 0x0033, 0x0036, 0x0038, 0x003b, 0x003d, 0x003f, 0x0042, 0x0044, 0x0046, 0x0049, 0x004b,
+  0x004e, 0x0050, 0x0052, 0x0055, 0x0057, 0x0059, 0x005c, 0x005e, 0x0060, 0x0063, 0x0065, 0x0067, 0x006a, 0x006c, 0x006e, 0x0071,
+  0x0073, 0x0075, 0x0077, 0x007a, 0x007c, 0x007e, 0x0081, 0x0083, 0x0085, 0x0088, 0x008a, 0x008c, 0x008e, 0x0091, 0x0093, 0x0095,
+  0x0097, 0x0099, 0x009c, 0x009e, 0x00a0, 0x00a2, 0x00a5, 0x00a7, 0x00a9, 0x00ab, 0x00ad, 0x00b0, 0x00b2, 0x00b4, 0x00b6, 0x00b8,
+  0x00ba, 0x00bd, 0x00bf, 0x00c1, 0x00c3, 0x00c5, 0x00c7, 0x00c9, 0x00cb, 0x00cd, 0x00cf, 0x00d1, 0x00d3, 0x00d5, 0x00d7, 0x00d9,
+  0x00dc, 0x00dd, 0x00df, 0x00e2, 0x00e3, 0x00e5, 0x00e7, 0x00e9, 0x00eb, 0x00ed, 0x00ef, 0x00f1, 0x00f3, 0x00f5, 0x00f7, 0x00f9,
+  0x00fa, 0x00fc, 0x00fe, 0x0100, 0x0102, 0x0104, 0x0105, 0x0107, 0x0109, 0x010b, 0x010c, 0x010f, 0x0110, 0x0112, 0x0114, 0x0115,
+  0x0117, 0x0118, 0x011b, 0x011c, 0x011e, 0x011f, 0x0121, 0x0122, 0x0124, 0x0126, 0x0127, 0x0129, 0x012a, 0x012c, 0x012e, 0x012f,
+  0x0131, 0x0133, 0x0133, 0x0135, 0x0137, 0x0138, 0x013a, 0x013b, 0x013d, 0x013e, 0x013f, 0x0141, 0x0142, 0x0144, 0x0145, 0x0146,
+  0x0148, 0x0149, 0x014b, 0x014c, 0x014d, 0x014e, 0x014f, 0x0151, 0x0152, 0x0153, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x015a,
+  0x015b, 0x015c, 0x015e, 0x015f, 0x0160, 0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x0169, 0x016a, 0x016b,
+  0x016c, 0x016d, 0x016e, 0x016f, 0x0170, 0x0171, 0x0172, 0x0172, 0x0173, 0x0174, 0x0175, 0x0175, 0x0176, 0x0177, 0x0178, 0x0178,
+  0x0179, 0x017a, 0x017a, 0x017b, 0x017c, 0x017c, 0x017d, 0x017d, 0x017e, 0x017f, 0x017f, 0x0180, 0x0180, 0x0181, 0x0181, 0x0182,
+  0x0182, 0x0182, 0x0183, 0x0183, 0x0184, 0x0184, 0x0184, 0x0185, 0x0185, 0x0185, 0x0186, 0x0186, 0x0186, 0x0187, 0x0187, 0x0187,
+  0x0187, 0x0188, 0x0188, 0x0188, 0x0188, 0x0188, 0x0188, 0x0188, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189,
+  0x0001, 0x0003, 0x0005, 0x0008, 0x000a, 0x000c, 0x000f, 0x0011, 0x0014, 0x0016, 0x0018, 0x001b, 0x001d, 0x001f, 0x0022, 0x0024,
+  0x0027, 0x0029, 0x002b, 0x002e, 0x0030, 0x0032, 0x0035, 0x0037, 0x0039, 0x003b, 0x003e, 0x0040, 0x0043, 0x0045, 0x0047, 0x004a,
+  0x004c, 0x004e, 0x0051, 0x0053, 0x0055, 0x0057, 0x005a, 0x005c, 0x005e, 0x0061, 0x0063, 0x0065, 0x0067, 0x006a, 0x006c, 0x006e,
+  0x0071, 0x0073, 0x0075, 0x0077, 0x0079, 0x007c, 0x007e, 0x0080, 0x0082, 0x0085, 0x0087, 0x0089, 0x008b, 0x008d, 0x0090, 0x0092,
+  0x0094, 0x0096, 0x0099, 0x009b, 0x009d, 0x009f, 0x00a1, 0x00a3, 0x00a6, 0x00a7, 0x00aa, 0x00ac, 0x00ae, 0x00b0, 0x00b2, 0x00b4,
+  0x00b6, 0x00b9, 0x00bb, 0x00bd, 0x00bf, 0x00c1, 0x00c3, 0x00c4, 0x00c7, 0x00c9, 0x00cb, 0x00cd, 0x00cf, 0x00d1, 0x00d3, 0x00d5,
+  0x00d7, 0x00d9, 0x00da, 0x00dd, 0x00df, 0x00e0, 0x00e2, 0x00e4, 0x00e6, 0x00e8, 0x00ea, 0x00ec, 0x00ee, 0x00ef, 0x00f1, 0x00f3,
+  0x00f5, 0x00f7, 0x00f9, 0x00fa, 0x00fc, 0x00fe, 0x0100, 0x0102, 0x0103, 0x0105, 0x0107, 0x0109, 0x010a, 0x010c, 0x010e, 0x010f,
+  0x0111, 0x0112, 0x0115, 0x0116, 0x0118, 0x0119, 0x011b, 0x011c, 0x011e, 0x011f, 0x0121, 0x0122, 0x0124, 0x0126, 0x0127, 0x0129,
+  0x012a, 0x012c, 0x012d, 0x012e, 0x0130, 0x0132, 0x0133, 0x0134, 0x0136, 0x0138, 0x0138, 0x013a, 0x013b, 0x013d, 0x013e, 0x013f,
+  0x0141, 0x0142, 0x0144, 0x0145, 0x0145, 0x0147, 0x0148, 0x014a, 0x014b, 0x014c, 0x014d, 0x014e, 0x014f, 0x0151, 0x0152, 0x0153,
+  0x0154, 0x0155, 0x0157, 0x0158, 0x0158, 0x0159, 0x015a, 0x015b, 0x015c, 0x015d, 0x015e, 0x015f, 0x0160, 0x0161, 0x0162, 0x0163,
+  0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x0169, 0x016a, 0x016a, 0x016b, 0x016c, 0x016d, 0x016d, 0x016e, 0x016f, 0x0170, 0x0170,
+  0x0171, 0x0172, 0x0172, 0x0173, 0x0174, 0x0174, 0x0175, 0x0175, 0x0176, 0x0177, 0x0177, 0x0178, 0x0178, 0x0179, 0x0179, 0x017a,
+  0x017a, 0x017a, 0x017b, 0x017b, 0x017c, 0x017c, 0x017c, 0x017d, 0x017d, 0x017d, 0x017e, 0x017e, 0x017e, 0x017f, 0x017f, 0x017f,
+  0x017f, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181, 0x0181,
+  0x0001, 0x0003, 0x0005, 0x0008, 0x000a, 0x000c, 0x000f, 0x0011, 0x0013, 0x0015, 0x0018, 0x001a, 0x001c, 0x001f, 0x0021, 0x0023,
+  0x0026, 0x0028, 0x002a, 0x002d, 0x002f, 0x0031, 0x0033, 0x0036, 0x0038, 0x003a, 0x003d, 0x003f, 0x0041, 0x0043, 0x0046, 0x0048,
+  0x004a, 0x004c, 0x004f, 0x0051, 0x0053, 0x0056, 0x0058, 0x005a, 0x005c, 0x005f, 0x0061, 0x0063, 0x0065, 0x0067, 0x006a, 0x006c,
+  0x006e, 0x0070, 0x0072, 0x0075, 0x0077, 0x0079, 0x007b, 0x007d, 0x0080, 0x0082, 0x0084, 0x0086, 0x0088, 0x008a, 0x008d, 0x008f,
+  0x0091, 0x0093, 0x0095, 0x0097, 0x0099, 0x009c, 0x009e, 0x00a0, 0x00a2, 0x00a4, 0x00a6, 0x00a8, 0x00aa, 0x00ac, 0x00ae, 0x00b0,
+  0x00b2, 0x00b5, 0x00b7, 0x00b9, 0x00bb, 0x00bd, 0x00bf, 0x00c0, 0x00c2, 0x00c4, 0x00c7, 0x00c8, 0x00ca, 0x00cc, 0x00ce, 0x00d0,
+  0x00d2, 0x00d4, 0x00d6, 0x00d8, 0x00da, 0x00dc, 0x00dd, 0x00df, 0x00e1, 0x00e3, 0x00e5, 0x00e7, 0x00e8, 0x00ea, 0x00ec, 0x00ee,
+  0x00ef, 0x00f1, 0x00f3, 0x00f5, 0x00f7, 0x00f9, 0x00fa, 0x00fc, 0x00fd, 0x0100, 0x0101, 0x0103, 0x0105, 0x0106, 0x0108, 0x010a,
+  0x010b, 0x010c, 0x010f, 0x0110, 0x0112, 0x0113, 0x0115, 0x0116, 0x0118, 0x0119, 0x011b, 0x011c, 0x011e, 0x011f, 0x0121, 0x0122,
+  0x0124, 0x0126, 0x0126, 0x0128, 0x012a, 0x012b, 0x012d, 0x012e, 0x012f, 0x0131, 0x0132, 0x0133, 0x0134, 0x0136, 0x0138, 0x0138,
+  0x013a, 0x013b, 0x013d, 0x013e, 0x013e, 0x0140, 0x0141, 0x0143, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148, 0x014a, 0x014b, 0x014c,
+  0x014d, 0x014d, 0x014f, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0158, 0x0159, 0x015a, 0x015b,
+  0x015c, 0x015d, 0x015e, 0x015f, 0x0160, 0x0161, 0x0162, 0x0162, 0x0163, 0x0164, 0x0165, 0x0165, 0x0166, 0x0167, 0x0168, 0x0168,
+  0x0169, 0x016a, 0x016a, 0x016b, 0x016c, 0x016c, 0x016d, 0x016d, 0x016e, 0x016f, 0x016f, 0x0170, 0x0170, 0x0171, 0x0171, 0x0172,
+  0x0172, 0x0172, 0x0173, 0x0173, 0x0174, 0x0174, 0x0174, 0x0175, 0x0175, 0x0175, 0x0176, 0x0176, 0x0176, 0x0177, 0x0177, 0x0177,
+  0x0177, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0178, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179,
+  0x0001, 0x0003, 0x0005, 0x0007, 0x000a, 0x000c, 0x000e, 0x0010, 0x0013, 0x0015, 0x0017, 0x001a, 0x001c, 0x001e, 0x0020, 0x0023,
+  0x0025, 0x0027, 0x0029, 0x002c, 0x002e, 0x0030, 0x0032, 0x0034, 0x0037, 0x0039, 0x003b, 0x003d, 0x0040, 0x0042, 0x0044, 0x0046,
+  0x0049, 0x004b, 0x004d, 0x004f, 0x0051, 0x0054, 0x0056, 0x0058, 0x005a, 0x005d, 0x005f, 0x0061, 0x0063, 0x0065, 0x0067, 0x0069,
+  0x006c, 0x006e, 0x0070, 0x0072, 0x0074, 0x0077, 0x0079, 0x007b, 0x007d, 0x007f, 0x0081, 0x0083, 0x0085, 0x0087, 0x008a, 0x008c,
+  0x008e, 0x0090, 0x0092, 0x0094, 0x0096, 0x0098, 0x009a, 0x009c, 0x009f, 0x00a0, 0x00a2, 0x00a5, 0x00a6, 0x00a8, 0x00ab, 0x00ac,
+  0x00ae, 0x00b1, 0x00b3, 0x00b5, 0x00b7, 0x00b9, 0x00bb, 0x00bc, 0x00be, 0x00c0, 0x00c2, 0x00c4, 0x00c6, 0x00c8, 0x00ca, 0x00cb,
+  0x00ce, 0x00cf, 0x00d1, 0x00d3, 0x00d5, 0x00d7, 0x00d9, 0x00da, 0x00dc, 0x00de, 0x00e0, 0x00e2, 0x00e3, 0x00e5, 0x00e7, 0x00e9,
+  0x00ea, 0x00ec, 0x00ee, 0x00ef, 0x00f1, 0x00f3, 0x00f5, 0x00f7, 0x00f8, 0x00fa, 0x00fb, 0x00fd, 0x00ff, 0x0100, 0x0102, 0x0104,
+  0x0105, 0x0107, 0x0109, 0x010a, 0x010c, 0x010d, 0x010f, 0x0110, 0x0112, 0x0113, 0x0115, 0x0116, 0x0118, 0x0119, 0x011b, 0x011c,
+  0x011e, 0x011f, 0x0120, 0x0122, 0x0123, 0x0125, 0x0126, 0x0127, 0x0129, 0x012a, 0x012b, 0x012d, 0x012e, 0x012f, 0x0131, 0x0132,
+  0x0133, 0x0134, 0x0136, 0x0137, 0x0138, 0x0139, 0x013a, 0x013c, 0x013d, 0x013e, 0x013f, 0x0140, 0x0141, 0x0143, 0x0144, 0x0145,
+  0x0145, 0x0146, 0x0148, 0x0149, 0x014a, 0x014b, 0x014c, 0x014d, 0x014d, 0x014e, 0x014f, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154,
+  0x0155, 0x0156, 0x0157, 0x0158, 0x0158, 0x0159, 0x015a, 0x015a, 0x015b, 0x015c, 0x015d, 0x015d, 0x015e, 0x015f, 0x0160, 0x0160,
+  0x0161, 0x0162, 0x0162, 0x0163, 0x0164, 0x0164, 0x0165, 0x0165, 0x0166, 0x0167, 0x0167, 0x0168, 0x0168, 0x0169, 0x0169, 0x016a,
+  0x016a, 0x016a, 0x016b, 0x016b, 0x016c, 0x016c, 0x016c, 0x016d, 0x016d, 0x016d, 0x016e, 0x016e, 0x016e, 0x016f, 0x016f, 0x016f,
+  0x016f, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171,
+  0x0001, 0x0003, 0x0005, 0x0007, 0x0009, 0x000c, 0x000e, 0x0010, 0x0012, 0x0015, 0x0017, 0x0019, 0x001b, 0x001d, 0x0020, 0x0022,
+  0x0024, 0x0026, 0x0028, 0x002b, 0x002d, 0x002f, 0x0031, 0x0033, 0x0036, 0x0038, 0x003a, 0x003c, 0x003e, 0x0041, 0x0043, 0x0045,
+  0x0047, 0x0049, 0x004b, 0x004e, 0x0050, 0x0052, 0x0054, 0x0056, 0x0058, 0x005b, 0x005d, 0x005f, 0x0061, 0x0063, 0x0065, 0x0067,
+  0x0069, 0x006b, 0x006e, 0x0070, 0x0072, 0x0074, 0x0076, 0x0078, 0x007a, 0x007c, 0x007e, 0x0081, 0x0082, 0x0085, 0x0087, 0x0089,
+  0x008b, 0x008d, 0x008f, 0x0091, 0x0093, 0x0095, 0x0097, 0x0099, 0x009b, 0x009d, 0x009f, 0x00a1, 0x00a3, 0x00a5, 0x00a7, 0x00a9,
+  0x00ab, 0x00ad, 0x00af, 0x00b1, 0x00b3, 0x00b5, 0x00b7, 0x00b8, 0x00ba, 0x00bc, 0x00be, 0x00c0, 0x00c2, 0x00c3, 0x00c6, 0x00c7,
+  0x00c9, 0x00cb, 0x00cd, 0x00cf, 0x00d1, 0x00d2, 0x00d4, 0x00d6, 0x00d7, 0x00d9, 0x00db, 0x00dd, 0x00df, 0x00e0, 0x00e2, 0x00e4,
+  0x00e5, 0x00e7, 0x00e9, 0x00ea, 0x00ec, 0x00ee, 0x00ef, 0x00f1, 0x00f3, 0x00f5, 0x00f6, 0x00f8, 0x00f9, 0x00fb, 0x00fd, 0x00fe,
+  0x0100, 0x0101, 0x0103, 0x0105, 0x0106, 0x0107, 0x0109, 0x010a, 0x010c, 0x010d, 0x010f, 0x0110, 0x0112, 0x0113, 0x0115, 0x0116,
+  0x0118, 0x0119, 0x011a, 0x011b, 0x011d, 0x011e, 0x0120, 0x0121, 0x0122, 0x0124, 0x0125, 0x0126, 0x0127, 0x0129, 0x012a, 0x012b,
+  0x012d, 0x012e, 0x012f, 0x0130, 0x0131, 0x0133, 0x0133, 0x0135, 0x0136, 0x0137, 0x0138, 0x0139, 0x013a, 0x013c, 0x013d, 0x013e,
+  0x013e, 0x013f, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 0x014a, 0x014b, 0x014c, 0x014d,
+  0x014d, 0x014e, 0x014f, 0x0150, 0x0151, 0x0152, 0x0153, 0x0153, 0x0154, 0x0155, 0x0156, 0x0156, 0x0157, 0x0158, 0x0158, 0x0158,
+  0x0159, 0x015a, 0x015a, 0x015b, 0x015c, 0x015c, 0x015d, 0x015d, 0x015e, 0x015f, 0x015f, 0x0160, 0x0160, 0x0161, 0x0161, 0x0162,
+  0x0162, 0x0162, 0x0163, 0x0163, 0x0164, 0x0164, 0x0164, 0x0165, 0x0165, 0x0165, 0x0166, 0x0166, 0x0166, 0x0167, 0x0167, 0x0167,
+  0x0167, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169,
+  0x0001, 0x0003, 0x0005, 0x0007, 0x0009, 0x000b, 0x000e, 0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x001b, 0x001d, 0x001f, 0x0021,
+  0x0023, 0x0025, 0x0028, 0x002a, 0x002c, 0x002e, 0x0030, 0x0032, 0x0034, 0x0037, 0x0039, 0x003b, 0x003d, 0x003f, 0x0041, 0x0043,
+  0x0046, 0x0048, 0x004a, 0x004c, 0x004e, 0x0050, 0x0052, 0x0054, 0x0056, 0x0059, 0x005b, 0x005d, 0x005f, 0x0061, 0x0063, 0x0065,
+  0x0067, 0x0069, 0x006b, 0x006d, 0x006f, 0x0071, 0x0074, 0x0076, 0x0077, 0x007a, 0x007c, 0x007e, 0x0080, 0x0082, 0x0084, 0x0086,
+  0x0088, 0x008a, 0x008c, 0x008e, 0x0090, 0x0092, 0x0094, 0x0096, 0x0098, 0x0099, 0x009c, 0x009e, 0x009f, 0x00a1, 0x00a3, 0x00a5,
+  0x00a7, 0x00a9, 0x00ab, 0x00ad, 0x00af, 0x00b1, 0x00b3, 0x00b4, 0x00b6, 0x00b8, 0x00ba, 0x00bc, 0x00be, 0x00bf, 0x00c1, 0x00c3,
+  0x00c5, 0x00c7, 0x00c8, 0x00ca, 0x00cc, 0x00ce, 0x00cf, 0x00d1, 0x00d3, 0x00d5, 0x00d6, 0x00d8, 0x00da, 0x00dc, 0x00dd, 0x00df,
+  0x00e0, 0x00e2, 0x00e4, 0x00e5, 0x00e7, 0x00e9, 0x00ea, 0x00ec, 0x00ee, 0x00ef, 0x00f1, 0x00f3, 0x00f4, 0x00f5, 0x00f7, 0x00f9,
+  0x00fa, 0x00fb, 0x00fd, 0x00ff, 0x0100, 0x0102, 0x0103, 0x0105, 0x0106, 0x0107, 0x0109, 0x010a, 0x010c, 0x010d, 0x010f, 0x0110,
+  0x0112, 0x0113, 0x0114, 0x0115, 0x0117, 0x0118, 0x011a, 0x011b, 0x011c, 0x011e, 0x011e, 0x0120, 0x0121, 0x0122, 0x0124, 0x0125,
+  0x0126, 0x0127, 0x0129, 0x012a, 0x012a, 0x012c, 0x012d, 0x012e, 0x012f, 0x0130, 0x0132, 0x0133, 0x0133, 0x0135, 0x0136, 0x0137,
+  0x0138, 0x0138, 0x013a, 0x013b, 0x013c, 0x013d, 0x013e, 0x013e, 0x013f, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0145,
+  0x0146, 0x0147, 0x0148, 0x0149, 0x014a, 0x014b, 0x014c, 0x014c, 0x014d, 0x014d, 0x014e, 0x014e, 0x014f, 0x0150, 0x0151, 0x0151,
+  0x0152, 0x0153, 0x0153, 0x0154, 0x0155, 0x0155, 0x0156, 0x0156, 0x0157, 0x0158, 0x0158, 0x0158, 0x0158, 0x0159, 0x0159, 0x015a,
+  0x015a, 0x015a, 0x015b, 0x015b, 0x015c, 0x015c, 0x015c, 0x015d, 0x015d, 0x015d, 0x015e, 0x015e, 0x015e, 0x015f, 0x015f, 0x015f,
+  0x015f, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161, 0x0161,
+  0x0001, 0x0003, 0x0005, 0x0007, 0x0009, 0x000b, 0x000d, 0x000f, 0x0012, 0x0014, 0x0016, 0x0018, 0x001a, 0x001c, 0x001e, 0x0020,
+  0x0023, 0x0025, 0x0027, 0x0029, 0x002b, 0x002d, 0x002f, 0x0031, 0x0033, 0x0035, 0x0038, 0x003a, 0x003c, 0x003e, 0x0040, 0x0042,
+  0x0044, 0x0046, 0x0048, 0x004a, 0x004c, 0x004e, 0x0051, 0x0053, 0x0055, 0x0057, 0x0059, 0x005b, 0x005d, 0x005f, 0x0061, 0x0063,
+  0x0065, 0x0067, 0x0069, 0x006b, 0x006d, 0x006f, 0x0071, 0x0073, 0x0075, 0x0077, 0x0079, 0x007b, 0x007d, 0x007f, 0x0081, 0x0083,
+  0x0085, 0x0087, 0x0089, 0x008b, 0x008d, 0x008f, 0x0091, 0x0093, 0x0095, 0x0096, 0x0098, 0x009a, 0x009c, 0x009e, 0x00a0, 0x00a2,
+  0x00a3, 0x00a6, 0x00a7, 0x00a9, 0x00ab, 0x00ad, 0x00af, 0x00b0, 0x00b2, 0x00b4, 0x00b6, 0x00b8, 0x00ba, 0x00bb, 0x00bd, 0x00bf,
+  0x00c1, 0x00c2, 0x00c4, 0x00c6, 0x00c8, 0x00c9, 0x00cb, 0x00cd, 0x00ce, 0x00d0, 0x00d2, 0x00d3, 0x00d5, 0x00d7, 0x00d9, 0x00da,
+  0x00dc, 0x00dd, 0x00df, 0x00e0, 0x00e2, 0x00e4, 0x00e5, 0x00e7, 0x00e8, 0x00ea, 0x00ec, 0x00ee, 0x00ef, 0x00f0, 0x00f2, 0x00f3,
+  0x00f5, 0x00f6, 0x00f8, 0x00f9, 0x00fb, 0x00fc, 0x00fd, 0x00ff, 0x0100, 0x0102, 0x0103, 0x0105, 0x0106, 0x0107, 0x0109, 0x010a,
+  0x010c, 0x010d, 0x010e, 0x010f, 0x0111, 0x0112, 0x0114, 0x0115, 0x0116, 0x0118, 0x0118, 0x011a, 0x011b, 0x011c, 0x011e, 0x011e,
+  0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0126, 0x0126, 0x0128, 0x0129, 0x012a, 0x012b, 0x012c, 0x012d, 0x012e, 0x012f, 0x0130,
+  0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0138, 0x0138, 0x0139, 0x013a, 0x013b, 0x013c, 0x013d, 0x013e, 0x013e,
+  0x013f, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0145, 0x0145, 0x0146, 0x0147, 0x0147, 0x0148, 0x0149, 0x014a, 0x014a,
+  0x014b, 0x014c, 0x014c, 0x014d, 0x014d, 0x014d, 0x014e, 0x014e, 0x014f, 0x0150, 0x0150, 0x0151, 0x0151, 0x0152, 0x0152, 0x0153,
+  0x0153, 0x0153, 0x0154, 0x0154, 0x0155, 0x0155, 0x0155, 0x0156, 0x0156, 0x0156, 0x0157, 0x0157, 0x0157, 0x0158, 0x0158, 0x0158,
+  0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159,
+  0x0001, 0x0003, 0x0005, 0x0007, 0x0009, 0x000b, 0x000d, 0x000f, 0x0011, 0x0013, 0x0015, 0x0017, 0x0019, 0x001c, 0x001e, 0x0020,
+  0x0022, 0x0024, 0x0026, 0x0028, 0x002a, 0x002c, 0x002e, 0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x003a, 0x003c, 0x003e, 0x0041,
+  0x0043, 0x0045, 0x0047, 0x0049, 0x004b, 0x004d, 0x004f, 0x0051, 0x0053, 0x0055, 0x0057, 0x0059, 0x005b, 0x005d, 0x005f, 0x0061,
+  0x0063, 0x0065, 0x0067, 0x0069, 0x006b, 0x006d, 0x006f, 0x0071, 0x0072, 0x0075, 0x0077, 0x0078, 0x007a, 0x007c, 0x007e, 0x0080,
+  0x0082, 0x0084, 0x0086, 0x0088, 0x008a, 0x008c, 0x008d, 0x008f, 0x0091, 0x0093, 0x0095, 0x0097, 0x0099, 0x009a, 0x009c, 0x009e,
+  0x00a0, 0x00a2, 0x00a4, 0x00a6, 0x00a7, 0x00a9, 0x00ab, 0x00ac, 0x00ae, 0x00b0, 0x00b2, 0x00b4, 0x00b6, 0x00b7, 0x00b9, 0x00bb,
+  0x00bd, 0x00be, 0x00c0, 0x00c2, 0x00c3, 0x00c5, 0x00c7, 0x00c8, 0x00ca, 0x00cb, 0x00cd, 0x00cf, 0x00d1, 0x00d2, 0x00d4, 0x00d6,
+  0x00d7, 0x00d9, 0x00da, 0x00dc, 0x00dd, 0x00df, 0x00e0, 0x00e2, 0x00e3, 0x00e5, 0x00e7, 0x00e8, 0x00ea, 0x00eb, 0x00ed, 0x00ee,
+  0x00ef, 0x00f1, 0x00f3, 0x00f4, 0x00f5, 0x00f7, 0x00f8, 0x00f9, 0x00fb, 0x00fc, 0x00fd, 0x00ff, 0x0100, 0x0102, 0x0103, 0x0105,
+  0x0106, 0x0107, 0x0108, 0x010a, 0x010b, 0x010c, 0x010e, 0x010f, 0x0110, 0x0112, 0x0112, 0x0114, 0x0115, 0x0116, 0x0118, 0x0118,
+  0x011a, 0x011b, 0x011c, 0x011d, 0x011e, 0x011f, 0x0120, 0x0122, 0x0122, 0x0123, 0x0125, 0x0126, 0x0126, 0x0128, 0x0129, 0x012a,
+  0x012a, 0x012b, 0x012d, 0x012e, 0x012e, 0x012f, 0x0130, 0x0131, 0x0132, 0x0133, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0138,
+  0x0138, 0x0139, 0x013a, 0x013b, 0x013c, 0x013d, 0x013e, 0x013e, 0x013e, 0x013f, 0x0140, 0x0140, 0x0141, 0x0142, 0x0143, 0x0143,
+  0x0144, 0x0145, 0x0145, 0x0145, 0x0146, 0x0146, 0x0147, 0x0147, 0x0148, 0x0149, 0x0149, 0x014a, 0x014a, 0x014b, 0x014b, 0x014c,
+  0x014c, 0x014c, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014e, 0x014e, 0x014e, 0x014f, 0x014f, 0x014f, 0x0150, 0x0150, 0x0150,
+  0x0150, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0152, 0x0152, 0x0152, 0x0152, 0x0152, 0x0152, 0x0152, 0x0152,
+  0x0001, 0x0003, 0x0005, 0x0007, 0x0009, 0x000b, 0x000d, 0x000f, 0x0011, 0x0013, 0x0015, 0x0017, 0x0019, 0x001b, 0x001d, 0x001f,
+  0x0021, 0x0023, 0x0025, 0x0027, 0x0029, 0x002b, 0x002d, 0x002f, 0x0031, 0x0033, 0x0035, 0x0037, 0x0039, 0x003b, 0x003d, 0x003f,
+  0x0041, 0x0043, 0x0045, 0x0047, 0x0049, 0x004b, 0x004d, 0x004f, 0x0051, 0x0053, 0x0055, 0x0057, 0x0059, 0x005b, 0x005d, 0x005f,
+  0x0061, 0x0063, 0x0064, 0x0066, 0x0068, 0x006a, 0x006c, 0x006e, 0x0070, 0x0072, 0x0074, 0x0076, 0x0077, 0x0079, 0x007b, 0x007d,
+  0x007f, 0x0081, 0x0083, 0x0085, 0x0087, 0x0089, 0x008a, 0x008c, 0x008e, 0x0090, 0x0092, 0x0094, 0x0095, 0x0097, 0x0099, 0x009b,
+  0x009c, 0x009f, 0x00a0, 0x00a2, 0x00a4, 0x00a6, 0x00a7, 0x00a9, 0x00ab, 0x00ac, 0x00ae, 0x00b0, 0x00b2, 0x00b3, 0x00b5, 0x00b7,
+  0x00b9, 0x00ba, 0x00bc, 0x00be, 0x00bf, 0x00c1, 0x00c2, 0x00c4, 0x00c6, 0x00c7, 0x00c9, 0x00ca, 0x00cc, 0x00ce, 0x00cf, 0x00d1,
+  0x00d2, 0x00d4, 0x00d6, 0x00d7, 0x00d9, 0x00da, 0x00dc, 0x00dd, 0x00df, 0x00e0, 0x00e2, 0x00e3, 0x00e5, 0x00e6, 0x00e8, 0x00e9,
+  0x00ea, 0x00ec, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f3, 0x00f4, 0x00f5, 0x00f7, 0x00f8, 0x00f9, 0x00fb, 0x00fc, 0x00fd, 0x00ff,
+  0x0100, 0x0102, 0x0102, 0x0104, 0x0105, 0x0107, 0x0108, 0x0109, 0x010a, 0x010c, 0x010c, 0x010e, 0x010f, 0x0110, 0x0112, 0x0112,
+  0x0114, 0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011a, 0x011b, 0x011c, 0x011d, 0x011e, 0x011f, 0x0120, 0x0122, 0x0122, 0x0123,
+  0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012a, 0x012a, 0x012b, 0x012c, 0x012d, 0x012e, 0x012e, 0x012f, 0x0130, 0x0131,
+  0x0132, 0x0133, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0137, 0x0138, 0x0138, 0x0139, 0x0139, 0x013a, 0x013b, 0x013c, 0x013c,
+  0x013d, 0x013e, 0x013e, 0x013e, 0x013f, 0x013f, 0x0140, 0x0140, 0x0141, 0x0142, 0x0142, 0x0143, 0x0143, 0x0144, 0x0144, 0x0145,
+  0x0145, 0x0145, 0x0145, 0x0145, 0x0146, 0x0146, 0x0146, 0x0147, 0x0147, 0x0147, 0x0148, 0x0148, 0x0148, 0x0149, 0x0149, 0x0149,
+  0x0149, 0x014a, 0x014a, 0x014a, 0x014a, 0x014a, 0x014a, 0x014a, 0x014b, 0x014b, 0x014b, 0x014b, 0x014b, 0x014b, 0x014b, 0x014b,
+  0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000c, 0x000e, 0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x001a, 0x001c, 0x001e,
+  0x0020, 0x0022, 0x0024, 0x0026, 0x0028, 0x002a, 0x002c, 0x002e, 0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x003a, 0x003c, 0x003e,
+  0x0040, 0x0042, 0x0044, 0x0046, 0x0047, 0x0049, 0x004b, 0x004d, 0x004f, 0x0051, 0x0053, 0x0055, 0x0057, 0x0059, 0x005b, 0x005d,
+  0x005f, 0x0060, 0x0062, 0x0064, 0x0066, 0x0068, 0x006a, 0x006c, 0x006e, 0x0070, 0x0071, 0x0073, 0x0075, 0x0077, 0x0079, 0x007a,
+  0x007c, 0x007e, 0x0080, 0x0082, 0x0084, 0x0086, 0x0087, 0x0089, 0x008b, 0x008d, 0x008f, 0x0091, 0x0092, 0x0094, 0x0096, 0x0097,
+  0x0099, 0x009b, 0x009d, 0x009f, 0x00a0, 0x00a2, 0x00a4, 0x00a5, 0x00a7, 0x00a9, 0x00ab, 0x00ac, 0x00ae, 0x00af, 0x00b1, 0x00b3,
+  0x00b5, 0x00b6, 0x00b8, 0x00ba, 0x00bb, 0x00bd, 0x00be, 0x00c0, 0x00c1, 0x00c3, 0x00c4, 0x00c6, 0x00c8, 0x00c9, 0x00cb, 0x00cd,
+  0x00ce, 0x00cf, 0x00d1, 0x00d2, 0x00d4, 0x00d6, 0x00d7, 0x00d9, 0x00da, 0x00dc, 0x00dd, 0x00df, 0x00e0, 0x00e1, 0x00e3, 0x00e4,
+  0x00e5, 0x00e7, 0x00e8, 0x00ea, 0x00eb, 0x00ec, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f3, 0x00f4, 0x00f5, 0x00f7, 0x00f8, 0x00f9,
+  0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x0100, 0x0101, 0x0102, 0x0103, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010a, 0x010c, 0x010c,
+  0x010e, 0x010f, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011a, 0x011b, 0x011c, 0x011d,
+  0x011e, 0x011e, 0x0120, 0x0121, 0x0122, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0126, 0x0127, 0x0128, 0x0129, 0x012a, 0x012a,
+  0x012b, 0x012c, 0x012d, 0x012e, 0x012e, 0x012f, 0x0130, 0x0130, 0x0131, 0x0132, 0x0133, 0x0133, 0x0133, 0x0134, 0x0135, 0x0135,
+  0x0136, 0x0137, 0x0137, 0x0138, 0x0138, 0x0138, 0x0139, 0x0139, 0x013a, 0x013b, 0x013b, 0x013c, 0x013c, 0x013d, 0x013d, 0x013e,
+  0x013e, 0x013e, 0x013e, 0x013e, 0x013f, 0x013f, 0x013f, 0x0140, 0x0140, 0x0140, 0x0141, 0x0141, 0x0141, 0x0142, 0x0142, 0x0142,
+  0x0142, 0x0143, 0x0143, 0x0143, 0x0143, 0x0143, 0x0143, 0x0143, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144,
+  0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000c, 0x000e, 0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x001a, 0x001c, 0x001e,
+  0x0020, 0x0021, 0x0023, 0x0025, 0x0027, 0x0029, 0x002b, 0x002d, 0x002f, 0x0031, 0x0033, 0x0035, 0x0037, 0x0039, 0x003b, 0x003c,
+  0x003e, 0x0040, 0x0042, 0x0044, 0x0046, 0x0048, 0x004a, 0x004c, 0x004e, 0x004f, 0x0051, 0x0053, 0x0055, 0x0057, 0x0059, 0x005b,
+  0x005d, 0x005e, 0x0060, 0x0062, 0x0064, 0x0066, 0x0068, 0x0069, 0x006b, 0x006d, 0x006f, 0x0071, 0x0072, 0x0074, 0x0076, 0x0078,
+  0x007a, 0x007b, 0x007d, 0x007f, 0x0081, 0x0083, 0x0085, 0x0086, 0x0088, 0x008a, 0x008c, 0x008d, 0x008f, 0x0091, 0x0093, 0x0094,
+  0x0096, 0x0098, 0x0099, 0x009b, 0x009d, 0x009f, 0x00a0, 0x00a2, 0x00a3, 0x00a5, 0x00a7, 0x00a8, 0x00aa, 0x00ac, 0x00ad, 0x00af,
+  0x00b1, 0x00b2, 0x00b4, 0x00b6, 0x00b7, 0x00b9, 0x00ba, 0x00bc, 0x00bd, 0x00bf, 0x00c0, 0x00c2, 0x00c3, 0x00c5, 0x00c7, 0x00c8,
+  0x00c9, 0x00cb, 0x00cd, 0x00ce, 0x00cf, 0x00d1, 0x00d2, 0x00d4, 0x00d5, 0x00d7, 0x00d8, 0x00da, 0x00db, 0x00dc, 0x00de, 0x00df,
+  0x00e0, 0x00e2, 0x00e3, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00ea, 0x00eb, 0x00ec, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f3, 0x00f4,
+  0x00f5, 0x00f7, 0x00f7, 0x00f9, 0x00fa, 0x00fb, 0x00fd, 0x00fd, 0x00ff, 0x0100, 0x0101, 0x0102, 0x0103, 0x0105, 0x0106, 0x0107,
+  0x0108, 0x0109, 0x010a, 0x010b, 0x010c, 0x010d, 0x010e, 0x010f, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117,
+  0x0118, 0x0118, 0x011a, 0x011b, 0x011b, 0x011c, 0x011d, 0x011e, 0x011e, 0x011f, 0x0120, 0x0121, 0x0122, 0x0122, 0x0123, 0x0124,
+  0x0125, 0x0126, 0x0126, 0x0127, 0x0128, 0x0129, 0x012a, 0x012a, 0x012a, 0x012b, 0x012c, 0x012c, 0x012d, 0x012e, 0x012e, 0x012e,
+  0x012f, 0x0130, 0x0130, 0x0131, 0x0132, 0x0132, 0x0133, 0x0133, 0x0133, 0x0134, 0x0134, 0x0135, 0x0135, 0x0136, 0x0136, 0x0137,
+  0x0137, 0x0137, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0139, 0x0139, 0x0139, 0x013a, 0x013a, 0x013a, 0x013b, 0x013b, 0x013b,
+  0x013b, 0x013c, 0x013c, 0x013c, 0x013c, 0x013c, 0x013c, 0x013c, 0x013d, 0x013d, 0x013d, 0x013d, 0x013d, 0x013d, 0x013d, 0x013d,
+  0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000c, 0x000e, 0x0010, 0x0012, 0x0013, 0x0015, 0x0017, 0x0019, 0x001b, 0x001d,
+  0x001f, 0x0021, 0x0023, 0x0025, 0x0026, 0x0028, 0x002a, 0x002c, 0x002e, 0x0030, 0x0032, 0x0034, 0x0035, 0x0037, 0x0039, 0x003b,
+  0x003d, 0x003f, 0x0041, 0x0043, 0x0044, 0x0046, 0x0048, 0x004a, 0x004c, 0x004e, 0x004f, 0x0051, 0x0053, 0x0055, 0x0057, 0x0059,
+  0x005b, 0x005c, 0x005e, 0x0060, 0x0062, 0x0064, 0x0065, 0x0067, 0x0069, 0x006b, 0x006d, 0x006e, 0x0070, 0x0072, 0x0074, 0x0075,
+  0x0077, 0x0079, 0x007b, 0x007c, 0x007e, 0x0080, 0x0082, 0x0083, 0x0085, 0x0087, 0x0089, 0x008a, 0x008c, 0x008d, 0x008f, 0x0091,
+  0x0093, 0x0095, 0x0096, 0x0098, 0x0099, 0x009b, 0x009d, 0x009e, 0x00a0, 0x00a2, 0x00a3, 0x00a5, 0x00a6, 0x00a8, 0x00aa, 0x00ab,
+  0x00ad, 0x00ae, 0x00b0, 0x00b2, 0x00b3, 0x00b5, 0x00b6, 0x00b8, 0x00b9, 0x00bb, 0x00bc, 0x00be, 0x00bf, 0x00c1, 0x00c2, 0x00c4,
+  0x00c5, 0x00c7, 0x00c8, 0x00c9, 0x00cb, 0x00cd, 0x00ce, 0x00cf, 0x00d1, 0x00d2, 0x00d3, 0x00d5, 0x00d6, 0x00d7, 0x00d9, 0x00da,
+  0x00dc, 0x00dd, 0x00df, 0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00ea, 0x00eb, 0x00ec, 0x00ee, 0x00ef,
+  0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x00f9, 0x00fb, 0x00fb, 0x00fd, 0x00fd, 0x00ff, 0x0100, 0x0101,
+  0x0102, 0x0103, 0x0105, 0x0105, 0x0106, 0x0107, 0x0108, 0x010a, 0x010a, 0x010b, 0x010c, 0x010d, 0x010e, 0x010f, 0x0110, 0x0111,
+  0x0112, 0x0112, 0x0114, 0x0115, 0x0115, 0x0116, 0x0117, 0x0118, 0x0118, 0x0119, 0x011a, 0x011b, 0x011b, 0x011c, 0x011d, 0x011e,
+  0x011e, 0x011f, 0x0120, 0x0121, 0x0122, 0x0122, 0x0123, 0x0123, 0x0124, 0x0125, 0x0126, 0x0126, 0x0126, 0x0127, 0x0128, 0x0128,
+  0x0129, 0x012a, 0x012a, 0x012a, 0x012b, 0x012b, 0x012c, 0x012c, 0x012d, 0x012e, 0x012e, 0x012e, 0x012e, 0x012f, 0x012f, 0x0130,
+  0x0130, 0x0130, 0x0131, 0x0131, 0x0132, 0x0132, 0x0132, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0134, 0x0134, 0x0134,
+  0x0134, 0x0135, 0x0135, 0x0135, 0x0135, 0x0135, 0x0135, 0x0135, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136,
+  0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000c, 0x000d, 0x000f, 0x0011, 0x0013, 0x0015, 0x0017, 0x0019, 0x001a, 0x001c,
+  0x001e, 0x0020, 0x0022, 0x0024, 0x0026, 0x0027, 0x0029, 0x002b, 0x002d, 0x002f, 0x0031, 0x0032, 0x0034, 0x0036, 0x0038, 0x003a,
+  0x003c, 0x003d, 0x003f, 0x0041, 0x0043, 0x0045, 0x0047, 0x0048, 0x004a, 0x004c, 0x004e, 0x0050, 0x0051, 0x0053, 0x0055, 0x0057,
+  0x0059, 0x005a, 0x005c, 0x005e, 0x0060, 0x0061, 0x0063, 0x0065, 0x0067, 0x0069, 0x006a, 0x006c, 0x006e, 0x006f, 0x0071, 0x0073,
+  0x0075, 0x0076, 0x0078, 0x007a, 0x007b, 0x007d, 0x007f, 0x0081, 0x0082, 0x0084, 0x0086, 0x0087, 0x0089, 0x008a, 0x008c, 0x008e,
+  0x008f, 0x0091, 0x0093, 0x0095, 0x0096, 0x0098, 0x0099, 0x009b, 0x009c, 0x009e, 0x00a0, 0x00a1, 0x00a3, 0x00a4, 0x00a6, 0x00a7,
+  0x00a9, 0x00ab, 0x00ac, 0x00ae, 0x00af, 0x00b1, 0x00b2, 0x00b4, 0x00b5, 0x00b7, 0x00b8, 0x00ba, 0x00bb, 0x00bd, 0x00be, 0x00c0,
+  0x00c1, 0x00c2, 0x00c4, 0x00c5, 0x00c7, 0x00c8, 0x00c9, 0x00cb, 0x00cc, 0x00ce, 0x00cf, 0x00d1, 0x00d2, 0x00d3, 0x00d5, 0x00d6,
+  0x00d7, 0x00d8, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00df, 0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00ea,
+  0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x00f9, 0x00fb, 0x00fb,
+  0x00fd, 0x00fd, 0x00ff, 0x0100, 0x0100, 0x0102, 0x0102, 0x0104, 0x0105, 0x0105, 0x0107, 0x0107, 0x0108, 0x010a, 0x010a, 0x010b,
+  0x010c, 0x010c, 0x010e, 0x010f, 0x010f, 0x0110, 0x0111, 0x0112, 0x0112, 0x0113, 0x0114, 0x0115, 0x0115, 0x0116, 0x0117, 0x0118,
+  0x0118, 0x0119, 0x011a, 0x011b, 0x011b, 0x011c, 0x011d, 0x011d, 0x011e, 0x011e, 0x011f, 0x011f, 0x0120, 0x0121, 0x0122, 0x0122,
+  0x0122, 0x0123, 0x0123, 0x0124, 0x0125, 0x0125, 0x0126, 0x0126, 0x0126, 0x0127, 0x0127, 0x0128, 0x0128, 0x0129, 0x0129, 0x012a,
+  0x012a, 0x012a, 0x012a, 0x012a, 0x012b, 0x012b, 0x012b, 0x012c, 0x012c, 0x012c, 0x012d, 0x012d, 0x012d, 0x012e, 0x012e, 0x012e,
+  0x012e, 0x012e, 0x012e, 0x012e, 0x012e, 0x012e, 0x012e, 0x012e, 0x012f, 0x012f, 0x012f, 0x012f, 0x012f, 0x012f, 0x012f, 0x012f,
+  0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000b, 0x000d, 0x000f, 0x0011, 0x0013, 0x0014, 0x0016, 0x0018, 0x001a, 0x001c,
+  0x001e, 0x001f, 0x0021, 0x0023, 0x0025, 0x0027, 0x0028, 0x002a, 0x002c, 0x002e, 0x0030, 0x0031, 0x0033, 0x0035, 0x0037, 0x0039,
+  0x003a, 0x003c, 0x003e, 0x0040, 0x0041, 0x0043, 0x0045, 0x0047, 0x0049, 0x004a, 0x004c, 0x004e, 0x0050, 0x0051, 0x0053, 0x0055,
+  0x0057, 0x0058, 0x005a, 0x005c, 0x005e, 0x005f, 0x0061, 0x0063, 0x0064, 0x0066, 0x0068, 0x006a, 0x006b, 0x006d, 0x006f, 0x0070,
+  0x0072, 0x0074, 0x0076, 0x0077, 0x0079, 0x007a, 0x007c, 0x007e, 0x0080, 0x0081, 0x0083, 0x0085, 0x0086, 0x0087, 0x0089, 0x008b,
+  0x008c, 0x008e, 0x0090, 0x0091, 0x0093, 0x0095, 0x0096, 0x0097, 0x0099, 0x009b, 0x009c, 0x009e, 0x009f, 0x00a1, 0x00a2, 0x00a4,
+  0x00a6, 0x00a7, 0x00a8, 0x00aa, 0x00ac, 0x00ad, 0x00ae, 0x00b0, 0x00b1, 0x00b3, 0x00b4, 0x00b6, 0x00b7, 0x00b9, 0x00ba, 0x00bc,
+  0x00bd, 0x00be, 0x00c0, 0x00c1, 0x00c2, 0x00c4, 0x00c5, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cc, 0x00cd, 0x00ce, 0x00d0, 0x00d1,
+  0x00d2, 0x00d3, 0x00d5, 0x00d6, 0x00d7, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00df, 0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e5,
+  0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6,
+  0x00f7, 0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x0101, 0x0102, 0x0102, 0x0104, 0x0105, 0x0105,
+  0x0106, 0x0107, 0x0108, 0x0109, 0x010a, 0x010a, 0x010b, 0x010c, 0x010c, 0x010d, 0x010e, 0x010f, 0x010f, 0x0110, 0x0111, 0x0112,
+  0x0112, 0x0113, 0x0114, 0x0115, 0x0115, 0x0116, 0x0117, 0x0117, 0x0118, 0x0118, 0x0119, 0x0119, 0x011a, 0x011b, 0x011b, 0x011b,
+  0x011c, 0x011d, 0x011d, 0x011e, 0x011e, 0x011e, 0x011f, 0x011f, 0x0120, 0x0121, 0x0121, 0x0122, 0x0122, 0x0122, 0x0122, 0x0123,
+  0x0123, 0x0123, 0x0124, 0x0124, 0x0125, 0x0125, 0x0125, 0x0126, 0x0126, 0x0126, 0x0126, 0x0126, 0x0126, 0x0127, 0x0127, 0x0127,
+  0x0127, 0x0128, 0x0128, 0x0128, 0x0128, 0x0128, 0x0128, 0x0128, 0x0129, 0x0129, 0x0129, 0x0129, 0x0129, 0x0129, 0x0129, 0x0129,
+  0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x0009, 0x000b, 0x000d, 0x000f, 0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x0019, 0x001b,
+  0x001d, 0x001f, 0x0020, 0x0022, 0x0024, 0x0026, 0x0028, 0x0029, 0x002b, 0x002d, 0x002f, 0x0030, 0x0032, 0x0034, 0x0036, 0x0037,
+  0x0039, 0x003b, 0x003d, 0x003e, 0x0040, 0x0042, 0x0044, 0x0045, 0x0047, 0x0049, 0x004a, 0x004c, 0x004e, 0x0050, 0x0051, 0x0053,
+  0x0055, 0x0056, 0x0058, 0x005a, 0x005c, 0x005d, 0x005f, 0x0061, 0x0062, 0x0064, 0x0066, 0x0067, 0x0069, 0x006b, 0x006c, 0x006e,
+  0x0070, 0x0071, 0x0073, 0x0075, 0x0076, 0x0078, 0x0079, 0x007b, 0x007d, 0x007e, 0x0080, 0x0082, 0x0083, 0x0085, 0x0086, 0x0088,
+  0x0089, 0x008b, 0x008d, 0x008e, 0x0090, 0x0091, 0x0093, 0x0094, 0x0096, 0x0097, 0x0099, 0x009a, 0x009c, 0x009d, 0x009f, 0x00a0,
+  0x00a2, 0x00a3, 0x00a5, 0x00a6, 0x00a8, 0x00a9, 0x00ab, 0x00ac, 0x00ad, 0x00af, 0x00b0, 0x00b2, 0x00b3, 0x00b5, 0x00b6, 0x00b8,
+  0x00b9, 0x00ba, 0x00bc, 0x00bd, 0x00be, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c5, 0x00c6, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cd,
+  0x00ce, 0x00cf, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00df, 0x00e0,
+  0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e7, 0x00e8, 0x00e8, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1,
+  0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f5, 0x00f7, 0x00f7, 0x00f9, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x0100,
+  0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0105, 0x0106, 0x0107, 0x0107, 0x0108, 0x0109, 0x010a, 0x010a, 0x010b, 0x010c,
+  0x010c, 0x010d, 0x010e, 0x010f, 0x010f, 0x0110, 0x0111, 0x0111, 0x0112, 0x0112, 0x0113, 0x0113, 0x0114, 0x0115, 0x0115, 0x0115,
+  0x0116, 0x0117, 0x0117, 0x0118, 0x0118, 0x0118, 0x0119, 0x0119, 0x011a, 0x011b, 0x011b, 0x011b, 0x011b, 0x011c, 0x011c, 0x011d,
+  0x011d, 0x011d, 0x011e, 0x011e, 0x011e, 0x011e, 0x011e, 0x011f, 0x011f, 0x011f, 0x0120, 0x0120, 0x0120, 0x0121, 0x0121, 0x0121,
+  0x0121, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122, 0x0122,
+  0x0000, 0x0002, 0x0004, 0x0006, 0x0007, 0x0009, 0x000b, 0x000d, 0x000e, 0x0010, 0x0012, 0x0014, 0x0015, 0x0017, 0x0019, 0x001b,
+  0x001c, 0x001e, 0x0020, 0x0021, 0x0023, 0x0025, 0x0027, 0x0028, 0x002a, 0x002c, 0x002e, 0x002f, 0x0031, 0x0033, 0x0034, 0x0036,
+  0x0038, 0x003a, 0x003b, 0x003d, 0x003f, 0x0040, 0x0042, 0x0044, 0x0046, 0x0047, 0x0049, 0x004b, 0x004c, 0x004e, 0x0050, 0x0051,
+  0x0053, 0x0055, 0x0056, 0x0058, 0x005a, 0x005b, 0x005d, 0x005f, 0x0060, 0x0062, 0x0064, 0x0065, 0x0067, 0x0068, 0x006a, 0x006b,
+  0x006d, 0x006f, 0x0071, 0x0072, 0x0074, 0x0075, 0x0077, 0x0078, 0x007a, 0x007b, 0x007d, 0x007f, 0x0080, 0x0082, 0x0083, 0x0085,
+  0x0086, 0x0088, 0x008a, 0x008b, 0x008d, 0x008e, 0x0090, 0x0091, 0x0093, 0x0094, 0x0096, 0x0097, 0x0099, 0x009a, 0x009c, 0x009d,
+  0x009f, 0x00a0, 0x00a1, 0x00a3, 0x00a4, 0x00a6, 0x00a7, 0x00a8, 0x00aa, 0x00ab, 0x00ac, 0x00ae, 0x00af, 0x00b1, 0x00b2, 0x00b4,
+  0x00b5, 0x00b6, 0x00b8, 0x00b9, 0x00ba, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c6, 0x00c7, 0x00c8,
+  0x00c9, 0x00ca, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7, 0x00d9, 0x00da, 0x00db,
+  0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e2, 0x00e3, 0x00e3, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e8, 0x00ea, 0x00eb, 0x00ec,
+  0x00ed, 0x00ee, 0x00ef, 0x00ef, 0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7, 0x00f7, 0x00f9, 0x00f9, 0x00fa,
+  0x00fb, 0x00fb, 0x00fd, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x0100, 0x0101, 0x0102, 0x0102, 0x0103, 0x0104, 0x0105, 0x0105, 0x0106,
+  0x0107, 0x0107, 0x0108, 0x0109, 0x010a, 0x010a, 0x010b, 0x010b, 0x010c, 0x010c, 0x010d, 0x010d, 0x010e, 0x010f, 0x010f, 0x010f,
+  0x0110, 0x0111, 0x0111, 0x0112, 0x0112, 0x0112, 0x0113, 0x0113, 0x0114, 0x0115, 0x0115, 0x0115, 0x0115, 0x0116, 0x0116, 0x0117,
+  0x0117, 0x0117, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0119, 0x0119, 0x0119, 0x011a, 0x011a, 0x011a, 0x011b, 0x011b, 0x011b,
+  0x011b, 0x011b, 0x011b, 0x011b, 0x011b, 0x011b, 0x011b, 0x011b, 0x011c, 0x011c, 0x011c, 0x011c, 0x011c, 0x011c, 0x011c, 0x011c,
+  0x0000, 0x0002, 0x0004, 0x0005, 0x0007, 0x0009, 0x000b, 0x000c, 0x000e, 0x0010, 0x0011, 0x0013, 0x0015, 0x0017, 0x0018, 0x001a,
+  0x001c, 0x001d, 0x001f, 0x0021, 0x0022, 0x0024, 0x0026, 0x0027, 0x0029, 0x002b, 0x002d, 0x002e, 0x0030, 0x0032, 0x0033, 0x0035,
+  0x0037, 0x0038, 0x003a, 0x003c, 0x003d, 0x003f, 0x0041, 0x0042, 0x0044, 0x0046, 0x0047, 0x0049, 0x004b, 0x004c, 0x004e, 0x004f,
+  0x0051, 0x0053, 0x0054, 0x0056, 0x0058, 0x0059, 0x005b, 0x005d, 0x005e, 0x0060, 0x0061, 0x0063, 0x0064, 0x0066, 0x0068, 0x0069,
+  0x006b, 0x006c, 0x006e, 0x0070, 0x0071, 0x0073, 0x0074, 0x0076, 0x0077, 0x0079, 0x007a, 0x007c, 0x007d, 0x007f, 0x0081, 0x0082,
+  0x0083, 0x0085, 0x0087, 0x0088, 0x008a, 0x008b, 0x008d, 0x008e, 0x008f, 0x0091, 0x0093, 0x0094, 0x0095, 0x0097, 0x0098, 0x0099,
+  0x009b, 0x009c, 0x009e, 0x009f, 0x00a1, 0x00a2, 0x00a3, 0x00a5, 0x00a6, 0x00a7, 0x00a9, 0x00aa, 0x00ac, 0x00ad, 0x00ae, 0x00b0,
+  0x00b1, 0x00b2, 0x00b4, 0x00b5, 0x00b6, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c3, 0x00c4,
+  0x00c5, 0x00c6, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6,
+  0x00d7, 0x00d9, 0x00d9, 0x00da, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e3, 0x00e5, 0x00e6, 0x00e7,
+  0x00e8, 0x00e8, 0x00ea, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00ef, 0x00f1, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5,
+  0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x00f9, 0x00f9, 0x00fa, 0x00fb, 0x00fb, 0x00fc, 0x00fd, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x0100,
+  0x0101, 0x0102, 0x0102, 0x0103, 0x0104, 0x0105, 0x0105, 0x0105, 0x0106, 0x0107, 0x0107, 0x0107, 0x0108, 0x0109, 0x010a, 0x010a,
+  0x010a, 0x010b, 0x010b, 0x010c, 0x010c, 0x010c, 0x010d, 0x010d, 0x010e, 0x010f, 0x010f, 0x010f, 0x010f, 0x0110, 0x0110, 0x0111,
+  0x0111, 0x0111, 0x0112, 0x0112, 0x0112, 0x0112, 0x0112, 0x0113, 0x0113, 0x0113, 0x0114, 0x0114, 0x0114, 0x0115, 0x0115, 0x0115,
+  0x0115, 0x0115, 0x0115, 0x0115, 0x0115, 0x0115, 0x0115, 0x0115, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116, 0x0116,
+  0x0000, 0x0002, 0x0004, 0x0005, 0x0007, 0x0009, 0x000a, 0x000c, 0x000e, 0x000f, 0x0011, 0x0013, 0x0014, 0x0016, 0x0018, 0x0019,
+  0x001b, 0x001d, 0x001e, 0x0020, 0x0022, 0x0023, 0x0025, 0x0027, 0x0028, 0x002a, 0x002c, 0x002d, 0x002f, 0x0031, 0x0032, 0x0034,
+  0x0035, 0x0037, 0x0039, 0x003a, 0x003c, 0x003e, 0x003f, 0x0041, 0x0043, 0x0044, 0x0046, 0x0047, 0x0049, 0x004b, 0x004c, 0x004e,
+  0x004f, 0x0051, 0x0053, 0x0054, 0x0056, 0x0057, 0x0059, 0x005b, 0x005c, 0x005e, 0x005f, 0x0061, 0x0062, 0x0064, 0x0065, 0x0067,
+  0x0069, 0x006a, 0x006c, 0x006d, 0x006f, 0x0070, 0x0072, 0x0073, 0x0075, 0x0076, 0x0078, 0x0079, 0x007b, 0x007c, 0x007e, 0x007f,
+  0x0081, 0x0082, 0x0084, 0x0085, 0x0087, 0x0088, 0x008a, 0x008b, 0x008c, 0x008e, 0x008f, 0x0091, 0x0092, 0x0093, 0x0095, 0x0096,
+  0x0098, 0x0099, 0x009a, 0x009c, 0x009d, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a4, 0x00a5, 0x00a6, 0x00a8, 0x00a9, 0x00ab, 0x00ac,
+  0x00ad, 0x00ae, 0x00b0, 0x00b1, 0x00b2, 0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00bf, 0x00c0,
+  0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d1, 0x00d2,
+  0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0x00e2,
+  0x00e3, 0x00e3, 0x00e5, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00ea, 0x00ec, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00ef,
+  0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f3, 0x00f4, 0x00f5, 0x00f5, 0x00f6, 0x00f7, 0x00f7, 0x00f8, 0x00f9, 0x00f9, 0x00fa, 0x00fb,
+  0x00fb, 0x00fc, 0x00fd, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x0100, 0x0100, 0x0101, 0x0102, 0x0102, 0x0102, 0x0103, 0x0104, 0x0104,
+  0x0105, 0x0105, 0x0105, 0x0106, 0x0107, 0x0107, 0x0107, 0x0107, 0x0108, 0x0109, 0x0109, 0x010a, 0x010a, 0x010a, 0x010a, 0x010b,
+  0x010b, 0x010b, 0x010c, 0x010c, 0x010c, 0x010c, 0x010c, 0x010d, 0x010d, 0x010d, 0x010e, 0x010e, 0x010e, 0x010f, 0x010f, 0x010f,
+  0x010f, 0x010f, 0x010f, 0x010f, 0x010f, 0x010f, 0x010f, 0x010f, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+  0x0000, 0x0002, 0x0004, 0x0005, 0x0007, 0x0008, 0x000a, 0x000c, 0x000d, 0x000f, 0x0011, 0x0012, 0x0014, 0x0016, 0x0017, 0x0019,
+  0x001a, 0x001c, 0x001e, 0x001f, 0x0021, 0x0023, 0x0024, 0x0026, 0x0027, 0x0029, 0x002b, 0x002c, 0x002e, 0x0030, 0x0031, 0x0033,
+  0x0034, 0x0036, 0x0038, 0x0039, 0x003b, 0x003c, 0x003e, 0x0040, 0x0041, 0x0043, 0x0044, 0x0046, 0x0047, 0x0049, 0x004b, 0x004c,
+  0x004e, 0x004f, 0x0051, 0x0052, 0x0054, 0x0056, 0x0057, 0x0059, 0x005a, 0x005c, 0x005d, 0x005f, 0x0060, 0x0062, 0x0063, 0x0065,
+  0x0066, 0x0068, 0x0069, 0x006b, 0x006c, 0x006e, 0x006f, 0x0071, 0x0072, 0x0074, 0x0075, 0x0077, 0x0078, 0x0079, 0x007b, 0x007c,
+  0x007e, 0x0080, 0x0081, 0x0082, 0x0084, 0x0085, 0x0087, 0x0088, 0x0089, 0x008b, 0x008c, 0x008d, 0x008f, 0x0090, 0x0092, 0x0093,
+  0x0095, 0x0096, 0x0097, 0x0099, 0x009a, 0x009b, 0x009c, 0x009e, 0x009f, 0x00a0, 0x00a2, 0x00a3, 0x00a4, 0x00a6, 0x00a7, 0x00a8,
+  0x00a9, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00bb, 0x00bc,
+  0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd,
+  0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d5, 0x00d5, 0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd,
+  0x00de, 0x00df, 0x00e0, 0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e5, 0x00e7, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00ea,
+  0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ee, 0x00ef, 0x00ef, 0x00f0, 0x00f1, 0x00f1, 0x00f2, 0x00f3, 0x00f3, 0x00f4, 0x00f5, 0x00f5,
+  0x00f6, 0x00f7, 0x00f7, 0x00f8, 0x00f9, 0x00f9, 0x00fa, 0x00fa, 0x00fb, 0x00fb, 0x00fc, 0x00fc, 0x00fd, 0x00fd, 0x00fe, 0x00fe,
+  0x00ff, 0x0100, 0x0100, 0x0100, 0x0101, 0x0101, 0x0102, 0x0102, 0x0102, 0x0103, 0x0103, 0x0104, 0x0104, 0x0105, 0x0105, 0x0105,
+  0x0105, 0x0105, 0x0106, 0x0106, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0108, 0x0108, 0x0108, 0x0109, 0x0109, 0x0109,
+  0x0109, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a, 0x010a,
+  0x0000, 0x0002, 0x0004, 0x0005, 0x0007, 0x0008, 0x000a, 0x000c, 0x000d, 0x000f, 0x0010, 0x0012, 0x0013, 0x0015, 0x0017, 0x0018,
+  0x001a, 0x001b, 0x001d, 0x001f, 0x0020, 0x0022, 0x0023, 0x0025, 0x0027, 0x0028, 0x002a, 0x002b, 0x002d, 0x002f, 0x0030, 0x0032,
+  0x0033, 0x0035, 0x0036, 0x0038, 0x0039, 0x003b, 0x003d, 0x003e, 0x0040, 0x0041, 0x0043, 0x0044, 0x0046, 0x0047, 0x0049, 0x004a,
+  0x004c, 0x004e, 0x004f, 0x0051, 0x0052, 0x0054, 0x0055, 0x0057, 0x0058, 0x005a, 0x005b, 0x005d, 0x005e, 0x0060, 0x0061, 0x0063,
+  0x0064, 0x0065, 0x0067, 0x0069, 0x006a, 0x006b, 0x006d, 0x006e, 0x0070, 0x0071, 0x0073, 0x0074, 0x0076, 0x0077, 0x0078, 0x007a,
+  0x007b, 0x007d, 0x007e, 0x0080, 0x0081, 0x0082, 0x0084, 0x0085, 0x0086, 0x0088, 0x0089, 0x008a, 0x008c, 0x008d, 0x008f, 0x0090,
+  0x0091, 0x0093, 0x0094, 0x0095, 0x0097, 0x0098, 0x0099, 0x009a, 0x009c, 0x009d, 0x009e, 0x009f, 0x00a1, 0x00a2, 0x00a3, 0x00a5,
+  0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b7, 0x00b8,
+  0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c6, 0x00c7, 0x00c8, 0x00c9,
+  0x00ca, 0x00cb, 0x00cb, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d3, 0x00d5, 0x00d5, 0x00d6, 0x00d7, 0x00d8,
+  0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e0, 0x00e2, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e5,
+  0x00e6, 0x00e7, 0x00e8, 0x00e8, 0x00e9, 0x00ea, 0x00ea, 0x00eb, 0x00ec, 0x00ec, 0x00ed, 0x00ee, 0x00ee, 0x00ef, 0x00ef, 0x00f0,
+  0x00f1, 0x00f1, 0x00f2, 0x00f3, 0x00f3, 0x00f4, 0x00f5, 0x00f5, 0x00f5, 0x00f6, 0x00f7, 0x00f7, 0x00f7, 0x00f8, 0x00f9, 0x00f9,
+  0x00f9, 0x00fa, 0x00fa, 0x00fb, 0x00fb, 0x00fb, 0x00fc, 0x00fc, 0x00fd, 0x00fd, 0x00fd, 0x00fe, 0x00fe, 0x00ff, 0x00ff, 0x0100,
+  0x0100, 0x0100, 0x0100, 0x0100, 0x0101, 0x0101, 0x0101, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0103, 0x0103, 0x0103,
+  0x0103, 0x0104, 0x0104, 0x0104, 0x0104, 0x0104, 0x0104, 0x0104, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+  0x0000, 0x0002, 0x0003, 0x0005, 0x0007, 0x0008, 0x000a, 0x000b, 0x000d, 0x000e, 0x0010, 0x0012, 0x0013, 0x0015, 0x0016, 0x0018,
+  0x0019, 0x001b, 0x001c, 0x001e, 0x0020, 0x0021, 0x0023, 0x0024, 0x0026, 0x0027, 0x0029, 0x002a, 0x002c, 0x002e, 0x002f, 0x0031,
+  0x0032, 0x0034, 0x0035, 0x0037, 0x0038, 0x003a, 0x003b, 0x003d, 0x003e, 0x0040, 0x0041, 0x0043, 0x0044, 0x0046, 0x0047, 0x0049,
+  0x004a, 0x004c, 0x004d, 0x004f, 0x0050, 0x0052, 0x0053, 0x0055, 0x0056, 0x0058, 0x0059, 0x005b, 0x005c, 0x005e, 0x005f, 0x0060,
+  0x0062, 0x0063, 0x0065, 0x0066, 0x0068, 0x0069, 0x006b, 0x006c, 0x006e, 0x006f, 0x0070, 0x0072, 0x0073, 0x0074, 0x0076, 0x0077,
+  0x0078, 0x007a, 0x007b, 0x007d, 0x007e, 0x0080, 0x0081, 0x0082, 0x0083, 0x0085, 0x0086, 0x0087, 0x0089, 0x008a, 0x008c, 0x008d,
+  0x008e, 0x008f, 0x0091, 0x0092, 0x0093, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009b, 0x009c, 0x009d, 0x009f, 0x00a0, 0x00a1,
+  0x00a2, 0x00a3, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b3, 0x00b4,
+  0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4,
+  0x00c6, 0x00c7, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d3,
+  0x00d5, 0x00d5, 0x00d6, 0x00d7, 0x00d7, 0x00d9, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e0,
+  0x00e1, 0x00e2, 0x00e3, 0x00e3, 0x00e4, 0x00e5, 0x00e5, 0x00e6, 0x00e7, 0x00e7, 0x00e8, 0x00e8, 0x00e9, 0x00ea, 0x00ea, 0x00eb,
+  0x00ec, 0x00ec, 0x00ed, 0x00ee, 0x00ee, 0x00ef, 0x00ef, 0x00ef, 0x00f0, 0x00f1, 0x00f1, 0x00f1, 0x00f2, 0x00f3, 0x00f3, 0x00f3,
+  0x00f4, 0x00f5, 0x00f5, 0x00f5, 0x00f6, 0x00f6, 0x00f7, 0x00f7, 0x00f7, 0x00f8, 0x00f8, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00fa,
+  0x00fa, 0x00fa, 0x00fb, 0x00fb, 0x00fb, 0x00fb, 0x00fb, 0x00fc, 0x00fc, 0x00fc, 0x00fd, 0x00fd, 0x00fd, 0x00fd, 0x00fd, 0x00fd,
+  0x00fd, 0x00fe, 0x00fe, 0x00fe, 0x00fe, 0x00fe, 0x00fe, 0x00fe, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff, 0x00ff,
+  0x0000, 0x0002, 0x0003, 0x0005, 0x0006, 0x0008, 0x0009, 0x000b, 0x000d, 0x000e, 0x0010, 0x0011, 0x0013, 0x0014, 0x0016, 0x0017,
+  0x0019, 0x001a, 0x001c, 0x001d, 0x001f, 0x0020, 0x0022, 0x0023, 0x0025, 0x0026, 0x0028, 0x0029, 0x002b, 0x002d, 0x002e, 0x0030,
+  0x0031, 0x0032, 0x0034, 0x0035, 0x0037, 0x0038, 0x003a, 0x003b, 0x003d, 0x003e, 0x0040, 0x0041, 0x0043, 0x0044, 0x0046, 0x0047,
+  0x0049, 0x004a, 0x004c, 0x004d, 0x004f, 0x0050, 0x0052, 0x0053, 0x0054, 0x0056, 0x0057, 0x0059, 0x005a, 0x005c, 0x005d, 0x005e,
+  0x0060, 0x0061, 0x0063, 0x0064, 0x0065, 0x0067, 0x0068, 0x006a, 0x006b, 0x006c, 0x006e, 0x006f, 0x0071, 0x0072, 0x0073, 0x0075,
+  0x0076, 0x0077, 0x0079, 0x007a, 0x007b, 0x007d, 0x007e, 0x007f, 0x0081, 0x0082, 0x0083, 0x0085, 0x0086, 0x0087, 0x0089, 0x008a,
+  0x008b, 0x008c, 0x008d, 0x008f, 0x0090, 0x0091, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0099, 0x009a, 0x009b, 0x009c, 0x009e,
+  0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ac, 0x00ac, 0x00ad, 0x00af, 0x00b0,
+  0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0,
+  0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+  0x00d0, 0x00d1, 0x00d2, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00d9, 0x00da, 0x00db, 0x00dc,
+  0x00dc, 0x00dd, 0x00de, 0x00df, 0x00df, 0x00e0, 0x00e0, 0x00e1, 0x00e2, 0x00e2, 0x00e3, 0x00e3, 0x00e4, 0x00e5, 0x00e5, 0x00e6,
+  0x00e7, 0x00e7, 0x00e8, 0x00e8, 0x00e9, 0x00ea, 0x00ea, 0x00ea, 0x00eb, 0x00ec, 0x00ec, 0x00ec, 0x00ed, 0x00ee, 0x00ee, 0x00ee,
+  0x00ef, 0x00ef, 0x00ef, 0x00f0, 0x00f1, 0x00f1, 0x00f1, 0x00f1, 0x00f2, 0x00f3, 0x00f3, 0x00f3, 0x00f3, 0x00f4, 0x00f4, 0x00f5,
+  0x00f5, 0x00f5, 0x00f5, 0x00f5, 0x00f6, 0x00f6, 0x00f6, 0x00f7, 0x00f7, 0x00f7, 0x00f7, 0x00f7, 0x00f7, 0x00f8, 0x00f8, 0x00f8,
+  0x00f8, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9, 0x00f9,
+  0x0000, 0x0002, 0x0003, 0x0005, 0x0006, 0x0008, 0x0009, 0x000b, 0x000c, 0x000e, 0x000f, 0x0011, 0x0012, 0x0014, 0x0015, 0x0017,
+  0x0018, 0x001a, 0x001b, 0x001d, 0x001e, 0x0020, 0x0021, 0x0023, 0x0024, 0x0026, 0x0027, 0x0029, 0x002a, 0x002c, 0x002d, 0x002f,
+  0x0030, 0x0031, 0x0033, 0x0034, 0x0036, 0x0037, 0x0039, 0x003a, 0x003c, 0x003d, 0x003e, 0x0040, 0x0041, 0x0043, 0x0044, 0x0046,
+  0x0047, 0x0049, 0x004a, 0x004b, 0x004d, 0x004e, 0x0050, 0x0051, 0x0053, 0x0054, 0x0056, 0x0057, 0x0058, 0x005a, 0x005b, 0x005c,
+  0x005e, 0x005f, 0x0061, 0x0062, 0x0063, 0x0065, 0x0066, 0x0067, 0x0069, 0x006a, 0x006b, 0x006d, 0x006e, 0x006f, 0x0071, 0x0072,
+  0x0073, 0x0075, 0x0076, 0x0077, 0x0079, 0x007a, 0x007b, 0x007c, 0x007e, 0x007f, 0x0081, 0x0082, 0x0083, 0x0084, 0x0086, 0x0087,
+  0x0088, 0x0089, 0x008a, 0x008c, 0x008d, 0x008e, 0x008f, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0097, 0x0098, 0x0099, 0x009a,
+  0x009b, 0x009c, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a6, 0x00a6, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac,
+  0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc,
+  0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c3, 0x00c4, 0x00c6, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00ca,
+  0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d6, 0x00d7,
+  0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00da, 0x00db, 0x00dc, 0x00dc, 0x00dd, 0x00dd, 0x00de, 0x00df, 0x00df, 0x00e0, 0x00e0, 0x00e1,
+  0x00e2, 0x00e2, 0x00e3, 0x00e3, 0x00e4, 0x00e5, 0x00e5, 0x00e5, 0x00e6, 0x00e7, 0x00e7, 0x00e7, 0x00e8, 0x00e8, 0x00e9, 0x00e9,
+  0x00ea, 0x00ea, 0x00ea, 0x00eb, 0x00ec, 0x00ec, 0x00ec, 0x00ec, 0x00ed, 0x00ee, 0x00ee, 0x00ee, 0x00ee, 0x00ef, 0x00ef, 0x00ef,
+  0x00ef, 0x00ef, 0x00f0, 0x00f0, 0x00f1, 0x00f1, 0x00f1, 0x00f1, 0x00f1, 0x00f1, 0x00f2, 0x00f2, 0x00f2, 0x00f3, 0x00f3, 0x00f3,
+  0x00f3, 0x00f3, 0x00f3, 0x00f3, 0x00f3, 0x00f3, 0x00f3, 0x00f3, 0x00f4, 0x00f4, 0x00f4, 0x00f4, 0x00f4, 0x00f4, 0x00f4, 0x00f4,
+  0x0000, 0x0002, 0x0003, 0x0005, 0x0006, 0x0008, 0x0009, 0x000b, 0x000c, 0x000d, 0x000f, 0x0010, 0x0012, 0x0013, 0x0015, 0x0016,
+  0x0018, 0x0019, 0x001b, 0x001c, 0x001d, 0x001f, 0x0020, 0x0022, 0x0023, 0x0025, 0x0026, 0x0028, 0x0029, 0x002b, 0x002c, 0x002e,
+  0x002f, 0x0030, 0x0032, 0x0033, 0x0035, 0x0036, 0x0038, 0x0039, 0x003a, 0x003c, 0x003d, 0x003f, 0x0040, 0x0041, 0x0043, 0x0044,
+  0x0046, 0x0047, 0x0048, 0x004a, 0x004b, 0x004d, 0x004e, 0x004f, 0x0051, 0x0052, 0x0054, 0x0055, 0x0056, 0x0058, 0x0059, 0x005a,
+  0x005c, 0x005d, 0x005f, 0x0060, 0x0061, 0x0063, 0x0064, 0x0065, 0x0067, 0x0068, 0x0069, 0x006b, 0x006c, 0x006d, 0x006e, 0x0070,
+  0x0071, 0x0072, 0x0074, 0x0075, 0x0076, 0x0077, 0x0079, 0x007a, 0x007b, 0x007c, 0x007e, 0x007f, 0x0080, 0x0081, 0x0083, 0x0084,
+  0x0085, 0x0086, 0x0087, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008f, 0x0090, 0x0091, 0x0092, 0x0093, 0x0095, 0x0096, 0x0097,
+  0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8,
+  0x00a9, 0x00aa, 0x00ac, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b8,
+  0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c3, 0x00c4, 0x00c6, 0x00c6,
+  0x00c7, 0x00c8, 0x00c9, 0x00c9, 0x00ca, 0x00cb, 0x00cb, 0x00cd, 0x00cd, 0x00ce, 0x00cf, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d2,
+  0x00d3, 0x00d3, 0x00d5, 0x00d5, 0x00d6, 0x00d6, 0x00d7, 0x00d7, 0x00d8, 0x00d9, 0x00d9, 0x00da, 0x00da, 0x00db, 0x00dc, 0x00dc,
+  0x00dd, 0x00dd, 0x00de, 0x00df, 0x00df, 0x00e0, 0x00e0, 0x00e0, 0x00e1, 0x00e2, 0x00e2, 0x00e2, 0x00e3, 0x00e3, 0x00e4, 0x00e4,
+  0x00e5, 0x00e5, 0x00e5, 0x00e6, 0x00e7, 0x00e7, 0x00e7, 0x00e7, 0x00e8, 0x00e8, 0x00e8, 0x00e9, 0x00e9, 0x00ea, 0x00ea, 0x00ea,
+  0x00ea, 0x00ea, 0x00eb, 0x00eb, 0x00ec, 0x00ec, 0x00ec, 0x00ec, 0x00ec, 0x00ec, 0x00ed, 0x00ed, 0x00ed, 0x00ee, 0x00ee, 0x00ee,
+  0x00ee, 0x00ee, 0x00ee, 0x00ee, 0x00ee, 0x00ee, 0x00ee, 0x00ee, 0x00ef, 0x00ef, 0x00ef, 0x00ef, 0x00ef, 0x00ef, 0x00ef, 0x00ef,
+  0x0000, 0x0002, 0x0003, 0x0005, 0x0006, 0x0007, 0x0009, 0x000a, 0x000c, 0x000d, 0x000f, 0x0010, 0x0011, 0x0013, 0x0014, 0x0016,
+  0x0017, 0x0019, 0x001a, 0x001b, 0x001d, 0x001e, 0x0020, 0x0021, 0x0023, 0x0024, 0x0025, 0x0027, 0x0028, 0x002a, 0x002b, 0x002d,
+  0x002e, 0x002f, 0x0031, 0x0032, 0x0033, 0x0035, 0x0036, 0x0038, 0x0039, 0x003b, 0x003c, 0x003d, 0x003f, 0x0040, 0x0041, 0x0043,
+  0x0044, 0x0046, 0x0047, 0x0048, 0x004a, 0x004b, 0x004c, 0x004e, 0x004f, 0x0051, 0x0052, 0x0053, 0x0054, 0x0056, 0x0057, 0x0058,
+  0x005a, 0x005b, 0x005d, 0x005e, 0x005f, 0x0060, 0x0062, 0x0063, 0x0064, 0x0065, 0x0067, 0x0068, 0x0069, 0x006b, 0x006c, 0x006d,
+  0x006e, 0x0070, 0x0071, 0x0072, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x0080, 0x0081,
+  0x0082, 0x0083, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0x0093, 0x0094,
+  0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009f, 0x009f, 0x00a1, 0x00a2, 0x00a2, 0x00a4, 0x00a5,
+  0x00a6, 0x00a6, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4,
+  0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00bf, 0x00c0, 0x00c1, 0x00c2,
+  0x00c3, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c7, 0x00c8, 0x00c9, 0x00c9, 0x00ca, 0x00cb, 0x00cb, 0x00cd, 0x00cd, 0x00ce,
+  0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d1, 0x00d2, 0x00d2, 0x00d3, 0x00d3, 0x00d4, 0x00d5, 0x00d5, 0x00d6, 0x00d6, 0x00d7, 0x00d7,
+  0x00d8, 0x00d9, 0x00d9, 0x00da, 0x00da, 0x00db, 0x00dc, 0x00dc, 0x00dc, 0x00dd, 0x00dd, 0x00dd, 0x00de, 0x00df, 0x00df, 0x00df,
+  0x00e0, 0x00e0, 0x00e0, 0x00e1, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e3, 0x00e3, 0x00e3, 0x00e4, 0x00e4, 0x00e5, 0x00e5, 0x00e5,
+  0x00e5, 0x00e5, 0x00e6, 0x00e6, 0x00e7, 0x00e7, 0x00e7, 0x00e7, 0x00e7, 0x00e7, 0x00e8, 0x00e8, 0x00e8, 0x00e8, 0x00e8, 0x00e8,
+  0x00e8, 0x00e9, 0x00e9, 0x00e9, 0x00e9, 0x00e9, 0x00e9, 0x00e9, 0x00ea, 0x00ea, 0x00ea, 0x00ea, 0x00ea, 0x00ea, 0x00ea, 0x00ea,
+  0x0000, 0x0002, 0x0003, 0x0004, 0x0006, 0x0007, 0x0009, 0x000a, 0x000b, 0x000d, 0x000e, 0x0010, 0x0011, 0x0012, 0x0014, 0x0015,
+  0x0017, 0x0018, 0x0019, 0x001b, 0x001c, 0x001e, 0x001f, 0x0020, 0x0022, 0x0023, 0x0025, 0x0026, 0x0027, 0x0029, 0x002a, 0x002c,
+  0x002d, 0x002e, 0x0030, 0x0031, 0x0032, 0x0034, 0x0035, 0x0037, 0x0038, 0x0039, 0x003b, 0x003c, 0x003d, 0x003f, 0x0040, 0x0041,
+  0x0043, 0x0044, 0x0045, 0x0047, 0x0048, 0x0049, 0x004b, 0x004c, 0x004d, 0x004f, 0x0050, 0x0051, 0x0053, 0x0054, 0x0055, 0x0056,
+  0x0058, 0x0059, 0x005b, 0x005c, 0x005d, 0x005e, 0x0060, 0x0061, 0x0062, 0x0063, 0x0065, 0x0066, 0x0067, 0x0068, 0x006a, 0x006b,
+  0x006c, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007b, 0x007c, 0x007d, 0x007e,
+  0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0091,
+  0x0091, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1,
+  0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00b0,
+  0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bb, 0x00bc, 0x00bd, 0x00be,
+  0x00bf, 0x00bf, 0x00c0, 0x00c1, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c7, 0x00c8, 0x00c9, 0x00c9,
+  0x00ca, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00cd, 0x00ce, 0x00ce, 0x00cf, 0x00cf, 0x00d0, 0x00d1, 0x00d1, 0x00d2, 0x00d2, 0x00d3,
+  0x00d3, 0x00d4, 0x00d5, 0x00d5, 0x00d6, 0x00d6, 0x00d7, 0x00d7, 0x00d7, 0x00d8, 0x00d9, 0x00d9, 0x00d9, 0x00da, 0x00da, 0x00da,
+  0x00db, 0x00dc, 0x00dc, 0x00dc, 0x00dd, 0x00dd, 0x00dd, 0x00dd, 0x00de, 0x00df, 0x00df, 0x00df, 0x00df, 0x00e0, 0x00e0, 0x00e0,
+  0x00e0, 0x00e0, 0x00e1, 0x00e1, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e3, 0x00e3, 0x00e3, 0x00e3, 0x00e3, 0x00e3,
+  0x00e3, 0x00e4, 0x00e4, 0x00e4, 0x00e4, 0x00e4, 0x00e4, 0x00e4, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5,
+  0x0000, 0x0002, 0x0003, 0x0004, 0x0006, 0x0007, 0x0008, 0x000a, 0x000b, 0x000d, 0x000e, 0x000f, 0x0011, 0x0012, 0x0013, 0x0015,
+  0x0016, 0x0018, 0x0019, 0x001a, 0x001c, 0x001d, 0x001e, 0x0020, 0x0021, 0x0022, 0x0024, 0x0025, 0x0027, 0x0028, 0x0029, 0x002b,
+  0x002c, 0x002d, 0x002f, 0x0030, 0x0031, 0x0033, 0x0034, 0x0035, 0x0037, 0x0038, 0x0039, 0x003b, 0x003c, 0x003d, 0x003f, 0x0040,
+  0x0041, 0x0043, 0x0044, 0x0045, 0x0046, 0x0048, 0x0049, 0x004a, 0x004c, 0x004d, 0x004e, 0x0050, 0x0051, 0x0052, 0x0053, 0x0055,
+  0x0056, 0x0057, 0x0059, 0x005a, 0x005b, 0x005c, 0x005e, 0x005f, 0x0060, 0x0061, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0069,
+  0x006a, 0x006b, 0x006c, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b,
+  0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d,
+  0x008e, 0x008f, 0x0091, 0x0091, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e,
+  0x009f, 0x009f, 0x00a1, 0x00a2, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ac,
+  0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b7, 0x00b8, 0x00b9, 0x00ba,
+  0x00bb, 0x00bb, 0x00bc, 0x00bd, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c0, 0x00c1, 0x00c2, 0x00c2, 0x00c3, 0x00c4, 0x00c4, 0x00c5,
+  0x00c6, 0x00c6, 0x00c7, 0x00c8, 0x00c8, 0x00c9, 0x00c9, 0x00ca, 0x00ca, 0x00cb, 0x00cb, 0x00cc, 0x00cd, 0x00cd, 0x00ce, 0x00ce,
+  0x00cf, 0x00cf, 0x00d0, 0x00d1, 0x00d1, 0x00d2, 0x00d2, 0x00d2, 0x00d3, 0x00d3, 0x00d4, 0x00d4, 0x00d5, 0x00d5, 0x00d6, 0x00d6,
+  0x00d6, 0x00d7, 0x00d7, 0x00d7, 0x00d8, 0x00d8, 0x00d9, 0x00d9, 0x00d9, 0x00da, 0x00da, 0x00da, 0x00da, 0x00db, 0x00db, 0x00dc,
+  0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dd, 0x00dd, 0x00dd, 0x00dd, 0x00dd, 0x00dd, 0x00de, 0x00de, 0x00de, 0x00df, 0x00df, 0x00df,
+  0x00df, 0x00df, 0x00df, 0x00df, 0x00df, 0x00df, 0x00df, 0x00df, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0, 0x00e0,
+  0x0000, 0x0002, 0x0003, 0x0004, 0x0006, 0x0007, 0x0008, 0x000a, 0x000b, 0x000c, 0x000e, 0x000f, 0x0010, 0x0012, 0x0013, 0x0014,
+  0x0016, 0x0017, 0x0018, 0x001a, 0x001b, 0x001c, 0x001e, 0x001f, 0x0020, 0x0022, 0x0023, 0x0024, 0x0026, 0x0027, 0x0028, 0x002a,
+  0x002b, 0x002c, 0x002e, 0x002f, 0x0030, 0x0032, 0x0033, 0x0034, 0x0035, 0x0037, 0x0038, 0x0039, 0x003b, 0x003c, 0x003d, 0x003e,
+  0x0040, 0x0041, 0x0042, 0x0044, 0x0045, 0x0046, 0x0048, 0x0049, 0x004a, 0x004b, 0x004d, 0x004e, 0x004f, 0x0050, 0x0052, 0x0053,
+  0x0054, 0x0055, 0x0057, 0x0058, 0x0059, 0x005a, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066,
+  0x0067, 0x0069, 0x006a, 0x006b, 0x006c, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0076, 0x0077, 0x0078, 0x0079,
+  0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a,
+  0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0091, 0x0091, 0x0093, 0x0093, 0x0095, 0x0095, 0x0097, 0x0097, 0x0098, 0x0099, 0x009a,
+  0x009b, 0x009c, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9,
+  0x00aa, 0x00ab, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b3, 0x00b4, 0x00b5, 0x00b6,
+  0x00b7, 0x00b7, 0x00b8, 0x00b9, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bc, 0x00bd, 0x00be, 0x00be, 0x00bf, 0x00c0, 0x00c0, 0x00c1,
+  0x00c1, 0x00c2, 0x00c3, 0x00c3, 0x00c4, 0x00c4, 0x00c5, 0x00c6, 0x00c6, 0x00c7, 0x00c7, 0x00c8, 0x00c8, 0x00c9, 0x00c9, 0x00ca,
+  0x00ca, 0x00cb, 0x00cb, 0x00cc, 0x00cd, 0x00cd, 0x00ce, 0x00ce, 0x00ce, 0x00cf, 0x00cf, 0x00cf, 0x00d0, 0x00d1, 0x00d1, 0x00d1,
+  0x00d2, 0x00d2, 0x00d2, 0x00d3, 0x00d3, 0x00d3, 0x00d4, 0x00d4, 0x00d5, 0x00d5, 0x00d5, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d7,
+  0x00d7, 0x00d7, 0x00d7, 0x00d7, 0x00d8, 0x00d8, 0x00d8, 0x00d9, 0x00d9, 0x00d9, 0x00d9, 0x00d9, 0x00d9, 0x00da, 0x00da, 0x00da,
+  0x00da, 0x00da, 0x00da, 0x00da, 0x00da, 0x00da, 0x00da, 0x00da, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db,
+  0x0000, 0x0001, 0x0003, 0x0004, 0x0005, 0x0007, 0x0008, 0x0009, 0x000b, 0x000c, 0x000d, 0x000f, 0x0010, 0x0011, 0x0013, 0x0014,
+  0x0015, 0x0017, 0x0018, 0x0019, 0x001a, 0x001c, 0x001d, 0x001e, 0x0020, 0x0021, 0x0022, 0x0024, 0x0025, 0x0026, 0x0027, 0x0029,
+  0x002a, 0x002b, 0x002d, 0x002e, 0x002f, 0x0030, 0x0032, 0x0033, 0x0034, 0x0036, 0x0037, 0x0038, 0x0039, 0x003b, 0x003c, 0x003d,
+  0x003e, 0x0040, 0x0041, 0x0042, 0x0043, 0x0045, 0x0046, 0x0047, 0x0048, 0x004a, 0x004b, 0x004c, 0x004d, 0x004f, 0x0050, 0x0051,
+  0x0052, 0x0053, 0x0055, 0x0056, 0x0057, 0x0058, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064,
+  0x0065, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+  0x0077, 0x0078, 0x0079, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+  0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+  0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009c, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a2, 0x00a3, 0x00a4, 0x00a5,
+  0x00a6, 0x00a7, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00af, 0x00b0, 0x00b1, 0x00b2,
+  0x00b3, 0x00b3, 0x00b4, 0x00b5, 0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b8, 0x00b9, 0x00ba, 0x00ba, 0x00bb, 0x00bc, 0x00bc, 0x00bd,
+  0x00bd, 0x00be, 0x00bf, 0x00bf, 0x00c0, 0x00c0, 0x00c1, 0x00c1, 0x00c2, 0x00c2, 0x00c3, 0x00c3, 0x00c4, 0x00c4, 0x00c5, 0x00c6,
+  0x00c6, 0x00c7, 0x00c7, 0x00c8, 0x00c8, 0x00c9, 0x00c9, 0x00c9, 0x00ca, 0x00ca, 0x00cb, 0x00cb, 0x00cb, 0x00cc, 0x00cd, 0x00cd,
+  0x00cd, 0x00ce, 0x00ce, 0x00ce, 0x00cf, 0x00cf, 0x00cf, 0x00cf, 0x00d0, 0x00d1, 0x00d1, 0x00d1, 0x00d1, 0x00d2, 0x00d2, 0x00d2,
+  0x00d2, 0x00d2, 0x00d3, 0x00d3, 0x00d3, 0x00d3, 0x00d3, 0x00d4, 0x00d4, 0x00d4, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5, 0x00d5,
+  0x00d5, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6, 0x00d6,
+  0x0000, 0x0001, 0x0003, 0x0004, 0x0005, 0x0007, 0x0008, 0x0009, 0x000a, 0x000c, 0x000d, 0x000e, 0x0010, 0x0011, 0x0012, 0x0013,
+  0x0015, 0x0016, 0x0017, 0x0019, 0x001a, 0x001b, 0x001c, 0x001e, 0x001f, 0x0020, 0x0022, 0x0023, 0x0024, 0x0025, 0x0027, 0x0028,
+  0x0029, 0x002a, 0x002c, 0x002d, 0x002e, 0x002f, 0x0031, 0x0032, 0x0033, 0x0034, 0x0036, 0x0037, 0x0038, 0x0039, 0x003b, 0x003c,
+  0x003d, 0x003e, 0x0040, 0x0041, 0x0042, 0x0043, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+  0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062,
+  0x0063, 0x0064, 0x0065, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0071, 0x0071, 0x0073, 0x0074,
+  0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083, 0x0085,
+  0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094,
+  0x0095, 0x0095, 0x0097, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009c, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2,
+  0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00aa, 0x00ab, 0x00ac, 0x00ac, 0x00ad, 0x00ae,
+  0x00af, 0x00af, 0x00b0, 0x00b1, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b4, 0x00b5, 0x00b6, 0x00b6, 0x00b7, 0x00b8, 0x00b8, 0x00b9,
+  0x00b9, 0x00ba, 0x00bb, 0x00bb, 0x00bc, 0x00bc, 0x00bd, 0x00bd, 0x00be, 0x00be, 0x00bf, 0x00bf, 0x00c0, 0x00c0, 0x00c1, 0x00c1,
+  0x00c2, 0x00c2, 0x00c3, 0x00c3, 0x00c4, 0x00c4, 0x00c5, 0x00c5, 0x00c6, 0x00c6, 0x00c7, 0x00c7, 0x00c7, 0x00c8, 0x00c8, 0x00c8,
+  0x00c9, 0x00c9, 0x00c9, 0x00ca, 0x00ca, 0x00ca, 0x00cb, 0x00cb, 0x00cb, 0x00cc, 0x00cc, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00ce,
+  0x00ce, 0x00ce, 0x00ce, 0x00ce, 0x00cf, 0x00cf, 0x00cf, 0x00cf, 0x00cf, 0x00cf, 0x00d0, 0x00d0, 0x00d0, 0x00d1, 0x00d1, 0x00d1,
+  0x00d1, 0x00d1, 0x00d1, 0x00d1, 0x00d1, 0x00d1, 0x00d1, 0x00d1, 0x00d2, 0x00d2, 0x00d2, 0x00d2, 0x00d2, 0x00d2, 0x00d2, 0x00d2,
+  0x0000, 0x0001, 0x0003, 0x0004, 0x0005, 0x0006, 0x0008, 0x0009, 0x000a, 0x000b, 0x000d, 0x000e, 0x000f, 0x0011, 0x0012, 0x0013,
+  0x0014, 0x0016, 0x0017, 0x0018, 0x0019, 0x001b, 0x001c, 0x001d, 0x001e, 0x0020, 0x0021, 0x0022, 0x0023, 0x0025, 0x0026, 0x0027,
+  0x0028, 0x0029, 0x002b, 0x002c, 0x002d, 0x002e, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0036, 0x0037, 0x0038, 0x0039, 0x003b,
+  0x003c, 0x003d, 0x003e, 0x003f, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004e,
+  0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060,
+  0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071,
+  0x0072, 0x0073, 0x0074, 0x0076, 0x0077, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x0080, 0x0081, 0x0082,
+  0x0082, 0x0083, 0x0085, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091,
+  0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009c, 0x009d, 0x009e,
+  0x009f, 0x00a0, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a4, 0x00a5, 0x00a6, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00aa,
+  0x00ab, 0x00ac, 0x00ac, 0x00ad, 0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b0, 0x00b1, 0x00b2, 0x00b2, 0x00b3, 0x00b4, 0x00b4, 0x00b5,
+  0x00b5, 0x00b6, 0x00b7, 0x00b7, 0x00b8, 0x00b8, 0x00b9, 0x00b9, 0x00ba, 0x00ba, 0x00bb, 0x00bb, 0x00bc, 0x00bc, 0x00bd, 0x00bd,
+  0x00be, 0x00be, 0x00bf, 0x00bf, 0x00c0, 0x00c0, 0x00c1, 0x00c1, 0x00c1, 0x00c2, 0x00c2, 0x00c2, 0x00c3, 0x00c3, 0x00c4, 0x00c4,
+  0x00c4, 0x00c5, 0x00c5, 0x00c6, 0x00c6, 0x00c6, 0x00c7, 0x00c7, 0x00c7, 0x00c8, 0x00c8, 0x00c8, 0x00c8, 0x00c9, 0x00c9, 0x00c9,
+  0x00c9, 0x00c9, 0x00ca, 0x00ca, 0x00ca, 0x00ca, 0x00ca, 0x00cb, 0x00cb, 0x00cb, 0x00cb, 0x00cb, 0x00cb, 0x00cc, 0x00cc, 0x00cc,
+  0x00cc, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd, 0x00cd,
+  0x0000, 0x0001, 0x0003, 0x0004, 0x0005, 0x0006, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000e, 0x000f, 0x0010, 0x0011, 0x0013,
+  0x0014, 0x0015, 0x0016, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001e, 0x001f, 0x0020, 0x0021, 0x0023, 0x0024, 0x0025, 0x0026,
+  0x0027, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+  0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x004a, 0x004b, 0x004c,
+  0x004d, 0x004e, 0x004f, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e,
+  0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+  0x0080, 0x0081, 0x0082, 0x0082, 0x0083, 0x0085, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008d,
+  0x008e, 0x008f, 0x0090, 0x0091, 0x0092, 0x0093, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b,
+  0x009c, 0x009c, 0x009d, 0x009e, 0x009f, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a2, 0x00a3, 0x00a4, 0x00a4, 0x00a5, 0x00a6, 0x00a6,
+  0x00a7, 0x00a8, 0x00a9, 0x00a9, 0x00aa, 0x00ab, 0x00ab, 0x00ac, 0x00ac, 0x00ad, 0x00ae, 0x00ae, 0x00af, 0x00b0, 0x00b0, 0x00b1,
+  0x00b1, 0x00b2, 0x00b3, 0x00b3, 0x00b4, 0x00b4, 0x00b5, 0x00b5, 0x00b6, 0x00b6, 0x00b7, 0x00b7, 0x00b8, 0x00b8, 0x00b9, 0x00b9,
+  0x00ba, 0x00ba, 0x00bb, 0x00bb, 0x00bc, 0x00bc, 0x00bd, 0x00bd, 0x00bd, 0x00be, 0x00be, 0x00be, 0x00bf, 0x00bf, 0x00c0, 0x00c0,
+  0x00c0, 0x00c1, 0x00c1, 0x00c1, 0x00c2, 0x00c2, 0x00c2, 0x00c2, 0x00c3, 0x00c3, 0x00c3, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c5,
+  0x00c5, 0x00c5, 0x00c6, 0x00c6, 0x00c6, 0x00c6, 0x00c6, 0x00c7, 0x00c7, 0x00c7, 0x00c7, 0x00c7, 0x00c7, 0x00c8, 0x00c8, 0x00c8,
+  0x00c8, 0x00c8, 0x00c8, 0x00c8, 0x00c8, 0x00c8, 0x00c8, 0x00c8, 0x00c9, 0x00c9, 0x00c9, 0x00c9, 0x00c9, 0x00c9, 0x00c9, 0x00c9,
+  0x0000, 0x0001, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000f, 0x0010, 0x0011, 0x0012,
+  0x0013, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025,
+  0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0035, 0x0036, 0x0037, 0x0038,
+  0x0039, 0x003a, 0x003b, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a,
+  0x004b, 0x004c, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c,
+  0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c,
+  0x006e, 0x006e, 0x006f, 0x0071, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c,
+  0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008a,
+  0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x008f, 0x0090, 0x0091, 0x0092, 0x0093, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0097,
+  0x0098, 0x0099, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009d, 0x009e, 0x009f, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a2, 0x00a3,
+  0x00a4, 0x00a4, 0x00a5, 0x00a6, 0x00a6, 0x00a7, 0x00a7, 0x00a8, 0x00a9, 0x00a9, 0x00aa, 0x00ab, 0x00ab, 0x00ac, 0x00ac, 0x00ad,
+  0x00ad, 0x00ae, 0x00af, 0x00af, 0x00b0, 0x00b0, 0x00b1, 0x00b1, 0x00b2, 0x00b2, 0x00b3, 0x00b3, 0x00b4, 0x00b4, 0x00b5, 0x00b5,
+  0x00b6, 0x00b6, 0x00b7, 0x00b7, 0x00b8, 0x00b8, 0x00b9, 0x00b9, 0x00b9, 0x00ba, 0x00ba, 0x00ba, 0x00bb, 0x00bb, 0x00bc, 0x00bc,
+  0x00bc, 0x00bd, 0x00bd, 0x00bd, 0x00be, 0x00be, 0x00be, 0x00be, 0x00bf, 0x00bf, 0x00bf, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c1,
+  0x00c1, 0x00c1, 0x00c1, 0x00c1, 0x00c2, 0x00c2, 0x00c2, 0x00c2, 0x00c2, 0x00c2, 0x00c3, 0x00c3, 0x00c3, 0x00c3, 0x00c3, 0x00c3,
+  0x00c3, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4, 0x00c4,
+  0x0000, 0x0001, 0x0002, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f, 0x0011, 0x0012,
+  0x0013, 0x0014, 0x0015, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0025,
+  0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0048, 0x0049,
+  0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0053, 0x0053, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a,
+  0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a,
+  0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0077, 0x0078, 0x0079,
+  0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0087,
+  0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008c, 0x008d, 0x008e, 0x008f, 0x008f, 0x0090, 0x0091, 0x0092, 0x0093, 0x0093, 0x0094,
+  0x0095, 0x0096, 0x0096, 0x0097, 0x0098, 0x0099, 0x0099, 0x009a, 0x009b, 0x009c, 0x009c, 0x009d, 0x009d, 0x009e, 0x009f, 0x009f,
+  0x00a0, 0x00a1, 0x00a2, 0x00a2, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a5, 0x00a6, 0x00a6, 0x00a7, 0x00a7, 0x00a8, 0x00a9, 0x00a9,
+  0x00aa, 0x00aa, 0x00ab, 0x00ac, 0x00ac, 0x00ac, 0x00ad, 0x00ad, 0x00ae, 0x00ae, 0x00af, 0x00af, 0x00b0, 0x00b0, 0x00b1, 0x00b1,
+  0x00b2, 0x00b2, 0x00b3, 0x00b3, 0x00b4, 0x00b4, 0x00b5, 0x00b5, 0x00b5, 0x00b6, 0x00b6, 0x00b6, 0x00b7, 0x00b7, 0x00b8, 0x00b8,
+  0x00b8, 0x00b9, 0x00b9, 0x00b9, 0x00ba, 0x00ba, 0x00ba, 0x00ba, 0x00bb, 0x00bb, 0x00bb, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bd,
+  0x00bd, 0x00bd, 0x00bd, 0x00bd, 0x00be, 0x00be, 0x00be, 0x00be, 0x00be, 0x00be, 0x00bf, 0x00bf, 0x00bf, 0x00bf, 0x00bf, 0x00bf,
+  0x00bf, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0,
+  0x0000, 0x0001, 0x0002, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0011,
+  0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0023, 0x0024,
+  0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0035, 0x0036,
+  0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058,
+  0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+  0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007e, 0x0080, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085,
+  0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x0089, 0x008a, 0x008b, 0x008c, 0x008c, 0x008d, 0x008e, 0x008f, 0x008f, 0x0090, 0x0091,
+  0x0092, 0x0093, 0x0093, 0x0094, 0x0095, 0x0095, 0x0096, 0x0097, 0x0097, 0x0098, 0x0099, 0x0099, 0x009a, 0x009b, 0x009c, 0x009c,
+  0x009d, 0x009d, 0x009e, 0x009f, 0x009f, 0x00a0, 0x00a0, 0x00a1, 0x00a2, 0x00a2, 0x00a3, 0x00a3, 0x00a4, 0x00a5, 0x00a5, 0x00a6,
+  0x00a6, 0x00a6, 0x00a7, 0x00a8, 0x00a8, 0x00a9, 0x00a9, 0x00aa, 0x00aa, 0x00ab, 0x00ab, 0x00ac, 0x00ac, 0x00ac, 0x00ad, 0x00ad,
+  0x00ae, 0x00ae, 0x00af, 0x00af, 0x00b0, 0x00b0, 0x00b1, 0x00b1, 0x00b1, 0x00b2, 0x00b2, 0x00b2, 0x00b3, 0x00b3, 0x00b4, 0x00b4,
+  0x00b4, 0x00b5, 0x00b5, 0x00b5, 0x00b6, 0x00b6, 0x00b6, 0x00b6, 0x00b7, 0x00b7, 0x00b7, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b9,
+  0x00b9, 0x00b9, 0x00b9, 0x00b9, 0x00ba, 0x00ba, 0x00ba, 0x00ba, 0x00ba, 0x00ba, 0x00bb, 0x00bb, 0x00bb, 0x00bb, 0x00bb, 0x00bb,
+  0x00bb, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc, 0x00bc,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000d, 0x000e, 0x000f, 0x0010, 0x0011,
+  0x0012, 0x0013, 0x0014, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x0020, 0x0021, 0x0022, 0x0023,
+  0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+  0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0045, 0x0046,
+  0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056,
+  0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0065,
+  0x0067, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0071, 0x0072, 0x0073, 0x0074,
+  0x0075, 0x0076, 0x0077, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082,
+  0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0086, 0x0087, 0x0088, 0x0089, 0x0089, 0x008a, 0x008b, 0x008c, 0x008c, 0x008d, 0x008e,
+  0x008f, 0x008f, 0x0090, 0x0091, 0x0091, 0x0092, 0x0093, 0x0093, 0x0094, 0x0095, 0x0095, 0x0096, 0x0097, 0x0097, 0x0098, 0x0099,
+  0x0099, 0x009a, 0x009b, 0x009b, 0x009c, 0x009c, 0x009d, 0x009e, 0x009e, 0x009f, 0x009f, 0x00a0, 0x00a0, 0x00a1, 0x00a2, 0x00a2,
+  0x00a2, 0x00a3, 0x00a4, 0x00a4, 0x00a5, 0x00a5, 0x00a6, 0x00a6, 0x00a6, 0x00a7, 0x00a7, 0x00a8, 0x00a8, 0x00a9, 0x00a9, 0x00aa,
+  0x00aa, 0x00ab, 0x00ab, 0x00ac, 0x00ac, 0x00ac, 0x00ad, 0x00ad, 0x00ad, 0x00ae, 0x00ae, 0x00ae, 0x00af, 0x00af, 0x00b0, 0x00b0,
+  0x00b0, 0x00b1, 0x00b1, 0x00b1, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b3, 0x00b3, 0x00b3, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b5,
+  0x00b5, 0x00b5, 0x00b5, 0x00b5, 0x00b6, 0x00b6, 0x00b6, 0x00b6, 0x00b6, 0x00b6, 0x00b7, 0x00b7, 0x00b7, 0x00b7, 0x00b7, 0x00b7,
+  0x00b7, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8, 0x00b8,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x0010, 0x0011,
+  0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022,
+  0x0023, 0x0024, 0x0025, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033,
+  0x0034, 0x0035, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+  0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+  0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0061, 0x0063, 0x0063,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072,
+  0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007c, 0x007d, 0x007e, 0x007f,
+  0x0080, 0x0080, 0x0081, 0x0082, 0x0083, 0x0083, 0x0084, 0x0085, 0x0086, 0x0086, 0x0087, 0x0088, 0x0089, 0x0089, 0x008a, 0x008b,
+  0x008c, 0x008c, 0x008d, 0x008d, 0x008e, 0x008f, 0x0090, 0x0090, 0x0091, 0x0092, 0x0092, 0x0093, 0x0093, 0x0094, 0x0095, 0x0095,
+  0x0096, 0x0097, 0x0097, 0x0098, 0x0098, 0x0099, 0x0099, 0x009a, 0x009b, 0x009b, 0x009c, 0x009c, 0x009d, 0x009e, 0x009e, 0x009f,
+  0x009f, 0x009f, 0x00a0, 0x00a1, 0x00a1, 0x00a2, 0x00a2, 0x00a2, 0x00a3, 0x00a3, 0x00a4, 0x00a4, 0x00a5, 0x00a5, 0x00a6, 0x00a6,
+  0x00a6, 0x00a7, 0x00a7, 0x00a8, 0x00a8, 0x00a9, 0x00a9, 0x00a9, 0x00aa, 0x00aa, 0x00ab, 0x00ab, 0x00ab, 0x00ac, 0x00ac, 0x00ac,
+  0x00ac, 0x00ad, 0x00ad, 0x00ad, 0x00ae, 0x00ae, 0x00ae, 0x00ae, 0x00af, 0x00af, 0x00af, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b1,
+  0x00b1, 0x00b1, 0x00b1, 0x00b1, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b2, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3, 0x00b3,
+  0x00b3, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4, 0x00b4,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f, 0x0010,
+  0x0011, 0x0012, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021,
+  0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032,
+  0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x003a, 0x003b, 0x003b, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043,
+  0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004c, 0x004e, 0x004f, 0x004f, 0x0050, 0x0051, 0x0052,
+  0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x005f, 0x0060, 0x0061,
+  0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006e, 0x006f,
+  0x0070, 0x0071, 0x0072, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0077, 0x0078, 0x0079, 0x007a, 0x007a, 0x007b, 0x007c,
+  0x007d, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0081, 0x0082, 0x0083, 0x0083, 0x0084, 0x0085, 0x0086, 0x0086, 0x0087, 0x0088,
+  0x0089, 0x0089, 0x008a, 0x008a, 0x008b, 0x008c, 0x008d, 0x008d, 0x008e, 0x008f, 0x008f, 0x0090, 0x0090, 0x0091, 0x0092, 0x0092,
+  0x0093, 0x0093, 0x0094, 0x0095, 0x0095, 0x0096, 0x0096, 0x0097, 0x0097, 0x0098, 0x0099, 0x0099, 0x0099, 0x009a, 0x009b, 0x009b,
+  0x009c, 0x009c, 0x009d, 0x009d, 0x009e, 0x009e, 0x009f, 0x009f, 0x009f, 0x00a0, 0x00a0, 0x00a1, 0x00a1, 0x00a2, 0x00a2, 0x00a2,
+  0x00a3, 0x00a3, 0x00a4, 0x00a4, 0x00a5, 0x00a5, 0x00a6, 0x00a6, 0x00a6, 0x00a6, 0x00a7, 0x00a7, 0x00a7, 0x00a8, 0x00a8, 0x00a8,
+  0x00a9, 0x00a9, 0x00a9, 0x00aa, 0x00aa, 0x00aa, 0x00ab, 0x00ab, 0x00ab, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ad,
+  0x00ad, 0x00ad, 0x00ad, 0x00ad, 0x00ae, 0x00ae, 0x00ae, 0x00ae, 0x00ae, 0x00ae, 0x00af, 0x00af, 0x00af, 0x00af, 0x00af, 0x00af,
+  0x00af, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0, 0x00b0,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f, 0x0010,
+  0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021,
+  0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031,
+  0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041,
+  0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+  0x0051, 0x0053, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005d, 0x005e, 0x005f,
+  0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d,
+  0x006e, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0077, 0x0078, 0x0079, 0x0079,
+  0x007a, 0x007b, 0x007c, 0x007c, 0x007d, 0x007e, 0x007e, 0x007f, 0x0080, 0x0081, 0x0081, 0x0082, 0x0083, 0x0083, 0x0084, 0x0085,
+  0x0086, 0x0086, 0x0087, 0x0087, 0x0088, 0x0089, 0x008a, 0x008a, 0x008b, 0x008c, 0x008c, 0x008d, 0x008d, 0x008e, 0x008f, 0x008f,
+  0x0090, 0x0090, 0x0091, 0x0091, 0x0092, 0x0093, 0x0093, 0x0094, 0x0094, 0x0095, 0x0095, 0x0096, 0x0096, 0x0097, 0x0097, 0x0098,
+  0x0098, 0x0099, 0x0099, 0x009a, 0x009a, 0x009b, 0x009b, 0x009c, 0x009c, 0x009c, 0x009d, 0x009d, 0x009e, 0x009e, 0x009f, 0x009f,
+  0x009f, 0x00a0, 0x00a0, 0x00a1, 0x00a1, 0x00a2, 0x00a2, 0x00a2, 0x00a2, 0x00a3, 0x00a3, 0x00a3, 0x00a4, 0x00a4, 0x00a5, 0x00a5,
+  0x00a5, 0x00a6, 0x00a6, 0x00a6, 0x00a6, 0x00a6, 0x00a7, 0x00a7, 0x00a7, 0x00a8, 0x00a8, 0x00a8, 0x00a8, 0x00a9, 0x00a9, 0x00a9,
+  0x00a9, 0x00a9, 0x00aa, 0x00aa, 0x00aa, 0x00aa, 0x00aa, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ab, 0x00ac, 0x00ac, 0x00ac,
+  0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac, 0x00ac,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000e, 0x000f, 0x0010,
+  0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020,
+  0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030,
+  0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040,
+  0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005b, 0x005c, 0x005d,
+  0x005e, 0x005f, 0x0060, 0x0061, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+  0x006b, 0x006c, 0x006d, 0x006e, 0x006e, 0x006f, 0x0070, 0x0071, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0075, 0x0076, 0x0077,
+  0x0077, 0x0078, 0x0079, 0x007a, 0x007a, 0x007b, 0x007c, 0x007c, 0x007d, 0x007e, 0x007e, 0x007f, 0x0080, 0x0081, 0x0081, 0x0082,
+  0x0083, 0x0083, 0x0084, 0x0085, 0x0085, 0x0086, 0x0087, 0x0087, 0x0088, 0x0089, 0x0089, 0x008a, 0x008a, 0x008b, 0x008c, 0x008c,
+  0x008d, 0x008d, 0x008e, 0x008e, 0x008f, 0x008f, 0x0090, 0x0091, 0x0091, 0x0091, 0x0092, 0x0093, 0x0093, 0x0094, 0x0094, 0x0095,
+  0x0095, 0x0095, 0x0096, 0x0097, 0x0097, 0x0097, 0x0098, 0x0098, 0x0099, 0x0099, 0x0099, 0x009a, 0x009a, 0x009b, 0x009b, 0x009c,
+  0x009c, 0x009c, 0x009d, 0x009d, 0x009e, 0x009e, 0x009f, 0x009f, 0x009f, 0x009f, 0x00a0, 0x00a0, 0x00a0, 0x00a1, 0x00a1, 0x00a1,
+  0x00a2, 0x00a2, 0x00a2, 0x00a2, 0x00a3, 0x00a3, 0x00a3, 0x00a3, 0x00a4, 0x00a4, 0x00a4, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a6,
+  0x00a6, 0x00a6, 0x00a6, 0x00a6, 0x00a6, 0x00a6, 0x00a6, 0x00a7, 0x00a7, 0x00a7, 0x00a7, 0x00a7, 0x00a7, 0x00a8, 0x00a8, 0x00a8,
+  0x00a8, 0x00a8, 0x00a8, 0x00a8, 0x00a8, 0x00a8, 0x00a8, 0x00a8, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9, 0x00a9,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+  0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003b, 0x003c, 0x003d, 0x003e,
+  0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004a, 0x004b, 0x004c, 0x004d,
+  0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x0059, 0x005a, 0x005b,
+  0x005c, 0x005d, 0x005e, 0x005f, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0067, 0x0068,
+  0x0069, 0x006a, 0x006b, 0x006b, 0x006c, 0x006d, 0x006e, 0x006e, 0x006f, 0x0070, 0x0071, 0x0071, 0x0072, 0x0073, 0x0074, 0x0074,
+  0x0075, 0x0076, 0x0077, 0x0077, 0x0078, 0x0078, 0x0079, 0x007a, 0x007a, 0x007b, 0x007c, 0x007c, 0x007d, 0x007e, 0x007e, 0x007f,
+  0x0080, 0x0081, 0x0081, 0x0082, 0x0082, 0x0083, 0x0084, 0x0084, 0x0085, 0x0086, 0x0086, 0x0087, 0x0087, 0x0088, 0x0089, 0x0089,
+  0x008a, 0x008a, 0x008b, 0x008b, 0x008c, 0x008c, 0x008d, 0x008d, 0x008e, 0x008e, 0x008f, 0x008f, 0x0090, 0x0091, 0x0091, 0x0091,
+  0x0092, 0x0092, 0x0093, 0x0093, 0x0094, 0x0094, 0x0095, 0x0095, 0x0095, 0x0096, 0x0096, 0x0097, 0x0097, 0x0097, 0x0098, 0x0098,
+  0x0099, 0x0099, 0x0099, 0x009a, 0x009a, 0x009b, 0x009b, 0x009b, 0x009c, 0x009c, 0x009c, 0x009c, 0x009d, 0x009d, 0x009e, 0x009e,
+  0x009e, 0x009f, 0x009f, 0x009f, 0x009f, 0x009f, 0x00a0, 0x00a0, 0x00a0, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a2, 0x00a2, 0x00a2,
+  0x00a2, 0x00a2, 0x00a2, 0x00a2, 0x00a3, 0x00a3, 0x00a3, 0x00a3, 0x00a3, 0x00a3, 0x00a4, 0x00a4, 0x00a4, 0x00a4, 0x00a4, 0x00a4,
+  0x00a4, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5, 0x00a5,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+  0x0020, 0x0021, 0x0022, 0x0023, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e,
+  0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d,
+  0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004b,
+  0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0057, 0x0058, 0x0059,
+  0x005a, 0x005b, 0x005c, 0x005d, 0x005d, 0x005e, 0x005f, 0x0060, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0064, 0x0065, 0x0066,
+  0x0067, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006b, 0x006c, 0x006d, 0x006e, 0x006e, 0x006f, 0x0070, 0x0070, 0x0071, 0x0072,
+  0x0072, 0x0073, 0x0074, 0x0075, 0x0075, 0x0076, 0x0077, 0x0077, 0x0078, 0x0078, 0x0079, 0x007a, 0x007a, 0x007b, 0x007c, 0x007c,
+  0x007d, 0x007e, 0x007e, 0x007f, 0x0080, 0x0080, 0x0081, 0x0081, 0x0082, 0x0083, 0x0083, 0x0084, 0x0084, 0x0085, 0x0086, 0x0086,
+  0x0087, 0x0087, 0x0088, 0x0088, 0x0089, 0x0089, 0x008a, 0x008a, 0x008b, 0x008b, 0x008c, 0x008c, 0x008d, 0x008d, 0x008e, 0x008e,
+  0x008f, 0x008f, 0x0090, 0x0090, 0x0091, 0x0091, 0x0091, 0x0092, 0x0092, 0x0093, 0x0093, 0x0093, 0x0094, 0x0094, 0x0095, 0x0095,
+  0x0095, 0x0096, 0x0096, 0x0097, 0x0097, 0x0097, 0x0098, 0x0098, 0x0098, 0x0099, 0x0099, 0x0099, 0x0099, 0x009a, 0x009a, 0x009a,
+  0x009b, 0x009b, 0x009b, 0x009c, 0x009c, 0x009c, 0x009c, 0x009c, 0x009d, 0x009d, 0x009d, 0x009e, 0x009e, 0x009e, 0x009e, 0x009f,
+  0x009f, 0x009f, 0x009f, 0x009f, 0x009f, 0x009f, 0x009f, 0x00a0, 0x00a0, 0x00a0, 0x00a0, 0x00a0, 0x00a0, 0x00a1, 0x00a1, 0x00a1,
+  0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a2, 0x00a2, 0x00a2, 0x00a2, 0x00a2, 0x00a2, 0x00a2, 0x00a2,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0010, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e,
+  0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d,
+  0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c,
+  0x003d, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a,
+  0x004b, 0x004c, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005a, 0x005b, 0x005b, 0x005c, 0x005d, 0x005e, 0x005e, 0x005f, 0x0060, 0x0061, 0x0061, 0x0062, 0x0063, 0x0064,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0067, 0x0068, 0x0069, 0x006a, 0x006a, 0x006b, 0x006c, 0x006d, 0x006d, 0x006e, 0x006f, 0x006f,
+  0x0070, 0x0071, 0x0071, 0x0072, 0x0073, 0x0073, 0x0074, 0x0075, 0x0075, 0x0076, 0x0077, 0x0077, 0x0078, 0x0078, 0x0079, 0x007a,
+  0x007a, 0x007b, 0x007b, 0x007c, 0x007d, 0x007d, 0x007e, 0x007e, 0x007f, 0x0080, 0x0080, 0x0081, 0x0081, 0x0082, 0x0083, 0x0083,
+  0x0084, 0x0084, 0x0085, 0x0085, 0x0086, 0x0086, 0x0087, 0x0087, 0x0088, 0x0088, 0x0089, 0x0089, 0x008a, 0x008a, 0x008b, 0x008b,
+  0x008c, 0x008c, 0x008d, 0x008d, 0x008d, 0x008e, 0x008e, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0091, 0x0091, 0x0091, 0x0092,
+  0x0092, 0x0093, 0x0093, 0x0093, 0x0094, 0x0094, 0x0095, 0x0095, 0x0095, 0x0095, 0x0096, 0x0096, 0x0096, 0x0097, 0x0097, 0x0097,
+  0x0097, 0x0098, 0x0098, 0x0098, 0x0099, 0x0099, 0x0099, 0x0099, 0x0099, 0x009a, 0x009a, 0x009a, 0x009a, 0x009b, 0x009b, 0x009b,
+  0x009b, 0x009b, 0x009c, 0x009c, 0x009c, 0x009c, 0x009c, 0x009c, 0x009c, 0x009c, 0x009d, 0x009d, 0x009d, 0x009d, 0x009d, 0x009d,
+  0x009d, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e, 0x009e,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e,
+  0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001a, 0x001b, 0x001c, 0x001d,
+  0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c,
+  0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003a,
+  0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0046, 0x0047, 0x0048,
+  0x0049, 0x004a, 0x004b, 0x004c, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0055,
+  0x0056, 0x0057, 0x0058, 0x0059, 0x0059, 0x005a, 0x005b, 0x005c, 0x005c, 0x005d, 0x005e, 0x005f, 0x005f, 0x0060, 0x0061, 0x0062,
+  0x0062, 0x0063, 0x0064, 0x0064, 0x0065, 0x0066, 0x0067, 0x0067, 0x0068, 0x0069, 0x0069, 0x006a, 0x006b, 0x006b, 0x006c, 0x006d,
+  0x006e, 0x006e, 0x006f, 0x0070, 0x0070, 0x0071, 0x0071, 0x0072, 0x0073, 0x0073, 0x0074, 0x0075, 0x0075, 0x0076, 0x0077, 0x0077,
+  0x0078, 0x0078, 0x0079, 0x0079, 0x007a, 0x007b, 0x007b, 0x007c, 0x007c, 0x007d, 0x007d, 0x007e, 0x007e, 0x007f, 0x0080, 0x0080,
+  0x0081, 0x0081, 0x0082, 0x0082, 0x0083, 0x0083, 0x0084, 0x0085, 0x0085, 0x0085, 0x0086, 0x0086, 0x0087, 0x0087, 0x0088, 0x0088,
+  0x0089, 0x0089, 0x008a, 0x008a, 0x008a, 0x008b, 0x008b, 0x008c, 0x008c, 0x008c, 0x008d, 0x008d, 0x008d, 0x008e, 0x008e, 0x008f,
+  0x008f, 0x008f, 0x0090, 0x0090, 0x0091, 0x0091, 0x0091, 0x0091, 0x0092, 0x0092, 0x0093, 0x0093, 0x0093, 0x0093, 0x0094, 0x0094,
+  0x0094, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0096, 0x0096, 0x0096, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0098,
+  0x0098, 0x0098, 0x0098, 0x0098, 0x0099, 0x0099, 0x0099, 0x0099, 0x0099, 0x0099, 0x0099, 0x0099, 0x0099, 0x009a, 0x009a, 0x009a,
+  0x009a, 0x009a, 0x009a, 0x009a, 0x009a, 0x009a, 0x009a, 0x009a, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b, 0x009b,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e,
+  0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d,
+  0x001e, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0028, 0x0029, 0x002a, 0x002b,
+  0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0037, 0x0038, 0x0039,
+  0x003a, 0x003b, 0x003c, 0x003d, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0050, 0x0051, 0x0052, 0x0053, 0x0053,
+  0x0054, 0x0055, 0x0056, 0x0057, 0x0057, 0x0058, 0x0059, 0x005a, 0x005a, 0x005b, 0x005c, 0x005d, 0x005d, 0x005e, 0x005f, 0x0060,
+  0x0060, 0x0061, 0x0062, 0x0062, 0x0063, 0x0064, 0x0064, 0x0065, 0x0066, 0x0067, 0x0067, 0x0068, 0x0069, 0x0069, 0x006a, 0x006b,
+  0x006b, 0x006c, 0x006d, 0x006d, 0x006e, 0x006e, 0x006f, 0x0070, 0x0070, 0x0071, 0x0071, 0x0072, 0x0073, 0x0073, 0x0074, 0x0075,
+  0x0075, 0x0076, 0x0076, 0x0077, 0x0077, 0x0078, 0x0079, 0x0079, 0x007a, 0x007a, 0x007b, 0x007b, 0x007c, 0x007c, 0x007d, 0x007d,
+  0x007e, 0x007e, 0x007f, 0x0080, 0x0080, 0x0081, 0x0081, 0x0082, 0x0082, 0x0082, 0x0083, 0x0083, 0x0084, 0x0085, 0x0085, 0x0085,
+  0x0086, 0x0086, 0x0087, 0x0087, 0x0087, 0x0088, 0x0088, 0x0089, 0x0089, 0x0089, 0x008a, 0x008a, 0x008a, 0x008b, 0x008b, 0x008c,
+  0x008c, 0x008c, 0x008d, 0x008d, 0x008d, 0x008e, 0x008e, 0x008e, 0x008f, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0091, 0x0091,
+  0x0091, 0x0091, 0x0091, 0x0092, 0x0092, 0x0092, 0x0093, 0x0093, 0x0093, 0x0093, 0x0093, 0x0094, 0x0094, 0x0094, 0x0094, 0x0095,
+  0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0095, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0096, 0x0097, 0x0097, 0x0097,
+  0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e,
+  0x000f, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c,
+  0x001d, 0x001e, 0x001f, 0x0020, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0028, 0x0029, 0x002a,
+  0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0035, 0x0036, 0x0037, 0x0038,
+  0x0039, 0x003a, 0x003b, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0040, 0x0041, 0x0042, 0x0043, 0x0043, 0x0044, 0x0045,
+  0x0046, 0x0047, 0x0048, 0x0048, 0x0049, 0x004a, 0x004b, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x004f, 0x0050, 0x0051, 0x0052,
+  0x0053, 0x0053, 0x0054, 0x0055, 0x0056, 0x0056, 0x0057, 0x0058, 0x0058, 0x0059, 0x005a, 0x005b, 0x005b, 0x005c, 0x005d, 0x005e,
+  0x005e, 0x005f, 0x0060, 0x0060, 0x0061, 0x0062, 0x0062, 0x0063, 0x0064, 0x0064, 0x0065, 0x0066, 0x0066, 0x0067, 0x0068, 0x0068,
+  0x0069, 0x0069, 0x006a, 0x006b, 0x006b, 0x006c, 0x006d, 0x006d, 0x006e, 0x006e, 0x006f, 0x0070, 0x0070, 0x0071, 0x0071, 0x0072,
+  0x0073, 0x0073, 0x0074, 0x0074, 0x0075, 0x0076, 0x0076, 0x0077, 0x0077, 0x0078, 0x0078, 0x0079, 0x0079, 0x007a, 0x007a, 0x007b,
+  0x007b, 0x007c, 0x007c, 0x007d, 0x007d, 0x007e, 0x007e, 0x007f, 0x007f, 0x0080, 0x0080, 0x0081, 0x0081, 0x0082, 0x0082, 0x0082,
+  0x0083, 0x0083, 0x0084, 0x0084, 0x0085, 0x0085, 0x0085, 0x0086, 0x0086, 0x0086, 0x0087, 0x0087, 0x0087, 0x0088, 0x0088, 0x0089,
+  0x0089, 0x0089, 0x008a, 0x008a, 0x008a, 0x008b, 0x008b, 0x008b, 0x008c, 0x008c, 0x008c, 0x008c, 0x008d, 0x008d, 0x008d, 0x008d,
+  0x008e, 0x008e, 0x008e, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091,
+  0x0091, 0x0091, 0x0092, 0x0092, 0x0092, 0x0092, 0x0092, 0x0093, 0x0093, 0x0093, 0x0093, 0x0093, 0x0093, 0x0093, 0x0093, 0x0093,
+  0x0093, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094, 0x0094,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000c, 0x000d,
+  0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001b,
+  0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0028, 0x0029,
+  0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0041, 0x0042, 0x0043, 0x0044,
+  0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0048, 0x0049, 0x004a, 0x004b, 0x004b, 0x004c, 0x004d, 0x004e, 0x004e, 0x004f, 0x0050,
+  0x0051, 0x0051, 0x0052, 0x0053, 0x0054, 0x0054, 0x0055, 0x0056, 0x0056, 0x0057, 0x0058, 0x0059, 0x0059, 0x005a, 0x005b, 0x005c,
+  0x005c, 0x005d, 0x005e, 0x005e, 0x005f, 0x0060, 0x0060, 0x0061, 0x0061, 0x0062, 0x0063, 0x0064, 0x0064, 0x0065, 0x0065, 0x0066,
+  0x0067, 0x0067, 0x0068, 0x0069, 0x0069, 0x006a, 0x006a, 0x006b, 0x006b, 0x006c, 0x006d, 0x006d, 0x006e, 0x006e, 0x006f, 0x0070,
+  0x0070, 0x0071, 0x0071, 0x0072, 0x0072, 0x0073, 0x0074, 0x0074, 0x0075, 0x0075, 0x0076, 0x0076, 0x0077, 0x0077, 0x0078, 0x0078,
+  0x0079, 0x0079, 0x007a, 0x007a, 0x007a, 0x007b, 0x007b, 0x007c, 0x007c, 0x007d, 0x007d, 0x007e, 0x007e, 0x007f, 0x007f, 0x0080,
+  0x0080, 0x0080, 0x0081, 0x0081, 0x0082, 0x0082, 0x0082, 0x0083, 0x0083, 0x0083, 0x0084, 0x0084, 0x0085, 0x0085, 0x0085, 0x0086,
+  0x0086, 0x0086, 0x0087, 0x0087, 0x0087, 0x0088, 0x0088, 0x0088, 0x0089, 0x0089, 0x0089, 0x0089, 0x008a, 0x008a, 0x008a, 0x008a,
+  0x008b, 0x008b, 0x008b, 0x008c, 0x008c, 0x008c, 0x008c, 0x008c, 0x008d, 0x008d, 0x008d, 0x008d, 0x008d, 0x008e, 0x008e, 0x008e,
+  0x008e, 0x008e, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x008f, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090,
+  0x0090, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000a, 0x000b, 0x000c, 0x000d,
+  0x000e, 0x000f, 0x0010, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b,
+  0x001c, 0x001d, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0028,
+  0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0032, 0x0033, 0x0034, 0x0035, 0x0035,
+  0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003a, 0x003b, 0x003c, 0x003d, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0041, 0x0042,
+  0x0043, 0x0044, 0x0045, 0x0045, 0x0046, 0x0047, 0x0048, 0x0048, 0x0049, 0x004a, 0x004b, 0x004b, 0x004c, 0x004d, 0x004e, 0x004e,
+  0x004f, 0x0050, 0x0050, 0x0051, 0x0052, 0x0053, 0x0053, 0x0054, 0x0055, 0x0055, 0x0056, 0x0057, 0x0057, 0x0058, 0x0059, 0x005a,
+  0x005a, 0x005b, 0x005c, 0x005c, 0x005d, 0x005e, 0x005e, 0x005f, 0x005f, 0x0060, 0x0061, 0x0061, 0x0062, 0x0063, 0x0063, 0x0064,
+  0x0064, 0x0065, 0x0066, 0x0066, 0x0067, 0x0067, 0x0068, 0x0069, 0x0069, 0x006a, 0x006a, 0x006b, 0x006b, 0x006c, 0x006d, 0x006d,
+  0x006e, 0x006e, 0x006f, 0x006f, 0x0070, 0x0071, 0x0071, 0x0071, 0x0072, 0x0073, 0x0073, 0x0074, 0x0074, 0x0075, 0x0075, 0x0076,
+  0x0076, 0x0077, 0x0077, 0x0077, 0x0078, 0x0078, 0x0079, 0x0079, 0x007a, 0x007a, 0x007b, 0x007b, 0x007b, 0x007c, 0x007c, 0x007d,
+  0x007d, 0x007d, 0x007e, 0x007e, 0x007f, 0x007f, 0x0080, 0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0082, 0x0082, 0x0082, 0x0083,
+  0x0083, 0x0083, 0x0084, 0x0084, 0x0085, 0x0085, 0x0085, 0x0085, 0x0086, 0x0086, 0x0086, 0x0086, 0x0087, 0x0087, 0x0087, 0x0087,
+  0x0088, 0x0088, 0x0088, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x008a, 0x008a, 0x008a, 0x008a, 0x008a, 0x008b, 0x008b, 0x008b,
+  0x008b, 0x008b, 0x008c, 0x008c, 0x008c, 0x008c, 0x008c, 0x008c, 0x008c, 0x008c, 0x008d, 0x008d, 0x008d, 0x008d, 0x008d, 0x008d,
+  0x008d, 0x008d, 0x008d, 0x008d, 0x008d, 0x008d, 0x008d, 0x008d, 0x008e, 0x008e, 0x008e, 0x008e, 0x008e, 0x008e, 0x008e, 0x008e,
+  0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d,
+  0x000e, 0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x0019, 0x001a,
+  0x001b, 0x001c, 0x001d, 0x001e, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0027,
+  0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0034,
+  0x0035, 0x0036, 0x0037, 0x0038, 0x0038, 0x0039, 0x003a, 0x003b, 0x003b, 0x003c, 0x003d, 0x003e, 0x003e, 0x003f, 0x0040, 0x0041,
+  0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0045, 0x0046, 0x0047, 0x0047, 0x0048, 0x0049, 0x004a, 0x004a, 0x004b, 0x004c, 0x004c,
+  0x004d, 0x004e, 0x004f, 0x004f, 0x0050, 0x0051, 0x0051, 0x0052, 0x0053, 0x0053, 0x0054, 0x0055, 0x0056, 0x0056, 0x0057, 0x0058,
+  0x0058, 0x0059, 0x005a, 0x005a, 0x005b, 0x005c, 0x005c, 0x005d, 0x005d, 0x005e, 0x005f, 0x005f, 0x0060, 0x0060, 0x0061, 0x0062,
+  0x0062, 0x0063, 0x0064, 0x0064, 0x0065, 0x0065, 0x0066, 0x0066, 0x0067, 0x0067, 0x0068, 0x0069, 0x0069, 0x006a, 0x006a, 0x006b,
+  0x006b, 0x006c, 0x006c, 0x006d, 0x006e, 0x006e, 0x006f, 0x006f, 0x0070, 0x0070, 0x0071, 0x0071, 0x0071, 0x0072, 0x0073, 0x0073,
+  0x0074, 0x0074, 0x0075, 0x0075, 0x0075, 0x0076, 0x0076, 0x0077, 0x0077, 0x0077, 0x0078, 0x0078, 0x0079, 0x0079, 0x007a, 0x007a,
+  0x007a, 0x007b, 0x007b, 0x007c, 0x007c, 0x007c, 0x007d, 0x007d, 0x007d, 0x007e, 0x007e, 0x007e, 0x007f, 0x007f, 0x0080, 0x0080,
+  0x0080, 0x0081, 0x0081, 0x0081, 0x0082, 0x0082, 0x0082, 0x0082, 0x0083, 0x0083, 0x0083, 0x0083, 0x0084, 0x0084, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0085, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0088, 0x0088, 0x0088,
+  0x0088, 0x0088, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x0089, 0x008a, 0x008a, 0x008a, 0x008a, 0x008a, 0x008a,
+  0x008a, 0x008a, 0x008a, 0x008a, 0x008a, 0x008a, 0x008a, 0x008a, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b, 0x008b,
+  0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000c,
+  0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a,
+  0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+  0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x002f, 0x0030, 0x0031, 0x0032, 0x0032, 0x0033,
+  0x0034, 0x0035, 0x0036, 0x0036, 0x0037, 0x0038, 0x0039, 0x0039, 0x003a, 0x003b, 0x003c, 0x003c, 0x003d, 0x003e, 0x003f, 0x003f,
+  0x0040, 0x0041, 0x0042, 0x0042, 0x0043, 0x0044, 0x0045, 0x0045, 0x0046, 0x0047, 0x0047, 0x0048, 0x0049, 0x0049, 0x004a, 0x004b,
+  0x004c, 0x004c, 0x004d, 0x004e, 0x004e, 0x004f, 0x0050, 0x0050, 0x0051, 0x0052, 0x0052, 0x0053, 0x0054, 0x0054, 0x0055, 0x0056,
+  0x0056, 0x0057, 0x0058, 0x0058, 0x0059, 0x005a, 0x005a, 0x005b, 0x005b, 0x005c, 0x005d, 0x005d, 0x005e, 0x005e, 0x005f, 0x0060,
+  0x0060, 0x0061, 0x0061, 0x0062, 0x0063, 0x0063, 0x0064, 0x0064, 0x0065, 0x0065, 0x0066, 0x0066, 0x0067, 0x0067, 0x0068, 0x0069,
+  0x0069, 0x006a, 0x006a, 0x006b, 0x006b, 0x006c, 0x006c, 0x006d, 0x006d, 0x006e, 0x006e, 0x006f, 0x006f, 0x0070, 0x0070, 0x0071,
+  0x0071, 0x0071, 0x0072, 0x0072, 0x0073, 0x0073, 0x0074, 0x0074, 0x0075, 0x0075, 0x0076, 0x0076, 0x0076, 0x0077, 0x0077, 0x0077,
+  0x0078, 0x0078, 0x0079, 0x0079, 0x0079, 0x007a, 0x007a, 0x007a, 0x007b, 0x007b, 0x007b, 0x007c, 0x007c, 0x007c, 0x007d, 0x007d,
+  0x007d, 0x007e, 0x007e, 0x007e, 0x007f, 0x007f, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0082, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0084, 0x0084, 0x0084, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0085, 0x0085, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0086, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087,
+  0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0088, 0x0088, 0x0088, 0x0088, 0x0088, 0x0088, 0x0088, 0x0088,
+  0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000b, 0x000c,
+  0x000d, 0x000e, 0x000f, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0018, 0x0019,
+  0x001a, 0x001b, 0x001c, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0020, 0x0021, 0x0022, 0x0023, 0x0023, 0x0024, 0x0025, 0x0026,
+  0x0027, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002b, 0x002c, 0x002d, 0x002e, 0x002e, 0x002f, 0x0030, 0x0031, 0x0031, 0x0032,
+  0x0033, 0x0034, 0x0034, 0x0035, 0x0036, 0x0037, 0x0037, 0x0038, 0x0039, 0x003a, 0x003a, 0x003b, 0x003c, 0x003c, 0x003d, 0x003e,
+  0x003f, 0x0040, 0x0040, 0x0041, 0x0042, 0x0042, 0x0043, 0x0044, 0x0044, 0x0045, 0x0046, 0x0046, 0x0047, 0x0048, 0x0049, 0x0049,
+  0x004a, 0x004b, 0x004b, 0x004c, 0x004d, 0x004d, 0x004e, 0x004f, 0x004f, 0x0050, 0x0051, 0x0051, 0x0052, 0x0053, 0x0053, 0x0054,
+  0x0054, 0x0055, 0x0056, 0x0056, 0x0057, 0x0058, 0x0058, 0x0059, 0x0059, 0x005a, 0x005b, 0x005b, 0x005c, 0x005c, 0x005d, 0x005e,
+  0x005e, 0x005f, 0x005f, 0x0060, 0x0060, 0x0061, 0x0061, 0x0062, 0x0063, 0x0063, 0x0064, 0x0064, 0x0065, 0x0065, 0x0066, 0x0066,
+  0x0067, 0x0067, 0x0068, 0x0068, 0x0069, 0x0069, 0x006a, 0x006a, 0x006b, 0x006b, 0x006c, 0x006c, 0x006d, 0x006d, 0x006e, 0x006e,
+  0x006f, 0x006f, 0x0070, 0x0070, 0x0070, 0x0071, 0x0071, 0x0072, 0x0072, 0x0072, 0x0073, 0x0073, 0x0074, 0x0074, 0x0075, 0x0075,
+  0x0075, 0x0076, 0x0076, 0x0077, 0x0077, 0x0077, 0x0077, 0x0078, 0x0078, 0x0078, 0x0079, 0x0079, 0x0079, 0x007a, 0x007a, 0x007a,
+  0x007b, 0x007b, 0x007b, 0x007c, 0x007c, 0x007c, 0x007d, 0x007d, 0x007d, 0x007d, 0x007e, 0x007e, 0x007e, 0x007e, 0x007f, 0x007f,
+  0x007f, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0082, 0x0082, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084, 0x0084,
+  0x0084, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085, 0x0085,
+  0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0009, 0x0009, 0x000a, 0x000b, 0x000c,
+  0x000d, 0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019,
+  0x0019, 0x001a, 0x001b, 0x001c, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0020, 0x0021, 0x0022, 0x0023, 0x0023, 0x0024, 0x0025,
+  0x0026, 0x0027, 0x0027, 0x0028, 0x0029, 0x002a, 0x002a, 0x002b, 0x002c, 0x002d, 0x002d, 0x002e, 0x002f, 0x0030, 0x0030, 0x0031,
+  0x0032, 0x0032, 0x0033, 0x0034, 0x0035, 0x0035, 0x0036, 0x0037, 0x0038, 0x0038, 0x0039, 0x003a, 0x003b, 0x003b, 0x003c, 0x003d,
+  0x003d, 0x003e, 0x003f, 0x0040, 0x0040, 0x0041, 0x0042, 0x0042, 0x0043, 0x0044, 0x0044, 0x0045, 0x0046, 0x0046, 0x0047, 0x0048,
+  0x0048, 0x0049, 0x004a, 0x004a, 0x004b, 0x004c, 0x004c, 0x004d, 0x004e, 0x004e, 0x004f, 0x004f, 0x0050, 0x0051, 0x0051, 0x0052,
+  0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0056, 0x0056, 0x0057, 0x0057, 0x0058, 0x0059, 0x0059, 0x005a, 0x005a, 0x005b, 0x005c,
+  0x005c, 0x005d, 0x005d, 0x005e, 0x005e, 0x005f, 0x005f, 0x0060, 0x0060, 0x0061, 0x0061, 0x0062, 0x0063, 0x0063, 0x0064, 0x0064,
+  0x0065, 0x0065, 0x0065, 0x0066, 0x0067, 0x0067, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069, 0x006a, 0x006a, 0x006b, 0x006b, 0x006c,
+  0x006c, 0x006d, 0x006d, 0x006e, 0x006e, 0x006e, 0x006f, 0x006f, 0x0070, 0x0070, 0x0071, 0x0071, 0x0071, 0x0072, 0x0072, 0x0072,
+  0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0075, 0x0075, 0x0075, 0x0076, 0x0076, 0x0076, 0x0077, 0x0077, 0x0077, 0x0077, 0x0078,
+  0x0078, 0x0078, 0x0079, 0x0079, 0x0079, 0x007a, 0x007a, 0x007a, 0x007a, 0x007b, 0x007b, 0x007b, 0x007b, 0x007c, 0x007c, 0x007c,
+  0x007c, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007e, 0x007e, 0x007e, 0x007e, 0x007e, 0x007f, 0x007f, 0x007f, 0x007f, 0x0080,
+  0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0080, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
+  0x0081, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x0009, 0x000a, 0x000b, 0x000c,
+  0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0017, 0x0018,
+  0x0019, 0x001a, 0x001a, 0x001b, 0x001c, 0x001d, 0x001d, 0x001e, 0x001f, 0x0020, 0x0020, 0x0021, 0x0022, 0x0023, 0x0023, 0x0024,
+  0x0025, 0x0026, 0x0026, 0x0027, 0x0028, 0x0029, 0x0029, 0x002a, 0x002b, 0x002c, 0x002c, 0x002d, 0x002e, 0x002f, 0x002f, 0x0030,
+  0x0031, 0x0031, 0x0032, 0x0033, 0x0034, 0x0034, 0x0035, 0x0036, 0x0037, 0x0037, 0x0038, 0x0039, 0x0039, 0x003a, 0x003b, 0x003b,
+  0x003c, 0x003d, 0x003d, 0x003e, 0x003f, 0x0040, 0x0040, 0x0041, 0x0041, 0x0042, 0x0043, 0x0043, 0x0044, 0x0045, 0x0046, 0x0046,
+  0x0047, 0x0047, 0x0048, 0x0049, 0x0049, 0x004a, 0x004b, 0x004b, 0x004c, 0x004c, 0x004d, 0x004e, 0x004e, 0x004f, 0x0050, 0x0050,
+  0x0051, 0x0051, 0x0052, 0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0056, 0x0056, 0x0057, 0x0057, 0x0058, 0x0058, 0x0059, 0x005a,
+  0x005a, 0x005b, 0x005b, 0x005c, 0x005c, 0x005d, 0x005d, 0x005e, 0x005e, 0x005f, 0x005f, 0x0060, 0x0060, 0x0061, 0x0061, 0x0062,
+  0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0065, 0x0065, 0x0066, 0x0066, 0x0067, 0x0067, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069,
+  0x006a, 0x006a, 0x006b, 0x006b, 0x006b, 0x006c, 0x006c, 0x006d, 0x006d, 0x006e, 0x006e, 0x006e, 0x006f, 0x006f, 0x0070, 0x0070,
+  0x0070, 0x0071, 0x0071, 0x0071, 0x0072, 0x0072, 0x0072, 0x0073, 0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0075, 0x0075, 0x0075,
+  0x0076, 0x0076, 0x0076, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0078, 0x0078, 0x0078, 0x0078, 0x0079, 0x0079, 0x0079, 0x0079,
+  0x007a, 0x007a, 0x007a, 0x007a, 0x007b, 0x007b, 0x007b, 0x007b, 0x007b, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007d,
+  0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007d, 0x007e, 0x007e, 0x007e, 0x007e, 0x007e, 0x007e, 0x007e, 0x007e, 0x007e,
+  0x007e, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f, 0x007f,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0004, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0008, 0x0009, 0x000a, 0x000b, 0x000b,
+  0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x0010, 0x0011, 0x0011, 0x0012, 0x0013, 0x0014, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018,
+  0x0018, 0x0019, 0x001a, 0x001a, 0x001b, 0x001c, 0x001d, 0x001d, 0x001e, 0x001f, 0x0020, 0x0020, 0x0021, 0x0022, 0x0023, 0x0023,
+  0x0024, 0x0025, 0x0026, 0x0026, 0x0027, 0x0028, 0x0029, 0x0029, 0x002a, 0x002b, 0x002b, 0x002c, 0x002d, 0x002e, 0x002e, 0x002f,
+  0x0030, 0x0030, 0x0031, 0x0032, 0x0032, 0x0033, 0x0034, 0x0035, 0x0035, 0x0036, 0x0037, 0x0037, 0x0038, 0x0039, 0x0039, 0x003a,
+  0x003b, 0x003b, 0x003c, 0x003d, 0x003d, 0x003e, 0x003f, 0x003f, 0x0040, 0x0041, 0x0041, 0x0042, 0x0043, 0x0043, 0x0044, 0x0045,
+  0x0045, 0x0046, 0x0046, 0x0047, 0x0048, 0x0048, 0x0049, 0x004a, 0x004a, 0x004b, 0x004b, 0x004c, 0x004d, 0x004d, 0x004e, 0x004f,
+  0x004f, 0x0050, 0x0050, 0x0051, 0x0051, 0x0052, 0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0056, 0x0056, 0x0056, 0x0057, 0x0058,
+  0x0058, 0x0059, 0x0059, 0x005a, 0x005a, 0x005b, 0x005b, 0x005c, 0x005c, 0x005d, 0x005d, 0x005e, 0x005e, 0x005f, 0x005f, 0x0060,
+  0x0060, 0x0061, 0x0061, 0x0062, 0x0062, 0x0063, 0x0063, 0x0064, 0x0064, 0x0065, 0x0065, 0x0065, 0x0066, 0x0066, 0x0067, 0x0067,
+  0x0068, 0x0068, 0x0069, 0x0069, 0x0069, 0x006a, 0x006a, 0x006b, 0x006b, 0x006b, 0x006c, 0x006c, 0x006c, 0x006d, 0x006d, 0x006e,
+  0x006e, 0x006e, 0x006f, 0x006f, 0x006f, 0x0070, 0x0070, 0x0070, 0x0071, 0x0071, 0x0071, 0x0071, 0x0072, 0x0072, 0x0072, 0x0073,
+  0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0075, 0x0075, 0x0075, 0x0075, 0x0076, 0x0076, 0x0076, 0x0076, 0x0077, 0x0077, 0x0077,
+  0x0077, 0x0077, 0x0077, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x007a, 0x007a, 0x007a,
+  0x007a, 0x007a, 0x007a, 0x007a, 0x007b, 0x007b, 0x007b, 0x007b, 0x007b, 0x007b, 0x007b, 0x007b, 0x007b, 0x007c, 0x007c, 0x007c,
+  0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c, 0x007c,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0004, 0x0004, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008, 0x0009, 0x000a, 0x000a, 0x000b,
+  0x000c, 0x000d, 0x000d, 0x000e, 0x000f, 0x0010, 0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0016, 0x0017,
+  0x0018, 0x0018, 0x0019, 0x001a, 0x001b, 0x001b, 0x001c, 0x001d, 0x001e, 0x001e, 0x001f, 0x0020, 0x0020, 0x0021, 0x0022, 0x0023,
+  0x0023, 0x0024, 0x0025, 0x0025, 0x0026, 0x0027, 0x0028, 0x0028, 0x0029, 0x002a, 0x002b, 0x002b, 0x002c, 0x002d, 0x002d, 0x002e,
+  0x002f, 0x002f, 0x0030, 0x0031, 0x0031, 0x0032, 0x0033, 0x0033, 0x0034, 0x0035, 0x0035, 0x0036, 0x0037, 0x0037, 0x0038, 0x0039,
+  0x0039, 0x003a, 0x003b, 0x003b, 0x003c, 0x003d, 0x003d, 0x003e, 0x003f, 0x003f, 0x0040, 0x0041, 0x0041, 0x0042, 0x0043, 0x0043,
+  0x0044, 0x0044, 0x0045, 0x0046, 0x0046, 0x0047, 0x0047, 0x0048, 0x0049, 0x0049, 0x004a, 0x004a, 0x004b, 0x004c, 0x004c, 0x004d,
+  0x004d, 0x004e, 0x004f, 0x004f, 0x0050, 0x0050, 0x0051, 0x0051, 0x0052, 0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0055, 0x0056,
+  0x0056, 0x0057, 0x0057, 0x0058, 0x0058, 0x0059, 0x0059, 0x005a, 0x005a, 0x005b, 0x005b, 0x005c, 0x005c, 0x005d, 0x005d, 0x005e,
+  0x005e, 0x005f, 0x005f, 0x0060, 0x0060, 0x0061, 0x0061, 0x0061, 0x0062, 0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0065, 0x0065,
+  0x0065, 0x0066, 0x0066, 0x0067, 0x0067, 0x0067, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069, 0x006a, 0x006a, 0x006b, 0x006b, 0x006b,
+  0x006b, 0x006c, 0x006c, 0x006d, 0x006d, 0x006d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006f, 0x006f, 0x006f, 0x0070, 0x0070, 0x0070,
+  0x0071, 0x0071, 0x0071, 0x0071, 0x0072, 0x0072, 0x0072, 0x0072, 0x0073, 0x0073, 0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0074,
+  0x0075, 0x0075, 0x0075, 0x0075, 0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077,
+  0x0077, 0x0077, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079,
+  0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x007a, 0x007a, 0x007a, 0x007a, 0x007a, 0x007a, 0x007a, 0x007a,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0004, 0x0004, 0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0009, 0x0009, 0x000a, 0x000b,
+  0x000c, 0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x0010, 0x0011, 0x0011, 0x0012, 0x0013, 0x0014, 0x0014, 0x0015, 0x0016, 0x0017,
+  0x0017, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b, 0x001c, 0x001c, 0x001d, 0x001e, 0x001e, 0x001f, 0x0020, 0x0020, 0x0021, 0x0022,
+  0x0023, 0x0023, 0x0024, 0x0025, 0x0025, 0x0026, 0x0027, 0x0027, 0x0028, 0x0029, 0x002a, 0x002a, 0x002b, 0x002c, 0x002c, 0x002d,
+  0x002e, 0x002e, 0x002f, 0x0030, 0x0030, 0x0031, 0x0032, 0x0032, 0x0033, 0x0034, 0x0034, 0x0035, 0x0036, 0x0036, 0x0037, 0x0038,
+  0x0038, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b, 0x003c, 0x003d, 0x003d, 0x003e, 0x003f, 0x003f, 0x0040, 0x0040, 0x0041, 0x0042,
+  0x0042, 0x0043, 0x0043, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046, 0x0047, 0x0048, 0x0048, 0x0049, 0x0049, 0x004a, 0x004b, 0x004b,
+  0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004f, 0x004f, 0x0050, 0x0050, 0x0051, 0x0051, 0x0052, 0x0052, 0x0053, 0x0053, 0x0054,
+  0x0054, 0x0055, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0058, 0x0058, 0x0059, 0x0059, 0x005a, 0x005a, 0x005b, 0x005b, 0x005c,
+  0x005c, 0x005d, 0x005d, 0x005e, 0x005e, 0x005f, 0x005f, 0x005f, 0x0060, 0x0060, 0x0061, 0x0061, 0x0061, 0x0062, 0x0063, 0x0063,
+  0x0063, 0x0064, 0x0064, 0x0064, 0x0065, 0x0065, 0x0065, 0x0066, 0x0066, 0x0067, 0x0067, 0x0067, 0x0068, 0x0068, 0x0069, 0x0069,
+  0x0069, 0x0069, 0x006a, 0x006a, 0x006b, 0x006b, 0x006b, 0x006b, 0x006c, 0x006c, 0x006c, 0x006d, 0x006d, 0x006d, 0x006e, 0x006e,
+  0x006e, 0x006e, 0x006f, 0x006f, 0x006f, 0x0070, 0x0070, 0x0070, 0x0070, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0072, 0x0072,
+  0x0072, 0x0072, 0x0072, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0075, 0x0075, 0x0075,
+  0x0075, 0x0075, 0x0075, 0x0075, 0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0076, 0x0077, 0x0077, 0x0077,
+  0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0003, 0x0004, 0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0008, 0x0009, 0x000a, 0x000b,
+  0x000b, 0x000c, 0x000d, 0x000d, 0x000e, 0x000f, 0x0010, 0x0010, 0x0011, 0x0012, 0x0012, 0x0013, 0x0014, 0x0015, 0x0015, 0x0016,
+  0x0017, 0x0017, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b, 0x001c, 0x001c, 0x001d, 0x001e, 0x001e, 0x001f, 0x0020, 0x0020, 0x0021,
+  0x0022, 0x0023, 0x0023, 0x0024, 0x0025, 0x0025, 0x0026, 0x0027, 0x0027, 0x0028, 0x0029, 0x0029, 0x002a, 0x002b, 0x002b, 0x002c,
+  0x002d, 0x002d, 0x002e, 0x002f, 0x002f, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0033, 0x0034, 0x0034, 0x0035, 0x0036, 0x0036,
+  0x0037, 0x0038, 0x0038, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b, 0x003c, 0x003d, 0x003d, 0x003e, 0x003e, 0x003f, 0x0040, 0x0040,
+  0x0041, 0x0041, 0x0042, 0x0043, 0x0043, 0x0044, 0x0044, 0x0045, 0x0046, 0x0046, 0x0047, 0x0047, 0x0048, 0x0048, 0x0049, 0x004a,
+  0x004a, 0x004b, 0x004b, 0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e, 0x004f, 0x004f, 0x0050, 0x0051, 0x0051, 0x0052, 0x0052,
+  0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0058, 0x0058, 0x0059, 0x0059, 0x005a,
+  0x005a, 0x005b, 0x005b, 0x005c, 0x005c, 0x005d, 0x005d, 0x005d, 0x005e, 0x005e, 0x005f, 0x005f, 0x005f, 0x0060, 0x0060, 0x0061,
+  0x0061, 0x0061, 0x0062, 0x0062, 0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0064, 0x0065, 0x0065, 0x0065, 0x0066, 0x0066, 0x0067,
+  0x0067, 0x0067, 0x0068, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069, 0x0069, 0x006a, 0x006a, 0x006a, 0x006b, 0x006b, 0x006b, 0x006b,
+  0x006c, 0x006c, 0x006c, 0x006d, 0x006d, 0x006d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f,
+  0x0070, 0x0070, 0x0070, 0x0070, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+  0x0072, 0x0072, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074,
+  0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0008, 0x0008, 0x0009, 0x000a, 0x000a,
+  0x000b, 0x000c, 0x000c, 0x000d, 0x000e, 0x000f, 0x000f, 0x0010, 0x0011, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016,
+  0x0016, 0x0017, 0x0018, 0x0018, 0x0019, 0x001a, 0x001a, 0x001b, 0x001c, 0x001c, 0x001d, 0x001e, 0x001e, 0x001f, 0x0020, 0x0020,
+  0x0021, 0x0022, 0x0022, 0x0023, 0x0024, 0x0024, 0x0025, 0x0026, 0x0026, 0x0027, 0x0028, 0x0028, 0x0029, 0x002a, 0x002a, 0x002b,
+  0x002c, 0x002c, 0x002d, 0x002e, 0x002e, 0x002f, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0033, 0x0033, 0x0034, 0x0035, 0x0035,
+  0x0036, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b, 0x003c, 0x003c, 0x003d, 0x003e, 0x003e, 0x003f,
+  0x0040, 0x0040, 0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046, 0x0047, 0x0047, 0x0048,
+  0x0048, 0x0049, 0x004a, 0x004a, 0x004b, 0x004b, 0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e, 0x004f, 0x004f, 0x0050, 0x0050,
+  0x0051, 0x0051, 0x0052, 0x0052, 0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0058,
+  0x0058, 0x0059, 0x0059, 0x005a, 0x005a, 0x005b, 0x005b, 0x005b, 0x005c, 0x005c, 0x005d, 0x005d, 0x005d, 0x005e, 0x005e, 0x005f,
+  0x005f, 0x005f, 0x0060, 0x0060, 0x0060, 0x0061, 0x0061, 0x0062, 0x0062, 0x0062, 0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0064,
+  0x0065, 0x0065, 0x0065, 0x0066, 0x0066, 0x0066, 0x0067, 0x0067, 0x0067, 0x0067, 0x0068, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069,
+  0x0069, 0x006a, 0x006a, 0x006a, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006c, 0x006c, 0x006c, 0x006c, 0x006d, 0x006d, 0x006d,
+  0x006d, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x0070, 0x0070, 0x0070,
+  0x0070, 0x0070, 0x0070, 0x0070, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071, 0x0071,
+  0x0071, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008, 0x0009, 0x0009, 0x000a,
+  0x000b, 0x000c, 0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x0010, 0x0010, 0x0011, 0x0012, 0x0012, 0x0013, 0x0014, 0x0014, 0x0015,
+  0x0016, 0x0016, 0x0017, 0x0018, 0x0018, 0x0019, 0x001a, 0x001a, 0x001b, 0x001c, 0x001c, 0x001d, 0x001e, 0x001e, 0x001f, 0x0020,
+  0x0020, 0x0021, 0x0022, 0x0022, 0x0023, 0x0024, 0x0024, 0x0025, 0x0026, 0x0026, 0x0027, 0x0028, 0x0028, 0x0029, 0x0029, 0x002a,
+  0x002b, 0x002b, 0x002c, 0x002d, 0x002d, 0x002e, 0x002f, 0x002f, 0x0030, 0x0030, 0x0031, 0x0032, 0x0032, 0x0033, 0x0033, 0x0034,
+  0x0035, 0x0035, 0x0036, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003b, 0x003b, 0x003c, 0x003c, 0x003d, 0x003d,
+  0x003e, 0x003f, 0x003f, 0x0040, 0x0040, 0x0041, 0x0041, 0x0042, 0x0043, 0x0043, 0x0044, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046,
+  0x0047, 0x0047, 0x0048, 0x0048, 0x0049, 0x004a, 0x004a, 0x004b, 0x004b, 0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e, 0x004f,
+  0x004f, 0x004f, 0x0050, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052, 0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0055, 0x0056, 0x0056,
+  0x0056, 0x0057, 0x0057, 0x0058, 0x0058, 0x0059, 0x0059, 0x0059, 0x005a, 0x005a, 0x005b, 0x005b, 0x005b, 0x005c, 0x005c, 0x005d,
+  0x005d, 0x005d, 0x005e, 0x005e, 0x005e, 0x005f, 0x005f, 0x0060, 0x0060, 0x0060, 0x0061, 0x0061, 0x0061, 0x0062, 0x0062, 0x0062,
+  0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0064, 0x0064, 0x0065, 0x0065, 0x0065, 0x0065, 0x0066, 0x0066, 0x0066, 0x0067, 0x0067,
+  0x0067, 0x0067, 0x0068, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x006a, 0x006a, 0x006a, 0x006a, 0x006b, 0x006b,
+  0x006b, 0x006b, 0x006b, 0x006b, 0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006e,
+  0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f,
+  0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008, 0x0009, 0x0009, 0x000a,
+  0x000b, 0x000b, 0x000c, 0x000d, 0x000d, 0x000e, 0x000f, 0x000f, 0x0010, 0x0011, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015,
+  0x0015, 0x0016, 0x0017, 0x0017, 0x0018, 0x0019, 0x0019, 0x001a, 0x001a, 0x001b, 0x001c, 0x001c, 0x001d, 0x001e, 0x001e, 0x001f,
+  0x0020, 0x0020, 0x0021, 0x0022, 0x0022, 0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0026, 0x0027, 0x0027, 0x0028, 0x0029, 0x0029,
+  0x002a, 0x002a, 0x002b, 0x002c, 0x002c, 0x002d, 0x002e, 0x002e, 0x002f, 0x002f, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0033,
+  0x0033, 0x0034, 0x0035, 0x0035, 0x0036, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003b, 0x003b, 0x003c, 0x003c,
+  0x003d, 0x003d, 0x003e, 0x003e, 0x003f, 0x0040, 0x0040, 0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043, 0x0044, 0x0044, 0x0045,
+  0x0045, 0x0046, 0x0046, 0x0047, 0x0047, 0x0048, 0x0048, 0x0049, 0x0049, 0x004a, 0x004a, 0x004b, 0x004b, 0x004c, 0x004c, 0x004d,
+  0x004d, 0x004e, 0x004e, 0x004f, 0x004f, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052, 0x0053, 0x0053, 0x0054, 0x0054,
+  0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0057, 0x0057, 0x0057, 0x0058, 0x0058, 0x0059, 0x0059, 0x0059, 0x005a, 0x005a, 0x005b,
+  0x005b, 0x005b, 0x005c, 0x005c, 0x005c, 0x005d, 0x005d, 0x005e, 0x005e, 0x005e, 0x005f, 0x005f, 0x005f, 0x0060, 0x0060, 0x0060,
+  0x0060, 0x0061, 0x0061, 0x0061, 0x0062, 0x0062, 0x0062, 0x0063, 0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0064, 0x0064, 0x0065,
+  0x0065, 0x0065, 0x0065, 0x0066, 0x0066, 0x0066, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068,
+  0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x006a, 0x006a, 0x006a, 0x006a, 0x006a, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b,
+  0x006b, 0x006b, 0x006b, 0x006b, 0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x006d, 0x006d, 0x006d,
+  0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d, 0x006d,
+  0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0004, 0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0008, 0x0009, 0x000a,
+  0x000a, 0x000b, 0x000c, 0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x0010, 0x0010, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014,
+  0x0015, 0x0015, 0x0016, 0x0017, 0x0017, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001e, 0x001e,
+  0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022, 0x0023, 0x0023, 0x0024, 0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0028, 0x0028,
+  0x0029, 0x0029, 0x002a, 0x002b, 0x002b, 0x002c, 0x002d, 0x002d, 0x002e, 0x002e, 0x002f, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032,
+  0x0032, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003a, 0x003b,
+  0x003b, 0x003c, 0x003c, 0x003d, 0x003e, 0x003e, 0x003f, 0x003f, 0x0040, 0x0040, 0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043,
+  0x0044, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046, 0x0047, 0x0047, 0x0048, 0x0048, 0x0049, 0x0049, 0x004a, 0x004a, 0x004b, 0x004b,
+  0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052,
+  0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0057, 0x0058, 0x0058, 0x0059,
+  0x0059, 0x0059, 0x005a, 0x005a, 0x005a, 0x005b, 0x005b, 0x005c, 0x005c, 0x005c, 0x005d, 0x005d, 0x005d, 0x005e, 0x005e, 0x005e,
+  0x005e, 0x005f, 0x005f, 0x005f, 0x0060, 0x0060, 0x0060, 0x0060, 0x0061, 0x0061, 0x0061, 0x0061, 0x0062, 0x0062, 0x0062, 0x0063,
+  0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069,
+  0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x006a, 0x006a, 0x006a, 0x006a, 0x006a, 0x006a, 0x006a, 0x006a, 0x006a,
+  0x006a, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b,
+  0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0004, 0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0008, 0x0009, 0x0009,
+  0x000a, 0x000b, 0x000b, 0x000c, 0x000d, 0x000d, 0x000e, 0x000f, 0x000f, 0x0010, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0014,
+  0x0014, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001e,
+  0x001e, 0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027,
+  0x0028, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002c, 0x002c, 0x002d, 0x002d, 0x002e, 0x002f, 0x002f, 0x0030, 0x0030, 0x0031,
+  0x0031, 0x0032, 0x0032, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039, 0x003a,
+  0x003a, 0x003b, 0x003b, 0x003c, 0x003c, 0x003d, 0x003d, 0x003e, 0x003e, 0x003f, 0x003f, 0x0040, 0x0040, 0x0041, 0x0041, 0x0042,
+  0x0042, 0x0043, 0x0043, 0x0044, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046, 0x0047, 0x0047, 0x0048, 0x0048, 0x0049, 0x0049, 0x004a,
+  0x004a, 0x004a, 0x004b, 0x004b, 0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x0050, 0x0050, 0x0051,
+  0x0051, 0x0051, 0x0052, 0x0052, 0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0057,
+  0x0057, 0x0057, 0x0058, 0x0058, 0x0058, 0x0059, 0x0059, 0x005a, 0x005a, 0x005a, 0x005b, 0x005b, 0x005b, 0x005c, 0x005c, 0x005c,
+  0x005c, 0x005d, 0x005d, 0x005d, 0x005e, 0x005e, 0x005e, 0x005e, 0x005f, 0x005f, 0x005f, 0x005f, 0x0060, 0x0060, 0x0060, 0x0060,
+  0x0061, 0x0061, 0x0061, 0x0061, 0x0062, 0x0062, 0x0062, 0x0062, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0064,
+  0x0064, 0x0064, 0x0064, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0067,
+  0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+  0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069,
+  0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008, 0x0009, 0x0009,
+  0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x0010, 0x0010, 0x0011, 0x0011, 0x0012, 0x0013, 0x0013,
+  0x0014, 0x0014, 0x0015, 0x0016, 0x0016, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001d,
+  0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0026, 0x0027,
+  0x0027, 0x0028, 0x0028, 0x0029, 0x0029, 0x002a, 0x002b, 0x002b, 0x002c, 0x002c, 0x002d, 0x002e, 0x002e, 0x002f, 0x002f, 0x0030,
+  0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0038, 0x0038,
+  0x0039, 0x0039, 0x003a, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003d, 0x003d, 0x003e, 0x003e, 0x003f, 0x0040, 0x0040, 0x0041,
+  0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043, 0x0044, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046, 0x0047, 0x0047, 0x0048, 0x0048,
+  0x0048, 0x0049, 0x0049, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004f,
+  0x004f, 0x0050, 0x0050, 0x0050, 0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0055, 0x0055,
+  0x0055, 0x0056, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0058, 0x0058, 0x0058, 0x0059, 0x0059, 0x0059, 0x005a, 0x005a, 0x005a,
+  0x005a, 0x005b, 0x005b, 0x005b, 0x005c, 0x005c, 0x005c, 0x005c, 0x005d, 0x005d, 0x005d, 0x005d, 0x005e, 0x005e, 0x005e, 0x005e,
+  0x005f, 0x005f, 0x005f, 0x005f, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0062, 0x0062,
+  0x0062, 0x0062, 0x0062, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064,
+  0x0064, 0x0064, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0066, 0x0066, 0x0066,
+  0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066, 0x0066,
+  0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008, 0x0008, 0x0009,
+  0x000a, 0x000a, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0011, 0x0012, 0x0012, 0x0013,
+  0x0013, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c,
+  0x001d, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023, 0x0024, 0x0025, 0x0025, 0x0026,
+  0x0026, 0x0027, 0x0027, 0x0028, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002c, 0x002d, 0x002d, 0x002e, 0x002e, 0x002f,
+  0x002f, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0033, 0x0033, 0x0034, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0037,
+  0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b, 0x003c, 0x003c, 0x003d, 0x003d, 0x003e, 0x003e, 0x003f, 0x003f,
+  0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043, 0x0044, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046,
+  0x0047, 0x0047, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004c, 0x004c, 0x004d, 0x004d,
+  0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x004f, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0053, 0x0053,
+  0x0053, 0x0054, 0x0054, 0x0054, 0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0057, 0x0058, 0x0058, 0x0058,
+  0x0058, 0x0059, 0x0059, 0x0059, 0x005a, 0x005a, 0x005a, 0x005a, 0x005b, 0x005b, 0x005b, 0x005b, 0x005c, 0x005c, 0x005c, 0x005c,
+  0x005d, 0x005d, 0x005d, 0x005d, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x0060, 0x0060,
+  0x0060, 0x0060, 0x0060, 0x0060, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062,
+  0x0062, 0x0062, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0064, 0x0064, 0x0064,
+  0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064,
+  0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0008, 0x0009,
+  0x0009, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0011, 0x0011, 0x0012, 0x0012,
+  0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b, 0x001b, 0x001c,
+  0x001c, 0x001d, 0x001d, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025,
+  0x0025, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002c, 0x002c, 0x002d, 0x002d, 0x002e,
+  0x002e, 0x002f, 0x002f, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0033, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035, 0x0036,
+  0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b, 0x003c, 0x003c, 0x003d, 0x003d, 0x003e,
+  0x003e, 0x003f, 0x003f, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043, 0x0044, 0x0044, 0x0045, 0x0045,
+  0x0045, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b,
+  0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x004f, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051,
+  0x0052, 0x0052, 0x0052, 0x0053, 0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0054, 0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056,
+  0x0056, 0x0057, 0x0057, 0x0057, 0x0058, 0x0058, 0x0058, 0x0058, 0x0059, 0x0059, 0x0059, 0x0059, 0x005a, 0x005a, 0x005a, 0x005a,
+  0x005b, 0x005b, 0x005b, 0x005b, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005e, 0x005e,
+  0x005e, 0x005e, 0x005e, 0x005e, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+  0x0060, 0x0060, 0x0060, 0x0060, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061,
+  0x0061, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062,
+  0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007, 0x0007, 0x0008, 0x0009,
+  0x0009, 0x000a, 0x000a, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000f, 0x0010, 0x0010, 0x0011, 0x0011, 0x0012,
+  0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b, 0x001b,
+  0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0024, 0x0024,
+  0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028, 0x0029, 0x0029, 0x002a, 0x002b, 0x002b, 0x002c, 0x002c, 0x002d,
+  0x002d, 0x002e, 0x002e, 0x002f, 0x002f, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0033, 0x0033, 0x0034, 0x0034, 0x0035,
+  0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c,
+  0x003d, 0x003d, 0x003e, 0x003e, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043,
+  0x0044, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x004a,
+  0x004a, 0x004b, 0x004b, 0x004b, 0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x004f,
+  0x0050, 0x0050, 0x0051, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0053, 0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0054,
+  0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0057, 0x0057, 0x0058, 0x0058, 0x0058, 0x0058,
+  0x0059, 0x0059, 0x0059, 0x0059, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005c, 0x005c,
+  0x005c, 0x005c, 0x005c, 0x005c, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e,
+  0x005e, 0x005e, 0x005e, 0x005e, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f, 0x005f,
+  0x005f, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+  0x0000, 0x0000, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0006, 0x0006, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0011, 0x0012,
+  0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001b,
+  0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001e, 0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023,
+  0x0024, 0x0024, 0x0025, 0x0025, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002c,
+  0x002c, 0x002d, 0x002d, 0x002e, 0x002e, 0x002f, 0x002f, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0033, 0x0033, 0x0034,
+  0x0034, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b,
+  0x003b, 0x003c, 0x003c, 0x003d, 0x003d, 0x003e, 0x003e, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0042, 0x0042,
+  0x0042, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048,
+  0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e,
+  0x004e, 0x004e, 0x004f, 0x004f, 0x004f, 0x0050, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0054, 0x0054, 0x0055, 0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056,
+  0x0057, 0x0057, 0x0057, 0x0057, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x005a, 0x005a,
+  0x005a, 0x005a, 0x005a, 0x005a, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c,
+  0x005c, 0x005c, 0x005c, 0x005c, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d, 0x005d,
+  0x005d, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e, 0x005e,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0009, 0x0009, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000f, 0x0010, 0x0010, 0x0011, 0x0011,
+  0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a,
+  0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022, 0x0023,
+  0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b,
+  0x002b, 0x002c, 0x002c, 0x002d, 0x002d, 0x002e, 0x002e, 0x002f, 0x002f, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032,
+  0x0033, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a,
+  0x003a, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x0040, 0x0040, 0x0041,
+  0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0047,
+  0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004c, 0x004c,
+  0x004c, 0x004d, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x004f, 0x004f, 0x0050, 0x0050, 0x0050, 0x0051, 0x0051,
+  0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0052, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0054, 0x0054, 0x0055,
+  0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0058, 0x0058,
+  0x0058, 0x0058, 0x0058, 0x0058, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+  0x005a, 0x005a, 0x005a, 0x005a, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b, 0x005b,
+  0x005b, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c, 0x005c,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007, 0x0008, 0x0008,
+  0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0011,
+  0x0011, 0x0012, 0x0012, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019,
+  0x001a, 0x001a, 0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022,
+  0x0022, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028, 0x0029, 0x0029, 0x002a,
+  0x002a, 0x002b, 0x002b, 0x002c, 0x002c, 0x002d, 0x002d, 0x002e, 0x002e, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031,
+  0x0032, 0x0032, 0x0033, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039,
+  0x0039, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f,
+  0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045,
+  0x0046, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004a,
+  0x004b, 0x004b, 0x004b, 0x004c, 0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x004f,
+  0x004f, 0x004f, 0x0050, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0052, 0x0053, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056,
+  0x0056, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058,
+  0x0058, 0x0058, 0x0058, 0x0058, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059, 0x0059,
+  0x0059, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a, 0x005a,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007, 0x0007, 0x0008,
+  0x0008, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010,
+  0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019,
+  0x0019, 0x001a, 0x001a, 0x001b, 0x001b, 0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0021, 0x0021,
+  0x0022, 0x0022, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0029,
+  0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002c, 0x002c, 0x002d, 0x002d, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030,
+  0x0031, 0x0031, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037,
+  0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003e,
+  0x003e, 0x003e, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0044,
+  0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0049, 0x0049,
+  0x0049, 0x0049, 0x004a, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004b, 0x004c, 0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004d,
+  0x004e, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x0050, 0x0050, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051,
+  0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0052, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0054,
+  0x0054, 0x0054, 0x0054, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056,
+  0x0056, 0x0056, 0x0056, 0x0056, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057, 0x0057,
+  0x0057, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058, 0x0058,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007, 0x0007, 0x0008,
+  0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010,
+  0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018,
+  0x0019, 0x0019, 0x001a, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020,
+  0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028,
+  0x0028, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002c, 0x002c, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f,
+  0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0036, 0x0036,
+  0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c,
+  0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042,
+  0x0043, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047,
+  0x0048, 0x0048, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004b, 0x004c,
+  0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x004f, 0x004f,
+  0x004f, 0x0050, 0x0050, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0052,
+  0x0052, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054,
+  0x0054, 0x0054, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056,
+  0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056, 0x0056,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0007, 0x0008,
+  0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010,
+  0x0010, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018,
+  0x0018, 0x0019, 0x0019, 0x001a, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020,
+  0x0020, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027,
+  0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e,
+  0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035,
+  0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b,
+  0x003b, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0041,
+  0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0046, 0x0046,
+  0x0046, 0x0046, 0x0047, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004a,
+  0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004b, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004d, 0x004d, 0x004e,
+  0x004e, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+  0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0053,
+  0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0053, 0x0054, 0x0054, 0x0054,
+  0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f,
+  0x0010, 0x0010, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017,
+  0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001f,
+  0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026,
+  0x0027, 0x0027, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d,
+  0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034,
+  0x0034, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003a,
+  0x003a, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f,
+  0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044,
+  0x0045, 0x0045, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048,
+  0x0049, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004c, 0x004c,
+  0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f,
+  0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051,
+  0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+  0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052, 0x0052,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f,
+  0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017,
+  0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001e,
+  0x001f, 0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025,
+  0x0026, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c,
+  0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0033,
+  0x0033, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0039,
+  0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e,
+  0x003e, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0043, 0x0043,
+  0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047,
+  0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004a, 0x004a,
+  0x004a, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004d,
+  0x004d, 0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f,
+  0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+  0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051, 0x0051,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000f,
+  0x000f, 0x0010, 0x0010, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016,
+  0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e,
+  0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025,
+  0x0025, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b,
+  0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032,
+  0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037,
+  0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003d,
+  0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041,
+  0x0042, 0x0042, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0045,
+  0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0049,
+  0x0049, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b,
+  0x004b, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d,
+  0x004d, 0x004d, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e, 0x004e,
+  0x004e, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007,
+  0x0007, 0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e,
+  0x000f, 0x000f, 0x0010, 0x0010, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016,
+  0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001d,
+  0x001d, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0024,
+  0x0024, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a,
+  0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0031,
+  0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036,
+  0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b,
+  0x003c, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040,
+  0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044,
+  0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047,
+  0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a,
+  0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004c,
+  0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004c, 0x004d, 0x004d, 0x004d,
+  0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d, 0x004d,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007,
+  0x0007, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e,
+  0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015,
+  0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c,
+  0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023,
+  0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029,
+  0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x0030,
+  0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035,
+  0x0035, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a,
+  0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003e,
+  0x003f, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0042,
+  0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0046,
+  0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048,
+  0x0048, 0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a,
+  0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b,
+  0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b, 0x004b,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0007,
+  0x0007, 0x0007, 0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e,
+  0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0015,
+  0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001c,
+  0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022,
+  0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0029,
+  0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002f,
+  0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034,
+  0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039,
+  0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d,
+  0x003d, 0x003e, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041,
+  0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044,
+  0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046,
+  0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048,
+  0x0048, 0x0048, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049,
+  0x0049, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a, 0x004a,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d,
+  0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014,
+  0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001b, 0x001b,
+  0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0022,
+  0x0022, 0x0022, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0028,
+  0x0028, 0x0028, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002e,
+  0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033,
+  0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0038,
+  0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c,
+  0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x003f, 0x0040,
+  0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0043,
+  0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0045,
+  0x0045, 0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047,
+  0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048,
+  0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048, 0x0048,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d, 0x000d,
+  0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014,
+  0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a,
+  0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0021,
+  0x0021, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0027, 0x0027,
+  0x0027, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002d,
+  0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032,
+  0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036,
+  0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a, 0x003b,
+  0x003b, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e,
+  0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0041,
+  0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043,
+  0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045,
+  0x0045, 0x0045, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046,
+  0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0046, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047, 0x0047,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000d,
+  0x000d, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013,
+  0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001a,
+  0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020,
+  0x0020, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026,
+  0x0026, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002c,
+  0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0031,
+  0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035,
+  0x0035, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039,
+  0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d,
+  0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040,
+  0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0042,
+  0x0042, 0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044,
+  0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045,
+  0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006, 0x0006,
+  0x0006, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000d,
+  0x000d, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013, 0x0013,
+  0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019,
+  0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f,
+  0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025,
+  0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002b,
+  0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x0030,
+  0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034,
+  0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038,
+  0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b,
+  0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e,
+  0x003e, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041,
+  0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042,
+  0x0042, 0x0042, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043,
+  0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c,
+  0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0013,
+  0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0019,
+  0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f,
+  0x001f, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024,
+  0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a,
+  0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002f,
+  0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033,
+  0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037,
+  0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a,
+  0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d,
+  0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f,
+  0x003f, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041,
+  0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042,
+  0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042, 0x0042,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c, 0x000c,
+  0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012,
+  0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018,
+  0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e,
+  0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0024,
+  0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0029,
+  0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002e,
+  0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032,
+  0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036,
+  0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039,
+  0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003c,
+  0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e,
+  0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x0040,
+  0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+  0x0040, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000c,
+  0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012,
+  0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018,
+  0x0018, 0x0018, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d,
+  0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028,
+  0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+  0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034,
+  0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038,
+  0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a,
+  0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c,
+  0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e,
+  0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f,
+  0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f, 0x003f,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005,
+  0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000c,
+  0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011,
+  0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017,
+  0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001d,
+  0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022,
+  0x0022, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027,
+  0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c,
+  0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030,
+  0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033,
+  0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0037,
+  0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x0039,
+  0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b,
+  0x003b, 0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d,
+  0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003e, 0x003e, 0x003e,
+  0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e, 0x003e,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005,
+  0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b,
+  0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011,
+  0x0011, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017,
+  0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c,
+  0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021,
+  0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026,
+  0x0026, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f,
+  0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032,
+  0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035,
+  0x0035, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038,
+  0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a,
+  0x003a, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b,
+  0x003b, 0x003b, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c,
+  0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d, 0x003d,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005,
+  0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b,
+  0x000b, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011,
+  0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016,
+  0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c,
+  0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025,
+  0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a,
+  0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e,
+  0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031,
+  0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034,
+  0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037,
+  0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039,
+  0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a,
+  0x003a, 0x003a, 0x003a, 0x003a, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b,
+  0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b, 0x003b,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005,
+  0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000b,
+  0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010,
+  0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016,
+  0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b,
+  0x001b, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0025,
+  0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029,
+  0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030,
+  0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033,
+  0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035,
+  0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037,
+  0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+  0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a,
+  0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a, 0x003a,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005,
+  0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000b,
+  0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010,
+  0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015,
+  0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a,
+  0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024,
+  0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028,
+  0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c,
+  0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f,
+  0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032,
+  0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034,
+  0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036,
+  0x0036, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038,
+  0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038,
+  0x0038, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005,
+  0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a,
+  0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010,
+  0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015,
+  0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a,
+  0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e,
+  0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027,
+  0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e,
+  0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031,
+  0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033,
+  0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035,
+  0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0037,
+  0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037,
+  0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038, 0x0038,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005,
+  0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a,
+  0x000a, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f,
+  0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014,
+  0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022,
+  0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026,
+  0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a,
+  0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030,
+  0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+  0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034,
+  0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035,
+  0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036,
+  0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0005,
+  0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a,
+  0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f,
+  0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019,
+  0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025,
+  0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029,
+  0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c,
+  0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f,
+  0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0031,
+  0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033,
+  0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034,
+  0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035,
+  0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x000a,
+  0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000f,
+  0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025,
+  0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028,
+  0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e,
+  0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030,
+  0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032,
+  0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033,
+  0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034,
+  0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004,
+  0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009,
+  0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013,
+  0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024,
+  0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027,
+  0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a,
+  0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f,
+  0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031,
+  0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+  0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033,
+  0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004,
+  0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e,
+  0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026,
+  0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c,
+  0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e,
+  0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030,
+  0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+  0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0032, 0x0032,
+  0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009,
+  0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022,
+  0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025,
+  0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+  0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f,
+  0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+  0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+  0x0030, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
+  0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025,
+  0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027,
+  0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a,
+  0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c,
+  0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e,
+  0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f,
+  0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f,
+  0x002f, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d,
+  0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024,
+  0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027,
+  0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e,
+  0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e,
+  0x002e, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f, 0x002f,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d,
+  0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011,
+  0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026,
+  0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+  0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a,
+  0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c,
+  0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x002d, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025,
+  0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027,
+  0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c,
+  0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c,
+  0x002c, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d, 0x002d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004,
+  0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022,
+  0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+  0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026,
+  0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+  0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a,
+  0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c, 0x002c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026,
+  0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027,
+  0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a,
+  0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002b, 0x002b, 0x002b,
+  0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b, 0x002b,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025,
+  0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027,
+  0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+  0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x002a, 0x002a, 0x002a,
+  0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a, 0x002a,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022,
+  0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024,
+  0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026,
+  0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027,
+  0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+  0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025,
+  0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026,
+  0x0026, 0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027,
+  0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+  0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028, 0x0028,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+  0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025,
+  0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026,
+  0x0026, 0x0026, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027,
+  0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027, 0x0027,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022,
+  0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025,
+  0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0026,
+  0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026,
+  0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024,
+  0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025,
+  0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025,
+  0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e,
+  0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022,
+  0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+  0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+  0x0024, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025, 0x0025,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+  0x0022, 0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+  0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+  0x0022, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022,
+  0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+  0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e,
+  0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e,
+  0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e, 0x001e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c, 0x001c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0019, 0x0019, 0x0019,
+  0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017, 0x0017,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0015, 0x0015, 0x0015,
+  0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015, 0x0015,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012, 0x0012,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f, 0x000f,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e, 0x000e,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+};
+
+static const INT32 lfo_pm_table[128*8*32] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+  0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+  0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+  0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+  0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+  0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+  0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+  0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+  0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+  0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+  0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -3, -3, -2, -2, -2, -1, -1, 0, 0,
+  0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+  0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -3, -3, -1, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+  0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+  0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -3, -3, -1, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+  0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+  0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -3, -3, -1, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+  0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+  0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -3, -3, -1, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 3, 4, 4, 3, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -3, -4, -4, -3, -3, -3, -1, -1, 0, 0,
+  0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+  0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+  0, 0, 1, 2, 2, 2, 3, 4, 4, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -4, -4, -3, -2, -2, -2, -1, 0, 0,
+  0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+  0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+  0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+  0, 0, 1, 2, 2, 2, 3, 4, 4, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -4, -4, -3, -2, -2, -2, -1, 0, 0,
+  0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+  0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+  0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+  0, 0, 1, 2, 2, 2, 3, 4, 4, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -4, -4, -3, -2, -2, -2, -1, 0, 0,
+  0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+  0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+  0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+  0, 0, 1, 2, 2, 2, 3, 4, 4, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -4, -4, -3, -2, -2, -2, -1, 0, 0,
+  0, 0, 2, 3, 4, 4, 5, 6, 6, 5, 4, 4, 3, 2, 0, 0, 0, 0, -2, -3, -4, -4, -5, -6, -6, -5, -4, -4, -3, -2, 0, 0,
+  0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+  0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+  0, 0, 1, 2, 2, 2, 3, 5, 5, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -5, -5, -3, -2, -2, -2, -1, 0, 0,
+  0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+  0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+  0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+  0, 0, 1, 2, 2, 2, 3, 5, 5, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -5, -5, -3, -2, -2, -2, -1, 0, 0,
+  0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+  0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+  0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+  0, 0, 1, 2, 2, 2, 3, 5, 5, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -5, -5, -3, -2, -2, -2, -1, 0, 0,
+  0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+  0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+  0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -2, -2, -3, -3, -3, -3, -2, -2, -1, -1, 0, 0,
+  0, 0, 1, 2, 2, 2, 3, 5, 5, 3, 2, 2, 2, 1, 0, 0, 0, 0, -1, -2, -2, -2, -3, -5, -5, -3, -2, -2, -2, -1, 0, 0,
+  0, 0, 2, 3, 5, 5, 6, 7, 7, 6, 5, 5, 3, 2, 0, 0, 0, 0, -2, -3, -5, -5, -6, -7, -7, -6, -5, -5, -3, -2, 0, 0,
+  0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+  0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+  0, 0, 1, 3, 3, 3, 4, 6, 6, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -6, -6, -4, -3, -3, -3, -1, 0, 0,
+  0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+  0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+  0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+  0, 0, 1, 3, 3, 3, 4, 6, 6, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -6, -6, -4, -3, -3, -3, -1, 0, 0,
+  0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+  0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+  0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+  0, 0, 1, 3, 3, 3, 4, 6, 6, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -6, -6, -4, -3, -3, -3, -1, 0, 0,
+  0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+  0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+  0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+  0, 0, 1, 3, 3, 3, 4, 6, 6, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -6, -6, -4, -3, -3, -3, -1, 0, 0,
+  0, 0, 3, 4, 6, 6, 7, 9, 9, 7, 6, 6, 4, 3, 0, 0, 0, 0, -3, -4, -6, -6, -7, -9, -9, -7, -6, -6, -4, -3, 0, 0,
+  0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+  0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+  0, 0, 1, 3, 3, 3, 4, 7, 7, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -7, -7, -4, -3, -3, -3, -1, 0, 0,
+  0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+  0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+  0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+  0, 0, 1, 3, 3, 3, 4, 7, 7, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -7, -7, -4, -3, -3, -3, -1, 0, 0,
+  0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+  0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+  0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+  0, 0, 1, 3, 3, 3, 4, 7, 7, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -7, -7, -4, -3, -3, -3, -1, 0, 0,
+  0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+  0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+  0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+  0, 0, 0, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -3, -3, -1, -1, -1, 0, 0, 0,
+  0, 0, 1, 1, 3, 3, 4, 4, 4, 4, 3, 3, 1, 1, 0, 0, 0, 0, -1, -1, -3, -3, -4, -4, -4, -4, -3, -3, -1, -1, 0, 0,
+  0, 0, 1, 3, 3, 3, 4, 7, 7, 4, 3, 3, 3, 1, 0, 0, 0, 0, -1, -3, -3, -3, -4, -7, -7, -4, -3, -3, -3, -1, 0, 0,
+  0, 0, 3, 4, 7, 7, 8, 10, 10, 8, 7, 7, 4, 3, 0, 0, 0, 0, -3, -4, -7, -7, -8, -10, -10, -8, -7, -7, -4, -3, 0, 0,
+  0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+  0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+  0, 0, 2, 4, 4, 4, 6, 8, 8, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -8, -8, -6, -4, -4, -4, -2, 0, 0,
+  0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+  0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+  0, 0, 16, 24, 32, 32, 40, 48, 48, 40, 32, 32, 24, 16, 0, 0, 0, 0, -16, -24, -32, -32, -40, -48, -48, -40, -32, -32, -24, -16, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+  0, 0, 2, 4, 4, 4, 6, 8, 8, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -8, -8, -6, -4, -4, -4, -2, 0, 0,
+  0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+  0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+  0, 0, 16, 24, 33, 33, 41, 49, 49, 41, 33, 33, 24, 16, 0, 0, 0, 0, -16, -24, -33, -33, -41, -49, -49, -41, -33, -33, -24, -16, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+  0, 0, 2, 4, 4, 4, 6, 8, 8, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -8, -8, -6, -4, -4, -4, -2, 0, 0,
+  0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+  0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+  0, 0, 17, 25, 34, 34, 42, 51, 51, 42, 34, 34, 25, 17, 0, 0, 0, 0, -17, -25, -34, -34, -42, -51, -51, -42, -34, -34, -25, -17, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+  0, 0, 2, 4, 4, 4, 6, 8, 8, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -8, -8, -6, -4, -4, -4, -2, 0, 0,
+  0, 0, 4, 6, 8, 8, 10, 12, 12, 10, 8, 8, 6, 4, 0, 0, 0, 0, -4, -6, -8, -8, -10, -12, -12, -10, -8, -8, -6, -4, 0, 0,
+  0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+  0, 0, 17, 25, 35, 35, 43, 52, 52, 43, 35, 35, 25, 17, 0, 0, 0, 0, -17, -25, -35, -35, -43, -52, -52, -43, -35, -35, -25, -17, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+  0, 0, 2, 4, 4, 4, 6, 9, 9, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -9, -9, -6, -4, -4, -4, -2, 0, 0,
+  0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+  0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+  0, 0, 18, 27, 36, 36, 45, 54, 54, 45, 36, 36, 27, 18, 0, 0, 0, 0, -18, -27, -36, -36, -45, -54, -54, -45, -36, -36, -27, -18, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+  0, 0, 2, 4, 4, 4, 6, 9, 9, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -9, -9, -6, -4, -4, -4, -2, 0, 0,
+  0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+  0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+  0, 0, 18, 27, 37, 37, 46, 55, 55, 46, 37, 37, 27, 18, 0, 0, 0, 0, -18, -27, -37, -37, -46, -55, -55, -46, -37, -37, -27, -18, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+  0, 0, 2, 4, 4, 4, 6, 9, 9, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -9, -9, -6, -4, -4, -4, -2, 0, 0,
+  0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+  0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+  0, 0, 19, 28, 38, 38, 47, 57, 57, 47, 38, 38, 28, 19, 0, 0, 0, 0, -19, -28, -38, -38, -47, -57, -57, -47, -38, -38, -28, -19, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -4, -4, -4, -4, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 4, 4, 6, 6, 6, 6, 4, 4, 2, 2, 0, 0, 0, 0, -2, -2, -4, -4, -6, -6, -6, -6, -4, -4, -2, -2, 0, 0,
+  0, 0, 2, 4, 4, 4, 6, 9, 9, 6, 4, 4, 4, 2, 0, 0, 0, 0, -2, -4, -4, -4, -6, -9, -9, -6, -4, -4, -4, -2, 0, 0,
+  0, 0, 4, 6, 9, 9, 11, 13, 13, 11, 9, 9, 6, 4, 0, 0, 0, 0, -4, -6, -9, -9, -11, -13, -13, -11, -9, -9, -6, -4, 0, 0,
+  0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+  0, 0, 19, 28, 39, 39, 48, 58, 58, 48, 39, 39, 28, 19, 0, 0, 0, 0, -19, -28, -39, -39, -48, -58, -58, -48, -39, -39, -28, -19, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+  0, 0, 2, 5, 5, 5, 7, 10, 10, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -10, -10, -7, -5, -5, -5, -2, 0, 0,
+  0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+  0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+  0, 0, 20, 30, 40, 40, 50, 60, 60, 50, 40, 40, 30, 20, 0, 0, 0, 0, -20, -30, -40, -40, -50, -60, -60, -50, -40, -40, -30, -20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+  0, 0, 2, 5, 5, 5, 7, 10, 10, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -10, -10, -7, -5, -5, -5, -2, 0, 0,
+  0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+  0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+  0, 0, 20, 30, 41, 41, 51, 61, 61, 51, 41, 41, 30, 20, 0, 0, 0, 0, -20, -30, -41, -41, -51, -61, -61, -51, -41, -41, -30, -20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+  0, 0, 2, 5, 5, 5, 7, 10, 10, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -10, -10, -7, -5, -5, -5, -2, 0, 0,
+  0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+  0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+  0, 0, 21, 31, 42, 42, 52, 63, 63, 52, 42, 42, 31, 21, 0, 0, 0, 0, -21, -31, -42, -42, -52, -63, -63, -52, -42, -42, -31, -21, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+  0, 0, 2, 5, 5, 5, 7, 10, 10, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -10, -10, -7, -5, -5, -5, -2, 0, 0,
+  0, 0, 5, 7, 10, 10, 12, 15, 15, 12, 10, 10, 7, 5, 0, 0, 0, 0, -5, -7, -10, -10, -12, -15, -15, -12, -10, -10, -7, -5, 0, 0,
+  0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+  0, 0, 21, 31, 43, 43, 53, 64, 64, 53, 43, 43, 31, 21, 0, 0, 0, 0, -21, -31, -43, -43, -53, -64, -64, -53, -43, -43, -31, -21, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+  0, 0, 2, 5, 5, 5, 7, 11, 11, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -11, -11, -7, -5, -5, -5, -2, 0, 0,
+  0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+  0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+  0, 0, 22, 33, 44, 44, 55, 66, 66, 55, 44, 44, 33, 22, 0, 0, 0, 0, -22, -33, -44, -44, -55, -66, -66, -55, -44, -44, -33, -22, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+  0, 0, 2, 5, 5, 5, 7, 11, 11, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -11, -11, -7, -5, -5, -5, -2, 0, 0,
+  0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+  0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+  0, 0, 22, 33, 45, 45, 56, 67, 67, 56, 45, 45, 33, 22, 0, 0, 0, 0, -22, -33, -45, -45, -56, -67, -67, -56, -45, -45, -33, -22, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+  0, 0, 2, 5, 5, 5, 7, 11, 11, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -11, -11, -7, -5, -5, -5, -2, 0, 0,
+  0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+  0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+  0, 0, 23, 34, 46, 46, 57, 69, 69, 57, 46, 46, 34, 23, 0, 0, 0, 0, -23, -34, -46, -46, -57, -69, -69, -57, -46, -46, -34, -23, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 5, 5, 5, 5, 2, 2, 2, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, -5, -5, -5, -2, -2, -2, 0, 0, 0,
+  0, 0, 2, 2, 5, 5, 7, 7, 7, 7, 5, 5, 2, 2, 0, 0, 0, 0, -2, -2, -5, -5, -7, -7, -7, -7, -5, -5, -2, -2, 0, 0,
+  0, 0, 2, 5, 5, 5, 7, 11, 11, 7, 5, 5, 5, 2, 0, 0, 0, 0, -2, -5, -5, -5, -7, -11, -11, -7, -5, -5, -5, -2, 0, 0,
+  0, 0, 5, 7, 11, 11, 13, 16, 16, 13, 11, 11, 7, 5, 0, 0, 0, 0, -5, -7, -11, -11, -13, -16, -16, -13, -11, -11, -7, -5, 0, 0,
+  0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+  0, 0, 23, 34, 47, 47, 58, 70, 70, 58, 47, 47, 34, 23, 0, 0, 0, 0, -23, -34, -47, -47, -58, -70, -70, -58, -47, -47, -34, -23, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+  0, 0, 3, 6, 6, 6, 9, 12, 12, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -12, -12, -9, -6, -6, -6, -3, 0, 0,
+  0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+  0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+  0, 0, 24, 36, 48, 48, 60, 72, 72, 60, 48, 48, 36, 24, 0, 0, 0, 0, -24, -36, -48, -48, -60, -72, -72, -60, -48, -48, -36, -24, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+  0, 0, 3, 6, 6, 6, 9, 12, 12, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -12, -12, -9, -6, -6, -6, -3, 0, 0,
+  0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+  0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+  0, 0, 24, 36, 49, 49, 61, 73, 73, 61, 49, 49, 36, 24, 0, 0, 0, 0, -24, -36, -49, -49, -61, -73, -73, -61, -49, -49, -36, -24, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+  0, 0, 3, 6, 6, 6, 9, 12, 12, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -12, -12, -9, -6, -6, -6, -3, 0, 0,
+  0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+  0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+  0, 0, 25, 37, 50, 50, 62, 75, 75, 62, 50, 50, 37, 25, 0, 0, 0, 0, -25, -37, -50, -50, -62, -75, -75, -62, -50, -50, -37, -25, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+  0, 0, 3, 6, 6, 6, 9, 12, 12, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -12, -12, -9, -6, -6, -6, -3, 0, 0,
+  0, 0, 6, 9, 12, 12, 15, 18, 18, 15, 12, 12, 9, 6, 0, 0, 0, 0, -6, -9, -12, -12, -15, -18, -18, -15, -12, -12, -9, -6, 0, 0,
+  0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+  0, 0, 25, 37, 51, 51, 63, 76, 76, 63, 51, 51, 37, 25, 0, 0, 0, 0, -25, -37, -51, -51, -63, -76, -76, -63, -51, -51, -37, -25, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+  0, 0, 3, 6, 6, 6, 9, 13, 13, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -13, -13, -9, -6, -6, -6, -3, 0, 0,
+  0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+  0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+  0, 0, 26, 39, 52, 52, 65, 78, 78, 65, 52, 52, 39, 26, 0, 0, 0, 0, -26, -39, -52, -52, -65, -78, -78, -65, -52, -52, -39, -26, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+  0, 0, 3, 6, 6, 6, 9, 13, 13, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -13, -13, -9, -6, -6, -6, -3, 0, 0,
+  0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+  0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+  0, 0, 26, 39, 53, 53, 66, 79, 79, 66, 53, 53, 39, 26, 0, 0, 0, 0, -26, -39, -53, -53, -66, -79, -79, -66, -53, -53, -39, -26, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+  0, 0, 3, 6, 6, 6, 9, 13, 13, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -13, -13, -9, -6, -6, -6, -3, 0, 0,
+  0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+  0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+  0, 0, 27, 40, 54, 54, 67, 81, 81, 67, 54, 54, 40, 27, 0, 0, 0, 0, -27, -40, -54, -54, -67, -81, -81, -67, -54, -54, -40, -27, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 6, 6, 6, 6, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -6, -6, -6, -6, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 6, 6, 9, 9, 9, 9, 6, 6, 3, 3, 0, 0, 0, 0, -3, -3, -6, -6, -9, -9, -9, -9, -6, -6, -3, -3, 0, 0,
+  0, 0, 3, 6, 6, 6, 9, 13, 13, 9, 6, 6, 6, 3, 0, 0, 0, 0, -3, -6, -6, -6, -9, -13, -13, -9, -6, -6, -6, -3, 0, 0,
+  0, 0, 6, 9, 13, 13, 16, 19, 19, 16, 13, 13, 9, 6, 0, 0, 0, 0, -6, -9, -13, -13, -16, -19, -19, -16, -13, -13, -9, -6, 0, 0,
+  0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+  0, 0, 27, 40, 55, 55, 68, 82, 82, 68, 55, 55, 40, 27, 0, 0, 0, 0, -27, -40, -55, -55, -68, -82, -82, -68, -55, -55, -40, -27, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+  0, 0, 3, 7, 7, 7, 10, 14, 14, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -14, -14, -10, -7, -7, -7, -3, 0, 0,
+  0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+  0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+  0, 0, 28, 42, 56, 56, 70, 84, 84, 70, 56, 56, 42, 28, 0, 0, 0, 0, -28, -42, -56, -56, -70, -84, -84, -70, -56, -56, -42, -28, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+  0, 0, 3, 7, 7, 7, 10, 14, 14, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -14, -14, -10, -7, -7, -7, -3, 0, 0,
+  0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+  0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+  0, 0, 28, 42, 57, 57, 71, 85, 85, 71, 57, 57, 42, 28, 0, 0, 0, 0, -28, -42, -57, -57, -71, -85, -85, -71, -57, -57, -42, -28, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+  0, 0, 3, 7, 7, 7, 10, 14, 14, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -14, -14, -10, -7, -7, -7, -3, 0, 0,
+  0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+  0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+  0, 0, 29, 43, 58, 58, 72, 87, 87, 72, 58, 58, 43, 29, 0, 0, 0, 0, -29, -43, -58, -58, -72, -87, -87, -72, -58, -58, -43, -29, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+  0, 0, 3, 7, 7, 7, 10, 14, 14, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -14, -14, -10, -7, -7, -7, -3, 0, 0,
+  0, 0, 7, 10, 14, 14, 17, 21, 21, 17, 14, 14, 10, 7, 0, 0, 0, 0, -7, -10, -14, -14, -17, -21, -21, -17, -14, -14, -10, -7, 0, 0,
+  0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+  0, 0, 29, 43, 59, 59, 73, 88, 88, 73, 59, 59, 43, 29, 0, 0, 0, 0, -29, -43, -59, -59, -73, -88, -88, -73, -59, -59, -43, -29, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+  0, 0, 3, 7, 7, 7, 10, 15, 15, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -15, -15, -10, -7, -7, -7, -3, 0, 0,
+  0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+  0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+  0, 0, 30, 45, 60, 60, 75, 90, 90, 75, 60, 60, 45, 30, 0, 0, 0, 0, -30, -45, -60, -60, -75, -90, -90, -75, -60, -60, -45, -30, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+  0, 0, 3, 7, 7, 7, 10, 15, 15, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -15, -15, -10, -7, -7, -7, -3, 0, 0,
+  0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+  0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+  0, 0, 30, 45, 61, 61, 76, 91, 91, 76, 61, 61, 45, 30, 0, 0, 0, 0, -30, -45, -61, -61, -76, -91, -91, -76, -61, -61, -45, -30, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+  0, 0, 3, 7, 7, 7, 10, 15, 15, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -15, -15, -10, -7, -7, -7, -3, 0, 0,
+  0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+  0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+  0, 0, 31, 46, 62, 62, 77, 93, 93, 77, 62, 62, 46, 31, 0, 0, 0, 0, -31, -46, -62, -62, -77, -93, -93, -77, -62, -62, -46, -31, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 7, 7, 7, 7, 3, 3, 3, 0, 0, 0, 0, 0, 0, -3, -3, -3, -7, -7, -7, -7, -3, -3, -3, 0, 0, 0,
+  0, 0, 3, 3, 7, 7, 10, 10, 10, 10, 7, 7, 3, 3, 0, 0, 0, 0, -3, -3, -7, -7, -10, -10, -10, -10, -7, -7, -3, -3, 0, 0,
+  0, 0, 3, 7, 7, 7, 10, 15, 15, 10, 7, 7, 7, 3, 0, 0, 0, 0, -3, -7, -7, -7, -10, -15, -15, -10, -7, -7, -7, -3, 0, 0,
+  0, 0, 7, 10, 15, 15, 18, 22, 22, 18, 15, 15, 10, 7, 0, 0, 0, 0, -7, -10, -15, -15, -18, -22, -22, -18, -15, -15, -10, -7, 0, 0,
+  0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+  0, 0, 31, 46, 63, 63, 78, 94, 94, 78, 63, 63, 46, 31, 0, 0, 0, 0, -31, -46, -63, -63, -78, -94, -94, -78, -63, -63, -46, -31, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+  0, 0, 4, 8, 8, 8, 12, 16, 16, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -16, -16, -12, -8, -8, -8, -4, 0, 0,
+  0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+  0, 0, 16, 24, 32, 32, 40, 48, 48, 40, 32, 32, 24, 16, 0, 0, 0, 0, -16, -24, -32, -32, -40, -48, -48, -40, -32, -32, -24, -16, 0, 0,
+  0, 0, 32, 48, 64, 64, 80, 96, 96, 80, 64, 64, 48, 32, 0, 0, 0, 0, -32, -48, -64, -64, -80, -96, -96, -80, -64, -64, -48, -32, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+  0, 0, 4, 8, 8, 8, 12, 16, 16, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -16, -16, -12, -8, -8, -8, -4, 0, 0,
+  0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+  0, 0, 16, 24, 32, 32, 40, 48, 48, 40, 32, 32, 24, 16, 0, 0, 0, 0, -16, -24, -32, -32, -40, -48, -48, -40, -32, -32, -24, -16, 0, 0,
+  0, 0, 32, 48, 65, 65, 81, 97, 97, 81, 65, 65, 48, 32, 0, 0, 0, 0, -32, -48, -65, -65, -81, -97, -97, -81, -65, -65, -48, -32, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+  0, 0, 4, 8, 8, 8, 12, 16, 16, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -16, -16, -12, -8, -8, -8, -4, 0, 0,
+  0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+  0, 0, 16, 24, 33, 33, 41, 49, 49, 41, 33, 33, 24, 16, 0, 0, 0, 0, -16, -24, -33, -33, -41, -49, -49, -41, -33, -33, -24, -16, 0, 0,
+  0, 0, 33, 49, 66, 66, 82, 99, 99, 82, 66, 66, 49, 33, 0, 0, 0, 0, -33, -49, -66, -66, -82, -99, -99, -82, -66, -66, -49, -33, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+  0, 0, 4, 8, 8, 8, 12, 16, 16, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -16, -16, -12, -8, -8, -8, -4, 0, 0,
+  0, 0, 8, 12, 16, 16, 20, 24, 24, 20, 16, 16, 12, 8, 0, 0, 0, 0, -8, -12, -16, -16, -20, -24, -24, -20, -16, -16, -12, -8, 0, 0,
+  0, 0, 16, 24, 33, 33, 41, 49, 49, 41, 33, 33, 24, 16, 0, 0, 0, 0, -16, -24, -33, -33, -41, -49, -49, -41, -33, -33, -24, -16, 0, 0,
+  0, 0, 33, 49, 67, 67, 83, 100, 100, 83, 67, 67, 49, 33, 0, 0, 0, 0, -33, -49, -67, -67, -83, -100, -100, -83, -67, -67, -49, -33, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+  0, 0, 4, 8, 8, 8, 12, 17, 17, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -17, -17, -12, -8, -8, -8, -4, 0, 0,
+  0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+  0, 0, 17, 25, 34, 34, 42, 51, 51, 42, 34, 34, 25, 17, 0, 0, 0, 0, -17, -25, -34, -34, -42, -51, -51, -42, -34, -34, -25, -17, 0, 0,
+  0, 0, 34, 51, 68, 68, 85, 102, 102, 85, 68, 68, 51, 34, 0, 0, 0, 0, -34, -51, -68, -68, -85, -102, -102, -85, -68, -68, -51, -34, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+  0, 0, 4, 8, 8, 8, 12, 17, 17, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -17, -17, -12, -8, -8, -8, -4, 0, 0,
+  0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+  0, 0, 17, 25, 34, 34, 42, 51, 51, 42, 34, 34, 25, 17, 0, 0, 0, 0, -17, -25, -34, -34, -42, -51, -51, -42, -34, -34, -25, -17, 0, 0,
+  0, 0, 34, 51, 69, 69, 86, 103, 103, 86, 69, 69, 51, 34, 0, 0, 0, 0, -34, -51, -69, -69, -86, -103, -103, -86, -69, -69, -51, -34, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+  0, 0, 4, 8, 8, 8, 12, 17, 17, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -17, -17, -12, -8, -8, -8, -4, 0, 0,
+  0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+  0, 0, 17, 25, 35, 35, 43, 52, 52, 43, 35, 35, 25, 17, 0, 0, 0, 0, -17, -25, -35, -35, -43, -52, -52, -43, -35, -35, -25, -17, 0, 0,
+  0, 0, 35, 52, 70, 70, 87, 105, 105, 87, 70, 70, 52, 35, 0, 0, 0, 0, -35, -52, -70, -70, -87, -105, -105, -87, -70, -70, -52, -35, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -8, -8, -8, -8, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 8, 8, 12, 12, 12, 12, 8, 8, 4, 4, 0, 0, 0, 0, -4, -4, -8, -8, -12, -12, -12, -12, -8, -8, -4, -4, 0, 0,
+  0, 0, 4, 8, 8, 8, 12, 17, 17, 12, 8, 8, 8, 4, 0, 0, 0, 0, -4, -8, -8, -8, -12, -17, -17, -12, -8, -8, -8, -4, 0, 0,
+  0, 0, 8, 12, 17, 17, 21, 25, 25, 21, 17, 17, 12, 8, 0, 0, 0, 0, -8, -12, -17, -17, -21, -25, -25, -21, -17, -17, -12, -8, 0, 0,
+  0, 0, 17, 25, 35, 35, 43, 52, 52, 43, 35, 35, 25, 17, 0, 0, 0, 0, -17, -25, -35, -35, -43, -52, -52, -43, -35, -35, -25, -17, 0, 0,
+  0, 0, 35, 52, 71, 71, 88, 106, 106, 88, 71, 71, 52, 35, 0, 0, 0, 0, -35, -52, -71, -71, -88, -106, -106, -88, -71, -71, -52, -35, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+  0, 0, 4, 9, 9, 9, 13, 18, 18, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -18, -18, -13, -9, -9, -9, -4, 0, 0,
+  0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+  0, 0, 18, 27, 36, 36, 45, 54, 54, 45, 36, 36, 27, 18, 0, 0, 0, 0, -18, -27, -36, -36, -45, -54, -54, -45, -36, -36, -27, -18, 0, 0,
+  0, 0, 36, 54, 72, 72, 90, 108, 108, 90, 72, 72, 54, 36, 0, 0, 0, 0, -36, -54, -72, -72, -90, -108, -108, -90, -72, -72, -54, -36, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+  0, 0, 4, 9, 9, 9, 13, 18, 18, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -18, -18, -13, -9, -9, -9, -4, 0, 0,
+  0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+  0, 0, 18, 27, 36, 36, 45, 54, 54, 45, 36, 36, 27, 18, 0, 0, 0, 0, -18, -27, -36, -36, -45, -54, -54, -45, -36, -36, -27, -18, 0, 0,
+  0, 0, 36, 54, 73, 73, 91, 109, 109, 91, 73, 73, 54, 36, 0, 0, 0, 0, -36, -54, -73, -73, -91, -109, -109, -91, -73, -73, -54, -36, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+  0, 0, 4, 9, 9, 9, 13, 18, 18, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -18, -18, -13, -9, -9, -9, -4, 0, 0,
+  0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+  0, 0, 18, 27, 37, 37, 46, 55, 55, 46, 37, 37, 27, 18, 0, 0, 0, 0, -18, -27, -37, -37, -46, -55, -55, -46, -37, -37, -27, -18, 0, 0,
+  0, 0, 37, 55, 74, 74, 92, 111, 111, 92, 74, 74, 55, 37, 0, 0, 0, 0, -37, -55, -74, -74, -92, -111, -111, -92, -74, -74, -55, -37, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+  0, 0, 4, 9, 9, 9, 13, 18, 18, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -18, -18, -13, -9, -9, -9, -4, 0, 0,
+  0, 0, 9, 13, 18, 18, 22, 27, 27, 22, 18, 18, 13, 9, 0, 0, 0, 0, -9, -13, -18, -18, -22, -27, -27, -22, -18, -18, -13, -9, 0, 0,
+  0, 0, 18, 27, 37, 37, 46, 55, 55, 46, 37, 37, 27, 18, 0, 0, 0, 0, -18, -27, -37, -37, -46, -55, -55, -46, -37, -37, -27, -18, 0, 0,
+  0, 0, 37, 55, 75, 75, 93, 112, 112, 93, 75, 75, 55, 37, 0, 0, 0, 0, -37, -55, -75, -75, -93, -112, -112, -93, -75, -75, -55, -37, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+  0, 0, 4, 9, 9, 9, 13, 19, 19, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -19, -19, -13, -9, -9, -9, -4, 0, 0,
+  0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+  0, 0, 19, 28, 38, 38, 47, 57, 57, 47, 38, 38, 28, 19, 0, 0, 0, 0, -19, -28, -38, -38, -47, -57, -57, -47, -38, -38, -28, -19, 0, 0,
+  0, 0, 38, 57, 76, 76, 95, 114, 114, 95, 76, 76, 57, 38, 0, 0, 0, 0, -38, -57, -76, -76, -95, -114, -114, -95, -76, -76, -57, -38, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+  0, 0, 4, 9, 9, 9, 13, 19, 19, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -19, -19, -13, -9, -9, -9, -4, 0, 0,
+  0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+  0, 0, 19, 28, 38, 38, 47, 57, 57, 47, 38, 38, 28, 19, 0, 0, 0, 0, -19, -28, -38, -38, -47, -57, -57, -47, -38, -38, -28, -19, 0, 0,
+  0, 0, 38, 57, 77, 77, 96, 115, 115, 96, 77, 77, 57, 38, 0, 0, 0, 0, -38, -57, -77, -77, -96, -115, -115, -96, -77, -77, -57, -38, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+  0, 0, 4, 9, 9, 9, 13, 19, 19, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -19, -19, -13, -9, -9, -9, -4, 0, 0,
+  0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+  0, 0, 19, 28, 39, 39, 48, 58, 58, 48, 39, 39, 28, 19, 0, 0, 0, 0, -19, -28, -39, -39, -48, -58, -58, -48, -39, -39, -28, -19, 0, 0,
+  0, 0, 39, 58, 78, 78, 97, 117, 117, 97, 78, 78, 58, 39, 0, 0, 0, 0, -39, -58, -78, -78, -97, -117, -117, -97, -78, -78, -58, -39, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, 0, 0,
+  0, 0, 0, 4, 4, 4, 9, 9, 9, 9, 4, 4, 4, 0, 0, 0, 0, 0, 0, -4, -4, -4, -9, -9, -9, -9, -4, -4, -4, 0, 0, 0,
+  0, 0, 4, 4, 9, 9, 13, 13, 13, 13, 9, 9, 4, 4, 0, 0, 0, 0, -4, -4, -9, -9, -13, -13, -13, -13, -9, -9, -4, -4, 0, 0,
+  0, 0, 4, 9, 9, 9, 13, 19, 19, 13, 9, 9, 9, 4, 0, 0, 0, 0, -4, -9, -9, -9, -13, -19, -19, -13, -9, -9, -9, -4, 0, 0,
+  0, 0, 9, 13, 19, 19, 23, 28, 28, 23, 19, 19, 13, 9, 0, 0, 0, 0, -9, -13, -19, -19, -23, -28, -28, -23, -19, -19, -13, -9, 0, 0,
+  0, 0, 19, 28, 39, 39, 48, 58, 58, 48, 39, 39, 28, 19, 0, 0, 0, 0, -19, -28, -39, -39, -48, -58, -58, -48, -39, -39, -28, -19, 0, 0,
+  0, 0, 39, 58, 79, 79, 98, 118, 118, 98, 79, 79, 58, 39, 0, 0, 0, 0, -39, -58, -79, -79, -98, -118, -118, -98, -79, -79, -58, -39, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+  0, 0, 5, 10, 10, 10, 15, 20, 20, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -20, -20, -15, -10, -10, -10, -5, 0, 0,
+  0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+  0, 0, 20, 30, 40, 40, 50, 60, 60, 50, 40, 40, 30, 20, 0, 0, 0, 0, -20, -30, -40, -40, -50, -60, -60, -50, -40, -40, -30, -20, 0, 0,
+  0, 0, 40, 60, 80, 80, 100, 120, 120, 100, 80, 80, 60, 40, 0, 0, 0, 0, -40, -60, -80, -80, -100, -120, -120, -100, -80, -80, -60, -40, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+  0, 0, 5, 10, 10, 10, 15, 20, 20, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -20, -20, -15, -10, -10, -10, -5, 0, 0,
+  0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+  0, 0, 20, 30, 40, 40, 50, 60, 60, 50, 40, 40, 30, 20, 0, 0, 0, 0, -20, -30, -40, -40, -50, -60, -60, -50, -40, -40, -30, -20, 0, 0,
+  0, 0, 40, 60, 81, 81, 101, 121, 121, 101, 81, 81, 60, 40, 0, 0, 0, 0, -40, -60, -81, -81, -101, -121, -121, -101, -81, -81, -60, -40, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+  0, 0, 5, 10, 10, 10, 15, 20, 20, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -20, -20, -15, -10, -10, -10, -5, 0, 0,
+  0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+  0, 0, 20, 30, 41, 41, 51, 61, 61, 51, 41, 41, 30, 20, 0, 0, 0, 0, -20, -30, -41, -41, -51, -61, -61, -51, -41, -41, -30, -20, 0, 0,
+  0, 0, 41, 61, 82, 82, 102, 123, 123, 102, 82, 82, 61, 41, 0, 0, 0, 0, -41, -61, -82, -82, -102, -123, -123, -102, -82, -82, -61, -41, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+  0, 0, 5, 10, 10, 10, 15, 20, 20, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -20, -20, -15, -10, -10, -10, -5, 0, 0,
+  0, 0, 10, 15, 20, 20, 25, 30, 30, 25, 20, 20, 15, 10, 0, 0, 0, 0, -10, -15, -20, -20, -25, -30, -30, -25, -20, -20, -15, -10, 0, 0,
+  0, 0, 20, 30, 41, 41, 51, 61, 61, 51, 41, 41, 30, 20, 0, 0, 0, 0, -20, -30, -41, -41, -51, -61, -61, -51, -41, -41, -30, -20, 0, 0,
+  0, 0, 41, 61, 83, 83, 103, 124, 124, 103, 83, 83, 61, 41, 0, 0, 0, 0, -41, -61, -83, -83, -103, -124, -124, -103, -83, -83, -61, -41, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+  0, 0, 5, 10, 10, 10, 15, 21, 21, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -21, -21, -15, -10, -10, -10, -5, 0, 0,
+  0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+  0, 0, 21, 31, 42, 42, 52, 63, 63, 52, 42, 42, 31, 21, 0, 0, 0, 0, -21, -31, -42, -42, -52, -63, -63, -52, -42, -42, -31, -21, 0, 0,
+  0, 0, 42, 63, 84, 84, 105, 126, 126, 105, 84, 84, 63, 42, 0, 0, 0, 0, -42, -63, -84, -84, -105, -126, -126, -105, -84, -84, -63, -42, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+  0, 0, 5, 10, 10, 10, 15, 21, 21, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -21, -21, -15, -10, -10, -10, -5, 0, 0,
+  0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+  0, 0, 21, 31, 42, 42, 52, 63, 63, 52, 42, 42, 31, 21, 0, 0, 0, 0, -21, -31, -42, -42, -52, -63, -63, -52, -42, -42, -31, -21, 0, 0,
+  0, 0, 42, 63, 85, 85, 106, 127, 127, 106, 85, 85, 63, 42, 0, 0, 0, 0, -42, -63, -85, -85, -106, -127, -127, -106, -85, -85, -63, -42, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+  0, 0, 5, 10, 10, 10, 15, 21, 21, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -21, -21, -15, -10, -10, -10, -5, 0, 0,
+  0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+  0, 0, 21, 31, 43, 43, 53, 64, 64, 53, 43, 43, 31, 21, 0, 0, 0, 0, -21, -31, -43, -43, -53, -64, -64, -53, -43, -43, -31, -21, 0, 0,
+  0, 0, 43, 64, 86, 86, 107, 129, 129, 107, 86, 86, 64, 43, 0, 0, 0, 0, -43, -64, -86, -86, -107, -129, -129, -107, -86, -86, -64, -43, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 10, 10, 10, 10, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -10, -10, -10, -10, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 10, 10, 15, 15, 15, 15, 10, 10, 5, 5, 0, 0, 0, 0, -5, -5, -10, -10, -15, -15, -15, -15, -10, -10, -5, -5, 0, 0,
+  0, 0, 5, 10, 10, 10, 15, 21, 21, 15, 10, 10, 10, 5, 0, 0, 0, 0, -5, -10, -10, -10, -15, -21, -21, -15, -10, -10, -10, -5, 0, 0,
+  0, 0, 10, 15, 21, 21, 26, 31, 31, 26, 21, 21, 15, 10, 0, 0, 0, 0, -10, -15, -21, -21, -26, -31, -31, -26, -21, -21, -15, -10, 0, 0,
+  0, 0, 21, 31, 43, 43, 53, 64, 64, 53, 43, 43, 31, 21, 0, 0, 0, 0, -21, -31, -43, -43, -53, -64, -64, -53, -43, -43, -31, -21, 0, 0,
+  0, 0, 43, 64, 87, 87, 108, 130, 130, 108, 87, 87, 64, 43, 0, 0, 0, 0, -43, -64, -87, -87, -108, -130, -130, -108, -87, -87, -64, -43, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+  0, 0, 5, 11, 11, 11, 16, 22, 22, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -22, -22, -16, -11, -11, -11, -5, 0, 0,
+  0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+  0, 0, 22, 33, 44, 44, 55, 66, 66, 55, 44, 44, 33, 22, 0, 0, 0, 0, -22, -33, -44, -44, -55, -66, -66, -55, -44, -44, -33, -22, 0, 0,
+  0, 0, 44, 66, 88, 88, 110, 132, 132, 110, 88, 88, 66, 44, 0, 0, 0, 0, -44, -66, -88, -88, -110, -132, -132, -110, -88, -88, -66, -44, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+  0, 0, 5, 11, 11, 11, 16, 22, 22, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -22, -22, -16, -11, -11, -11, -5, 0, 0,
+  0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+  0, 0, 22, 33, 44, 44, 55, 66, 66, 55, 44, 44, 33, 22, 0, 0, 0, 0, -22, -33, -44, -44, -55, -66, -66, -55, -44, -44, -33, -22, 0, 0,
+  0, 0, 44, 66, 89, 89, 111, 133, 133, 111, 89, 89, 66, 44, 0, 0, 0, 0, -44, -66, -89, -89, -111, -133, -133, -111, -89, -89, -66, -44, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+  0, 0, 5, 11, 11, 11, 16, 22, 22, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -22, -22, -16, -11, -11, -11, -5, 0, 0,
+  0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+  0, 0, 22, 33, 45, 45, 56, 67, 67, 56, 45, 45, 33, 22, 0, 0, 0, 0, -22, -33, -45, -45, -56, -67, -67, -56, -45, -45, -33, -22, 0, 0,
+  0, 0, 45, 67, 90, 90, 112, 135, 135, 112, 90, 90, 67, 45, 0, 0, 0, 0, -45, -67, -90, -90, -112, -135, -135, -112, -90, -90, -67, -45, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+  0, 0, 5, 11, 11, 11, 16, 22, 22, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -22, -22, -16, -11, -11, -11, -5, 0, 0,
+  0, 0, 11, 16, 22, 22, 27, 33, 33, 27, 22, 22, 16, 11, 0, 0, 0, 0, -11, -16, -22, -22, -27, -33, -33, -27, -22, -22, -16, -11, 0, 0,
+  0, 0, 22, 33, 45, 45, 56, 67, 67, 56, 45, 45, 33, 22, 0, 0, 0, 0, -22, -33, -45, -45, -56, -67, -67, -56, -45, -45, -33, -22, 0, 0,
+  0, 0, 45, 67, 91, 91, 113, 136, 136, 113, 91, 91, 67, 45, 0, 0, 0, 0, -45, -67, -91, -91, -113, -136, -136, -113, -91, -91, -67, -45, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+  0, 0, 5, 11, 11, 11, 16, 23, 23, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -23, -23, -16, -11, -11, -11, -5, 0, 0,
+  0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+  0, 0, 23, 34, 46, 46, 57, 69, 69, 57, 46, 46, 34, 23, 0, 0, 0, 0, -23, -34, -46, -46, -57, -69, -69, -57, -46, -46, -34, -23, 0, 0,
+  0, 0, 46, 69, 92, 92, 115, 138, 138, 115, 92, 92, 69, 46, 0, 0, 0, 0, -46, -69, -92, -92, -115, -138, -138, -115, -92, -92, -69, -46, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+  0, 0, 5, 11, 11, 11, 16, 23, 23, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -23, -23, -16, -11, -11, -11, -5, 0, 0,
+  0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+  0, 0, 23, 34, 46, 46, 57, 69, 69, 57, 46, 46, 34, 23, 0, 0, 0, 0, -23, -34, -46, -46, -57, -69, -69, -57, -46, -46, -34, -23, 0, 0,
+  0, 0, 46, 69, 93, 93, 116, 139, 139, 116, 93, 93, 69, 46, 0, 0, 0, 0, -46, -69, -93, -93, -116, -139, -139, -116, -93, -93, -69, -46, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+  0, 0, 5, 11, 11, 11, 16, 23, 23, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -23, -23, -16, -11, -11, -11, -5, 0, 0,
+  0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+  0, 0, 23, 34, 47, 47, 58, 70, 70, 58, 47, 47, 34, 23, 0, 0, 0, 0, -23, -34, -47, -47, -58, -70, -70, -58, -47, -47, -34, -23, 0, 0,
+  0, 0, 47, 70, 94, 94, 117, 141, 141, 117, 94, 94, 70, 47, 0, 0, 0, 0, -47, -70, -94, -94, -117, -141, -141, -117, -94, -94, -70, -47, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 5, 11, 11, 11, 11, 5, 5, 5, 0, 0, 0, 0, 0, 0, -5, -5, -5, -11, -11, -11, -11, -5, -5, -5, 0, 0, 0,
+  0, 0, 5, 5, 11, 11, 16, 16, 16, 16, 11, 11, 5, 5, 0, 0, 0, 0, -5, -5, -11, -11, -16, -16, -16, -16, -11, -11, -5, -5, 0, 0,
+  0, 0, 5, 11, 11, 11, 16, 23, 23, 16, 11, 11, 11, 5, 0, 0, 0, 0, -5, -11, -11, -11, -16, -23, -23, -16, -11, -11, -11, -5, 0, 0,
+  0, 0, 11, 16, 23, 23, 28, 34, 34, 28, 23, 23, 16, 11, 0, 0, 0, 0, -11, -16, -23, -23, -28, -34, -34, -28, -23, -23, -16, -11, 0, 0,
+  0, 0, 23, 34, 47, 47, 58, 70, 70, 58, 47, 47, 34, 23, 0, 0, 0, 0, -23, -34, -47, -47, -58, -70, -70, -58, -47, -47, -34, -23, 0, 0,
+  0, 0, 47, 70, 95, 95, 118, 142, 142, 118, 95, 95, 70, 47, 0, 0, 0, 0, -47, -70, -95, -95, -118, -142, -142, -118, -95, -95, -70, -47, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+  0, 0, 6, 12, 12, 12, 18, 24, 24, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -24, -24, -18, -12, -12, -12, -6, 0, 0,
+  0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+  0, 0, 24, 36, 48, 48, 60, 72, 72, 60, 48, 48, 36, 24, 0, 0, 0, 0, -24, -36, -48, -48, -60, -72, -72, -60, -48, -48, -36, -24, 0, 0,
+  0, 0, 48, 72, 96, 96, 120, 144, 144, 120, 96, 96, 72, 48, 0, 0, 0, 0, -48, -72, -96, -96, -120, -144, -144, -120, -96, -96, -72, -48, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+  0, 0, 6, 12, 12, 12, 18, 24, 24, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -24, -24, -18, -12, -12, -12, -6, 0, 0,
+  0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+  0, 0, 24, 36, 48, 48, 60, 72, 72, 60, 48, 48, 36, 24, 0, 0, 0, 0, -24, -36, -48, -48, -60, -72, -72, -60, -48, -48, -36, -24, 0, 0,
+  0, 0, 48, 72, 97, 97, 121, 145, 145, 121, 97, 97, 72, 48, 0, 0, 0, 0, -48, -72, -97, -97, -121, -145, -145, -121, -97, -97, -72, -48, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+  0, 0, 6, 12, 12, 12, 18, 24, 24, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -24, -24, -18, -12, -12, -12, -6, 0, 0,
+  0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+  0, 0, 24, 36, 49, 49, 61, 73, 73, 61, 49, 49, 36, 24, 0, 0, 0, 0, -24, -36, -49, -49, -61, -73, -73, -61, -49, -49, -36, -24, 0, 0,
+  0, 0, 49, 73, 98, 98, 122, 147, 147, 122, 98, 98, 73, 49, 0, 0, 0, 0, -49, -73, -98, -98, -122, -147, -147, -122, -98, -98, -73, -49, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+  0, 0, 6, 12, 12, 12, 18, 24, 24, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -24, -24, -18, -12, -12, -12, -6, 0, 0,
+  0, 0, 12, 18, 24, 24, 30, 36, 36, 30, 24, 24, 18, 12, 0, 0, 0, 0, -12, -18, -24, -24, -30, -36, -36, -30, -24, -24, -18, -12, 0, 0,
+  0, 0, 24, 36, 49, 49, 61, 73, 73, 61, 49, 49, 36, 24, 0, 0, 0, 0, -24, -36, -49, -49, -61, -73, -73, -61, -49, -49, -36, -24, 0, 0,
+  0, 0, 49, 73, 99, 99, 123, 148, 148, 123, 99, 99, 73, 49, 0, 0, 0, 0, -49, -73, -99, -99, -123, -148, -148, -123, -99, -99, -73, -49, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+  0, 0, 6, 12, 12, 12, 18, 25, 25, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -25, -25, -18, -12, -12, -12, -6, 0, 0,
+  0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+  0, 0, 25, 37, 50, 50, 62, 75, 75, 62, 50, 50, 37, 25, 0, 0, 0, 0, -25, -37, -50, -50, -62, -75, -75, -62, -50, -50, -37, -25, 0, 0,
+  0, 0, 50, 75, 100, 100, 125, 150, 150, 125, 100, 100, 75, 50, 0, 0, 0, 0, -50, -75, -100, -100, -125, -150, -150, -125, -100, -100, -75, -50, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+  0, 0, 6, 12, 12, 12, 18, 25, 25, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -25, -25, -18, -12, -12, -12, -6, 0, 0,
+  0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+  0, 0, 25, 37, 50, 50, 62, 75, 75, 62, 50, 50, 37, 25, 0, 0, 0, 0, -25, -37, -50, -50, -62, -75, -75, -62, -50, -50, -37, -25, 0, 0,
+  0, 0, 50, 75, 101, 101, 126, 151, 151, 126, 101, 101, 75, 50, 0, 0, 0, 0, -50, -75, -101, -101, -126, -151, -151, -126, -101, -101, -75, -50, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+  0, 0, 6, 12, 12, 12, 18, 25, 25, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -25, -25, -18, -12, -12, -12, -6, 0, 0,
+  0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+  0, 0, 25, 37, 51, 51, 63, 76, 76, 63, 51, 51, 37, 25, 0, 0, 0, 0, -25, -37, -51, -51, -63, -76, -76, -63, -51, -51, -37, -25, 0, 0,
+  0, 0, 51, 76, 102, 102, 127, 153, 153, 127, 102, 102, 76, 51, 0, 0, 0, 0, -51, -76, -102, -102, -127, -153, -153, -127, -102, -102, -76, -51, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 12, 12, 12, 12, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -12, -12, -12, -12, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 12, 12, 18, 18, 18, 18, 12, 12, 6, 6, 0, 0, 0, 0, -6, -6, -12, -12, -18, -18, -18, -18, -12, -12, -6, -6, 0, 0,
+  0, 0, 6, 12, 12, 12, 18, 25, 25, 18, 12, 12, 12, 6, 0, 0, 0, 0, -6, -12, -12, -12, -18, -25, -25, -18, -12, -12, -12, -6, 0, 0,
+  0, 0, 12, 18, 25, 25, 31, 37, 37, 31, 25, 25, 18, 12, 0, 0, 0, 0, -12, -18, -25, -25, -31, -37, -37, -31, -25, -25, -18, -12, 0, 0,
+  0, 0, 25, 37, 51, 51, 63, 76, 76, 63, 51, 51, 37, 25, 0, 0, 0, 0, -25, -37, -51, -51, -63, -76, -76, -63, -51, -51, -37, -25, 0, 0,
+  0, 0, 51, 76, 103, 103, 128, 154, 154, 128, 103, 103, 76, 51, 0, 0, 0, 0, -51, -76, -103, -103, -128, -154, -154, -128, -103, -103, -76, -51, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+  0, 0, 6, 13, 13, 13, 19, 26, 26, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -26, -26, -19, -13, -13, -13, -6, 0, 0,
+  0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+  0, 0, 26, 39, 52, 52, 65, 78, 78, 65, 52, 52, 39, 26, 0, 0, 0, 0, -26, -39, -52, -52, -65, -78, -78, -65, -52, -52, -39, -26, 0, 0,
+  0, 0, 52, 78, 104, 104, 130, 156, 156, 130, 104, 104, 78, 52, 0, 0, 0, 0, -52, -78, -104, -104, -130, -156, -156, -130, -104, -104, -78, -52, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+  0, 0, 6, 13, 13, 13, 19, 26, 26, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -26, -26, -19, -13, -13, -13, -6, 0, 0,
+  0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+  0, 0, 26, 39, 52, 52, 65, 78, 78, 65, 52, 52, 39, 26, 0, 0, 0, 0, -26, -39, -52, -52, -65, -78, -78, -65, -52, -52, -39, -26, 0, 0,
+  0, 0, 52, 78, 105, 105, 131, 157, 157, 131, 105, 105, 78, 52, 0, 0, 0, 0, -52, -78, -105, -105, -131, -157, -157, -131, -105, -105, -78, -52, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+  0, 0, 6, 13, 13, 13, 19, 26, 26, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -26, -26, -19, -13, -13, -13, -6, 0, 0,
+  0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+  0, 0, 26, 39, 53, 53, 66, 79, 79, 66, 53, 53, 39, 26, 0, 0, 0, 0, -26, -39, -53, -53, -66, -79, -79, -66, -53, -53, -39, -26, 0, 0,
+  0, 0, 53, 79, 106, 106, 132, 159, 159, 132, 106, 106, 79, 53, 0, 0, 0, 0, -53, -79, -106, -106, -132, -159, -159, -132, -106, -106, -79, -53, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+  0, 0, 6, 13, 13, 13, 19, 26, 26, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -26, -26, -19, -13, -13, -13, -6, 0, 0,
+  0, 0, 13, 19, 26, 26, 32, 39, 39, 32, 26, 26, 19, 13, 0, 0, 0, 0, -13, -19, -26, -26, -32, -39, -39, -32, -26, -26, -19, -13, 0, 0,
+  0, 0, 26, 39, 53, 53, 66, 79, 79, 66, 53, 53, 39, 26, 0, 0, 0, 0, -26, -39, -53, -53, -66, -79, -79, -66, -53, -53, -39, -26, 0, 0,
+  0, 0, 53, 79, 107, 107, 133, 160, 160, 133, 107, 107, 79, 53, 0, 0, 0, 0, -53, -79, -107, -107, -133, -160, -160, -133, -107, -107, -79, -53, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+  0, 0, 6, 13, 13, 13, 19, 27, 27, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -27, -27, -19, -13, -13, -13, -6, 0, 0,
+  0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+  0, 0, 27, 40, 54, 54, 67, 81, 81, 67, 54, 54, 40, 27, 0, 0, 0, 0, -27, -40, -54, -54, -67, -81, -81, -67, -54, -54, -40, -27, 0, 0,
+  0, 0, 54, 81, 108, 108, 135, 162, 162, 135, 108, 108, 81, 54, 0, 0, 0, 0, -54, -81, -108, -108, -135, -162, -162, -135, -108, -108, -81, -54, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+  0, 0, 6, 13, 13, 13, 19, 27, 27, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -27, -27, -19, -13, -13, -13, -6, 0, 0,
+  0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+  0, 0, 27, 40, 54, 54, 67, 81, 81, 67, 54, 54, 40, 27, 0, 0, 0, 0, -27, -40, -54, -54, -67, -81, -81, -67, -54, -54, -40, -27, 0, 0,
+  0, 0, 54, 81, 109, 109, 136, 163, 163, 136, 109, 109, 81, 54, 0, 0, 0, 0, -54, -81, -109, -109, -136, -163, -163, -136, -109, -109, -81, -54, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+  0, 0, 6, 13, 13, 13, 19, 27, 27, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -27, -27, -19, -13, -13, -13, -6, 0, 0,
+  0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+  0, 0, 27, 40, 55, 55, 68, 82, 82, 68, 55, 55, 40, 27, 0, 0, 0, 0, -27, -40, -55, -55, -68, -82, -82, -68, -55, -55, -40, -27, 0, 0,
+  0, 0, 55, 82, 110, 110, 137, 165, 165, 137, 110, 110, 82, 55, 0, 0, 0, 0, -55, -82, -110, -110, -137, -165, -165, -137, -110, -110, -82, -55, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, 0, 0,
+  0, 0, 0, 6, 6, 6, 13, 13, 13, 13, 6, 6, 6, 0, 0, 0, 0, 0, 0, -6, -6, -6, -13, -13, -13, -13, -6, -6, -6, 0, 0, 0,
+  0, 0, 6, 6, 13, 13, 19, 19, 19, 19, 13, 13, 6, 6, 0, 0, 0, 0, -6, -6, -13, -13, -19, -19, -19, -19, -13, -13, -6, -6, 0, 0,
+  0, 0, 6, 13, 13, 13, 19, 27, 27, 19, 13, 13, 13, 6, 0, 0, 0, 0, -6, -13, -13, -13, -19, -27, -27, -19, -13, -13, -13, -6, 0, 0,
+  0, 0, 13, 19, 27, 27, 33, 40, 40, 33, 27, 27, 19, 13, 0, 0, 0, 0, -13, -19, -27, -27, -33, -40, -40, -33, -27, -27, -19, -13, 0, 0,
+  0, 0, 27, 40, 55, 55, 68, 82, 82, 68, 55, 55, 40, 27, 0, 0, 0, 0, -27, -40, -55, -55, -68, -82, -82, -68, -55, -55, -40, -27, 0, 0,
+  0, 0, 55, 82, 111, 111, 138, 166, 166, 138, 111, 111, 82, 55, 0, 0, 0, 0, -55, -82, -111, -111, -138, -166, -166, -138, -111, -111, -82, -55, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+  0, 0, 7, 14, 14, 14, 21, 28, 28, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -28, -28, -21, -14, -14, -14, -7, 0, 0,
+  0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+  0, 0, 28, 42, 56, 56, 70, 84, 84, 70, 56, 56, 42, 28, 0, 0, 0, 0, -28, -42, -56, -56, -70, -84, -84, -70, -56, -56, -42, -28, 0, 0,
+  0, 0, 56, 84, 112, 112, 140, 168, 168, 140, 112, 112, 84, 56, 0, 0, 0, 0, -56, -84, -112, -112, -140, -168, -168, -140, -112, -112, -84, -56, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+  0, 0, 7, 14, 14, 14, 21, 28, 28, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -28, -28, -21, -14, -14, -14, -7, 0, 0,
+  0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+  0, 0, 28, 42, 56, 56, 70, 84, 84, 70, 56, 56, 42, 28, 0, 0, 0, 0, -28, -42, -56, -56, -70, -84, -84, -70, -56, -56, -42, -28, 0, 0,
+  0, 0, 56, 84, 113, 113, 141, 169, 169, 141, 113, 113, 84, 56, 0, 0, 0, 0, -56, -84, -113, -113, -141, -169, -169, -141, -113, -113, -84, -56, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+  0, 0, 7, 14, 14, 14, 21, 28, 28, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -28, -28, -21, -14, -14, -14, -7, 0, 0,
+  0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+  0, 0, 28, 42, 57, 57, 71, 85, 85, 71, 57, 57, 42, 28, 0, 0, 0, 0, -28, -42, -57, -57, -71, -85, -85, -71, -57, -57, -42, -28, 0, 0,
+  0, 0, 57, 85, 114, 114, 142, 171, 171, 142, 114, 114, 85, 57, 0, 0, 0, 0, -57, -85, -114, -114, -142, -171, -171, -142, -114, -114, -85, -57, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+  0, 0, 7, 14, 14, 14, 21, 28, 28, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -28, -28, -21, -14, -14, -14, -7, 0, 0,
+  0, 0, 14, 21, 28, 28, 35, 42, 42, 35, 28, 28, 21, 14, 0, 0, 0, 0, -14, -21, -28, -28, -35, -42, -42, -35, -28, -28, -21, -14, 0, 0,
+  0, 0, 28, 42, 57, 57, 71, 85, 85, 71, 57, 57, 42, 28, 0, 0, 0, 0, -28, -42, -57, -57, -71, -85, -85, -71, -57, -57, -42, -28, 0, 0,
+  0, 0, 57, 85, 115, 115, 143, 172, 172, 143, 115, 115, 85, 57, 0, 0, 0, 0, -57, -85, -115, -115, -143, -172, -172, -143, -115, -115, -85, -57, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+  0, 0, 7, 14, 14, 14, 21, 29, 29, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -29, -29, -21, -14, -14, -14, -7, 0, 0,
+  0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+  0, 0, 29, 43, 58, 58, 72, 87, 87, 72, 58, 58, 43, 29, 0, 0, 0, 0, -29, -43, -58, -58, -72, -87, -87, -72, -58, -58, -43, -29, 0, 0,
+  0, 0, 58, 87, 116, 116, 145, 174, 174, 145, 116, 116, 87, 58, 0, 0, 0, 0, -58, -87, -116, -116, -145, -174, -174, -145, -116, -116, -87, -58, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+  0, 0, 7, 14, 14, 14, 21, 29, 29, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -29, -29, -21, -14, -14, -14, -7, 0, 0,
+  0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+  0, 0, 29, 43, 58, 58, 72, 87, 87, 72, 58, 58, 43, 29, 0, 0, 0, 0, -29, -43, -58, -58, -72, -87, -87, -72, -58, -58, -43, -29, 0, 0,
+  0, 0, 58, 87, 117, 117, 146, 175, 175, 146, 117, 117, 87, 58, 0, 0, 0, 0, -58, -87, -117, -117, -146, -175, -175, -146, -117, -117, -87, -58, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+  0, 0, 7, 14, 14, 14, 21, 29, 29, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -29, -29, -21, -14, -14, -14, -7, 0, 0,
+  0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+  0, 0, 29, 43, 59, 59, 73, 88, 88, 73, 59, 59, 43, 29, 0, 0, 0, 0, -29, -43, -59, -59, -73, -88, -88, -73, -59, -59, -43, -29, 0, 0,
+  0, 0, 59, 88, 118, 118, 147, 177, 177, 147, 118, 118, 88, 59, 0, 0, 0, 0, -59, -88, -118, -118, -147, -177, -177, -147, -118, -118, -88, -59, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 14, 14, 14, 14, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -14, -14, -14, -14, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 14, 14, 21, 21, 21, 21, 14, 14, 7, 7, 0, 0, 0, 0, -7, -7, -14, -14, -21, -21, -21, -21, -14, -14, -7, -7, 0, 0,
+  0, 0, 7, 14, 14, 14, 21, 29, 29, 21, 14, 14, 14, 7, 0, 0, 0, 0, -7, -14, -14, -14, -21, -29, -29, -21, -14, -14, -14, -7, 0, 0,
+  0, 0, 14, 21, 29, 29, 36, 43, 43, 36, 29, 29, 21, 14, 0, 0, 0, 0, -14, -21, -29, -29, -36, -43, -43, -36, -29, -29, -21, -14, 0, 0,
+  0, 0, 29, 43, 59, 59, 73, 88, 88, 73, 59, 59, 43, 29, 0, 0, 0, 0, -29, -43, -59, -59, -73, -88, -88, -73, -59, -59, -43, -29, 0, 0,
+  0, 0, 59, 88, 119, 119, 148, 178, 178, 148, 119, 119, 88, 59, 0, 0, 0, 0, -59, -88, -119, -119, -148, -178, -178, -148, -119, -119, -88, -59, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+  0, 0, 7, 15, 15, 15, 22, 30, 30, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -30, -30, -22, -15, -15, -15, -7, 0, 0,
+  0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+  0, 0, 30, 45, 60, 60, 75, 90, 90, 75, 60, 60, 45, 30, 0, 0, 0, 0, -30, -45, -60, -60, -75, -90, -90, -75, -60, -60, -45, -30, 0, 0,
+  0, 0, 60, 90, 120, 120, 150, 180, 180, 150, 120, 120, 90, 60, 0, 0, 0, 0, -60, -90, -120, -120, -150, -180, -180, -150, -120, -120, -90, -60, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+  0, 0, 7, 15, 15, 15, 22, 30, 30, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -30, -30, -22, -15, -15, -15, -7, 0, 0,
+  0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+  0, 0, 30, 45, 60, 60, 75, 90, 90, 75, 60, 60, 45, 30, 0, 0, 0, 0, -30, -45, -60, -60, -75, -90, -90, -75, -60, -60, -45, -30, 0, 0,
+  0, 0, 60, 90, 121, 121, 151, 181, 181, 151, 121, 121, 90, 60, 0, 0, 0, 0, -60, -90, -121, -121, -151, -181, -181, -151, -121, -121, -90, -60, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+  0, 0, 7, 15, 15, 15, 22, 30, 30, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -30, -30, -22, -15, -15, -15, -7, 0, 0,
+  0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+  0, 0, 30, 45, 61, 61, 76, 91, 91, 76, 61, 61, 45, 30, 0, 0, 0, 0, -30, -45, -61, -61, -76, -91, -91, -76, -61, -61, -45, -30, 0, 0,
+  0, 0, 61, 91, 122, 122, 152, 183, 183, 152, 122, 122, 91, 61, 0, 0, 0, 0, -61, -91, -122, -122, -152, -183, -183, -152, -122, -122, -91, -61, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+  0, 0, 7, 15, 15, 15, 22, 30, 30, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -30, -30, -22, -15, -15, -15, -7, 0, 0,
+  0, 0, 15, 22, 30, 30, 37, 45, 45, 37, 30, 30, 22, 15, 0, 0, 0, 0, -15, -22, -30, -30, -37, -45, -45, -37, -30, -30, -22, -15, 0, 0,
+  0, 0, 30, 45, 61, 61, 76, 91, 91, 76, 61, 61, 45, 30, 0, 0, 0, 0, -30, -45, -61, -61, -76, -91, -91, -76, -61, -61, -45, -30, 0, 0,
+  0, 0, 61, 91, 123, 123, 153, 184, 184, 153, 123, 123, 91, 61, 0, 0, 0, 0, -61, -91, -123, -123, -153, -184, -184, -153, -123, -123, -91, -61, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+  0, 0, 7, 15, 15, 15, 22, 31, 31, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -31, -31, -22, -15, -15, -15, -7, 0, 0,
+  0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+  0, 0, 31, 46, 62, 62, 77, 93, 93, 77, 62, 62, 46, 31, 0, 0, 0, 0, -31, -46, -62, -62, -77, -93, -93, -77, -62, -62, -46, -31, 0, 0,
+  0, 0, 62, 93, 124, 124, 155, 186, 186, 155, 124, 124, 93, 62, 0, 0, 0, 0, -62, -93, -124, -124, -155, -186, -186, -155, -124, -124, -93, -62, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+  0, 0, 7, 15, 15, 15, 22, 31, 31, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -31, -31, -22, -15, -15, -15, -7, 0, 0,
+  0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+  0, 0, 31, 46, 62, 62, 77, 93, 93, 77, 62, 62, 46, 31, 0, 0, 0, 0, -31, -46, -62, -62, -77, -93, -93, -77, -62, -62, -46, -31, 0, 0,
+  0, 0, 62, 93, 125, 125, 156, 187, 187, 156, 125, 125, 93, 62, 0, 0, 0, 0, -62, -93, -125, -125, -156, -187, -187, -156, -125, -125, -93, -62, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+  0, 0, 7, 15, 15, 15, 22, 31, 31, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -31, -31, -22, -15, -15, -15, -7, 0, 0,
+  0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+  0, 0, 31, 46, 63, 63, 78, 94, 94, 78, 63, 63, 46, 31, 0, 0, 0, 0, -31, -46, -63, -63, -78, -94, -94, -78, -63, -63, -46, -31, 0, 0,
+  0, 0, 63, 94, 126, 126, 157, 189, 189, 157, 126, 126, 94, 63, 0, 0, 0, 0, -63, -94, -126, -126, -157, -189, -189, -157, -126, -126, -94, -63, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, 0, 0, 0, 0,
+  0, 0, 0, 7, 7, 7, 15, 15, 15, 15, 7, 7, 7, 0, 0, 0, 0, 0, 0, -7, -7, -7, -15, -15, -15, -15, -7, -7, -7, 0, 0, 0,
+  0, 0, 7, 7, 15, 15, 22, 22, 22, 22, 15, 15, 7, 7, 0, 0, 0, 0, -7, -7, -15, -15, -22, -22, -22, -22, -15, -15, -7, -7, 0, 0,
+  0, 0, 7, 15, 15, 15, 22, 31, 31, 22, 15, 15, 15, 7, 0, 0, 0, 0, -7, -15, -15, -15, -22, -31, -31, -22, -15, -15, -15, -7, 0, 0,
+  0, 0, 15, 22, 31, 31, 38, 46, 46, 38, 31, 31, 22, 15, 0, 0, 0, 0, -15, -22, -31, -31, -38, -46, -46, -38, -31, -31, -22, -15, 0, 0,
+  0, 0, 31, 46, 63, 63, 78, 94, 94, 78, 63, 63, 46, 31, 0, 0, 0, 0, -31, -46, -63, -63, -78, -94, -94, -78, -63, -63, -46, -31, 0, 0,
+  0, 0, 63, 94, 127, 127, 158, 190, 190, 158, 127, 127, 94, 63, 0, 0, 0, 0, -63, -94, -127, -127, -158, -190, -190, -158, -127, -127, -94, -63, 0, 0,
+};
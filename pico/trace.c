@@ -0,0 +1,306 @@
+/*
+ * PicoDrive
+ * binary instruction trace writer, see trace.h for the format
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ *
+ * Records are packed into fixed size chunks by the emulation thread. Full
+ * chunks are queued to a writer thread doing the file output, so tracing
+ * mostly costs the packing. If the writer falls behind, the emulation
+ * waits for a free chunk, nothing is dropped.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "pico_int.h"
+#include "trace.h"
+
+#define TRACE_CHUNK_SIZE (256 * 1024)
+#define TRACE_CHUNKS     16
+
+struct trace_chunk {
+  int cpu;
+  int len;
+  u8 data[TRACE_CHUNK_SIZE];
+};
+
+static const char *trace_names[TRACE_CPU_CNT] = { "m68k", "s68k", "msh2", "ssh2" };
+
+static struct trace_stream {
+  FILE *f;
+  struct trace_chunk *chunk;
+  u32 pc, cycles;
+  u32 regs[TRACE_MAX_REGS];
+  int have_regs;
+} streams[TRACE_CPU_CNT];
+
+static struct trace_chunk *chunks;
+static struct trace_chunk *free_list[TRACE_CHUNKS];
+static struct trace_chunk *queue[TRACE_CHUNKS];
+static int free_cnt, queue_start, queue_len;
+static int state; // 0 not started, 1 running, -1 stopped or failed
+static int quit;
+
+static pthread_t writer_thread;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t cond_freed = PTHREAD_COND_INITIALIZER;
+
+static void *trace_writer(void *arg)
+{
+  struct trace_chunk *c;
+
+  pthread_mutex_lock(&lock);
+  while (1) {
+    while (queue_len == 0 && !quit)
+      pthread_cond_wait(&cond_queued, &lock);
+    if (queue_len == 0)
+      break;
+    c = queue[queue_start];
+    queue_start = (queue_start + 1) % TRACE_CHUNKS;
+    queue_len--;
+    pthread_mutex_unlock(&lock);
+
+    fwrite(c->data, 1, c->len, streams[c->cpu].f);
+
+    pthread_mutex_lock(&lock);
+    free_list[free_cnt++] = c;
+    pthread_cond_signal(&cond_freed);
+  }
+  pthread_mutex_unlock(&lock);
+  return NULL;
+}
+
+// queue the stream chunk for writing, and optionally get a new one
+static void trace_submit(struct trace_stream *s, int get_new)
+{
+  pthread_mutex_lock(&lock);
+  if (s->chunk != NULL && s->chunk->len > 0) {
+    queue[(queue_start + queue_len) % TRACE_CHUNKS] = s->chunk;
+    queue_len++;
+    pthread_cond_signal(&cond_queued);
+  }
+  else if (s->chunk != NULL)
+    free_list[free_cnt++] = s->chunk;
+  s->chunk = NULL;
+
+  if (get_new) {
+    while (free_cnt == 0)
+      pthread_cond_wait(&cond_freed, &lock);
+    s->chunk = free_list[--free_cnt];
+    s->chunk->cpu = s - streams;
+    s->chunk->len = 0;
+  }
+  pthread_mutex_unlock(&lock);
+}
+
+static int trace_start(void)
+{
+  int i;
+
+  state = -1;
+  chunks = malloc(TRACE_CHUNKS * sizeof(chunks[0]));
+  if (chunks == NULL) {
+    elprintf(EL_STATUS, "trace: OOM");
+    return -1;
+  }
+  for (i = 0; i < TRACE_CHUNKS; i++)
+    free_list[i] = &chunks[i];
+  free_cnt = TRACE_CHUNKS;
+  queue_start = queue_len = 0;
+  quit = 0;
+
+  if (pthread_create(&writer_thread, NULL, trace_writer, NULL) != 0) {
+    elprintf(EL_STATUS, "trace: can't create writer thread");
+    free(chunks);
+    chunks = NULL;
+    return -1;
+  }
+  atexit(cpu_trace_stop);
+  state = 1;
+  return 0;
+}
+
+static int trace_open(struct trace_stream *s, int cpu, int nregs)
+{
+  char name[32];
+  u8 hdr[8];
+
+  snprintf(name, sizeof(name), "trace_%s.bin", trace_names[cpu]);
+  s->f = fopen(name, "wb");
+  if (s->f == NULL) {
+    elprintf(EL_STATUS, "trace: can't open %s", name);
+    return -1;
+  }
+
+  memcpy(hdr, TRACE_MAGIC, 4);
+  hdr[4] = TRACE_VERSION;
+  hdr[5] = cpu;
+  hdr[6] = nregs;
+#ifdef CPU_TRACE_REGS
+  hdr[7] = TRH_REGS;
+#else
+  hdr[7] = 0;
+#endif
+  fwrite(hdr, 1, sizeof(hdr), s->f);
+
+  // deltas start from 0, the first record has all registers
+  s->pc = 0;
+  s->cycles = 0;
+  s->have_regs = 0;
+  elprintf(EL_STATUS, "trace: writing %s", name);
+  return 0;
+}
+
+static void trace_insn(int cpu, u32 pc, u32 op, u32 cycles,
+  const u32 *regs, int nregs)
+{
+  struct trace_stream *s = &streams[cpu];
+  u32 dpc, dcyc;
+  u8 *p, *flags;
+#ifdef CPU_TRACE_REGS
+  u8 *maskp;
+  u32 mask = 0;
+  int i;
+#endif
+
+  if (state == 0)
+    trace_start();
+  if (state < 0)
+    return;
+  if (s->f == NULL && trace_open(s, cpu, nregs) != 0)
+    return;
+  if (s->chunk == NULL || s->chunk->len > TRACE_CHUNK_SIZE - TRACE_REC_MAX)
+    trace_submit(s, 1);
+
+  p = s->chunk->data + s->chunk->len;
+  flags = p++;
+
+  dpc = pc - s->pc;
+  if ((s32)dpc == (s8)dpc) {
+    *flags = TRF_PC_S8;
+    *p++ = dpc;
+  } else if ((s32)dpc == (s16)dpc) {
+    *flags = TRF_PC_S16;
+    *p++ = dpc; *p++ = dpc >> 8;
+  } else {
+    *flags = TRF_PC_U32;
+    *p++ = pc; *p++ = pc >> 8; *p++ = pc >> 16; *p++ = pc >> 24;
+  }
+  s->pc = pc;
+
+  *p++ = op; *p++ = op >> 8;
+
+  dcyc = cycles - s->cycles;
+  if (dcyc < 0x100)
+    *p++ = dcyc;
+  else if (dcyc < 0x10000) {
+    *flags |= TRF_CYC_U16;
+    *p++ = dcyc; *p++ = dcyc >> 8;
+  } else {
+    *flags |= TRF_CYC_U32;
+    *p++ = dcyc; *p++ = dcyc >> 8; *p++ = dcyc >> 16; *p++ = dcyc >> 24;
+  }
+  s->cycles = cycles;
+
+#ifdef CPU_TRACE_REGS
+  maskp = p;
+  p += 4;
+  for (i = 0; i < nregs; i++) {
+    if (s->have_regs && regs[i] == s->regs[i])
+      continue;
+    s->regs[i] = regs[i];
+    mask |= 1 << i;
+    *p++ = regs[i]; *p++ = regs[i] >> 8; *p++ = regs[i] >> 16; *p++ = regs[i] >> 24;
+  }
+  s->have_regs = 1;
+  if (mask) {
+    *flags |= TRF_REGS;
+    maskp[0] = mask; maskp[1] = mask >> 8; maskp[2] = mask >> 16; maskp[3] = mask >> 24;
+  } else
+    p = maskp;
+#endif
+
+  s->chunk->len = p - s->chunk->data;
+}
+
+void cpu_trace_m68k(int is_sub, u32 pc, u32 op, u32 sr)
+{
+  u32 cycles;
+#ifdef CPU_TRACE_REGS
+  u32 regs[TRACE_M68K_REGS];
+  int i;
+
+  for (i = 0; i < 16; i++)
+    regs[i] = is_sub ? SekDarS68k(i) : SekDar(i);
+  regs[16] = sr & 0xffff;
+#else
+  u32 *regs = NULL;
+#endif
+  cycles = is_sub ? SekCyclesDoneS68k() : SekCyclesDone();
+
+  trace_insn(is_sub ? TRACE_S68K : TRACE_M68K, pc & 0xffffff, op, cycles,
+    regs, TRACE_M68K_REGS);
+}
+
+#ifdef EMU_F68K
+void cpu_trace_fm68k(M68K_CONTEXT *ctx, u32 pc, u32 op, u32 sr)
+{
+  cpu_trace_m68k(ctx == &PicoCpuFS68k, pc, op, sr);
+}
+#endif
+
+void cpu_trace_sh2(SH2 *sh2, u32 pc, u32 op)
+{
+  u32 cycles;
+#ifdef CPU_TRACE_REGS
+  u32 regs[TRACE_SH2_REGS];
+
+  memcpy(regs, sh2->r, sizeof(sh2->r));
+  regs[16] = sh2->pr;
+  regs[17] = sh2->sr & 0x3f3;
+  regs[18] = sh2->gbr;
+  regs[19] = sh2->vbr;
+  regs[20] = sh2->mach;
+  regs[21] = sh2->macl;
+#else
+  u32 *regs = NULL;
+#endif
+  // the interpreter keeps the cycles left in icount even in DRC builds
+  cycles = C_M68K_TO_SH2(sh2, sh2->m68krcycles_done)
+    + sh2->cycles_timeslice - sh2->icount;
+
+  trace_insn(sh2->is_slave ? TRACE_SSH2 : TRACE_MSH2, pc, op, cycles,
+    regs, TRACE_SH2_REGS);
+}
+
+void cpu_trace_stop(void)
+{
+  int i;
+
+  if (state <= 0)
+    return;
+  state = -1;
+
+  for (i = 0; i < TRACE_CPU_CNT; i++)
+    if (streams[i].chunk != NULL)
+      trace_submit(&streams[i], 0);
+
+  pthread_mutex_lock(&lock);
+  quit = 1;
+  pthread_cond_signal(&cond_queued);
+  pthread_mutex_unlock(&lock);
+  pthread_join(writer_thread, NULL);
+
+  for (i = 0; i < TRACE_CPU_CNT; i++) {
+    if (streams[i].f != NULL)
+      fclose(streams[i].f);
+    streams[i].f = NULL;
+  }
+  free(chunks);
+  chunks = NULL;
+}
+
+// vim:shiftwidth=2:ts=2:expandtab
@@ -0,0 +1,57 @@
+/*
+ * PicoDrive
+ * binary instruction trace format, written by trace.c in CPU_TRACE builds
+ * and decoded by tools/tracedec.c
+ *
+ * This work is licensed under the terms of MAME license.
+ * See COPYING file in the top-level directory.
+ *
+ * Each CPU gets its own file (trace_<cpu>.bin), starting with a header:
+ *   "PTRC", u8 version, u8 cpu, u8 register count, u8 flags
+ * followed by one record per executed instruction:
+ *   u8  record flags
+ *   pc: s8/s16 delta to the previous pc, or u32 (TRF_PC_*)
+ *   u16 opcode
+ *   cycles: u8/u16/u32 delta to the previous record (TRF_CYC_*)
+ *   if TRF_REGS: u32 mask of changed registers, a u32 for each set bit
+ * Everything is little endian. Register deltas are only present if the
+ * writer was built with CPU_TRACE_REGS, which is also noted in the header.
+ */
+#ifndef PICO_TRACE_H
+#define PICO_TRACE_H
+
+#define TRACE_MAGIC   "PTRC"
+#define TRACE_VERSION 1
+
+enum trace_cpu {
+  TRACE_M68K,
+  TRACE_S68K,
+  TRACE_MSH2,
+  TRACE_SSH2,
+  TRACE_CPU_CNT
+};
+
+// header flags
+#define TRH_REGS      0x01
+
+// record flags
+#define TRF_PC_S8     0x00
+#define TRF_PC_S16    0x01
+#define TRF_PC_U32    0x02
+#define TRF_PC_MASK   0x03
+#define TRF_CYC_U8    0x00
+#define TRF_CYC_U16   0x04
+#define TRF_CYC_U32   0x08
+#define TRF_CYC_MASK  0x0c
+#define TRF_REGS      0x10
+
+// registers in a delta mask, 68k: d0-d7, a0-a7, sr
+// sh2: r0-r15, pr, sr, gbr, vbr, mach, macl
+#define TRACE_M68K_REGS 17
+#define TRACE_SH2_REGS  22
+#define TRACE_MAX_REGS  TRACE_SH2_REGS
+
+// largest possible record
+#define TRACE_REC_MAX (1 + 4 + 2 + 4 + 4 + TRACE_MAX_REGS * 4)
+
+#endif
@@ -31,12 +31,51 @@ SRCS_COMMON += $(R)cpu/debug.c
  LDFLAGS += -lreadline
  endif
 endif
+# 68k core compare: a cpu_cmp_w=1 build writes a tracelog, a build with
+# another core and cpu_cmp=1 alone checks against it, cpu_cmp_step=<cycles>
+# compares every few instructions instead of once per run
 ifeq "$(cpu_cmp)" "1"
 ifdef cpu_cmp_w
 DEFINES += CPU_CMP_W
 else
 DEFINES += CPU_CMP_R
+SRCS_COMMON += $(R)cpu/musashi/m68kdasm.c
 endif # cpu_cmp_w
+ifdef cpu_cmp_step
+DEFINES += CPU_CMP_STEP=$(cpu_cmp_step)
+endif
+endif
+# memory access stats per map page, dumped at exit or every N frames
+ifeq "$(mem_stats)" "1"
+DEFINES += MEM_STATS
+ifdef mem_stats_period
+DEFINES += MEM_STATS_PERIOD=$(mem_stats_period)
+endif
+endif
+# guest PC sampling profiler, reports the hottest PCs of each CPU at exit.
+# pc_prof_rate=<lines> between samples, pc_prof_top=<count> PCs reported
+ifeq "$(pc_prof)" "1"
+DEFINES += PC_PROF
+ifdef pc_prof_rate
+DEFINES += PC_PROF_RATE=$(pc_prof_rate)
+endif
+ifdef pc_prof_top
+DEFINES += PC_PROF_TOP=$(pc_prof_top)
+endif
+endif
+# binary instruction traces, one file per CPU, see tools/tracedec.c.
+# cpu_trace_regs=1 also records register changes
+ifeq "$(cpu_trace)" "1"
+DEFINES += CPU_TRACE
+SRCS_COMMON += $(R)pico/trace.c
+LDFLAGS += -lpthread
+ifeq "$(cpu_trace_regs)" "1"
+DEFINES += CPU_TRACE_REGS
+endif
+endif
+# wall clock time of the startup phases up to the first frame, per media type
+ifeq "$(startup_prof)" "1"
+DEFINES += STARTUP_PROF
 endif
 ifeq "$(pprof)" "1"
 DEFINES += PPROF
@@ -89,7 +128,8 @@ SRCS_COMMON += $(R)pico/pico.c $(R)pico/cart.c $(R)pico/memory.c \
 	$(R)pico/state.c $(R)pico/sek.c $(R)pico/z80if.c \
 	$(R)pico/videoport.c $(R)pico/draw2.c $(R)pico/draw.c \
 	$(R)pico/mode4.c $(R)pico/misc.c $(R)pico/eeprom.c \
-	$(R)pico/patch.c $(R)pico/debug.c $(R)pico/media.c
+	$(R)pico/patch.c $(R)pico/debug.c $(R)pico/media.c \
+	$(R)pico/sched.c $(R)pico/movie.c
 # SMS
 ifneq "$(no_sms)" "1"
 SRCS_COMMON += $(R)pico/sms.c
@@ -122,7 +162,7 @@ SRCS_COMMON += $(R)pico/carthw/svp/stub_arm.S
 SRCS_COMMON += $(R)pico/carthw/svp/compiler.c
 endif
 # sound
-SRCS_COMMON += $(R)pico/sound/sound.c
+SRCS_COMMON += $(R)pico/sound/sound.c $(R)pico/sound/resampler.c
 SRCS_COMMON += $(R)pico/sound/sn76496.c $(R)pico/sound/ym2612.c
 SRCS_COMMON += $(R)pico/sound/emu2413/emu2413.c
 ifneq "$(ARCH)$(asm_mix)" "arm1"
@@ -363,6 +363,8 @@ int emu_reload_rom(const char *rom_fname_in)
 	int retval = 0;
 
 	lprintf("emu_ReloadRom(%s)\n", rom_fname_in);
+	startup_prof_begin();
+	startup_prof_phase("prepare");
 
 	rom_fname = strdup(rom_fname_in);
 	if (rom_fname == NULL)
@@ -372,6 +374,7 @@ int emu_reload_rom(const char *rom_fname_in)
 
 	// early cleanup
 	PicoPatchUnload();
+	PicoMovieStop();
 	if (movie_data) {
 		free(movie_data);
 		movie_data = 0;
@@ -458,6 +461,7 @@ int emu_reload_rom(const char *rom_fname_in)
 	menu_romload_end();
 	menu_romload_started = 0;
 
+	startup_prof_phase("post load");
 	if (PicoPatches) {
 		PicoPatchPrepare();
 		PicoPatchApply();
@@ -525,6 +529,8 @@ int emu_reload_rom(const char *rom_fname_in)
 out:
 	if (menu_romload_started)
 		menu_romload_end();
+	if (!retval)
+		startup_prof_end(NULL);
 	free(rom_fname);
 	return retval;
 }
@@ -1246,6 +1252,9 @@ void emu_init(void)
 	fclose(f);
 #endif
 
+	startup_prof_begin();
+	startup_prof_phase("dirs");
+
 	/* make dirs for saves */
 	pos = plat_get_root_dir(path, sizeof(path) - 4);
 	mkdir_path(path, pos, "mds");
@@ -1255,15 +1264,19 @@ void emu_init(void)
 
 	pprof_init();
 
+	startup_prof_phase("config");
 	make_config_cfg(path);
 	config_readlrom(path);
 
+	startup_prof_phase("core init");
 	PicoInit();
 	PicoIn.osdMessage = plat_status_msg_busy_next;
 	PicoIn.mcdTrayOpen = emu_tray_open;
 	PicoIn.mcdTrayClose = emu_tray_close;
 
+	startup_prof_phase("sound init");
 	sndout_init();
+	startup_prof_end("init");
 }
 
 void emu_finish(void)
@@ -1285,6 +1298,7 @@ void emu_finish(void)
 
 	pprof_finish();
 
+	PicoMovieStop();
 	PicoExit();
 	sndout_exit();
 }
@@ -1364,6 +1378,7 @@ void emu_loop(void)
 
 	fpsbuff[0] = 0;
 
+	startup_prof_phase("loop prepare");
 	PicoLoopPrepare();
 
 	plat_video_loop_prepare();
@@ -1378,6 +1393,7 @@ void emu_loop(void)
 
 	reset_timing = 1;
 	frames_done = frames_shown = 0;
+	startup_prof_phase("first frame");
 
 	/* loop with resync every 1 sec. */
 	while (engineState == PGS_Running)
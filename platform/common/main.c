@@ -20,9 +20,12 @@
 #include "emu.h"
 #include "version.h"
 #include <cpu/debug.h>
+#include <pico/pico.h>
 
 
 static int load_state_slot = -1;
+static const char *movie_record, *movie_play;
+static int movie_hash_flags = PMOV_HASH_ALL;
 char **g_argv;
 
 void parse_cmd_line(int argc, char *argv[])
@@ -41,6 +44,15 @@ void parse_cmd_line(int argc, char *argv[])
 			{
 				if (x+1 < argc) { ++x; load_state_slot = atoi(argv[x]); }
 			}
+			else if (strcasecmp(argv[x], "-record") == 0) {
+				if (x+1 < argc) { ++x; movie_record = argv[x]; }
+			}
+			else if (strcasecmp(argv[x], "-play") == 0) {
+				if (x+1 < argc) { ++x; movie_play = argv[x]; }
+			}
+			else if (strcasecmp(argv[x], "-nohash") == 0) {
+				movie_hash_flags = 0;
+			}
 			else if (strcasecmp(argv[x], "-pdb") == 0) {
 				if (x+1 < argc) { ++x; pdb_command(argv[x]); }
 			}
@@ -69,7 +81,10 @@ void parse_cmd_line(int argc, char *argv[])
 		printf("usage: %s [options] [romfile]\n", argv[0]);
 		printf("options:\n"
 			" -config <file>    use specified config file instead of default 'config.cfg'\n"
-			" -loadstate <num>  if ROM is specified, try loading savestate slot <num>\n");
+			" -loadstate <num>  if ROM is specified, try loading savestate slot <num>\n"
+			" -record <file>    record an input movie, starting after ROM load\n"
+			" -play <file>      play back an input movie, checking its frame hashes\n"
+			" -nohash           don't store frame hashes when recording\n");
 		exit(1);
 	}
 }
@@ -110,6 +125,10 @@ int main(int argc, char *argv[])
 				state_slot = load_state_slot;
 				emu_save_load_game(1, 0);
 			}
+			if (movie_play != NULL)
+				PicoMoviePlay(movie_play);
+			else if (movie_record != NULL)
+				PicoMovieRecord(movie_record, movie_hash_flags);
 		}
 	}
 
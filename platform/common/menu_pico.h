@@ -49,6 +49,7 @@ typedef enum
 	MA_OPT2_ENABLE_Z80,
 	MA_OPT2_ENABLE_YM2612,
 	MA_OPT2_DISABLE_YM_SSG,
+	MA_OPT2_ENABLE_FM_FILTER,
 	MA_OPT2_ENABLE_SN76496,
 	MA_OPT2_ENABLE_YM2413,
 	MA_OPT2_GZIP_STATES,
@@ -84,6 +85,7 @@ typedef enum
 	MA_CDOPT_CDDA,
 	MA_CDOPT_PCM,
 	MA_CDOPT_READAHEAD,
+	MA_CDOPT_FASTCD,
 	MA_CDOPT_SAVERAM,
 	MA_CDOPT_SCALEROT_CHIP,
 	MA_CDOPT_DONE,
@@ -77,6 +77,8 @@ bool show_overscan = false;
 
 static void *vout_buf;
 static int vout_width, vout_height, vout_offset;
+static void *vout_fb;    // frontend framebuffer the core renders into, if any
+static size_t vout_fb_pitch;
 static float user_vout_width = 0.0;
 
 static short ALIGNED(4) sndBuffer[2*44100/50];
@@ -450,8 +452,8 @@ int plat_mem_set_exec(void *ptr, size_t size)
    int ret = -1;
 #ifdef _WIN32
    DWORD oldProtect = 0;
-   ret = VirtualProtect(ptr, size, PAGE_EXECUTE_READWRITE, &oldProtect);
-   if (ret == 0 && log_cb)
+   ret = VirtualProtect(ptr, size, PAGE_EXECUTE_READWRITE, &oldProtect) ? 0 : -1;
+   if (ret != 0 && log_cb)
       log_cb(RETRO_LOG_ERROR, "VirtualProtect(%p, %d) failed: %d\n", ptr, (int)size,
              GetLastError());
 #elif defined(_3DS)
@@ -488,6 +490,8 @@ void emu_video_mode_change(int start_line, int line_count, int is_32cols)
 
    memset(vout_buf, 0, 320 * 240 * 2);
    vout_width = is_32cols ? 256 : 320;
+   // frontend buffer was requested with the old geometry, finish in vout_buf
+   vout_fb = NULL;
    PicoDrawSetOutBuf(vout_buf, vout_width * 2);
    if (show_overscan == true) line_count += 16;
    if (show_overscan == true) start_line -= 8;
@@ -526,10 +530,12 @@ void retro_set_environment(retro_environment_t cb)
       { "picodrive_input2",      "Input device 2; 3 button pad|6 button pad|None" },
       { "picodrive_sprlim",      "No sprite limit; disabled|enabled" },
       { "picodrive_ramcart",     "MegaCD RAM cart; disabled|enabled" },
+      { "picodrive_fastcd",      "MegaCD fast CD loading; disabled|enabled" },
       { "picodrive_region",      "Region; Auto|Japan NTSC|Japan PAL|US|Europe" },
       { "picodrive_aspect",      "Core-provided aspect ratio; PAR|4/3|CRT" },
       { "picodrive_overscan",    "Show Overscan; disabled|enabled" },
       { "picodrive_overclk68k",  "68k overclock; disabled|+25%|+50%|+75%|+100%|+200%|+400%" },
+      { "picodrive_fm_filter",   "FM filtering; disabled|enabled" },
 #ifdef DRC_SH2
       { "picodrive_drc", "Dynamic recompilers; enabled|disabled" },
 #endif
@@ -1215,6 +1221,7 @@ static void update_variables(void)
 {
    struct retro_variable var;
    int OldPicoRegionOverride;
+   int OldPicoOpt;
    float old_user_vout_width;
 
    var.value = NULL;
@@ -1245,6 +1252,15 @@ static void update_variables(void)
          PicoIn.opt &= ~POPT_EN_MCD_RAMCART;
    }
 
+   var.value = NULL;
+   var.key = "picodrive_fastcd";
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value) {
+      if (strcmp(var.value, "enabled") == 0)
+         PicoIn.opt |= POPT_EN_MCD_FASTCD;
+      else
+         PicoIn.opt &= ~POPT_EN_MCD_FASTCD;
+   }
+
    OldPicoRegionOverride = PicoIn.regionOverride;
    var.value = NULL;
    var.key = "picodrive_region";
@@ -1269,6 +1285,18 @@ static void update_variables(void)
       PsndRerate(1);
    }
 
+   OldPicoOpt = PicoIn.opt;
+   var.value = NULL;
+   var.key = "picodrive_fm_filter";
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value) {
+      if (strcmp(var.value, "enabled") == 0)
+         PicoIn.opt |= POPT_EN_FM_FILTER;
+      else
+         PicoIn.opt &= ~POPT_EN_FM_FILTER;
+   }
+   if (Pico.rom && ((PicoIn.opt ^ OldPicoOpt) & POPT_EN_FM_FILTER))
+      PsndRerate(1);
+
    old_user_vout_width = user_vout_width;
    var.value = NULL;
    var.key = "picodrive_aspect";
@@ -1322,9 +1350,39 @@ static void update_variables(void)
 #endif
 }
 
+/* try rendering directly into frontend memory to avoid a frame copy */
+static void vout_fb_acquire(void)
+{
+   struct retro_framebuffer fb = { 0 };
+   int start_line;
+
+   vout_fb = NULL;
+   if (PicoIn.skipFrame)
+      return;
+   // overscan borders aren't drawn by the core, and the 32X renderer writes
+   // beyond 256 pixels per line in 32 column mode
+   if (show_overscan || ((PicoIn.AHW & PAHW_32X) && vout_width != 320))
+      return;
+
+   fb.width = vout_width;
+   fb.height = vout_height;
+   fb.access_flags = RETRO_MEMORY_ACCESS_WRITE;
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER, &fb) ||
+       fb.data == NULL || fb.format != RETRO_PIXEL_FORMAT_RGB565 ||
+       fb.pitch < vout_width * 2)
+      return;
+
+   vout_fb = fb.data;
+   vout_fb_pitch = fb.pitch;
+   // the renderer addresses lines relative to the top of a 240 line screen
+   start_line = vout_offset / vout_width;
+   PicoDrawSetOutBuf((char *)vout_fb - start_line * vout_fb_pitch, vout_fb_pitch);
+}
+
 void retro_run(void)
 {
    bool updated = false;
+   int av_enable = 3;
    int pad, i;
 
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
@@ -1338,11 +1396,24 @@ void retro_run(void)
          if (input_state_cb(pad, RETRO_DEVICE_JOYPAD, 0, i))
             PicoIn.pad[pad] |= retro_pico_map[i];
 
+   // frontends disable video for fast-forward or run-ahead, don't draw then
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &av_enable))
+      av_enable = 3;
+   PicoIn.skipFrame = !(av_enable & 1);
+   vout_fb_acquire();
+
    PicoPatchApply();
    PicoFrame();
 
-   video_cb((short *)vout_buf + vout_offset,
-      vout_width, vout_height, vout_width * 2);
+   if (vout_fb != NULL) {
+      video_cb(vout_fb, vout_width, vout_height, vout_fb_pitch);
+      // frontend memory is only valid until retro_run returns
+      vout_fb = NULL;
+      PicoDrawSetOutBuf(vout_buf, vout_width * 2);
+   }
+   else
+      video_cb((short *)vout_buf + vout_offset,
+         vout_width, vout_height, vout_width * 2);
 }
 
 void retro_init(void)
@@ -170,6 +170,55 @@ int main(int argc, char *argv[])
 
   do_host_disasm(0);
 
+  // block linking: link and unlink a BL_LDJMP and a BL_JCCBLX exit, the
+  // unlink restores the dispatcher jump from jdisp (through the RW view)
+  {
+    struct block_entry be = { 0 };
+    struct block_link ld = { 0 }, jcc = { 0 };
+    u32 (*f)(u32), (*g)(u32);
+    u8 *disp, *start = tcache_ptr;
+
+    disp = tcache_ptr;                  // stand-in dispatcher, returns 1
+    emith_move_r_imm(RET_REG, 1);
+    emith_ret();
+    be.tcache_ptr = tcache_ptr;         // target block, returns 2
+    emith_move_r_imm(RET_REG, 2);
+    emith_ret();
+    emith_flush();
+
+    f = (void *)tcache_ptr;             // far jump to dispatcher
+    ld.type = BL_LDJMP;
+    ld.jump = tcache_ptr;
+    emith_jump_at(tcache_ptr, disp);
+    tcache_ptr += emith_jump_at_size();
+
+    g = (void *)tcache_ptr;             // jcc to blx, blx far jump
+    emith_cmp_r_imm(arg0, 0);
+    jcc.type = BL_JCCBLX;
+    jcc.jump = tcache_ptr;
+    emith_jump_cond_patchable(DCOND_NE, 0);
+    emith_move_r_imm(RET_REG, 3);
+    emith_ret();
+    emith_flush();
+    jcc.blx = tcache_ptr;
+    emith_jump_patch(jcc.jump, jcc.blx, NULL);
+    emith_jump_at(tcache_ptr, disp);
+    tcache_ptr += emith_jump_at_size();
+    host_instructions_updated(start, tcache_ptr);
+
+    memcpy(ld.jdisp, ld.jump, emith_jump_at_size());
+    memcpy(jcc.jdisp, jcc.blx, emith_jump_at_size());
+
+    printf("unlinked %u %u %u, ", f(1), g(1), g(0));
+    dr_block_link(&be, &ld, 1);
+    dr_block_link(&be, &jcc, 1);
+    printf("linked %u %u %u, ", f(1), g(1), g(0));
+    dr_block_unlink(&ld, 1);
+    dr_block_unlink(&jcc, 1);
+    printf("unlinked %u %u %u (want 1 1 3, 2 2 3, 1 1 3)\n",
+      f(1), g(1), g(0));
+  }
+
 #if  0
   testfunc = (void *)tcache_next[0];
   tcache_ptr = tcache_next[0];
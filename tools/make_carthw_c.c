@@ -1,11 +1,115 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
+/*
+ * besides the config text, an index of the sections by their first check
+ * is generated, so that PicoCartDetect only has to parse the sections
+ * which can match. A check_str or check_csum is hashed from the ROM bytes
+ * it compares, sections starting with anything else are always parsed.
+ */
+
+#define MAX_SECTS	1024
+#define MAX_PROBES	256
+
+/* must match rom_key() in pico/cart.c */
+static unsigned int make_key(unsigned int offs, const unsigned char *s, int len)
+{
+	unsigned int h = (2166136261u ^ offs) * 16777619u;
+	int i;
+
+	for (i = 0; i < len; i++)
+		h = (h ^ s[i]) * 16777619u;
+	return h;
+}
+
+static struct {
+	unsigned int key;
+	unsigned int offs;	/* in the config text */
+	int probe;		/* -1 if not indexed */
+	int next;
+} sects[MAX_SECTS];
+static int sect_cnt;
+
+static struct {
+	unsigned int offs, len;
+} probes[MAX_PROBES];
+static int probe_cnt;
+
+static int get_probe(unsigned int offs, unsigned int len)
+{
+	int i;
+
+	for (i = 0; i < probe_cnt; i++)
+		if (probes[i].offs == offs && probes[i].len == len)
+			return i;
+	if (probe_cnt == MAX_PROBES) {
+		printf("too many probes\n");
+		exit(1);
+	}
+	probes[probe_cnt].offs = offs;
+	probes[probe_cnt].len = len;
+	return probe_cnt++;
+}
+
+/* index the section by its first line, which has no whitespace left */
+static void index_sect(int n, const char *line)
+{
+	unsigned char bytes[256];
+	unsigned long offs, v;
+	const char *p, *e;
+	char *r;
+	int len;
+
+	if (strncmp(line, "check_str=", 10) == 0) {
+		offs = strtoul(line + 10, &r, 0);
+		if (r == line + 10 || r[0] != ',' || r[1] != '"')
+			return;
+		p = r + 2;
+		e = strchr(p, '"');
+		if (e == NULL || e == p)
+			return;
+		len = e - p;
+		memcpy(bytes, p, len);
+	}
+	else if (strncmp(line, "check_csum=", 11) == 0) {
+		/* the header checksum word at 0x18e */
+		v = strtoul(line + 11, &r, 0);
+		if (r == line + 11 || (v & 0xffff0000))
+			return;
+		offs = 0x18e;
+		len = 2;
+		bytes[0] = v >> 8;
+		bytes[1] = v;
+	}
+	else
+		return;
+
+	sects[n].probe = get_probe(offs, len);
+	sects[n].key = make_key(offs, bytes, len);
+}
+
+static void new_sect(unsigned int offs)
+{
+	if (sect_cnt == MAX_SECTS) {
+		printf("too many sections\n");
+		exit(1);
+	}
+	sects[sect_cnt].offs = offs;
+	sects[sect_cnt].probe = -1;
+	sects[sect_cnt].next = -1;
+	sect_cnt++;
+}
+
 int main(int argc, char *argv[])
 {
 	FILE *fi, *fo;
 	char buf[256];
+	unsigned int text_len = 0;
+	int first_line = 0;
+	int hash_size, *hash, unindexed = -1, *tail = &unindexed;
+	int i, j;
 
 	if (argc != 3) {
 		printf("usage:\n%s <carthw.cfg> <carthw.c>\n", argv[0]);
@@ -24,8 +128,8 @@ int main(int argc, char *argv[])
 
 	while ((fgets(buf, sizeof(buf), fi)))
 	{
-		char bufd[256];
-		char *d = bufd, *p = buf;
+		char bufd[256], bufs[256];
+		char *d = bufd, *s = bufs, *p = buf;
 		int quote = 0;
 
 		while (*p && isspace(*p))
@@ -35,8 +139,16 @@ int main(int argc, char *argv[])
 			continue;
 
 		/* section names not needed */
-		if (*p == '[')
+		if (*p == '[') {
 			strcpy(p, "[]");
+			new_sect(text_len);
+			first_line = 1;
+		}
+		else if (sect_cnt == 0) {
+			/* lines before the first section form one of their own */
+			new_sect(text_len);
+			first_line = 1;
+		}
 
 		for (; *p != 0; p++) {
 			if (!quote && isspace(*p))
@@ -46,15 +158,65 @@ int main(int argc, char *argv[])
 				*d++ = '\\';
 			}
 			*d++ = *p;
+			*s++ = *p;
 		}
-		*d = 0;
+		*d = *s = 0;
 
+		if (bufs[0] != '[' && first_line) {
+			index_sect(sect_cnt - 1, bufs);
+			first_line = 0;
+		}
+		text_len += strlen(bufs) + 1;
 
 		fprintf(fo, "  \"%s\\n\"\n", bufd);
 	}
 
 	fprintf(fo, ";\n");
 
+	/* chain the sections into hash buckets, keeping the file order */
+	for (hash_size = 16; hash_size < sect_cnt * 2; hash_size *= 2)
+		;
+	hash = malloc(hash_size * sizeof(hash[0]));
+	if (hash == NULL) {
+		printf("OOM\n");
+		return 1;
+	}
+	for (i = 0; i < hash_size; i++)
+		hash[i] = -1;
+	for (i = sect_cnt - 1; i >= 0; i--) {
+		if (sects[i].probe < 0)
+			continue;
+		j = sects[i].key & (hash_size - 1);
+		sects[i].next = hash[j];
+		hash[j] = i;
+	}
+	for (i = 0; i < sect_cnt; i++) {
+		if (sects[i].probe >= 0)
+			continue;
+		*tail = i;
+		tail = &sects[i].next;
+	}
+
+	fprintf(fo, "\n");
+	fprintf(fo, "static const struct carthw_probe builtin_carthw_probes[] = {\n");
+	for (i = 0; i < probe_cnt; i++)
+		fprintf(fo, "  { 0x%06x, %2u },\n", probes[i].offs, probes[i].len);
+	fprintf(fo, "};\n\n");
+
+	fprintf(fo, "static const struct carthw_sect builtin_carthw_sects[] = {\n");
+	for (i = 0; i < sect_cnt; i++)
+		fprintf(fo, "  { 0x%08x, %5u, %3d, %3d },\n", sects[i].key,
+			sects[i].offs, sects[i].probe, sects[i].next);
+	fprintf(fo, "};\n\n");
+
+	fprintf(fo, "static const short builtin_carthw_hash[%d] = {", hash_size);
+	for (i = 0; i < hash_size; i++)
+		fprintf(fo, "%s%3d,", (i & 15) ? " " : "\n  ", hash[i]);
+	fprintf(fo, "\n};\n\n");
+
+	fprintf(fo, "static const short builtin_carthw_unindexed = %d;\n", unindexed);
+
+	free(hash);
 	fclose(fi);
 	fclose(fo);
 
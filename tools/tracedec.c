@@ -0,0 +1,224 @@
+/*
+ * decoder for the binary instruction traces written by CPU_TRACE builds
+ * (pico/trace.c), prints them as text and/or as a hotspot histogram
+ *
+ * usage: tracedec [-n] [-h <count>] trace_<cpu>.bin
+ *   -n          don't print the instruction listing
+ *   -h <count>  print the <count> most executed and most expensive PCs
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../pico/trace.h"
+
+static const char *m68k_regs[TRACE_M68K_REGS] = {
+	"d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7",
+	"a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "sr",
+};
+static const char *sh2_regs[TRACE_SH2_REGS] = {
+	"r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7",
+	"r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+	"pr", "sr", "gbr", "vbr", "mach", "macl",
+};
+
+// PC histogram, open addressing hash
+struct hist_ent {
+	unsigned int pc;
+	unsigned int used;
+	unsigned long long count;
+	unsigned long long cycles;
+};
+static struct hist_ent *hist;
+static unsigned int hist_size, hist_cnt;
+
+static struct hist_ent *hist_get(unsigned int pc)
+{
+	unsigned int i;
+
+	if (hist_cnt * 2 >= hist_size) {
+		struct hist_ent *old = hist;
+		unsigned int old_size = hist_size;
+
+		hist_size = hist_size ? hist_size * 2 : 0x10000;
+		hist = calloc(hist_size, sizeof(hist[0]));
+		if (hist == NULL) {
+			fprintf(stderr, "OOM\n");
+			exit(1);
+		}
+		hist_cnt = 0;
+		for (i = 0; i < old_size; i++)
+			if (old[i].used)
+				*hist_get(old[i].pc) = old[i];
+		free(old);
+	}
+
+	i = (pc * 0x9e3779b1u) & (hist_size - 1);
+	while (hist[i].used && hist[i].pc != pc)
+		i = (i + 1) & (hist_size - 1);
+	if (!hist[i].used) {
+		hist[i].used = 1;
+		hist[i].pc = pc;
+		hist_cnt++;
+	}
+	return &hist[i];
+}
+
+static int cmp_count(const void *p1, const void *p2)
+{
+	const struct hist_ent *e1 = p1, *e2 = p2;
+	return e1->count < e2->count ? 1 : e1->count > e2->count ? -1 : 0;
+}
+
+static int cmp_cycles(const void *p1, const void *p2)
+{
+	const struct hist_ent *e1 = p1, *e2 = p2;
+	return e1->cycles < e2->cycles ? 1 : e1->cycles > e2->cycles ? -1 : 0;
+}
+
+static void hist_print(int top, unsigned long long insns,
+	unsigned long long cycles)
+{
+	unsigned int i, n = 0;
+
+	// compact the used entries to the start for sorting
+	for (i = 0; i < hist_size; i++)
+		if (hist[i].used)
+			hist[n++] = hist[i];
+	if (top > n)
+		top = n;
+
+	printf("\n%llu instructions, %llu cycles, %u different PCs\n",
+		insns, cycles, n);
+
+	qsort(hist, n, sizeof(hist[0]), cmp_count);
+	printf("\nmost executed:\n");
+	for (i = 0; i < top; i++)
+		printf("  %08x %12llu %6.2f%%\n", hist[i].pc, hist[i].count,
+			insns ? hist[i].count * 100.0 / insns : 0);
+
+	qsort(hist, n, sizeof(hist[0]), cmp_cycles);
+	printf("\nmost cycles:\n");
+	for (i = 0; i < top; i++)
+		printf("  %08x %12llu %6.2f%%\n", hist[i].pc, hist[i].cycles,
+			cycles ? hist[i].cycles * 100.0 / cycles : 0);
+}
+
+static unsigned int get_le(const unsigned char *p, int len)
+{
+	unsigned int v = 0;
+	while (len-- > 0)
+		v = (v << 8) | p[len];
+	return v;
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned long long insns = 0, total_cycles = 0;
+	unsigned char hdr[8], buf[TRACE_REC_MAX];
+	unsigned int regs[TRACE_MAX_REGS];
+	unsigned int pc = 0, cycles = 0, op, d, mask;
+	struct hist_ent *prev = NULL;
+	const char **regnames;
+	int listing = 1, top = 0;
+	int nregs, flags, len, i, bad = 1;
+	const char *fname = NULL;
+	FILE *f;
+
+	for (i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-n") == 0)
+			listing = 0;
+		else if (strcmp(argv[i], "-h") == 0 && i + 1 < argc)
+			top = atoi(argv[++i]);
+		else if (argv[i][0] != '-')
+			fname = argv[i];
+		else
+			fname = NULL, i = argc;
+	}
+	if (fname == NULL) {
+		fprintf(stderr, "usage: %s [-n] [-h <count>] <trace file>\n", argv[0]);
+		return 1;
+	}
+
+	f = fopen(fname, "rb");
+	if (f == NULL) {
+		perror(fname);
+		return 1;
+	}
+	if (fread(hdr, 1, sizeof(hdr), f) != sizeof(hdr)
+	    || memcmp(hdr, TRACE_MAGIC, 4) != 0 || hdr[4] != TRACE_VERSION
+	    || hdr[5] >= TRACE_CPU_CNT) {
+		fprintf(stderr, "%s: not a trace file or unsupported version\n", fname);
+		return 1;
+	}
+	nregs = hdr[6];
+	regnames = (hdr[5] == TRACE_MSH2 || hdr[5] == TRACE_SSH2) ?
+		sh2_regs : m68k_regs;
+	if (nregs > (regnames == sh2_regs ? TRACE_SH2_REGS : TRACE_M68K_REGS)) {
+		fprintf(stderr, "%s: bad register count %d\n", fname, nregs);
+		return 1;
+	}
+	memset(regs, 0, sizeof(regs));
+
+	while ((flags = fgetc(f)) != EOF) {
+		// pc and opcode
+		len = (flags & TRF_PC_MASK) == TRF_PC_U32 ? 4 :
+			(flags & TRF_PC_MASK) == TRF_PC_S16 ? 2 : 1;
+		if (fread(buf, 1, len + 2, f) != len + 2)
+			goto out;
+		d = get_le(buf, len);
+		if (len == 4)
+			pc = d;
+		else if (len == 2)
+			pc += (signed short)d;
+		else
+			pc += (signed char)d;
+		op = get_le(buf + len, 2);
+
+		// cycles, the delta belongs to the previous instruction
+		len = (flags & TRF_CYC_MASK) == TRF_CYC_U32 ? 4 :
+			(flags & TRF_CYC_MASK) == TRF_CYC_U16 ? 2 : 1;
+		if (fread(buf, 1, len, f) != len)
+			goto out;
+		d = get_le(buf, len);
+		cycles += d;
+		if (prev != NULL) {
+			prev->cycles += d;
+			total_cycles += d;
+		}
+
+		if (listing)
+			printf("%10u %08x %04x", cycles, pc, op);
+
+		if (flags & TRF_REGS) {
+			if (fread(buf, 1, 4, f) != 4)
+				goto out;
+			mask = get_le(buf, 4);
+			for (i = 0; i < nregs; i++) {
+				if (!(mask & (1u << i)))
+					continue;
+				if (fread(buf, 1, 4, f) != 4)
+					goto out;
+				regs[i] = get_le(buf, 4);
+				if (listing)
+					printf(" %s=%08x", regnames[i], regs[i]);
+			}
+		}
+		if (listing)
+			printf("\n");
+
+		insns++;
+		if (top > 0) {
+			prev = hist_get(pc);
+			prev->count++;
+		}
+	}
+	bad = 0;
+out:
+	if (bad)
+		fprintf(stderr, "%s: truncated record\n", fname);
+	fclose(f);
+
+	if (top > 0)
+		hist_print(top, insns, total_cycles);
+	return 0;
+}